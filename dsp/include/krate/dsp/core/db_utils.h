@@ -36,6 +36,15 @@ constexpr float kSilenceFloorDb = -144.0f;
 /// denormalized floating-point numbers which cause significant CPU slowdowns.
 inline constexpr float kDenormalThreshold = 1e-15f;
 
+/// Build option (CMake: KRATE_DSP_ASSUME_FTZ). When set, callers guarantee
+/// that DSP code only runs inside a ScopedFlushToZero (core/denormal_scope.h),
+/// so the hardware flushes denormals and detail::flushDenormal() becomes a
+/// no-op in the inner loops. NaN/Inf checks are unaffected.
+#ifndef KRATE_DSP_ASSUME_FTZ
+#define KRATE_DSP_ASSUME_FTZ 0
+#endif
+inline constexpr bool kAssumeFlushToZero = KRATE_DSP_ASSUME_FTZ != 0;
+
 namespace detail {
 
 /// Constexpr-safe NaN check using IEEE 754 bit pattern.
@@ -152,9 +161,14 @@ constexpr float constexprPow10(float x) noexcept {
 /// Flush denormal values to zero for real-time safety.
 /// Denormalized floats can cause 100x CPU slowdowns on some processors.
 /// @param x Value to check
-/// @return 0 if |x| < kDenormalThreshold, otherwise x
+/// @return 0 if |x| < kDenormalThreshold, otherwise x (always x when
+///         kAssumeFlushToZero, the hardware flushes instead)
 [[nodiscard]] inline constexpr float flushDenormal(float x) noexcept {
-    return (x > -kDenormalThreshold && x < kDenormalThreshold) ? 0.0f : x;
+    if constexpr (kAssumeFlushToZero) {
+        return x;
+    } else {
+        return (x > -kDenormalThreshold && x < kDenormalThreshold) ? 0.0f : x;
+    }
 }
 
 /// Platform-independent infinity check using bit manipulation.
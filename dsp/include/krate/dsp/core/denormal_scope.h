@@ -0,0 +1,118 @@
+// ==============================================================================
+// Layer 0: Core Utility - Denormal Scope
+// ==============================================================================
+// RAII floating-point environment for the audio callback: flush-to-zero and
+// denormals-are-zero are switched on for the lifetime of the scope and the
+// caller's environment is restored on exit.
+//
+// x86/x64: MXCSR FTZ (bit 15) and DAZ (bit 6)
+// AArch64: FPCR FZ (bit 24), which covers both inputs and results
+// Elsewhere the scope is a no-op and isSupported() returns false.
+//
+// With the KRATE_DSP_ASSUME_FTZ build option (see db_utils.h) the per-sample
+// detail::flushDenormal() calls in the inner loops compile away, so every
+// entry point that runs DSP code must hold one of these scopes.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (no allocation, noexcept)
+// - Principle IX: Layer 0 (no dependencies on higher layers)
+// ==============================================================================
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#endif
+
+namespace Krate {
+namespace DSP {
+
+namespace detail {
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+
+using FpControlWord = std::uint32_t;
+inline constexpr bool kHasFlushToZero = true;
+inline constexpr FpControlWord kFlushToZeroBits = 0x8040u;  // FTZ | DAZ
+
+inline FpControlWord readFpControl() noexcept { return _mm_getcsr(); }
+inline void writeFpControl(FpControlWord value) noexcept { _mm_setcsr(value); }
+
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+
+using FpControlWord = std::uint64_t;
+inline constexpr bool kHasFlushToZero = true;
+inline constexpr FpControlWord kFlushToZeroBits = FpControlWord{1} << 24;  // FZ
+
+inline FpControlWord readFpControl() noexcept {
+    FpControlWord value;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(value));
+    return value;
+}
+inline void writeFpControl(FpControlWord value) noexcept {
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(value));
+}
+
+#else
+
+using FpControlWord = std::uint32_t;
+inline constexpr bool kHasFlushToZero = false;
+inline constexpr FpControlWord kFlushToZeroBits = 0u;
+
+inline FpControlWord readFpControl() noexcept { return 0u; }
+inline void writeFpControl(FpControlWord) noexcept {}
+
+#endif
+
+} // namespace detail
+
+/// @brief Enables FTZ/DAZ for its lifetime and restores the previous mode.
+///
+/// Construct one at the top of the host callback (Processor::process()),
+/// not per module: writing the control register stalls the pipeline, and
+/// nested scopes that find the bits already set do not touch it.
+///
+/// @par Usage
+/// @code
+/// tresult Processor::process(ProcessData& data) {
+///     const Krate::DSP::ScopedFlushToZero denormalScope;
+///     ...
+/// }
+/// @endcode
+class ScopedFlushToZero {
+public:
+    ScopedFlushToZero() noexcept : saved_(detail::readFpControl()) {
+        const detail::FpControlWord wanted = saved_ | detail::kFlushToZeroBits;
+        if (wanted != saved_) {
+            detail::writeFpControl(wanted);
+        }
+    }
+
+    ~ScopedFlushToZero() noexcept {
+        if ((saved_ & detail::kFlushToZeroBits) != detail::kFlushToZeroBits) {
+            detail::writeFpControl(saved_);
+        }
+    }
+
+    ScopedFlushToZero(const ScopedFlushToZero&) = delete;
+    ScopedFlushToZero& operator=(const ScopedFlushToZero&) = delete;
+    ScopedFlushToZero(ScopedFlushToZero&&) = delete;
+    ScopedFlushToZero& operator=(ScopedFlushToZero&&) = delete;
+
+    /// True if this platform has a flush-to-zero mode the scope can set
+    [[nodiscard]] static constexpr bool isSupported() noexcept { return detail::kHasFlushToZero; }
+
+    /// True if the calling thread currently flushes denormals to zero
+    [[nodiscard]] static bool isActive() noexcept {
+        return isSupported() &&
+               (detail::readFpControl() & detail::kFlushToZeroBits) == detail::kFlushToZeroBits;
+    }
+
+private:
+    detail::FpControlWord saved_;
+};
+
+} // namespace DSP
+} // namespace Krate
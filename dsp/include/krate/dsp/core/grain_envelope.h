@@ -6,7 +6,9 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <krate/dsp/core/math_constants.h>
+#include <krate/dsp/core/table_registry.h>
 
 namespace Krate::DSP {
 
@@ -118,6 +120,19 @@ inline void generate(float* output, size_t size, GrainEnvelopeType type,
     return table[index0] + frac * (table[index1] - table[index0]);
 }
 
+/// Get a process-wide shared envelope table (see TableRegistry)
+/// Uses the default Trapezoid attack/release ratios.
+/// @param type Envelope shape
+/// @param size Number of samples in the envelope
+/// @return Read-only table, identical to generate(output, size, type)
+/// @note NOT real-time safe (may allocate and locks) - call from prepare()
+[[nodiscard]] inline std::span<const float> shared(GrainEnvelopeType type, size_t size) {
+    const TableKey key{TableFamily::GrainEnvelope, static_cast<uint8_t>(type), size};
+    return TableRegistry::instance().acquire(key, [type](float* output, size_t n) {
+        generate(output, n, type);
+    });
+}
+
 }  // namespace GrainEnvelope
 
 }  // namespace Krate::DSP
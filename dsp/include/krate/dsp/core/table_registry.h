@@ -0,0 +1,96 @@
+// ==============================================================================
+// Layer 0: Core Utility - Shared Table Registry
+// ==============================================================================
+// Process-wide cache of immutable lookup tables (windows, grain envelopes,
+// LFO wavetables). Each distinct (family, shape, size, parameter) table is
+// generated once, on first request, and every instance that asks for it
+// afterwards gets a span over the same memory.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (lookups allocate and lock - call from
+//   prepare(), never from process())
+// - Principle III: Modern C++ (C++20, std::span)
+// - Principle IX: Layer 0 (no DSP primitive dependencies)
+// ==============================================================================
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Krate::DSP {
+
+/// @brief Owner of a shared table's generator (keeps keys from colliding)
+enum class TableFamily : uint8_t {
+    Window,         ///< Window::shared()
+    GrainEnvelope,  ///< GrainEnvelope::shared()
+    LFOWaveform     ///< LFO wavetables
+};
+
+/// @brief Identifies one shared table
+struct TableKey {
+    TableFamily family = TableFamily::Window;
+    uint8_t shape = 0;        ///< Family-specific shape enum value
+    size_t size = 0;          ///< Number of samples
+    float parameter = 0.0f;   ///< Shape parameter (e.g. Kaiser beta), 0 if unused
+
+    auto operator<=>(const TableKey&) const = default;
+};
+
+/// @brief Process-wide registry of immutable, lazily generated tables
+///
+/// Tables live until the process (or plugin module) is unloaded, so the
+/// returned spans stay valid for the lifetime of any DSP object holding them.
+///
+/// @note acquire() takes a lock and may allocate: call it from prepare() or
+///       setup code, then keep the span for use in process().
+class TableRegistry {
+public:
+    /// @brief The registry shared by every instance in this module
+    [[nodiscard]] static TableRegistry& instance() noexcept {
+        static TableRegistry registry;
+        return registry;
+    }
+
+    /// @brief Get the table for @p key, generating it on first use
+    /// @param key Table identity
+    /// @param generate Callable `void(float* output, size_t size)` that fills
+    ///        the table; only invoked when the table does not exist yet
+    /// @return Read-only view of key.size samples
+    template <typename Generator>
+    [[nodiscard]] std::span<const float> acquire(const TableKey& key, Generator&& generate) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = tables_.find(key);
+        if (it == tables_.end()) {
+            std::vector<float> table(key.size, 0.0f);
+            generate(table.data(), key.size);
+            it = tables_.emplace(key, std::move(table)).first;
+        }
+        return std::span<const float>(it->second.data(), it->second.size());
+    }
+
+    /// @brief Number of distinct tables generated so far
+    [[nodiscard]] size_t tableCount() const {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return tables_.size();
+    }
+
+    TableRegistry(const TableRegistry&) = delete;
+    TableRegistry& operator=(const TableRegistry&) = delete;
+
+private:
+    TableRegistry() = default;
+
+    mutable std::mutex mutex_;
+    // std::map nodes never move, so spans into the vectors stay valid
+    std::map<TableKey, std::vector<float>> tables_;
+};
+
+}  // namespace Krate::DSP
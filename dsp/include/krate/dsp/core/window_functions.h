@@ -16,12 +16,14 @@
 #pragma once
 
 #include <krate/dsp/core/math_constants.h>
+#include <krate/dsp/core/table_registry.h>
 
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 namespace Krate {
@@ -279,6 +281,27 @@ inline void generateKaiser(float* output, size_t size, float beta) noexcept {
     return window;
 }
 
+/// @brief Get a process-wide shared copy of a window (see TableRegistry)
+/// @param type Window type
+/// @param size Window size
+/// @param kaiserBeta Kaiser beta parameter (only used if type == Kaiser)
+/// @return Read-only coefficients, identical to generate(type, size, kaiserBeta)
+/// @note NOT real-time safe (may allocate and locks) - call from prepare()
+[[nodiscard]] inline std::span<const float> shared(
+    WindowType type,
+    size_t size,
+    float kaiserBeta = kDefaultKaiserBeta
+) {
+    const TableKey key{
+        TableFamily::Window, static_cast<uint8_t>(type), size,
+        (type == WindowType::Kaiser) ? kaiserBeta : 0.0f};
+
+    return TableRegistry::instance().acquire(key, [&](float* output, size_t n) {
+        const std::vector<float> window = generate(type, n, kaiserBeta);
+        std::copy(window.begin(), window.end(), output);
+    });
+}
+
 } // namespace Window
 
 } // namespace DSP
@@ -9,6 +9,7 @@
 // - CharacterProcessor (Layer 3): DigitalVintage mode for 80s/Lo-Fi
 // - DynamicsProcessor (Layer 2): Program-dependent limiter
 // - LFO (Layer 1): Modulation with 6 waveform shapes
+// - BiquadBank (Layer 1): Stereo anti-aliasing filter for 80s/Lo-Fi
 //
 // Feature: 026-digital-delay
 // Layer: 4 (User Feature)
@@ -27,8 +28,9 @@
 #include <krate/dsp/core/block_context.h>
 #include <krate/dsp/core/db_utils.h>
 #include <krate/dsp/core/note_value.h>
-#include <krate/dsp/primitives/biquad.h>
+#include <krate/dsp/primitives/biquad_bank.h>
 #include <krate/dsp/primitives/lfo.h>
+#include <krate/dsp/primitives/output_stage.h>
 #include <krate/dsp/primitives/smoother.h>
 #include <krate/dsp/processors/dynamics_processor.h>
 #include <krate/dsp/processors/envelope_follower.h>
@@ -206,38 +208,40 @@ public:
         // Prepare smoothers
         timeSmoother_.configure(kSmoothingTimeMs, static_cast<float>(sampleRate));
         feedbackSmoother_.configure(kSmoothingTimeMs, static_cast<float>(sampleRate));
-        mixSmoother_.configure(kSmoothingTimeMs, static_cast<float>(sampleRate));
         modulationDepthSmoother_.configure(kSmoothingTimeMs, static_cast<float>(sampleRate));
         ageSmoother_.configure(kSmoothingTimeMs, static_cast<float>(sampleRate));
-        widthSmoother_.configure(kSmoothingTimeMs, static_cast<float>(sampleRate));
 
         // Initialize to defaults
         timeSmoother_.snapTo(kDefaultDelayMs);
         feedbackSmoother_.snapTo(kDefaultFeedback);
-        mixSmoother_.snapTo(kDefaultMix);
         modulationDepthSmoother_.snapTo(0.0f);
         ageSmoother_.snapTo(0.0f);
-        widthSmoother_.snapTo(100.0f);
 
         // Configure 80s era anti-aliasing filters (FR-009)
         // Lowpass at 14kHz to simulate ~32kHz ADC Nyquist
-        antiAliasFilterL_.configure(FilterType::Lowpass, k80sAntiAliasHz, 0.707f, 0.0f,
-                                    static_cast<float>(sampleRate));
-        antiAliasFilterR_.configure(FilterType::Lowpass, k80sAntiAliasHz, 0.707f, 0.0f,
-                                    static_cast<float>(sampleRate));
-
-        // Allocate dry buffers sized for maxBlockSize (REGRESSION FIX: was static 8192)
-        // This prevents discontinuities when processing blocks larger than 8192 samples
-        dryBufferL_.resize(maxBlockSize);
-        dryBufferR_.resize(maxBlockSize);
-        std::fill(dryBufferL_.begin(), dryBufferL_.end(), 0.0f);
-        std::fill(dryBufferR_.begin(), dryBufferR_.end(), 0.0f);
+        antiAliasFilter_.configure(FilterType::Lowpass, k80sAntiAliasHz, 0.707f, 0.0f,
+                                   static_cast<float>(sampleRate));
+
+        // Output stage holds the dry buffers, sized for maxBlockSize (REGRESSION FIX:
+        // was static 8192). This prevents discontinuities when processing blocks
+        // larger than 8192 samples
+        outputStage_.prepare(sampleRate, maxBlockSize, kSmoothingTimeMs);
+        outputStage_.setMix(kDefaultMix);
+        outputStage_.setWidth(1.0f);
+        outputStage_.snapParameters();
 
         // Allocate envelope buffer for noise modulation
         envelopeBuffer_.resize(maxBlockSize);
         std::fill(envelopeBuffer_.begin(), envelopeBuffer_.end(), 0.0f);
 
+        // Per-sample delay time, modulation and feedback handed to the feedback network
+        const size_t curveCapacity = std::max<size_t>(maxBlockSize, 1);
+        delayCurveMs_.assign(curveCapacity, 0.0f);
+        modulationCurveMs_.assign(curveCapacity, 0.0f);
+        feedbackCurve_.assign(curveCapacity, 0.0f);
+
         prepared_ = true;
+        started_ = false;
     }
 
     /// @brief Reset all internal state
@@ -248,25 +252,27 @@ public:
         limiter_.reset();
         noiseEnvelope_.reset();
         modulationLfo_.reset();
-        antiAliasFilterL_.reset();
-        antiAliasFilterR_.reset();
+        antiAliasFilter_.reset();
 
         timeSmoother_.snapTo(delayTimeMs_);
         feedbackSmoother_.snapTo(feedback_);
-        mixSmoother_.snapTo(mix_);
         modulationDepthSmoother_.snapTo(modulationDepth_);
         ageSmoother_.snapTo(age_);
-        widthSmoother_.snapTo(width_);
+        outputStage_.setMix(mix_);
+        outputStage_.setWidth(width_ / 100.0f);
+        outputStage_.reset();
+        started_ = false;
     }
 
     /// @brief Snap all parameters to current values (skip smoothing, for testing)
     void snapParameters() noexcept {
         timeSmoother_.snapTo(delayTimeMs_);
         feedbackSmoother_.snapTo(feedback_);
-        mixSmoother_.snapTo(mix_);
         modulationDepthSmoother_.snapTo(modulationDepth_);
         ageSmoother_.snapTo(age_);
-        widthSmoother_.snapTo(width_);
+        outputStage_.setMix(mix_);
+        outputStage_.setWidth(width_ / 100.0f);
+        outputStage_.snapParameters();
 
         // Snap FeedbackNetwork parameters to avoid transients in tests
         feedbackNetwork_.setDelayTimeMs(delayTimeMs_);
@@ -444,7 +450,7 @@ public:
     /// @param amount Mix [0, 1] (0 = dry, 1 = wet)
     void setMix(float amount) noexcept {
         mix_ = std::clamp(amount, 0.0f, 1.0f);
-        mixSmoother_.setTarget(mix_);
+        outputStage_.setMix(mix_);
     }
 
     /// @brief Get mix amount
@@ -460,7 +466,7 @@ public:
     /// @param percent Width percentage [0, 200] (0 = mono, 100 = original, 200 = maximum)
     void setWidth(float percent) noexcept {
         width_ = std::clamp(percent, 0.0f, 200.0f);
-        widthSmoother_.setTarget(width_);
+        outputStage_.setWidth(width_ / 100.0f);
     }
 
     /// @brief Get stereo width
@@ -484,11 +490,7 @@ public:
         if (!prepared_ || numSamples == 0) return;
 
         // Store dry signal for mixing (buffer sized in prepare() for maxBlockSize)
-        const size_t samplesToStore = std::min(numSamples, dryBufferL_.size());
-        for (size_t i = 0; i < samplesToStore; ++i) {
-            dryBufferL_[i] = left[i];
-            dryBufferR_[i] = right[i];
-        }
+        outputStage_.captureDry(left, right, numSamples);
 
         // Calculate base delay time (handle tempo sync using Layer 0 utility)
         float baseDelayMs = delayTimeMs_;
@@ -498,51 +500,64 @@ public:
             baseDelayMs = std::clamp(baseDelayMs, kMinDelayMs, maxDelayMs_);
         }
         timeSmoother_.setTarget(baseDelayMs);
+        if (!started_) {
+            // The network snaps to the delay time of its first block rather
+            // than crossfading in, so don't ramp there from the default
+            timeSmoother_.snapToTarget();
+            started_ = true;
+        }
 
-        // Sample-by-sample processing for parameter smoothing
-        for (size_t i = 0; i < numSamples; ++i) {
-            // Get smoothed parameters
-            const float currentDelayMs = timeSmoother_.process();
-            const float currentFeedback = feedbackSmoother_.process();
-            const float currentModDepth = modulationDepthSmoother_.process();
-
-            // Calculate modulated delay time (FR-020 to FR-030)
-            float modulatedDelay = currentDelayMs;
-            if (currentModDepth > 0.0f) {
-                float lfoValue = modulationLfo_.process();
-                // Modulation depth maps to +/- 10% of delay time at 100%
-                float modAmount = lfoValue * currentModDepth * 0.1f * currentDelayMs;
-                modulatedDelay = std::clamp(currentDelayMs + modAmount,
-                                            kMinDelayMs, maxDelayMs_);
-            } else {
-                (void)modulationLfo_.process(); // Keep LFO running
+        // Per-sample delay time, modulation and feedback curves. The network
+        // crossfades delay time changes and glides the read position with the
+        // modulation, so the LFO is heard per sample without the time knob
+        // bending the pitch
+        for (size_t offset = 0; offset < numSamples;) {
+            const size_t length = std::min(numSamples - offset, delayCurveMs_.size());
+
+            for (size_t i = 0; i < length; ++i) {
+                // Get smoothed parameters
+                const float currentDelayMs = timeSmoother_.process();
+                const float currentModDepth = modulationDepthSmoother_.process();
+                feedbackCurve_[i] = feedbackSmoother_.process();
+
+                // Calculate modulated delay time (FR-020 to FR-030)
+                float modulatedDelay = currentDelayMs;
+                if (currentModDepth > 0.0f) {
+                    float lfoValue = modulationLfo_.process();
+                    // Modulation depth maps to +/- 10% of delay time at 100%
+                    float modAmount = lfoValue * currentModDepth * 0.1f * currentDelayMs;
+                    modulatedDelay = std::clamp(currentDelayMs + modAmount,
+                                                kMinDelayMs, maxDelayMs_);
+                } else {
+                    (void)modulationLfo_.process(); // Keep LFO running
+                }
+                delayCurveMs_[i] = currentDelayMs;
+                modulationCurveMs_[i] = modulatedDelay - currentDelayMs;
             }
 
-            // Update feedback network with modulated delay
-            feedbackNetwork_.setDelayTimeMs(modulatedDelay);
-            feedbackNetwork_.setFeedbackAmount(currentFeedback);
+            // Process through feedback network (has delay + feedback built-in)
+            feedbackNetwork_.process(left + offset, right + offset, length, ctx,
+                                     delayCurveMs_.data(), modulationCurveMs_.data(),
+                                     feedbackCurve_.data());
+            offset += length;
         }
 
-        // Process through feedback network (has delay + feedback built-in)
-        feedbackNetwork_.process(left, right, numSamples, ctx);
-
         // Track envelope of DRY INPUT ONLY for dither modulation (MOVED BEFORE character processing)
         // CRITICAL: We must track ONLY the dry (input) signal, NOT the wet signal
         // When user plays notes, dry is loud → envelope high → dither loud
         // When user stops, dry is silent → envelope drops → dither drops (breathing effect)
         const size_t samplesToProcess = std::min(numSamples, envelopeBuffer_.size());
+        const float* dryL = outputStage_.dryLeft();
+        const float* dryR = outputStage_.dryRight();
         for (size_t i = 0; i < samplesToProcess; ++i) {
-            const float dryMono = (dryBufferL_[i] + dryBufferR_[i]) * 0.5f;
+            const float dryMono = (dryL[i] + dryR[i]) * 0.5f;
             envelopeBuffer_[i] = noiseEnvelope_.processSample(dryMono);
         }
 
         // Apply anti-aliasing filter for 80s/Lo-Fi era (FR-009)
         // Simulates the Nyquist filter of early ~32kHz ADCs
         if (antiAliasEnabled_) {
-            for (size_t i = 0; i < numSamples; ++i) {
-                left[i] = antiAliasFilterL_.process(left[i]);
-                right[i] = antiAliasFilterR_.process(right[i]);
-            }
+            antiAliasFilter_.processStereo(left, right, numSamples);
         }
 
         // Apply era-based character processing
@@ -556,32 +571,12 @@ public:
         // this only ran when feedback_ > 1.0f, but the instant feedback_ drops,
         // the limiter would stop while the delay line still contains high-amplitude
         // self-oscillating signal, causing distorted noise during the transition.
-        limiter_.process(left, numSamples);
-        limiter_.process(right, numSamples);
-
-        // Apply stereo width to wet signal (spec 036, FR-013, FR-016)
-        // Width processing uses Mid/Side: mid = (L+R)/2, side = (L-R)/2 * widthFactor
-        for (size_t i = 0; i < numSamples; ++i) {
-            const float currentWidth = widthSmoother_.process();
-            const float widthFactor = currentWidth / 100.0f;
-
-            const float mid = (left[i] + right[i]) * 0.5f;
-            const float side = (left[i] - right[i]) * 0.5f * widthFactor;
-
-            left[i] = mid + side;
-            right[i] = mid - side;
-        }
+        // Linked stereo: one detector, the same gain on both channels
+        limiter_.processStereo(left, right, numSamples);
 
-        // Mix dry/wet
-        for (size_t i = 0; i < samplesToStore; ++i) {
-            const float currentMix = mixSmoother_.process();
-
-            const float wetMix = currentMix;
-            const float dryMix = 1.0f - wetMix;
-
-            left[i] = dryBufferL_[i] * dryMix + left[i] * wetMix;
-            right[i] = dryBufferR_[i] * dryMix + right[i] * wetMix;
-        }
+        // Stereo width on the wet signal (spec 036, FR-013, FR-016) and dry/wet
+        // mix in one pass. Width uses Mid/Side: side = (L-R)/2 * widthFactor
+        outputStage_.process(left, right, numSamples);
     }
 
     /// @brief Process mono audio in-place (FR-036)
@@ -683,6 +678,7 @@ private:
     size_t maxBlockSize_ = 512;
     float maxDelayMs_ = kMaxDelayMs;
     bool prepared_ = false;
+    bool started_ = false;  ///< False until the first process() after prepare()/reset()
 
     // Layer 3 components
     FeedbackNetwork feedbackNetwork_;
@@ -715,21 +711,22 @@ private:
     // Smoothers
     OnePoleSmoother timeSmoother_;
     OnePoleSmoother feedbackSmoother_;
-    OnePoleSmoother mixSmoother_;
     OnePoleSmoother modulationDepthSmoother_;
     OnePoleSmoother ageSmoother_;
-    OnePoleSmoother widthSmoother_;
 
-    // Dry signal buffer for mixing (allocated in prepare, not in process)
-    std::vector<float> dryBufferL_;
-    std::vector<float> dryBufferR_;
+    // Dry capture, width and dry/wet mix (dry buffers allocated in prepare)
+    OutputStage outputStage_;
 
     // Envelope buffer for noise modulation (allocated in prepare)
     std::vector<float> envelopeBuffer_;
 
+    // Per-sample feedback network curves (allocated in prepare)
+    std::vector<float> delayCurveMs_;
+    std::vector<float> modulationCurveMs_;
+    std::vector<float> feedbackCurve_;
+
     // 80s era anti-aliasing filter (FR-009)
-    Biquad antiAliasFilterL_;
-    Biquad antiAliasFilterR_;
+    BiquadBank<2> antiAliasFilter_;  // L/R lanes
     bool antiAliasEnabled_ = false;
 };
 
@@ -6,7 +6,7 @@
 //
 // Composes:
 // - FlexibleFeedbackNetwork (Layer 3): Feedback loop with built-in freeze
-// - PitchShiftProcessor (Layer 2): 2 instances for stereo pitch shifting
+// - PitchShiftProcessor (Layer 2): stereo pitch shifting
 // - DiffusionNetwork (Layer 2): Smearing for pad-like texture
 // - OnePoleSmoother (Layer 1): Parameter smoothing
 //
@@ -27,6 +27,7 @@
 #include <krate/dsp/core/block_context.h>
 #include <krate/dsp/core/db_utils.h>
 #include <krate/dsp/core/note_value.h>
+#include <krate/dsp/primitives/output_stage.h>
 #include <krate/dsp/primitives/smoother.h>
 #include <krate/dsp/processors/diffusion_network.h>
 #include <krate/dsp/processors/pitch_shift_processor.h>
@@ -53,7 +54,7 @@ namespace DSP {
 /// 1. Pitch shifting (stereo) - optional shimmer effect
 /// 2. Diffusion network (pad-like smearing)
 /// 3. Shimmer mix blending (pitched vs unpitched ratio)
-/// 4. Decay gain reduction (per-sample fade)
+/// 4. Decay gain reduction (per-pass gain matching the decay time)
 class FreezeFeedbackProcessor : public IFeedbackProcessor {
 public:
     FreezeFeedbackProcessor() noexcept = default;
@@ -77,13 +78,16 @@ public:
     // Decay configuration (FR-013 to FR-016)
     void setDecayAmount(float decay) noexcept;  // 0-1 (0 = infinite sustain, 1 = fast fade)
 
+    /// Loop period of the host feedback network. The processor runs once per
+    /// pass, so the decay is applied as decayGain^loopSamples on every pass.
+    void setLoopDelayMs(float ms) noexcept;
+
 private:
     double sampleRate_ = 44100.0;
     std::size_t maxBlockSize_ = 512;
 
-    // Pitch shifters (stereo)
-    PitchShiftProcessor pitchShifterL_;
-    PitchShiftProcessor pitchShifterR_;
+    // Pitch shifter (stereo)
+    PitchShiftProcessor pitchShifter_;
 
     // Diffusion network
     DiffusionNetwork diffusion_;
@@ -93,7 +97,8 @@ private:
     float diffusionAmount_ = 0.0f;  // 0-1
     float decayAmount_ = 0.0f;      // 0-1 (0 = infinite sustain)
     float decayGain_ = 1.0f;        // Pre-calculated per-sample gain
-    float currentDecayLevel_ = 1.0f; // Running decay level (accumulated across blocks)
+    float loopDelayMs_ = 0.0f;      // Feedback loop period
+    float passGain_ = 1.0f;         // decayGain_ ^ (loop period in samples)
 
     // Scratch buffers
     std::vector<float> unpitchedL_;
@@ -103,6 +108,9 @@ private:
 
     // Calculate decay gain coefficient from decay amount and sample rate
     [[nodiscard]] float calculateDecayGain() const noexcept;
+
+    // Recompute passGain_ from decayGain_ and loopDelayMs_
+    void updatePassGain() noexcept;
 };
 
 // =============================================================================
@@ -420,7 +428,6 @@ private:
 
     // Layer 1 primitives - parameter smoothers
     OnePoleSmoother delaySmoother_;
-    OnePoleSmoother dryWetSmoother_;
 
     // Parameters - delay
     float delayTimeMs_ = kDefaultDelayMs;
@@ -451,9 +458,8 @@ private:
     // Parameters - output
     float dryWetMix_ = kDefaultDryWetMix;
 
-    // Scratch buffers for dry signal storage
-    std::vector<float> dryBufferL_;
-    std::vector<float> dryBufferR_;
+    // Dry signal storage and dry/wet mix
+    OutputStage outputStage_;
 };
 
 // =============================================================================
@@ -464,9 +470,8 @@ inline void FreezeFeedbackProcessor::prepare(double sampleRate, std::size_t maxB
     sampleRate_ = sampleRate;
     maxBlockSize_ = maxBlockSize;
 
-    // Prepare pitch shifters
-    pitchShifterL_.prepare(sampleRate, maxBlockSize);
-    pitchShifterR_.prepare(sampleRate, maxBlockSize);
+    // Prepare pitch shifter (both channels)
+    pitchShifter_.prepare(sampleRate, maxBlockSize);
 
     // Prepare diffusion network
     diffusion_.prepare(static_cast<float>(sampleRate), maxBlockSize);
@@ -479,6 +484,7 @@ inline void FreezeFeedbackProcessor::prepare(double sampleRate, std::size_t maxB
 
     // Calculate initial decay gain
     decayGain_ = calculateDecayGain();
+    updatePassGain();
 }
 
 inline void FreezeFeedbackProcessor::process(float* left, float* right, std::size_t numSamples) noexcept {
@@ -492,8 +498,7 @@ inline void FreezeFeedbackProcessor::process(float* left, float* right, std::siz
 
     // Apply pitch shifting if shimmer mix > 0
     if (shimmerMix_ > 0.001f) {
-        pitchShifterL_.process(left, left, numSamples);
-        pitchShifterR_.process(right, right, numSamples);
+        pitchShifter_.processStereo(left, right, left, right, numSamples);
     }
 
     // Apply diffusion to pitched signal if enabled
@@ -513,39 +518,33 @@ inline void FreezeFeedbackProcessor::process(float* left, float* right, std::siz
         right[i] = unpitchedR_[i] * (1.0f - shimmerMix_) + right[i] * shimmerMix_;
     }
 
-    // Apply decay gain (cumulative per-sample reduction for fade effect)
+    // Apply decay gain once per loop pass
     // SC-003: At decay 100%, reach -60dB within 500ms
-    // decayGain_ is per-sample, so we accumulate across samples
-    if (decayGain_ < 0.9999f) {
-        float runningGain = currentDecayLevel_;
+    // Every sample of the frozen loop passes through here once per loop period,
+    // so a constant passGain_ = decayGain_^period yields decayGain_ per sample
+    if (passGain_ < 1.0f) {
         for (std::size_t i = 0; i < numSamples; ++i) {
-            runningGain *= decayGain_;
-            left[i] *= runningGain;
-            right[i] *= runningGain;
+            left[i] *= passGain_;
+            right[i] *= passGain_;
         }
-        currentDecayLevel_ = runningGain;
     }
 }
 
 inline void FreezeFeedbackProcessor::reset() noexcept {
-    pitchShifterL_.reset();
-    pitchShifterR_.reset();
+    pitchShifter_.reset();
     diffusion_.reset();
-    currentDecayLevel_ = 1.0f;  // Reset cumulative decay
 }
 
 inline std::size_t FreezeFeedbackProcessor::getLatencySamples() const noexcept {
-    return pitchShifterL_.getLatencySamples();
+    return pitchShifter_.getLatencySamples();
 }
 
 inline void FreezeFeedbackProcessor::setPitchSemitones(float semitones) noexcept {
-    pitchShifterL_.setSemitones(semitones);
-    pitchShifterR_.setSemitones(semitones);
+    pitchShifter_.setSemitones(semitones);
 }
 
 inline void FreezeFeedbackProcessor::setPitchCents(float cents) noexcept {
-    pitchShifterL_.setCents(cents);
-    pitchShifterR_.setCents(cents);
+    pitchShifter_.setCents(cents);
 }
 
 inline void FreezeFeedbackProcessor::setShimmerMix(float mix) noexcept {
@@ -564,6 +563,22 @@ inline void FreezeFeedbackProcessor::setDiffusionSize(float size) noexcept {
 inline void FreezeFeedbackProcessor::setDecayAmount(float decay) noexcept {
     decayAmount_ = std::clamp(decay, 0.0f, 1.0f);
     decayGain_ = calculateDecayGain();
+    updatePassGain();
+}
+
+inline void FreezeFeedbackProcessor::setLoopDelayMs(float ms) noexcept {
+    if (ms == loopDelayMs_) return;
+    loopDelayMs_ = ms;
+    updatePassGain();
+}
+
+inline void FreezeFeedbackProcessor::updatePassGain() noexcept {
+    if (decayGain_ >= 0.9999f) {
+        passGain_ = 1.0f;  // Infinite sustain
+        return;
+    }
+    const float loopSamples = static_cast<float>(loopDelayMs_ * sampleRate_ / 1000.0);
+    passGain_ = std::pow(decayGain_, std::max(loopSamples, 1.0f));
 }
 
 inline float FreezeFeedbackProcessor::calculateDecayGain() const noexcept {
@@ -609,23 +624,23 @@ inline void FreezeMode::prepare(double sampleRate, std::size_t maxBlockSize, flo
 
     // Allocate scratch buffers
     const std::size_t bufferSize = std::max(maxBlockSize, kMaxDryBufferSize);
-    dryBufferL_.resize(bufferSize);
-    dryBufferR_.resize(bufferSize);
+    outputStage_.prepare(sampleRate, bufferSize, kSmoothingTimeMs);
 
     // Configure smoothers
     const float sr = static_cast<float>(sampleRate);
     delaySmoother_.configure(kSmoothingTimeMs, sr);
-    dryWetSmoother_.configure(kSmoothingTimeMs, sr);
 
     // Initialize smoothers
     delaySmoother_.snapTo(delayTimeMs_);
-    dryWetSmoother_.snapTo(dryWetMix_ / 100.0f);
+    outputStage_.setMix(dryWetMix_ / 100.0f);
+    outputStage_.snapParameters();
 
     // Initialize freeze processor parameters
     freezeProcessor_.setShimmerMix(shimmerMix_ / 100.0f);
     freezeProcessor_.setDiffusionAmount(diffusionAmount_ / 100.0f);
     freezeProcessor_.setDiffusionSize(diffusionSize_);
     freezeProcessor_.setDecayAmount(decayAmount_ / 100.0f);
+    freezeProcessor_.setLoopDelayMs(delayTimeMs_);
     freezeProcessor_.setPitchSemitones(pitchSemitones_);
     freezeProcessor_.setPitchCents(pitchCents_);
 
@@ -640,14 +655,16 @@ inline void FreezeMode::reset() noexcept {
     freezeProcessor_.reset();
 
     delaySmoother_.snapTo(delayTimeMs_);
-    dryWetSmoother_.snapTo(dryWetMix_ / 100.0f);
+    outputStage_.setMix(dryWetMix_ / 100.0f);
+    outputStage_.reset();
 
     feedbackNetwork_.snapParameters();
 }
 
 inline void FreezeMode::snapParameters() noexcept {
     delaySmoother_.snapTo(delayTimeMs_);
-    dryWetSmoother_.snapTo(dryWetMix_ / 100.0f);
+    outputStage_.setMix(dryWetMix_ / 100.0f);
+    outputStage_.snapParameters();
 
     feedbackNetwork_.setDelayTimeMs(delayTimeMs_);
     feedbackNetwork_.setFeedbackAmount(feedbackAmount_);
@@ -660,6 +677,7 @@ inline void FreezeMode::snapParameters() noexcept {
     freezeProcessor_.setDiffusionAmount(diffusionAmount_ / 100.0f);
     freezeProcessor_.setDiffusionSize(diffusionSize_);
     freezeProcessor_.setDecayAmount(decayAmount_ / 100.0f);
+    freezeProcessor_.setLoopDelayMs(delayTimeMs_);
     freezeProcessor_.setPitchSemitones(pitchSemitones_);
     freezeProcessor_.setPitchCents(pitchCents_);
 }
@@ -735,7 +753,7 @@ inline void FreezeMode::setFilterCutoff(float hz) noexcept {
 
 inline void FreezeMode::setDryWetMix(float percent) noexcept {
     dryWetMix_ = std::clamp(percent, kMinDryWetMix, kMaxDryWetMix);
-    dryWetSmoother_.setTarget(dryWetMix_ / 100.0f);
+    outputStage_.setMix(dryWetMix_ / 100.0f);
 }
 
 inline std::size_t FreezeMode::getLatencySamples() const noexcept {
@@ -759,6 +777,7 @@ inline void FreezeMode::process(float* left, float* right, std::size_t numSample
         feedbackNetwork_.setDelayTimeMs(baseDelayMs);
     }
     delaySmoother_.setTarget(baseDelayMs);
+    freezeProcessor_.setLoopDelayMs(baseDelayMs);
 
     // Process in chunks
     std::size_t samplesProcessed = 0;
@@ -768,21 +787,13 @@ inline void FreezeMode::process(float* left, float* right, std::size_t numSample
         float* chunkRight = right + samplesProcessed;
 
         // Store dry signal for mixing
-        for (std::size_t i = 0; i < chunkSize; ++i) {
-            dryBufferL_[i] = chunkLeft[i];
-            dryBufferR_[i] = chunkRight[i];
-        }
+        outputStage_.captureDry(chunkLeft, chunkRight, chunkSize);
 
         // Process through feedback network
         feedbackNetwork_.process(chunkLeft, chunkRight, chunkSize, ctx);
 
         // Mix dry/wet with smoothed parameters
-        for (std::size_t i = 0; i < chunkSize; ++i) {
-            const float currentDryWet = dryWetSmoother_.process();
-
-            chunkLeft[i] = dryBufferL_[i] * (1.0f - currentDryWet) + chunkLeft[i] * currentDryWet;
-            chunkRight[i] = dryBufferR_[i] * (1.0f - currentDryWet) + chunkRight[i] * currentDryWet;
-        }
+        outputStage_.process(chunkLeft, chunkRight, chunkSize);
 
         samplesProcessed += chunkSize;
     }
@@ -22,6 +22,7 @@
 #include <krate/dsp/systems/granular_engine.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 
 namespace Krate::DSP {
@@ -34,6 +35,10 @@ public:
     static constexpr float kDefaultSmoothTimeMs = 20.0f;
     static constexpr float kMaxDelaySeconds = 2.0f;
 
+    /// Feedback path latency in samples. The wet signal is fed back one
+    /// engine chunk later so the engine can render whole chunks at a time.
+    static constexpr size_t kFeedbackLatency = GranularEngine::kMaxBlockSize;
+
     /// Prepare effect for processing
     /// @param sampleRate Current sample rate
     void prepare(double sampleRate) noexcept {
@@ -54,8 +59,9 @@ public:
         engine_.reset();
 
         // Reset feedback state
-        feedbackL_ = 0.0f;
-        feedbackR_ = 0.0f;
+        feedbackL_.fill(0.0f);
+        feedbackR_.fill(0.0f);
+        feedbackIndex_ = 0;
 
         // Snap smoothers to current values
         feedbackSmoother_.snapTo(feedback_);
@@ -204,10 +210,25 @@ private:
     void processCore(const float* leftIn, const float* rightIn,
                      float* leftOut, float* rightOut,
                      size_t numSamples) noexcept {
+        size_t offset = 0;
+        while (offset < numSamples) {
+            const size_t chunk = std::min(kFeedbackLatency, numSamples - offset);
+            processChunk(leftIn + offset, rightIn + offset,
+                         leftOut + offset, rightOut + offset, chunk);
+            offset += chunk;
+        }
+    }
+
+    /// Process up to kFeedbackLatency samples. Every feedback sample read
+    /// here was written at least kFeedbackLatency samples ago, so the whole
+    /// chunk can go through the engine at once.
+    void processChunk(const float* leftIn, const float* rightIn,
+                      float* leftOut, float* rightOut,
+                      size_t numSamples) noexcept {
         for (size_t i = 0; i < numSamples; ++i) {
             // Get smoothed parameters
             const float feedback = feedbackSmoother_.process();
-            const float dryWet = dryWetSmoother_.process();
+            dryWetScratch_[i] = dryWetSmoother_.process();
 
             // Mix input with feedback
             float inputL = leftIn[i];
@@ -216,28 +237,36 @@ private:
             // Add feedback with ALWAYS-ON soft limiting to prevent runaway
             // This is critical for stability with overlapping grains
             if (feedback > 0.0f) {
+                const size_t tap = (feedbackIndex_ + i) % kFeedbackLatency;
+
                 // Always apply tanh to prevent accumulation, even at low feedback
                 // Scale by 2.0 before tanh to preserve more dynamic range at low levels
-                const float fbL = std::tanh(feedbackL_ * feedback * 0.5f) * 2.0f;
-                const float fbR = std::tanh(feedbackR_ * feedback * 0.5f) * 2.0f;
+                const float fbL = std::tanh(feedbackL_[tap] * feedback * 0.5f) * 2.0f;
+                const float fbR = std::tanh(feedbackR_[tap] * feedback * 0.5f) * 2.0f;
 
                 inputL += fbL;
                 inputR += fbR;
             }
 
-            // Process through granular engine
-            float wetL = 0.0f;
-            float wetR = 0.0f;
-            engine_.process(inputL, inputR, wetL, wetR);
+            wetL_[i] = inputL;
+            wetR_[i] = inputR;
+        }
+
+        // Process through granular engine (in place)
+        engine_.process(wetL_.data(), wetR_.data(), wetL_.data(), wetR_.data(), numSamples);
+
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float dryWet = dryWetScratch_[i];
 
             // Apply soft limiter to wet output before storing for feedback
             // This prevents extreme values from entering the feedback loop
-            const float limitedWetL = std::tanh(wetL * 0.5f) * 2.0f;
-            const float limitedWetR = std::tanh(wetR * 0.5f) * 2.0f;
+            const float limitedWetL = std::tanh(wetL_[i] * 0.5f) * 2.0f;
+            const float limitedWetR = std::tanh(wetR_[i] * 0.5f) * 2.0f;
 
             // Store limited values for feedback
-            feedbackL_ = limitedWetL;
-            feedbackR_ = limitedWetR;
+            const size_t tap = (feedbackIndex_ + i) % kFeedbackLatency;
+            feedbackL_[tap] = limitedWetL;
+            feedbackR_[tap] = limitedWetR;
 
             // Dry/wet mix (use limited wet for output as well)
             const float dryL = leftIn[i] * (1.0f - dryWet);
@@ -259,6 +288,8 @@ private:
             leftOut[i] = mixedL;
             rightOut[i] = mixedR;
         }
+
+        feedbackIndex_ = (feedbackIndex_ + numSamples) % kFeedbackLatency;
     }
 
 public:
@@ -277,9 +308,15 @@ public:
 private:
     GranularEngine engine_;
 
-    // Feedback state
-    float feedbackL_ = 0.0f;
-    float feedbackR_ = 0.0f;
+    // Feedback state: limited wet output from the last kFeedbackLatency samples
+    std::array<float, kFeedbackLatency> feedbackL_{};
+    std::array<float, kFeedbackLatency> feedbackR_{};
+    size_t feedbackIndex_ = 0;
+
+    // Chunk scratch
+    std::array<float, kFeedbackLatency> wetL_{};
+    std::array<float, kFeedbackLatency> wetR_{};
+    std::array<float, kFeedbackLatency> dryWetScratch_{};
 
     // Smoothers
     OnePoleSmoother feedbackSmoother_;
@@ -589,7 +589,7 @@ public:
 
         // Apply modulation if connected
         if (modMatrix_) {
-            applyModulation();
+            applyModulation(numSamples);
         }
 
         // Store dry signal
@@ -879,10 +879,12 @@ private:
     }
 
     /// @brief Apply modulation from connected matrix
-    void applyModulation() noexcept {
+    /// @param numSamples Block length (advances the matrix by the whole block)
+    void applyModulation(size_t numSamples) noexcept {
         if (!modMatrix_) return;
 
-        modMatrix_->process(1); // Process for 1 sample to update modulation values
+        // Tap parameters are block-rate: use the end-of-block offsets
+        modMatrix_->process(numSamples);
 
         // Apply modulation to per-tap parameters
         // Modulation destination IDs: time (0-15), level (16-31), pan (32-47), cutoff (48-63)
@@ -93,7 +93,9 @@ public:
 
     // Internal
     static constexpr float kSmoothingTimeMs = 20.0f;
-    static constexpr float kMinDelayForNetwork = 1.0f;  // Minimal delay in FFN
+    // Minimal delay in FFN; kept above FlexibleFeedbackNetwork::kSubBlockSize
+    // (32 samples) so the network never has to lengthen it
+    static constexpr float kMinDelayForNetwork = 2.0f;
 
     // =========================================================================
     // Construction / Destruction
@@ -6,7 +6,7 @@
 //
 // Composes:
 // - FlexibleFeedbackNetwork (Layer 3): Feedback loop with processor injection
-// - PitchShiftProcessor (Layer 2): 2 instances for stereo pitch shifting
+// - PitchShiftProcessor (Layer 2): stereo pitch shifting
 // - DiffusionNetwork (Layer 2): Smearing for reverb-like texture
 // - OnePoleSmoother (Layer 1): Parameter smoothing
 // - ModulationMatrix (Layer 3): Optional external modulation
@@ -28,6 +28,7 @@
 #include <krate/dsp/core/block_context.h>
 #include <krate/dsp/core/db_utils.h>
 #include <krate/dsp/core/note_value.h>
+#include <krate/dsp/primitives/output_stage.h>
 #include <krate/dsp/primitives/smoother.h>
 #include <krate/dsp/processors/diffusion_network.h>
 #include <krate/dsp/processors/pitch_shift_processor.h>
@@ -65,9 +66,8 @@ public:
         sampleRate_ = sampleRate;
         maxBlockSize_ = maxBlockSize;
 
-        // Prepare pitch shifters
-        pitchShifterL_.prepare(sampleRate, maxBlockSize);
-        pitchShifterR_.prepare(sampleRate, maxBlockSize);
+        // Prepare pitch shifter (both channels)
+        pitchShifter_.prepare(sampleRate, maxBlockSize);
 
         // Prepare diffusion network
         diffusion_.prepare(static_cast<float>(sampleRate), maxBlockSize);
@@ -89,8 +89,7 @@ public:
         }
 
         // Apply pitch shifting
-        pitchShifterL_.process(left, left, numSamples);
-        pitchShifterR_.process(right, right, numSamples);
+        pitchShifter_.processStereo(left, right, left, right, numSamples);
 
         // Apply diffusion to pitched signal if enabled
         if (diffusionAmount_ > 0.001f) {
@@ -113,29 +112,29 @@ public:
     }
 
     void reset() noexcept override {
-        pitchShifterL_.reset();
-        pitchShifterR_.reset();
+        pitchShifter_.reset();
         diffusion_.reset();
     }
 
     [[nodiscard]] std::size_t getLatencySamples() const noexcept override {
-        return pitchShifterL_.getLatencySamples();
+        return pitchShifter_.getLatencySamples();
     }
 
     // Configuration methods (called from ShimmerDelay)
     void setPitchSemitones(float semitones) noexcept {
-        pitchShifterL_.setSemitones(semitones);
-        pitchShifterR_.setSemitones(semitones);
+        pitchShifter_.setSemitones(semitones);
     }
 
     void setPitchCents(float cents) noexcept {
-        pitchShifterL_.setCents(cents);
-        pitchShifterR_.setCents(cents);
+        pitchShifter_.setCents(cents);
     }
 
     void setPitchMode(PitchMode mode) noexcept {
-        pitchShifterL_.setMode(mode);
-        pitchShifterR_.setMode(mode);
+        pitchShifter_.setMode(mode);
+    }
+
+    void setPitchQuality(PhaseVocoderQuality quality) noexcept {
+        pitchShifter_.setPhaseVocoderQuality(quality);
     }
 
     void setShimmerMix(float mix) noexcept {
@@ -155,9 +154,8 @@ private:
     double sampleRate_ = 44100.0;
     std::size_t maxBlockSize_ = 512;
 
-    // Pitch shifters (stereo)
-    PitchShiftProcessor pitchShifterL_;
-    PitchShiftProcessor pitchShifterR_;
+    // Pitch shifter (stereo)
+    PitchShiftProcessor pitchShifter_;
 
     // Diffusion network
     DiffusionNetwork diffusion_;
@@ -380,6 +378,14 @@ public:
     /// @brief Get current pitch mode
     [[nodiscard]] PitchMode getPitchMode() const noexcept { return pitchMode_; }
 
+    /// @brief Set the PhaseVocoder frame size (latency and CPU vs. quality)
+    /// @param quality Low (1024), Medium (2048) or High (4096)
+    /// @note Only affects PitchMode::PhaseVocoder; a change restarts the shifter
+    void setPitchQuality(PhaseVocoderQuality quality) noexcept;
+
+    /// @brief Get the PhaseVocoder frame size setting
+    [[nodiscard]] PhaseVocoderQuality getPitchQuality() const noexcept { return pitchQuality_; }
+
     /// @brief Get target pitch ratio (from semitones + cents)
     [[nodiscard]] float getPitchRatio() const noexcept;
 
@@ -521,7 +527,6 @@ private:
 
     // Layer 1 primitives - parameter smoothers
     OnePoleSmoother delaySmoother_;
-    OnePoleSmoother dryWetSmoother_;
     OnePoleSmoother pitchRatioSmoother_;  // FR-009: Smooth pitch changes
 
     // Layer 3 - optional modulation matrix
@@ -537,6 +542,7 @@ private:
     float pitchSemitones_ = kDefaultPitchSemitones;
     float pitchCents_ = kDefaultPitchCents;
     PitchMode pitchMode_ = PitchMode::Granular;  // Default per FR-008
+    PhaseVocoderQuality pitchQuality_ = PhaseVocoderQuality::High;
 
     // Parameters - shimmer
     float shimmerMix_ = kDefaultShimmerMix;
@@ -553,9 +559,8 @@ private:
     // Parameters - output
     float dryWetMix_ = kDefaultDryWetMix;
 
-    // Scratch buffers for dry signal storage
-    std::vector<float> dryBufferL_;
-    std::vector<float> dryBufferR_;
+    // Dry signal storage and dry/wet mix
+    OutputStage outputStage_;
 };
 
 // =============================================================================
@@ -569,6 +574,7 @@ inline void ShimmerDelay::prepare(double sampleRate, size_t maxBlockSize, float
 
     // Prepare the shimmer processor (will also be prepared by feedbackNetwork_)
     shimmerProcessor_.setPitchMode(pitchMode_);
+    shimmerProcessor_.setPitchQuality(pitchQuality_);
 
     // Prepare flexible feedback network (FR-018)
     feedbackNetwork_.prepare(sampleRate, maxBlockSize);
@@ -582,18 +588,17 @@ inline void ShimmerDelay::prepare(double sampleRate, size_t maxBlockSize, float
 
     // Allocate scratch buffers for dry signal storage
     const size_t bufferSize = std::max(maxBlockSize, kMaxDryBufferSize);
-    dryBufferL_.resize(bufferSize);
-    dryBufferR_.resize(bufferSize);
+    outputStage_.prepare(sampleRate, bufferSize, kSmoothingTimeMs);
 
     // Configure smoothers (Layer 1)
     const float sr = static_cast<float>(sampleRate);
     delaySmoother_.configure(kSmoothingTimeMs, sr);
-    dryWetSmoother_.configure(kSmoothingTimeMs, sr);
     pitchRatioSmoother_.configure(kSmoothingTimeMs, sr);  // FR-009
 
     // Initialize smoothers to defaults
     delaySmoother_.snapTo(delayTimeMs_);
-    dryWetSmoother_.snapTo(dryWetMix_ / 100.0f);
+    outputStage_.setMix(dryWetMix_ / 100.0f);
+    outputStage_.snapParameters();
     pitchRatioSmoother_.snapTo(calculatePitchRatio());  // FR-009
 
     // Initialize shimmer processor parameters
@@ -616,7 +621,8 @@ inline void ShimmerDelay::reset() noexcept {
 
     // Snap local smoothers to current targets
     delaySmoother_.snapTo(delayTimeMs_);
-    dryWetSmoother_.snapTo(dryWetMix_ / 100.0f);
+    outputStage_.setMix(dryWetMix_ / 100.0f);
+    outputStage_.reset();
     pitchRatioSmoother_.snapTo(calculatePitchRatio());  // FR-009
 
     // Snap feedback network parameters
@@ -626,7 +632,8 @@ inline void ShimmerDelay::reset() noexcept {
 inline void ShimmerDelay::snapParameters() noexcept {
     // Snap local smoothers
     delaySmoother_.snapTo(delayTimeMs_);
-    dryWetSmoother_.snapTo(dryWetMix_ / 100.0f);
+    outputStage_.setMix(dryWetMix_ / 100.0f);
+    outputStage_.snapParameters();
     pitchRatioSmoother_.snapTo(calculatePitchRatio());  // FR-009
 
     // Apply snapped pitch to shimmer processor immediately
@@ -674,6 +681,11 @@ inline void ShimmerDelay::setPitchMode(PitchMode mode) noexcept {
     shimmerProcessor_.setPitchMode(mode);
 }
 
+inline void ShimmerDelay::setPitchQuality(PhaseVocoderQuality quality) noexcept {
+    pitchQuality_ = quality;
+    shimmerProcessor_.setPitchQuality(quality);
+}
+
 inline float ShimmerDelay::getPitchRatio() const noexcept {
     // Return the TARGET ratio (what user set), not the smoothed value
     return calculatePitchRatio();
@@ -711,7 +723,7 @@ inline void ShimmerDelay::setFilterCutoff(float hz) noexcept {
 
 inline void ShimmerDelay::setDryWetMix(float percent) noexcept {
     dryWetMix_ = std::clamp(percent, kMinDryWetMix, kMaxDryWetMix);
-    dryWetSmoother_.setTarget(dryWetMix_ / 100.0f);
+    outputStage_.setMix(dryWetMix_ / 100.0f);
 }
 
 inline float ShimmerDelay::getCurrentDelayMs() const noexcept {
@@ -759,10 +771,7 @@ inline void ShimmerDelay::process(float* left, float* right, size_t numSamples,
         float* chunkRight = right + samplesProcessed;
 
         // Store dry signal for mixing
-        for (size_t i = 0; i < chunkSize; ++i) {
-            dryBufferL_[i] = chunkLeft[i];
-            dryBufferR_[i] = chunkRight[i];
-        }
+        outputStage_.captureDry(chunkLeft, chunkRight, chunkSize);
 
         // FR-009: Apply smoothed pitch ratio
         float smoothedRatio = pitchRatioSmoother_.getCurrentValue();
@@ -777,12 +786,7 @@ inline void ShimmerDelay::process(float* left, float* right, size_t numSamples,
         feedbackNetwork_.process(chunkLeft, chunkRight, chunkSize, ctx);
 
         // Mix dry/wet for output with smoothed parameters
-        for (size_t i = 0; i < chunkSize; ++i) {
-            const float currentDryWet = dryWetSmoother_.process();
-
-            chunkLeft[i] = dryBufferL_[i] * (1.0f - currentDryWet) + chunkLeft[i] * currentDryWet;
-            chunkRight[i] = dryBufferR_[i] * (1.0f - currentDryWet) + chunkRight[i] * currentDryWet;
-        }
+        outputStage_.process(chunkLeft, chunkRight, chunkSize);
 
         samplesProcessed += chunkSize;
     }
@@ -8,7 +8,7 @@
 // Composes:
 // - STFT, OverlapAdd (Layer 1): Spectral analysis/resynthesis
 // - SpectralBuffer (Layer 1): Spectrum storage
-// - DelayLine (Layer 1): Per-bin delay lines
+// - SpectralHistory (Layer 1): Contiguous per-bin spectral delay store
 // - OnePoleSmoother (Layer 1): Parameter smoothing
 //
 // Feature: 033-spectral-delay
@@ -30,9 +30,9 @@
 #include <krate/dsp/core/math_constants.h>
 #include <krate/dsp/core/note_value.h>
 #include <krate/dsp/core/random.h>
-#include <krate/dsp/primitives/delay_line.h>
 #include <krate/dsp/primitives/smoother.h>
 #include <krate/dsp/primitives/spectral_buffer.h>
+#include <krate/dsp/primitives/spectral_history.h>
 #include <krate/dsp/primitives/stft.h>
 #include <krate/dsp/systems/delay_engine.h>
 
@@ -63,6 +63,12 @@ enum class SpreadCurve : std::uint8_t {
     Logarithmic  ///< Logarithmic distribution (perceptually more even)
 };
 
+/// @brief Per-bin kernel used by processSpectralFrame()
+enum class SpectralProcessingMode : std::uint8_t {
+    Polar,      ///< Reference path: magnitude/phase round-trip per bin
+    Cartesian   ///< Gain ratios and complex rotations, no per-bin atan2 (default)
+};
+
 // =============================================================================
 // SpectralDelay - Layer 4 User Feature
 // =============================================================================
@@ -153,33 +159,21 @@ public:
         // Calculate max delay in seconds for delay lines
         const float maxDelaySeconds = kMaxDelayMs / 1000.0f;
 
-        // Prepare per-bin delay lines (stereo)
-        // Delay lines work at spectral frame rate (sampleRate / hopSize)
+        // Prepare per-bin spectral history (stereo)
+        // History runs at spectral frame rate (sampleRate / hopSize)
         const double frameRate = sampleRate / static_cast<double>(hopSize_);
-
-        // Prepare complex delay lines (real + imaginary parts)
-        binRealDelaysL_.clear();
-        binRealDelaysR_.clear();
-        binImagDelaysL_.clear();
-        binImagDelaysR_.clear();
-        binRealDelaysL_.reserve(numBins);
-        binRealDelaysR_.reserve(numBins);
-        binImagDelaysL_.reserve(numBins);
-        binImagDelaysR_.reserve(numBins);
-
-        for (std::size_t i = 0; i < numBins; ++i) {
-            // Real part delay lines
-            binRealDelaysL_.emplace_back();
-            binRealDelaysR_.emplace_back();
-            binRealDelaysL_.back().prepare(frameRate, maxDelaySeconds);
-            binRealDelaysR_.back().prepare(frameRate, maxDelaySeconds);
-
-            // Imaginary part delay lines
-            binImagDelaysL_.emplace_back();
-            binImagDelaysR_.emplace_back();
-            binImagDelaysL_.back().prepare(frameRate, maxDelaySeconds);
-            binImagDelaysR_.back().prepare(frameRate, maxDelaySeconds);
-        }
+        const auto maxDelayFrames = static_cast<std::size_t>(
+            frameRate * static_cast<double>(maxDelaySeconds));
+        historyL_.prepare(numBins, maxDelayFrames);
+        historyR_.prepare(numBins, maxDelayFrames);
+
+        // Per-frame scratch for the delay gather
+        binDelayFrames_.assign(numBins, 0.0f);
+        binFeedback_.assign(numBins, 0.0f);
+        delayedRealL_.assign(numBins, 0.0f);
+        delayedImagL_.assign(numBins, 0.0f);
+        delayedRealR_.assign(numBins, 0.0f);
+        delayedImagR_.assign(numBins, 0.0f);
 
         // Configure parameter smoothers (50ms smoothing time for spectral processing)
         // Increased from 10ms to reduce artifacts during parameter changes
@@ -260,21 +254,9 @@ public:
         frozenSpectrumL_.reset();
         frozenSpectrumR_.reset();
 
-        // Reset all per-bin complex delay lines (real parts)
-        for (auto& delay : binRealDelaysL_) {
-            delay.reset();
-        }
-        for (auto& delay : binRealDelaysR_) {
-            delay.reset();
-        }
-
-        // Reset all per-bin complex delay lines (imaginary parts)
-        for (auto& delay : binImagDelaysL_) {
-            delay.reset();
-        }
-        for (auto& delay : binImagDelaysR_) {
-            delay.reset();
-        }
+        // Reset per-bin spectral history
+        historyL_.reset();
+        historyR_.reset();
 
         // Reset freeze state
         wasFrozen_ = false;
@@ -542,6 +524,18 @@ public:
     }
     [[nodiscard]] int getNoteValue() const noexcept { return noteValueIndex_; }
 
+    // =========================================================================
+    // Processing Mode
+    // =========================================================================
+
+    /// @brief Select the per-bin kernel (Cartesian is the fast default)
+    void setProcessingMode(SpectralProcessingMode mode) noexcept {
+        processingMode_ = mode;
+    }
+    [[nodiscard]] SpectralProcessingMode getProcessingMode() const noexcept {
+        return processingMode_;
+    }
+
     // =========================================================================
     // Query
     // =========================================================================
@@ -699,12 +693,8 @@ private:
         const bool freezing = freezeEnabled_;
         if (freezing && !wasFrozen_) {
             // Just entered freeze: capture current spectrum
-            for (std::size_t i = 0; i < numBins; ++i) {
-                frozenSpectrumL_.setMagnitude(i, inputL.getMagnitude(i));
-                frozenSpectrumL_.setPhase(i, inputL.getPhase(i));
-                frozenSpectrumR_.setMagnitude(i, inputR.getMagnitude(i));
-                frozenSpectrumR_.setPhase(i, inputR.getPhase(i));
-            }
+            std::copy(inputL.data(), inputL.data() + numBins, frozenSpectrumL_.data());
+            std::copy(inputR.data(), inputR.data() + numBins, frozenSpectrumR_.data());
             freezeCrossfade_ = 0.0f;
             freezePhaseDrift_ = 0.0f;  // Reset phase drift when entering freeze
         }
@@ -727,14 +717,46 @@ private:
             }
         }
 
-        // Process each bin
+        // Calculate per-bin delay times in frames, then gather all delayed
+        // complex values from the history in one pass per channel
+        const float frameRate = static_cast<float>(sampleRate_) /
+                                static_cast<float>(hopSize_);
         for (std::size_t bin = 0; bin < numBins; ++bin) {
-            // Calculate per-bin delay time in frames
             const float binDelayMs = calculateBinDelayMs(bin, numBins, baseDelay, spread);
-            const float frameRate = static_cast<float>(sampleRate_) /
-                                    static_cast<float>(hopSize_);
-            const float delayFrames = (binDelayMs / 1000.0f) * frameRate;
+            binDelayFrames_[bin] = (binDelayMs / 1000.0f) * frameRate;
+        }
+        historyL_.readLinear(binDelayFrames_.data(), delayedRealL_.data(), delayedImagL_.data());
+        historyR_.readLinear(binDelayFrames_.data(), delayedRealR_.data(), delayedImagR_.data());
+
+        if (processingMode_ == SpectralProcessingMode::Cartesian) {
+            processBinsCartesian(inputL, inputR, outputL, outputR, numBins,
+                                 feedback, tilt, diffusion, stereoWidth, freezing);
+        } else {
+            processBinsPolar(inputL, inputR, outputL, outputR, numBins,
+                             feedback, tilt, diffusion, stereoWidth, freezing);
+        }
+
+        // Commit this frame to history (frozen frames leave history untouched)
+        if (!freezing) {
+            historyL_.advance();
+            historyR_.advance();
+        }
+    }
 
+    /// @brief Reference per-bin kernel in polar form
+    /// @note Converts every bin to magnitude/phase and back (sqrt/atan2/cos/sin)
+    void processBinsPolar(const SpectralBuffer& inputL, const SpectralBuffer& inputR,
+                          SpectralBuffer& outputL, SpectralBuffer& outputR,
+                          std::size_t numBins, float feedback, float tilt,
+                          float diffusion, float stereoWidth, bool freezing) noexcept {
+        // History slots for this frame (committed below unless frozen)
+        float* writeRealL = historyL_.writeReal();
+        float* writeImagL = historyL_.writeImag();
+        float* writeRealR = historyR_.writeReal();
+        float* writeImagR = historyR_.writeImag();
+
+        // Process each bin
+        for (std::size_t bin = 0; bin < numBins; ++bin) {
             // Calculate tilted feedback for this bin
             const float binFeedback = calculateTiltedFeedback(bin, numBins,
                                                               feedback, tilt);
@@ -752,11 +774,11 @@ private:
             const float inputRealR = inputMagR * std::cos(inputPhaseR);
             const float inputImagR = inputMagR * std::sin(inputPhaseR);
 
-            // Read delayed complex values from delay lines (linear interpolation is safe here)
-            const float delayedRealL = binRealDelaysL_[bin].readLinear(delayFrames);
-            const float delayedImagL = binImagDelaysL_[bin].readLinear(delayFrames);
-            const float delayedRealR = binRealDelaysR_[bin].readLinear(delayFrames);
-            const float delayedImagR = binImagDelaysR_[bin].readLinear(delayFrames);
+            // Delayed complex values (linearly interpolated in the gather above)
+            const float delayedRealL = delayedRealL_[bin];
+            const float delayedImagL = delayedImagL_[bin];
+            const float delayedRealR = delayedRealR_[bin];
+            const float delayedImagR = delayedImagR_[bin];
 
             // Convert delayed complex back to magnitude and phase
             const float delayedMagL = std::sqrt(delayedRealL * delayedRealL +
@@ -779,14 +801,14 @@ private:
             const float feedbackRealR = feedbackMagR * std::cos(delayedPhaseR);
             const float feedbackImagR = feedbackMagR * std::sin(delayedPhaseR);
 
-            // Only write to delay lines when not frozen
+            // Only write to history when not frozen
             // This ensures freeze truly ignores new input
             if (!freezing) {
-                // Write complex values (input + feedback) to delay lines
-                binRealDelaysL_[bin].write(inputRealL + feedbackRealL);
-                binImagDelaysL_[bin].write(inputImagL + feedbackImagL);
-                binRealDelaysR_[bin].write(inputRealR + feedbackRealR);
-                binImagDelaysR_[bin].write(inputImagR + feedbackImagR);
+                // Write complex values (input + feedback) to history
+                writeRealL[bin] = inputRealL + feedbackRealL;
+                writeImagL[bin] = inputImagL + feedbackImagL;
+                writeRealR[bin] = inputRealR + feedbackRealR;
+                writeImagR[bin] = inputImagR + feedbackImagR;
             }
 
             // Output is the delayed magnitude and phase
@@ -867,6 +889,162 @@ private:
         }
     }
 
+    /// @brief Per-bin kernel that stays in Cartesian form
+    ///
+    /// Equivalent to processBinsPolar() without the polar round-trips:
+    /// - tanh-limited feedback is a real gain ratio tanh(|d|*fb)/|d| on d
+    /// - freeze crossfade rescales the delayed value to the blended magnitude
+    /// - freeze phase drift is a per-bin phasor advanced by complex multiply
+    /// - stereo/diffusion phase offsets are merged into one rotation per bin
+    /// - magnitude blur rescales each bin by blurred/original magnitude
+    /// Each stage is a flat loop over the bin arrays so it auto-vectorizes.
+    void processBinsCartesian(const SpectralBuffer& inputL, const SpectralBuffer& inputR,
+                              SpectralBuffer& outputL, SpectralBuffer& outputR,
+                              std::size_t numBins, float feedback, float tilt,
+                              float diffusion, float stereoWidth, bool freezing) noexcept {
+        // Per-bin tilted feedback (shared by both channels)
+        for (std::size_t bin = 0; bin < numBins; ++bin) {
+            binFeedback_[bin] = calculateTiltedFeedback(bin, numBins, feedback, tilt);
+        }
+
+        // Write input + limited feedback into history
+        if (!freezing) {
+            writeFeedbackCartesian(inputL.data(), delayedRealL_.data(), delayedImagL_.data(),
+                                   historyL_.writeReal(), historyL_.writeImag(), numBins);
+            writeFeedbackCartesian(inputR.data(), delayedRealR_.data(), delayedImagR_.data(),
+                                   historyR_.writeReal(), historyR_.writeImag(), numBins);
+        }
+
+        // Output starts as the delayed spectrum
+        Complex* outL = outputL.data();
+        Complex* outR = outputR.data();
+        for (std::size_t bin = 0; bin < numBins; ++bin) {
+            outL[bin] = {delayedRealL_[bin], delayedImagL_[bin]};
+            outR[bin] = {delayedRealR_[bin], delayedImagR_[bin]};
+        }
+
+        // Freeze crossfade toward the captured spectrum
+        if (freezeCrossfade_ > 0.0f) {
+            applyFreezeCartesian(frozenSpectrumL_.data(), outL, numBins);
+            applyFreezeCartesian(frozenSpectrumR_.data(), outR, numBins);
+        }
+
+        // Stereo decorrelation and diffusion phase offsets, merged into a
+        // single rotation angle per bin and channel
+        const float widthAmount = (stereoWidth > 0.001f) ? stereoWidth : 0.0f;
+        const float diffusionAmount = (diffusion > 0.001f) ? diffusion : 0.0f;
+        if (widthAmount > 0.0f || diffusionAmount > 0.0f) {
+            for (std::size_t bin = 0; bin < numBins; ++bin) {
+                const float angleL = stereoPhaseL_[bin] * widthAmount +
+                                     diffusionPhaseL_[bin] * diffusionAmount;
+                const float angleR = -stereoPhaseR_[bin] * widthAmount +
+                                     diffusionPhaseR_[bin] * diffusionAmount;
+                outL[bin] = outL[bin] * Complex{std::cos(angleL), std::sin(angleL)};
+                outR[bin] = outR[bin] * Complex{std::cos(angleR), std::sin(angleR)};
+            }
+        }
+
+        // Magnitude blur across neighbouring bins, applied as a real gain
+        if (diffusionAmount > 0.0f) {
+            blurMagnitudeCartesian(outL, numBins, diffusionAmount);
+            blurMagnitudeCartesian(outR, numBins, diffusionAmount);
+        }
+    }
+
+    /// @brief history = input + d * tanh(|d| * fb) / |d| for every bin
+    void writeFeedbackCartesian(const Complex* input, const float* delayedRe,
+                                const float* delayedIm, float* writeRe, float* writeIm,
+                                std::size_t numBins) const noexcept {
+        for (std::size_t bin = 0; bin < numBins; ++bin) {
+            const float re = delayedRe[bin];
+            const float im = delayedIm[bin];
+            const float mag = std::sqrt(re * re + im * im);
+            const float gain = (mag > 0.0f) ? std::tanh(mag * binFeedback_[bin]) / mag : 0.0f;
+            writeRe[bin] = input[bin].real + re * gain;
+            writeIm[bin] = input[bin].imag + im * gain;
+        }
+    }
+
+    /// @brief Blend delayed magnitude toward the frozen spectrum
+    ///
+    /// Below the fully-frozen threshold the delayed phase is kept; at or above
+    /// it the frozen phase (plus per-bin drift) is used, matching the polar path.
+    void applyFreezeCartesian(const Complex* frozen, Complex* out,
+                              std::size_t numBins) const noexcept {
+        const float xf = freezeCrossfade_;
+        const bool useFrozenPhase = xf >= 0.99f;
+
+        // Drift rotation e^(i * drift * (1 + 0.5 * bin / numBins)), advanced
+        // by a constant per-bin step phasor (double to avoid accumulation error)
+        double rotRe = 1.0;
+        double rotIm = 0.0;
+        double stepRe = 1.0;
+        double stepIm = 0.0;
+        if (useFrozenPhase && freezePhaseDrift_ > 0.0f) {
+            const double drift = static_cast<double>(freezePhaseDrift_);
+            const double step = drift * 0.5 / static_cast<double>(numBins);
+            rotRe = std::cos(drift);
+            rotIm = std::sin(drift);
+            stepRe = std::cos(step);
+            stepIm = std::sin(step);
+        }
+
+        for (std::size_t bin = 0; bin < numBins; ++bin) {
+            const float frozenMag = frozen[bin].magnitude();
+            const float delayedMag = out[bin].magnitude();
+            const float mag = delayedMag * (1.0f - xf) + frozenMag * xf;
+
+            if (useFrozenPhase) {
+                // Unit vector of the frozen bin (phase 0 for silent bins)
+                float unitRe = 1.0f;
+                float unitIm = 0.0f;
+                if (frozenMag > 0.0f) {
+                    unitRe = frozen[bin].real / frozenMag;
+                    unitIm = frozen[bin].imag / frozenMag;
+                }
+                const float rRe = static_cast<float>(rotRe);
+                const float rIm = static_cast<float>(rotIm);
+                out[bin] = {mag * (unitRe * rRe - unitIm * rIm),
+                            mag * (unitRe * rIm + unitIm * rRe)};
+
+                const double nextRe = rotRe * stepRe - rotIm * stepIm;
+                rotIm = rotRe * stepIm + rotIm * stepRe;
+                rotRe = nextRe;
+            } else if (delayedMag > 0.0f) {
+                const float gain = mag / delayedMag;
+                out[bin] = {out[bin].real * gain, out[bin].imag * gain};
+            } else {
+                out[bin] = {mag, 0.0f};
+            }
+        }
+    }
+
+    /// @brief 3-tap magnitude blur (same kernel as applyDiffusion()) as a gain
+    void blurMagnitudeCartesian(Complex* spectrum, std::size_t numBins,
+                                float diffusionAmount) noexcept {
+        if (numBins < 3) return;
+
+        const float side = diffusionAmount * 0.25f;
+        const float center = 1.0f - diffusionAmount * 0.5f;
+
+        for (std::size_t i = 0; i < numBins; ++i) {
+            blurredMag_[i] = spectrum[i].magnitude();
+        }
+
+        float prevMag = blurredMag_[0];
+        for (std::size_t i = 1; i < numBins - 1; ++i) {
+            const float mag = blurredMag_[i];
+            const float blurred = prevMag * side + mag * center + blurredMag_[i + 1] * side;
+            prevMag = mag;
+            if (mag > 0.0f) {
+                const float gain = blurred / mag;
+                spectrum[i] = {spectrum[i].real * gain, spectrum[i].imag * gain};
+            } else {
+                spectrum[i] = {blurred, 0.0f};
+            }
+        }
+    }
+
     // =========================================================================
     // State
     // =========================================================================
@@ -898,16 +1076,23 @@ private:
     SpectralBuffer frozenSpectrumL_;
     SpectralBuffer frozenSpectrumR_;
 
-    // Per-Bin Delay Lines for Complex Values (stereo)
+    // Per-Bin Spectral History for Complex Values (stereo)
     // We delay real and imaginary parts instead of magnitude and phase
     // to avoid phase wrapping issues during linear interpolation.
     // When phase wraps from +π to -π, linear interpolation produces incorrect
     // values (e.g., interp(3.1, -3.1, 0.5) = 0.0 instead of ~±π).
     // Complex interpolation handles this correctly.
-    std::vector<DelayLine> binRealDelaysL_;
-    std::vector<DelayLine> binRealDelaysR_;
-    std::vector<DelayLine> binImagDelaysL_;
-    std::vector<DelayLine> binImagDelaysR_;
+    // One contiguous frame-major ring per channel replaces 2×numBins DelayLines.
+    SpectralHistory historyL_;
+    SpectralHistory historyR_;
+
+    // Per-frame scratch (numBins each)
+    std::vector<float> binDelayFrames_;
+    std::vector<float> binFeedback_;
+    std::vector<float> delayedRealL_;
+    std::vector<float> delayedImagL_;
+    std::vector<float> delayedRealR_;
+    std::vector<float> delayedImagR_;
 
     // Parameters
     float baseDelayMs_ = kDefaultDelayMs;
@@ -920,6 +1105,7 @@ private:
     float dryWetMix_ = kDefaultDryWet;
     float stereoWidth_ = 0.0f;  // Phase 3.2: Stereo decorrelation amount
     bool freezeEnabled_ = false;
+    SpectralProcessingMode processingMode_ = SpectralProcessingMode::Cartesian;
 
     // Tempo Sync State (spec 041)
     TimeMode timeMode_ = TimeMode::Free;  // Default to free (ms) mode
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <krate/dsp/core/db_utils.h>
+#include <krate/dsp/primitives/output_stage.h>
 #include <krate/dsp/primitives/smoother.h>
 #include <krate/dsp/systems/character_processor.h>
 #include <krate/dsp/systems/tap_manager.h>
@@ -32,6 +33,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace Krate {
 namespace DSP {
@@ -126,6 +128,11 @@ public:
         return delaySmoother_.process();
     }
 
+    /// @brief Write the smoothed delay (ms) for each of numSamples samples
+    void processBlock(float* delayMs, size_t numSamples) noexcept {
+        delaySmoother_.processBlock(delayMs, numSamples);
+    }
+
 private:
     float sampleRate_ = 44100.0f;
     float targetDelayMs_ = 0.0f;
@@ -224,9 +231,13 @@ public:
     /// @post Ready for process() calls
     void prepare(double sampleRate, size_t maxBlockSize, float maxDelayMs) noexcept {
         sampleRate_ = sampleRate;
-        maxBlockSize_ = maxBlockSize;
+        maxBlockSize_ = std::max<size_t>(maxBlockSize, 1);
         maxDelayMs_ = std::min(maxDelayMs, kMaxDelayMs);
 
+        // Per-block scratch: dry copy (in the output stage) and motor delay curve
+        outputStage_.prepare(sampleRate, maxBlockSize_, kSmoothingTimeMs);
+        motorScale_.assign(maxBlockSize_, 1.0f);
+
         // Prepare motor controller
         motor_.prepare(static_cast<float>(sampleRate), maxBlockSize);
 
@@ -246,10 +257,10 @@ public:
 
         // Prepare smoothers
         feedbackSmoother_.configure(kSmoothingTimeMs, static_cast<float>(sampleRate));
-        mixSmoother_.configure(kSmoothingTimeMs, static_cast<float>(sampleRate));
 
         feedbackSmoother_.snapTo(feedback_);
-        mixSmoother_.snapTo(mix_);
+        outputStage_.setMix(mix_);
+        outputStage_.snapParameters();
 
         prepared_ = true;
     }
@@ -262,7 +273,8 @@ public:
         character_.reset();
 
         feedbackSmoother_.snapTo(feedback_);
-        mixSmoother_.snapTo(mix_);
+        outputStage_.setMix(mix_);
+        outputStage_.reset();
 
         // Reset splice artifact state
         spliceSampleCounter_ = 0;
@@ -476,7 +488,7 @@ public:
     /// @param amount Mix [0, 1] (0 = dry, 1 = wet)
     void setMix(float amount) noexcept {
         mix_ = std::clamp(amount, 0.0f, 1.0f);
-        mixSmoother_.setTarget(mix_);
+        outputStage_.setMix(mix_);
     }
 
     /// @brief Get current mix amount
@@ -495,172 +507,153 @@ public:
     /// @pre prepare() has been called
     /// @note noexcept, allocation-free (FR-034, FR-035)
     void process(float* left, float* right, size_t numSamples) noexcept {
-        if (!prepared_ || numSamples == 0) return;
+        if (!prepared_) return;
 
-        // Calculate splice click duration in samples
-        const size_t spliceClickSamples = static_cast<size_t>(
-            kSpliceClickDurationMs * 0.001 * sampleRate_);
+        // Blocks larger than maxBlockSize are processed in prepared-size chunks
+        for (size_t offset = 0; offset < numSamples; offset += maxBlockSize_) {
+            const size_t n = std::min(maxBlockSize_, numSamples - offset);
+            processChunk(left + offset, right + offset, n);
+        }
+    }
 
-        // Save dry signal BEFORE processing (required for dry/wet mix)
-        // Use stack-allocated temp buffers for real-time safety
-        constexpr size_t kMaxBlockSize = 4096;
-        const size_t safeSamples = std::min(numSamples, kMaxBlockSize);
-        float dryLeft[kMaxBlockSize];
-        float dryRight[kMaxBlockSize];
-        for (size_t i = 0; i < safeSamples; ++i) {
-            dryLeft[i] = left[i];
-            dryRight[i] = right[i];
+    /// @brief Process mono audio in-place
+    /// @param buffer Mono buffer (modified in-place)
+    /// @param numSamples Number of samples
+    void process(float* buffer, size_t numSamples) noexcept {
+        if (!prepared_) return;
+
+        for (size_t offset = 0; offset < numSamples; offset += maxBlockSize_) {
+            const size_t n = std::min(maxBlockSize_, numSamples - offset);
+            processChunk(buffer + offset, n);
         }
+    }
 
-        for (size_t i = 0; i < numSamples; ++i) {
-            // Get smoothed motor delay and update head times
-            const float currentDelayMs = motor_.process();
+    // =========================================================================
+    // Query Methods
+    // =========================================================================
 
-            // Update head delay times based on motor speed
-            for (size_t h = 0; h < kNumHeads; ++h) {
-                const float headDelay = currentDelayMs * heads_[h].ratio;
-                tapManager_.setTapTimeMs(h, std::min(headDelay, maxDelayMs_));
-            }
+    /// @brief Get number of active (enabled) heads
+    [[nodiscard]] size_t getActiveHeadCount() const noexcept {
+        size_t count = 0;
+        for (size_t i = 0; i < kNumHeads; ++i) {
+            if (heads_[i].enabled) ++count;
+        }
+        return count;
+    }
+
+    /// @brief Check if currently transitioning (motor inertia active)
+    [[nodiscard]] bool isTransitioning() const noexcept {
+        return motor_.isTransitioning();
+    }
+
+private:
+    // =========================================================================
+    // Internal Helpers
+    // =========================================================================
 
-            // Advance feedback smoother for consistent parameter processing
+    /// @brief Process up to maxBlockSize_ stereo samples in-place
+    void processChunk(float* left, float* right, size_t numSamples) noexcept {
+        // Save dry signal BEFORE processing (required for dry/wet mix)
+        outputStage_.captureDry(left, right, numSamples);
+
+        // Motor inertia is applied per sample: the heads read at their
+        // target times scaled by the motor's delay curve
+        renderMotorScale(numSamples);
+
+        // Advance feedback smoother for consistent parameter processing
+        for (size_t i = 0; i < numSamples; ++i) {
             (void)feedbackSmoother_.process();
         }
 
         // Update per-tap feedback amounts from master feedback
         // All taps get the same feedback, providing master feedback behavior
-        const float currentFeedback = feedbackSmoother_.getCurrentValue() * 100.0f;  // Convert to percentage
-        for (size_t h = 0; h < kNumHeads; ++h) {
-            if (heads_[h].enabled) {
-                tapManager_.setTapFeedback(h, currentFeedback);
-            }
-        }
+        setHeadFeedback(feedbackSmoother_.getCurrentValue());
 
         // Process through TapManager (multi-head delay with master feedback via per-tap)
-        tapManager_.process(left, right, left, right, numSamples);
+        tapManager_.process(left, right, left, right, motorScale_.data(), numSamples);
 
         // Process through CharacterProcessor (tape character)
         character_.processStereo(left, right, numSamples);
 
         // FR-023: Add splice artifacts if enabled
-        if (spliceEnabled_ && spliceIntensity_ > 0.0f && spliceIntervalSamples_ > 0) {
-            for (size_t i = 0; i < numSamples; ++i) {
-                // Check if we're within a splice click window
-                if (spliceSampleCounter_ < spliceClickSamples) {
-                    const float spliceArtifact = generateSpliceClick(
-                        spliceSampleCounter_, spliceClickSamples);
-                    left[i] += spliceArtifact;
-                    right[i] += spliceArtifact;
-                }
-
-                // Increment counter and wrap at splice interval
-                spliceSampleCounter_++;
-                if (spliceSampleCounter_ >= spliceIntervalSamples_) {
-                    spliceSampleCounter_ = 0;
-                }
-            }
-        }
+        addSpliceArtifacts(left, right, numSamples);
 
         // Apply mix using saved dry signal
-        for (size_t i = 0; i < safeSamples; ++i) {
-            const float wetMix = mixSmoother_.process();
-            const float dryMix = 1.0f - wetMix;
-
-            left[i] = dryLeft[i] * dryMix + left[i] * wetMix;
-            right[i] = dryRight[i] * dryMix + right[i] * wetMix;
-        }
+        outputStage_.process(left, right, numSamples);
     }
 
-    /// @brief Process mono audio in-place
-    /// @param buffer Mono buffer (modified in-place)
-    /// @param numSamples Number of samples
-    void process(float* buffer, size_t numSamples) noexcept {
-        if (!prepared_ || numSamples == 0) return;
-
-        // Calculate splice click duration in samples
-        const size_t spliceClickSamples = static_cast<size_t>(
-            kSpliceClickDurationMs * 0.001 * sampleRate_);
-
-        // Save dry signal BEFORE processing (required for dry/wet mix)
-        constexpr size_t kMaxBlockSize = 4096;
-        const size_t safeSamples = std::min(numSamples, kMaxBlockSize);
-        float dryBuffer[kMaxBlockSize];
-        for (size_t i = 0; i < safeSamples; ++i) {
-            dryBuffer[i] = buffer[i];
-        }
-
-        // For mono, process as dual mono
-        for (size_t i = 0; i < numSamples; ++i) {
-            const float currentDelayMs = motor_.process();
+    /// @brief Process up to maxBlockSize_ mono samples in-place (dual mono)
+    void processChunk(float* buffer, size_t numSamples) noexcept {
+        outputStage_.captureDry(buffer, numSamples);
 
-            for (size_t h = 0; h < kNumHeads; ++h) {
-                const float headDelay = currentDelayMs * heads_[h].ratio;
-                tapManager_.setTapTimeMs(h, std::min(headDelay, maxDelayMs_));
-            }
-        }
-
-        // Update per-tap feedback amounts from master feedback
-        const float currentFeedback = feedback_ * 100.0f;  // Convert to percentage
-        for (size_t h = 0; h < kNumHeads; ++h) {
-            if (heads_[h].enabled) {
-                tapManager_.setTapFeedback(h, currentFeedback);
-            }
-        }
+        renderMotorScale(numSamples);
+        setHeadFeedback(feedback_);
 
         // Process mono through tap manager (with feedback)
-        tapManager_.process(buffer, buffer, buffer, buffer, numSamples);
+        tapManager_.process(buffer, buffer, buffer, buffer, motorScale_.data(), numSamples);
 
         // Process through character
         character_.process(buffer, numSamples);
 
         // FR-023: Add splice artifacts if enabled
-        if (spliceEnabled_ && spliceIntensity_ > 0.0f && spliceIntervalSamples_ > 0) {
-            for (size_t i = 0; i < numSamples; ++i) {
-                // Check if we're within a splice click window
-                if (spliceSampleCounter_ < spliceClickSamples) {
-                    const float spliceArtifact = generateSpliceClick(
-                        spliceSampleCounter_, spliceClickSamples);
-                    buffer[i] += spliceArtifact;
-                }
-
-                // Increment counter and wrap at splice interval
-                spliceSampleCounter_++;
-                if (spliceSampleCounter_ >= spliceIntervalSamples_) {
-                    spliceSampleCounter_ = 0;
-                }
-            }
-        }
+        addSpliceArtifacts(buffer, nullptr, numSamples);
 
         // Apply mix using saved dry signal
-        for (size_t i = 0; i < safeSamples; ++i) {
-            const float wetMix = mixSmoother_.process();
-            const float dryMix = 1.0f - wetMix;
-
-            buffer[i] = dryBuffer[i] * dryMix + buffer[i] * wetMix;
-        }
+        outputStage_.processMono(buffer, numSamples);
     }
 
-    // =========================================================================
-    // Query Methods
-    // =========================================================================
+    /// @brief Fill motorScale_ with the motor delay curve relative to its target
+    ///
+    /// Head times are set to ratio * target delay, so scaling them by
+    /// current / target gives ratio * current delay at every sample.
+    void renderMotorScale(size_t numSamples) noexcept {
+        motor_.processBlock(motorScale_.data(), numSamples);
 
-    /// @brief Get number of active (enabled) heads
-    [[nodiscard]] size_t getActiveHeadCount() const noexcept {
-        size_t count = 0;
-        for (size_t i = 0; i < kNumHeads; ++i) {
-            if (heads_[i].enabled) ++count;
+        const float targetDelay = motor_.getTargetDelayMs();
+        const float invTarget = (targetDelay > 0.0f) ? 1.0f / targetDelay : 0.0f;
+        for (size_t i = 0; i < numSamples; ++i) {
+            motorScale_[i] *= invTarget;
         }
-        return count;
     }
 
-    /// @brief Check if currently transitioning (motor inertia active)
-    [[nodiscard]] bool isTransitioning() const noexcept {
-        return motor_.isTransitioning();
+    /// @brief Apply master feedback (0-1.2) to every enabled head
+    void setHeadFeedback(float feedback) noexcept {
+        const float feedbackPercent = feedback * 100.0f;
+        for (size_t h = 0; h < kNumHeads; ++h) {
+            if (heads_[h].enabled) {
+                tapManager_.setTapFeedback(h, feedbackPercent);
+            }
+        }
     }
 
-private:
-    // =========================================================================
-    // Internal Helpers
-    // =========================================================================
+    /// @brief Add splice clicks (FR-023); right may be nullptr for mono
+    void addSpliceArtifacts(float* left, float* right, size_t numSamples) noexcept {
+        if (!spliceEnabled_ || spliceIntensity_ <= 0.0f || spliceIntervalSamples_ == 0) {
+            return;
+        }
+
+        // Calculate splice click duration in samples
+        const size_t spliceClickSamples = static_cast<size_t>(
+            kSpliceClickDurationMs * 0.001 * sampleRate_);
+
+        for (size_t i = 0; i < numSamples; ++i) {
+            // Check if we're within a splice click window
+            if (spliceSampleCounter_ < spliceClickSamples) {
+                const float spliceArtifact = generateSpliceClick(
+                    spliceSampleCounter_, spliceClickSamples);
+                left[i] += spliceArtifact;
+                if (right != nullptr) {
+                    right[i] += spliceArtifact;
+                }
+            }
+
+            // Increment counter and wrap at splice interval
+            spliceSampleCounter_++;
+            if (spliceSampleCounter_ >= spliceIntervalSamples_) {
+                spliceSampleCounter_ = 0;
+            }
+        }
+    }
 
     /// @brief Update head delay times based on motor speed
     void updateHeadDelayTimes() noexcept {
@@ -785,6 +778,10 @@ private:
     // Motor controller (inertia)
     MotorController motor_;
 
+    // Scratch buffers (sized in prepare)
+    OutputStage outputStage_;        // Dry copy and dry/wet mix
+    std::vector<float> motorScale_;  // Per-sample motor delay / target delay
+
     // Layer 3 components
     TapManager tapManager_;
     CharacterProcessor character_;
@@ -811,7 +808,6 @@ private:
 
     // Smoothers
     OnePoleSmoother feedbackSmoother_;
-    OnePoleSmoother mixSmoother_;
 };
 
 } // namespace DSP
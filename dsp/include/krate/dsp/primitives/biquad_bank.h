@@ -0,0 +1,243 @@
+// ==============================================================================
+// Layer 1: DSP Primitive - Biquad Bank
+// ==============================================================================
+// Multi-channel, multi-stage TDF2 biquad. Every channel is a lane of the same
+// update, so the per-sample work is one short fixed-length loop over channels
+// per stage that the compiler vectorizes (stereo pairs, tap banks, ...).
+// NaN recovery and denormal flushing run once per block instead of per sample.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept, no allocations)
+// - Principle III: Modern C++ (C++20, templates, value semantics)
+// - Principle IX: Layer 1 (depends only on Layer 0 / Biquad definitions)
+// - Principle X: DSP Constraints (TDF2 topology, denormal flushing)
+// ==============================================================================
+
+#pragma once
+
+#include <krate/dsp/core/db_utils.h>
+#include <krate/dsp/primitives/biquad.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief Bank of Channels independent TDF2 biquad cascades of Stages stages.
+///
+/// Coefficients may be shared by all channels (setStage(stage, coeffs)) or
+/// set per channel. Channel state is independent.
+///
+/// Unlike Biquad::process(), which checks each input for NaN/Inf and flushes
+/// denormals every sample, the bank checks its state once at the end of each
+/// block: a channel whose state went non-finite is cleared and its output for
+/// that block is zeroed, and tiny state values are flushed to zero.
+///
+/// @par Usage
+/// @code
+/// BiquadBank<2> antiAlias;  // stereo, one stage
+/// antiAlias.configure(FilterType::Lowpass, 14000.0f, 0.707f, 0.0f, 44100.0f);
+/// antiAlias.processStereo(left, right, numSamples);
+/// @endcode
+template <size_t Channels, size_t Stages = 1>
+class BiquadBank {
+public:
+    static_assert(Channels >= 1 && Channels <= 64, "BiquadBank supports 1-64 channels");
+    static_assert(Stages >= 1 && Stages <= 8, "BiquadBank supports 1-8 stages (12-96 dB/oct)");
+
+    /// Construct as bypass (b0 = 1) on every stage and channel
+    BiquadBank() noexcept {
+        for (auto& st : stages_) {
+            st.b0.fill(1.0f);
+        }
+    }
+
+    // =========================================================================
+    // Configuration
+    // =========================================================================
+
+    /// Set one stage's coefficients on every channel
+    void setStage(size_t stage, const BiquadCoefficients& coeffs) noexcept {
+        if (stage >= Stages) {
+            return;
+        }
+        for (size_t ch = 0; ch < Channels; ++ch) {
+            setLane(stage, ch, coeffs);
+        }
+    }
+
+    /// Set one stage's coefficients on one channel
+    void setStage(size_t stage, size_t channel, const BiquadCoefficients& coeffs) noexcept {
+        if (stage < Stages && channel < Channels) {
+            setLane(stage, channel, coeffs);
+        }
+    }
+
+    /// Configure every stage of every channel identically
+    void configure(FilterType type, float frequency, float Q, float gainDb, float sampleRate) noexcept {
+        const auto coeffs = BiquadCoefficients::calculate(type, frequency, Q, gainDb, sampleRate);
+        for (size_t s = 0; s < Stages; ++s) {
+            setStage(s, coeffs);
+        }
+    }
+
+    /// Set all stages for Butterworth response (maximally flat passband)
+    void setButterworth(FilterType type, float frequency, float sampleRate) noexcept {
+        for (size_t s = 0; s < Stages; ++s) {
+            setStage(s, BiquadCoefficients::calculate(
+                type, frequency, butterworthQ(s, Stages), 0.0f, sampleRate));
+        }
+    }
+
+    /// Set all stages for Linkwitz-Riley response (flat sum at crossover)
+    void setLinkwitzRiley(FilterType type, float frequency, float sampleRate) noexcept {
+        for (size_t s = 0; s < Stages; ++s) {
+            setStage(s, BiquadCoefficients::calculate(
+                type, frequency, linkwitzRileyQ(s, Stages), 0.0f, sampleRate));
+        }
+    }
+
+    /// Get one stage's coefficients for one channel
+    [[nodiscard]] BiquadCoefficients coefficients(size_t stage, size_t channel) const noexcept {
+        const Stage& st = stages_[std::min(stage, Stages - 1)];
+        const size_t ch = std::min(channel, Channels - 1);
+        return BiquadCoefficients{st.b0[ch], st.b1[ch], st.b2[ch], st.a1[ch], st.a2[ch]};
+    }
+
+    // =========================================================================
+    // Processing
+    // =========================================================================
+
+    /// Process planar channel buffers in-place
+    /// @param channels Channels pointers to numSamples samples each
+    /// @param numSamples Number of samples per channel
+    void processBlock(float* const* channels, size_t numSamples) noexcept {
+        run(numSamples,
+            [channels](size_t i, size_t ch) noexcept -> float& { return channels[ch][i]; });
+        recover(channels, numSamples);
+    }
+
+    /// Process interleaved frames in-place (frame i, channel c at [i * Channels + c])
+    void processInterleaved(float* frames, size_t numFrames) noexcept {
+        run(numFrames,
+            [frames](size_t i, size_t ch) noexcept -> float& { return frames[i * Channels + ch]; });
+        recoverInterleaved(frames, numFrames);
+    }
+
+    /// Process a stereo pair in-place
+    void processStereo(float* left, float* right, size_t numSamples) noexcept
+        requires(Channels == 2) {
+        float* channels[2] = {left, right};
+        processBlock(channels, numSamples);
+    }
+
+    // =========================================================================
+    // State Management
+    // =========================================================================
+
+    /// Clear all filter state
+    void reset() noexcept {
+        for (auto& st : stages_) {
+            st.z1.fill(0.0f);
+            st.z2.fill(0.0f);
+        }
+    }
+
+    [[nodiscard]] static constexpr size_t numChannels() noexcept { return Channels; }
+    [[nodiscard]] static constexpr size_t numStages() noexcept { return Stages; }
+
+private:
+    struct Stage {
+        std::array<float, Channels> b0{};
+        std::array<float, Channels> b1{};
+        std::array<float, Channels> b2{};
+        std::array<float, Channels> a1{};
+        std::array<float, Channels> a2{};
+        std::array<float, Channels> z1{};
+        std::array<float, Channels> z2{};
+    };
+
+    void setLane(size_t stage, size_t ch, const BiquadCoefficients& c) noexcept {
+        Stage& st = stages_[stage];
+        st.b0[ch] = c.b0;
+        st.b1[ch] = c.b1;
+        st.b2[ch] = c.b2;
+        st.a1[ch] = c.a1;
+        st.a2[ch] = c.a2;
+    }
+
+    /// TDF2 over all lanes; sample(i, ch) returns a reference to the sample.
+    /// Stages are copied to a local so the compiler knows the audio buffers
+    /// cannot alias coefficients or state and keeps them in registers.
+    template <typename SampleRef>
+    void run(size_t numSamples, SampleRef&& sample) noexcept {
+        std::array<Stage, Stages> st = stages_;
+
+        for (size_t i = 0; i < numSamples; ++i) {
+            std::array<float, Channels> x;
+            for (size_t ch = 0; ch < Channels; ++ch) {
+                x[ch] = sample(i, ch);
+            }
+
+            for (size_t s = 0; s < Stages; ++s) {
+                Stage& g = st[s];
+                for (size_t ch = 0; ch < Channels; ++ch) {
+                    const float in = x[ch];
+                    const float out = g.b0[ch] * in + g.z1[ch];
+                    g.z1[ch] = g.b1[ch] * in - g.a1[ch] * out + g.z2[ch];
+                    g.z2[ch] = g.b2[ch] * in - g.a2[ch] * out;
+                    x[ch] = out;
+                }
+            }
+
+            for (size_t ch = 0; ch < Channels; ++ch) {
+                sample(i, ch) = x[ch];
+            }
+        }
+
+        for (size_t s = 0; s < Stages; ++s) {
+            stages_[s].z1 = st[s].z1;
+            stages_[s].z2 = st[s].z2;
+        }
+    }
+
+    /// End-of-block state check for one channel
+    /// @return true if the channel's state was non-finite and has been cleared
+    [[nodiscard]] bool recoverLane(size_t ch) noexcept {
+        bool finite = true;
+        for (auto& st : stages_) {
+            finite = finite && detail::isFiniteBits(st.z1[ch]) && detail::isFiniteBits(st.z2[ch]);
+        }
+
+        for (auto& st : stages_) {
+            st.z1[ch] = finite ? detail::flushDenormal(st.z1[ch]) : 0.0f;
+            st.z2[ch] = finite ? detail::flushDenormal(st.z2[ch]) : 0.0f;
+        }
+        return !finite;
+    }
+
+    void recover(float* const* channels, size_t numSamples) noexcept {
+        for (size_t ch = 0; ch < Channels; ++ch) {
+            if (recoverLane(ch)) {
+                std::fill(channels[ch], channels[ch] + numSamples, 0.0f);
+            }
+        }
+    }
+
+    void recoverInterleaved(float* frames, size_t numFrames) noexcept {
+        for (size_t ch = 0; ch < Channels; ++ch) {
+            if (recoverLane(ch)) {
+                for (size_t i = 0; i < numFrames; ++i) {
+                    frames[i * Channels + ch] = 0.0f;
+                }
+            }
+        }
+    }
+
+    std::array<Stage, Stages> stages_{};
+};
+
+} // namespace DSP
+} // namespace Krate
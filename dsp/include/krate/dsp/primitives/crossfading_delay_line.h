@@ -114,6 +114,7 @@ public:
         activeIsTapA_ = true;
         crossfading_ = false;
         crossfadePosition_ = 0.0f;
+        modulationSamples_ = 0.0f;
 
         // Calculate crossfade increment per sample
         setCrossfadeTime(kDefaultCrossfadeTimeMs);
@@ -196,6 +197,24 @@ public:
         setDelaySamples(delayMs * 0.001f * static_cast<float>(sampleRate_));
     }
 
+    /// @brief Set a modulation offset added to both taps' read positions.
+    /// @param offsetSamples Offset in samples (negative = shorter delay)
+    ///
+    /// Unlike the delay time, the offset is not crossfaded: it moves the read
+    /// position directly, so changing it every sample glides the read and
+    /// bends the pitch as with a plain modulated DelayLine. Use it for LFO
+    /// modulation around a delay time set with setDelaySamples(); time knob
+    /// changes still crossfade.
+    void setModulationSamples(float offsetSamples) noexcept {
+        modulationSamples_ = offsetSamples;
+    }
+
+    /// @brief Set the modulation offset in milliseconds.
+    /// @see setModulationSamples()
+    void setModulationMs(float offsetMs) noexcept {
+        setModulationSamples(offsetMs * 0.001f * static_cast<float>(sampleRate_));
+    }
+
     /// @brief Snap to a delay position immediately without crossfading.
     /// @param delaySamples Target delay in samples
     /// @note Use this during initialization or after reset to avoid crossfade transient.
@@ -231,9 +250,22 @@ public:
     /// perceived loudness during the transition. This eliminates the -3dB dip
     /// that occurs with linear crossfading at the midpoint.
     [[nodiscard]] float read() noexcept {
+        return readAhead(0);
+    }
+
+    /// @brief read() as it will be after `pendingWrites` more write() calls.
+    ///
+    /// Advances the crossfade exactly like read(), so a feedback loop can
+    /// read a chunk of delayed samples (pendingWrites = 0, 1, 2, ...) before
+    /// writing any of them back.
+    ///
+    /// @param pendingWrites Writes still to be made before this sample
+    /// @pre Both tap delays are at least pendingWrites samples
+    ///      (see minTapDelaySamples())
+    [[nodiscard]] float readAhead(size_t pendingWrites) noexcept {
         // Read from both taps
-        const float tapAOutput = delayLine_.readLinear(tapADelaySamples_);
-        const float tapBOutput = delayLine_.readLinear(tapBDelaySamples_);
+        const float tapAOutput = delayLine_.readLinearAhead(tapADelaySamples_ + modulationSamples_, pendingWrites);
+        const float tapBOutput = delayLine_.readLinearAhead(tapBDelaySamples_ + modulationSamples_, pendingWrites);
 
         // Mix based on current gains
         float output = tapAOutput * tapAGain_ + tapBOutput * tapBGain_;
@@ -285,6 +317,85 @@ public:
         return output;
     }
 
+    /// @brief readAhead(0), readAhead(1), ... readAhead(numSamples - 1) for a
+    ///        delay that is not moving.
+    ///
+    /// @param output Receives numSamples delayed samples
+    /// @param numSamples Number of samples
+    /// @pre !isCrossfading(), both tap delays are at least numSamples - 1
+    ///      samples, and the delay is not changed until the reads are done
+    void readAheadBlock(float* output, size_t numSamples) const noexcept {
+        const float gainA = tapAGain_;
+        const float gainB = tapBGain_;
+        const size_t head = delayLine_.writeHead();
+        const size_t mask = delayLine_.mask();
+        const float* buffer = delayLine_.data();
+
+        const DelayLine::LinearTap a = delayLine_.linearTap(tapADelaySamples_ + modulationSamples_);
+        const DelayLine::LinearTap b = delayLine_.linearTap(tapBDelaySamples_ + modulationSamples_);
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float a0 = buffer[(head + i - a.index0) & mask];
+            const float a1 = buffer[(head + i - a.index1) & mask];
+            const float b0 = buffer[(head + i - b.index0) & mask];
+            const float b1 = buffer[(head + i - b.index1) & mask];
+            output[i] = (a0 + a.frac * (a1 - a0)) * gainA + (b0 + b.frac * (b1 - b0)) * gainB;
+        }
+    }
+
+    /// @brief setDelaySamples(delaySamples[i]), setModulationSamples(
+    ///        modulationSamples[i]) then readAhead(i), for i in [0, numSamples).
+    ///
+    /// When no crossfade is running or starts in the chunk, the active tap
+    /// stays put and only the modulation moves, so the reads are done as one
+    /// gather loop over the buffer; otherwise the per-sample path runs. The
+    /// result is the same either way.
+    ///
+    /// @param delaySamples Per-sample delay time in samples
+    /// @param modulationSamples Per-sample modulation offset in samples
+    /// @param output Receives numSamples delayed samples
+    /// @param numSamples Number of samples
+    /// @pre Every tap delay plus modulation is at least the index it is read
+    ///      at (see readAhead())
+    void readAheadBlock(const float* delaySamples, const float* modulationSamples,
+                        float* output, size_t numSamples) noexcept {
+        if (numSamples == 0) return;
+
+        if (!crossfading_ && !crossfadeStarts(delaySamples, numSamples)) {
+            // The inactive tap follows the delay curve, the active one stays
+            const float gainA = tapAGain_;
+            const float gainB = tapBGain_;
+            const size_t head = delayLine_.writeHead();
+            const size_t mask = delayLine_.mask();
+            const float* buffer = delayLine_.data();
+            const float activeDelay = activeIsTapA_ ? tapADelaySamples_ : tapBDelaySamples_;
+            for (size_t i = 0; i < numSamples; ++i) {
+                const float inactiveDelay = std::max(0.0f, delaySamples[i]);
+                const float delayA = activeIsTapA_ ? activeDelay : inactiveDelay;
+                const float delayB = activeIsTapA_ ? inactiveDelay : activeDelay;
+                const DelayLine::LinearTap a = delayLine_.linearTap(delayA + modulationSamples[i]);
+                const DelayLine::LinearTap b = delayLine_.linearTap(delayB + modulationSamples[i]);
+                const float a0 = buffer[(head + i - a.index0) & mask];
+                const float a1 = buffer[(head + i - a.index1) & mask];
+                const float b0 = buffer[(head + i - b.index0) & mask];
+                const float b1 = buffer[(head + i - b.index1) & mask];
+                output[i] = (a0 + a.frac * (a1 - a0)) * gainA + (b0 + b.frac * (b1 - b0)) * gainB;
+            }
+
+            // Where the per-sample path would have left the taps
+            const float last = std::max(0.0f, delaySamples[numSamples - 1]);
+            (activeIsTapA_ ? tapBDelaySamples_ : tapADelaySamples_) = last;
+            targetDelaySamples_ = last;
+            modulationSamples_ = modulationSamples[numSamples - 1];
+            return;
+        }
+
+        for (size_t i = 0; i < numSamples; ++i) {
+            setDelaySamples(delaySamples[i]);
+            setModulationSamples(modulationSamples[i]);
+            output[i] = readAhead(i);
+        }
+    }
+
     /// @brief Process a single sample (write + read).
     /// @param input Input sample
     /// @return Delayed and crossfaded output
@@ -305,7 +416,18 @@ public:
     /// @brief Get current effective delay in samples.
     [[nodiscard]] float getCurrentDelaySamples() const noexcept {
         // Weighted average based on tap gains
-        return tapADelaySamples_ * tapAGain_ + tapBDelaySamples_ * tapBGain_;
+        return tapADelaySamples_ * tapAGain_ + tapBDelaySamples_ * tapBGain_ + modulationSamples_;
+    }
+
+    /// @brief Get the modulation offset in samples.
+    [[nodiscard]] float getModulationSamples() const noexcept {
+        return modulationSamples_;
+    }
+
+    /// @brief Shorter of the two tap delays in samples, without modulation
+    ///        (before clamping to maxDelaySamples())
+    [[nodiscard]] float minTapDelaySamples() const noexcept {
+        return std::min(tapADelaySamples_, tapBDelaySamples_);
     }
 
     /// @brief Get maximum delay in samples.
@@ -314,12 +436,26 @@ public:
     }
 
 private:
+    /// True if setDelaySamples() would start a crossfade for some value of
+    /// the curve
+    [[nodiscard]] bool crossfadeStarts(const float* delaySamples, size_t numSamples) const noexcept {
+        const float activePosition = activeIsTapA_ ? tapADelaySamples_ : tapBDelaySamples_;
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float current = std::max(0.0f, delaySamples[i]);
+            if (std::abs(current - activePosition) >= kCrossfadeThresholdSamples) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     DelayLine delayLine_;               ///< Underlying delay buffer
 
     // Tap positions (in samples)
     float tapADelaySamples_ = 0.0f;     ///< Tap A read position
     float tapBDelaySamples_ = 0.0f;     ///< Tap B read position
     float targetDelaySamples_ = 0.0f;   ///< Target delay position
+    float modulationSamples_ = 0.0f;    ///< Offset added to both taps (not crossfaded)
 
     // Tap gains for crossfading
     float tapAGain_ = 1.0f;             ///< Tap A output gain [0, 1]
@@ -123,6 +123,57 @@ public:
     /// @note O(1) time complexity.
     [[nodiscard]] float readLinear(float delaySamples) const noexcept;
 
+    /// @brief Linear-interpolated read as it would have been `samplesAgo` writes ago.
+    ///
+    /// Lets block processors write a whole block first and then evaluate
+    /// per-sample reads relative to where the write head was at each sample:
+    /// readLinear(d, 0) == readLinear(d).
+    ///
+    /// @param delaySamples Number of samples to delay (fractional allowed).
+    /// @param samplesAgo Writes made since the sample being evaluated.
+    /// @return The interpolated sample value.
+    ///
+    /// @note Delay is clamped to [0, maxDelaySamples]; samplesAgo is not.
+    ///       Prepare with enough headroom that delay + samplesAgo stays within
+    ///       the history the caller needs.
+    /// @note O(1) time complexity.
+    [[nodiscard]] float readLinear(float delaySamples, size_t samplesAgo) const noexcept;
+
+    /// @brief Linear-interpolated read as it will be after `pendingWrites` more writes.
+    ///
+    /// The mirror of readLinear(d, samplesAgo): lets a feedback loop read a
+    /// whole chunk of delayed samples before writing any of them back.
+    /// readLinearAhead(d, 0) == readLinear(d).
+    ///
+    /// @param delaySamples Number of samples to delay (fractional allowed).
+    /// @param pendingWrites Writes that will be made before the sample being evaluated.
+    /// @return The interpolated sample value.
+    ///
+    /// @pre The clamped delay is at least pendingWrites samples, so only
+    ///      samples already written are read.
+    /// @note O(1) time complexity.
+    [[nodiscard]] float readLinearAhead(float delaySamples, size_t pendingWrites) const noexcept;
+
+    /// @brief Integer positions and fraction of a linear-interpolated read
+    struct LinearTap {
+        size_t index0;  ///< Delay of the first sample (clamped)
+        size_t index1;  ///< Delay of the second sample (clamped)
+        float frac;     ///< Weight of the second sample
+    };
+
+    /// @brief Split a delay the way readLinear() does, for block readers
+    ///        that walk buffer[(writeHead() + i - index) & mask()]
+    [[nodiscard]] LinearTap linearTap(float delaySamples) const noexcept;
+
+    /// @brief Index of the most recently written sample
+    [[nodiscard]] size_t writeHead() const noexcept { return writeIndex_ - 1; }
+
+    /// @brief Wraparound mask for indices into data()
+    [[nodiscard]] size_t mask() const noexcept { return mask_; }
+
+    /// @brief Raw circular buffer (power-of-2 size)
+    [[nodiscard]] const float* data() const noexcept { return buffer_.data(); }
+
     /// @brief Read a sample at a fractional delay with allpass interpolation.
     ///
     /// @param delaySamples Number of samples to delay (fractional allowed).
@@ -214,6 +265,41 @@ inline float DelayLine::readLinear(float delaySamples) const noexcept {
     return y0 + frac * (y1 - y0);
 }
 
+inline float DelayLine::readLinear(float delaySamples, size_t samplesAgo) const noexcept {
+    const float clampedDelay = std::clamp(delaySamples, 0.0f, static_cast<float>(maxDelaySamples_));
+
+    const float intPart = std::floor(clampedDelay);
+    const float frac = clampedDelay - intPart;
+
+    const size_t index0 = static_cast<size_t>(intPart);
+    const size_t index1 = std::min(index0 + 1, maxDelaySamples_);
+
+    const size_t head = writeIndex_ - 1 - samplesAgo;
+    const float y0 = buffer_[(head - index0) & mask_];
+    const float y1 = buffer_[(head - index1) & mask_];
+
+    return y0 + frac * (y1 - y0);
+}
+
+inline float DelayLine::readLinearAhead(float delaySamples, size_t pendingWrites) const noexcept {
+    const LinearTap tap = linearTap(delaySamples);
+
+    // Where the most recent sample will be once the pending writes are made
+    const size_t head = writeIndex_ - 1 + pendingWrites;
+    const float y0 = buffer_[(head - tap.index0) & mask_];
+    const float y1 = buffer_[(head - tap.index1) & mask_];
+
+    return y0 + tap.frac * (y1 - y0);
+}
+
+inline DelayLine::LinearTap DelayLine::linearTap(float delaySamples) const noexcept {
+    const float clampedDelay = std::clamp(delaySamples, 0.0f, static_cast<float>(maxDelaySamples_));
+
+    const float intPart = std::floor(clampedDelay);
+    const size_t index0 = static_cast<size_t>(intPart);
+    return LinearTap{index0, std::min(index0 + 1, maxDelaySamples_), clampedDelay - intPart};
+}
+
 inline float DelayLine::readAllpass(float delaySamples) noexcept {
     // Clamp delay to valid range [0, maxDelaySamples_]
     const float clampedDelay = std::clamp(delaySamples, 0.0f, static_cast<float>(maxDelaySamples_));
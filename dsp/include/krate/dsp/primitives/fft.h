@@ -1,7 +1,8 @@
 // ==============================================================================
 // Layer 1: DSP Primitive - Fast Fourier Transform
 // ==============================================================================
-// Radix-2 Decimation-in-Time FFT implementation for spectral processing.
+// Real-input FFT for spectral processing. Packs N real samples into an N/2-point
+// complex transform with radix-4 butterflies over split real/imag arrays.
 // Provides forward (real-to-complex) and inverse (complex-to-real) transforms.
 //
 // Constitution Compliance:
@@ -12,7 +13,7 @@
 // - Principle XII: Test-First Development
 //
 // Reference: specs/007-fft-processor/spec.md
-// Algorithm: Cooley-Tukey Radix-2 DIT
+// Algorithm: Real-to-complex packing + Cooley-Tukey Radix-4 (2^2) DIT
 // ==============================================================================
 
 #pragma once
@@ -98,7 +99,13 @@ struct Complex {
 // =============================================================================
 
 /// @brief Core Fast Fourier Transform processor
-/// @note Uses Radix-2 Decimation-in-Time (DIT) algorithm
+/// @note Real-input transform: N real samples are packed as N/2 complex values
+///       (even samples → real, odd samples → imag), transformed with an N/2-point
+///       radix-4 DIT FFT, then split into the N/2+1 bin real spectrum.
+///
+/// The working data lives in split real/imag arrays so every butterfly stage
+/// is a unit-stride loop over contiguous floats, which the compiler turns
+/// into SSE/AVX/NEON code without platform-specific intrinsics.
 class FFT {
 public:
     FFT() noexcept = default;
@@ -121,18 +128,19 @@ public:
     void prepare(size_t fftSize) noexcept {
         size_ = fftSize;
 
-        // Validate power of 2
-        if (fftSize == 0 || !std::has_single_bit(fftSize)) {
+        // Validate power of 2 (N >= 2 so the packed half-size transform exists)
+        if (fftSize < 2 || !std::has_single_bit(fftSize)) {
             size_ = 0;
             return;
         }
 
-        // Number of bits needed to represent indices
-        const size_t numBits = std::countr_zero(fftSize);
+        const size_t half = fftSize / 2;
+        const size_t numBits = static_cast<size_t>(std::countr_zero(half));
+        const double twoPi = 2.0 * std::numbers::pi;
 
-        // T039: Generate bit-reversal LUT
-        bitReversalLUT_.resize(fftSize);
-        for (size_t i = 0; i < fftSize; ++i) {
+        // Bit-reversal LUT for the N/2-point complex transform
+        bitReversalLUT_.resize(half);
+        for (size_t i = 0; i < half; ++i) {
             size_t reversed = 0;
             size_t temp = i;
             for (size_t b = 0; b < numBits; ++b) {
@@ -142,27 +150,49 @@ public:
             bitReversalLUT_[i] = reversed;
         }
 
-        // T040: Precompute twiddle factors W_N^k = exp(-2πik/N)
-        // Only need N/2 factors due to symmetry
-        const size_t halfSize = fftSize / 2;
-        twiddleFactors_.resize(halfSize);
-        const double twoPi = 2.0 * std::numbers::pi;
-        for (size_t k = 0; k < halfSize; ++k) {
+        // Odd log2(N/2) needs one leading radix-2 stage, the rest are radix-4
+        leadingRadix2_ = (numBits % 2) != 0;
+
+        // Per-stage radix-4 twiddles, stored contiguously as
+        // [w1re | w1im | w2re | w2im | w3re | w3im] blocks of L floats each
+        // for every stage with sub-transform length L >= 2.
+        stageTwiddles_.clear();
+        for (size_t quarter = leadingRadix2_ ? 2 : 1; quarter * 4 <= half; quarter *= 4) {
+            if (quarter < 2) continue;  // L == 1 stage uses trivial twiddles
+            const size_t offset = stageTwiddles_.size();
+            stageTwiddles_.resize(offset + 6 * quarter);
+            float* tw = stageTwiddles_.data() + offset;
+            for (size_t k = 0; k < quarter; ++k) {
+                const double angle = -twoPi * static_cast<double>(k)
+                                   / static_cast<double>(4 * quarter);
+                tw[k]               = static_cast<float>(std::cos(angle));
+                tw[quarter + k]     = static_cast<float>(std::sin(angle));
+                tw[2 * quarter + k] = static_cast<float>(std::cos(2.0 * angle));
+                tw[3 * quarter + k] = static_cast<float>(std::sin(2.0 * angle));
+                tw[4 * quarter + k] = static_cast<float>(std::cos(3.0 * angle));
+                tw[5 * quarter + k] = static_cast<float>(std::sin(3.0 * angle));
+            }
+        }
+
+        // Real-split twiddles W_N^k = exp(-2πik/N), k in [0, N/2)
+        splitTwiddleRe_.resize(half);
+        splitTwiddleIm_.resize(half);
+        for (size_t k = 0; k < half; ++k) {
             const double angle = -twoPi * static_cast<double>(k) / static_cast<double>(fftSize);
-            twiddleFactors_[k] = {
-                static_cast<float>(std::cos(angle)),
-                static_cast<float>(std::sin(angle))
-            };
+            splitTwiddleRe_[k] = static_cast<float>(std::cos(angle));
+            splitTwiddleIm_[k] = static_cast<float>(std::sin(angle));
         }
 
-        // Allocate work buffer
-        workBuffer_.resize(fftSize);
+        // Split work buffers (N/2 complex values = N floats total)
+        workRe_.assign(half, 0.0f);
+        workIm_.assign(half, 0.0f);
     }
 
     /// @brief Reset internal work buffers (not LUTs)
     /// @note Real-time safe
     void reset() noexcept {
-        std::fill(workBuffer_.begin(), workBuffer_.end(), Complex{0.0f, 0.0f});
+        std::fill(workRe_.begin(), workRe_.end(), 0.0f);
+        std::fill(workIm_.begin(), workIm_.end(), 0.0f);
     }
 
     // -------------------------------------------------------------------------
@@ -177,51 +207,46 @@ public:
     void forward(const float* input, Complex* output) noexcept {
         if (!isPrepared() || input == nullptr || output == nullptr) return;
 
-        // T041: Radix-2 DIT Forward FFT
+        const size_t half = size_ / 2;
+        float* re = workRe_.data();
+        float* im = workIm_.data();
 
-        // Step 1: Copy input to work buffer with bit-reversal permutation
-        for (size_t i = 0; i < size_; ++i) {
+        // Step 1: Pack z[n] = x[2n] + i*x[2n+1] in bit-reversed order
+        for (size_t i = 0; i < half; ++i) {
             const size_t j = bitReversalLUT_[i];
-            workBuffer_[j] = {input[i], 0.0f};
-        }
-
-        // Step 2: Cooley-Tukey iterative FFT
-        // Process stages from 1-point DFTs up to N-point DFT
-        for (size_t stage = 1; stage < size_; stage <<= 1) {
-            const size_t twiddleStep = size_ / (stage << 1);
-
-            for (size_t k = 0; k < size_; k += (stage << 1)) {
-                size_t twiddleIndex = 0;
-
-                for (size_t j = 0; j < stage; ++j) {
-                    // Butterfly operation
-                    const Complex& twiddle = twiddleFactors_[twiddleIndex];
-                    const size_t evenIdx = k + j;
-                    const size_t oddIdx = evenIdx + stage;
-
-                    const Complex even = workBuffer_[evenIdx];
-                    const Complex odd = workBuffer_[oddIdx] * twiddle;
-
-                    workBuffer_[evenIdx] = even + odd;
-                    workBuffer_[oddIdx] = even - odd;
-
-                    twiddleIndex += twiddleStep;
-                }
-            }
+            re[j] = input[2 * i];
+            im[j] = input[2 * i + 1];
         }
 
-        // T042: Pack output (N/2+1 bins: DC to Nyquist)
-        // For real input, output has conjugate symmetry: X[k] = X[N-k]*
-        // We only need bins 0 to N/2 (inclusive)
-        const size_t numBins = size_ / 2 + 1;
-        for (size_t i = 0; i < numBins; ++i) {
-            output[i] = workBuffer_[i];
+        // Step 2: N/2-point complex FFT, Z[k]
+        transform(re, im);
+
+        // Step 3: Split into the real spectrum
+        //   Fe[k] = (Z[k] + conj(Z[M-k])) / 2        (spectrum of even samples)
+        //   Fo[k] = -i * (Z[k] - conj(Z[M-k])) / 2   (spectrum of odd samples)
+        //   X[k]  = Fe[k] + W_N^k * Fo[k]
+        output[0] = {re[0] + im[0], 0.0f};
+        output[half] = {re[0] - im[0], 0.0f};
+
+        for (size_t k = 1; k < half; ++k) {
+            const size_t m = half - k;
+            const float zr = re[k];
+            const float zi = im[k];
+            const float cr = re[m];
+            const float ci = -im[m];
+
+            const float feRe = 0.5f * (zr + cr);
+            const float feIm = 0.5f * (zi + ci);
+            const float foRe = 0.5f * (zi - ci);
+            const float foIm = -0.5f * (zr - cr);
+
+            const float wr = splitTwiddleRe_[k];
+            const float wi = splitTwiddleIm_[k];
+            output[k] = {
+                feRe + wr * foRe - wi * foIm,
+                feIm + wr * foIm + wi * foRe
+            };
         }
-
-        // DC and Nyquist bins should have zero imaginary part for real input
-        // (enforced by symmetry, but we explicitly zero for numerical stability)
-        output[0].imag = 0.0f;
-        output[size_ / 2].imag = 0.0f;
     }
 
     /// @brief Inverse FFT: complex frequency-domain → real time-domain
@@ -232,67 +257,52 @@ public:
     void inverse(const Complex* input, float* output) noexcept {
         if (!isPrepared() || input == nullptr || output == nullptr) return;
 
-        // T044: Unpack complex spectrum to full N-point complex array
-        // Reconstruct negative frequencies from conjugate symmetry: X[N-k] = X[k]*
-        const size_t halfSize = size_ / 2;
-
-        // DC bin (no conjugate)
-        workBuffer_[0] = input[0];
-
-        // Positive frequencies and their conjugate mirrors
-        for (size_t k = 1; k < halfSize; ++k) {
-            workBuffer_[k] = input[k];
-            workBuffer_[size_ - k] = input[k].conjugate();
+        const size_t half = size_ / 2;
+        float* re = workRe_.data();
+        float* im = workIm_.data();
+
+        // Step 1: Rebuild the packed half-size spectrum, written straight into
+        // bit-reversed positions. DC and Nyquist are treated as purely real.
+        //   Fe[k] = (X[k] + conj(X[M-k])) / 2
+        //   Fo[k] = conj(W_N^k) * (X[k] - conj(X[M-k])) / 2
+        //   Z[k]  = Fe[k] + i * Fo[k]
+        {
+            const float dc = input[0].real;
+            const float nyquist = input[half].real;
+            re[0] = 0.5f * (dc + nyquist);
+            im[0] = 0.5f * (dc - nyquist);
         }
 
-        // Nyquist bin (no conjugate)
-        workBuffer_[halfSize] = input[halfSize];
+        for (size_t k = 1; k < half; ++k) {
+            const Complex x = input[k];
+            const Complex c = input[half - k].conjugate();
 
-        // T045: Radix-2 DIT Inverse FFT
-        // IFFT is FFT with conjugate twiddle factors, followed by 1/N scaling
-        // Or equivalently: conjugate input, FFT, conjugate output, scale
+            const float feRe = 0.5f * (x.real + c.real);
+            const float feIm = 0.5f * (x.imag + c.imag);
+            const float tRe = 0.5f * (x.real - c.real);
+            const float tIm = 0.5f * (x.imag - c.imag);
 
-        // Conjugate the input
-        for (size_t i = 0; i < size_; ++i) {
-            workBuffer_[i].imag = -workBuffer_[i].imag;
-        }
+            const float wr = splitTwiddleRe_[k];
+            const float wi = -splitTwiddleIm_[k];
+            const float foRe = wr * tRe - wi * tIm;
+            const float foIm = wr * tIm + wi * tRe;
 
-        // Apply bit-reversal permutation
-        for (size_t i = 0; i < size_; ++i) {
-            const size_t j = bitReversalLUT_[i];
-            if (i < j) {
-                std::swap(workBuffer_[i], workBuffer_[j]);
-            }
+            const size_t j = bitReversalLUT_[k];
+            re[j] = feRe - foIm;
+            im[j] = feIm + foRe;
         }
 
-        // Cooley-Tukey iterative FFT
-        for (size_t stage = 1; stage < size_; stage <<= 1) {
-            const size_t twiddleStep = size_ / (stage << 1);
-
-            for (size_t k = 0; k < size_; k += (stage << 1)) {
-                size_t twiddleIndex = 0;
-
-                for (size_t j = 0; j < stage; ++j) {
-                    const Complex& twiddle = twiddleFactors_[twiddleIndex];
-                    const size_t evenIdx = k + j;
-                    const size_t oddIdx = evenIdx + stage;
-
-                    const Complex even = workBuffer_[evenIdx];
-                    const Complex odd = workBuffer_[oddIdx] * twiddle;
-
-                    workBuffer_[evenIdx] = even + odd;
-                    workBuffer_[oddIdx] = even - odd;
-
-                    twiddleIndex += twiddleStep;
-                }
-            }
-        }
-
-        // Conjugate and scale output (1/N normalization)
-        const float scale = 1.0f / static_cast<float>(size_);
-        for (size_t i = 0; i < size_; ++i) {
-            // Output should be real; take conjugate then real part (imag should be ~0)
-            output[i] = workBuffer_[i].real * scale;
+        // Step 2: Inverse transform via the swap identity
+        //   IFFT(Z) = swap(FFT(swap(Z))) / M, swap(a + ib) = b + ia
+        // With split storage the swaps are free: run the forward kernel with
+        // the real and imaginary arrays exchanged.
+        transform(im, re);
+
+        // Step 3: Unpack z[n] into even/odd output samples with 1/M scaling
+        const float scale = 1.0f / static_cast<float>(half);
+        for (size_t n = 0; n < half; ++n) {
+            output[2 * n] = re[n] * scale;
+            output[2 * n + 1] = im[n] * scale;
         }
     }
 
@@ -310,10 +320,107 @@ public:
     [[nodiscard]] bool isPrepared() const noexcept { return size_ > 0; }
 
 private:
+    // -------------------------------------------------------------------------
+    // Complex Kernel
+    // -------------------------------------------------------------------------
+
+    /// @brief In-place N/2-point forward complex FFT on bit-reversed split data
+    ///
+    /// Radix-4 stages are the radix-2^2 form of two fused DIT radix-2 stages,
+    /// so the ordinary bit-reversed input order is kept. For sub-transforms
+    /// A, B, C, D of length L at offsets 0, L, 2L, 3L:
+    ///   b = w2*B, c = w1*C, d = w3*D   (w_n = W_4L^(n*k))
+    ///   t0 = A + b, t1 = A - b, t2 = c + d, t3 = c - d
+    ///   X[k] = t0 + t2, X[k+L] = t1 - i*t3, X[k+2L] = t0 - t2, X[k+3L] = t1 + i*t3
+    void transform(float* re, float* im) const noexcept {
+        const size_t half = size_ / 2;
+        size_t quarter = 1;
+
+        if (leadingRadix2_) {
+            for (size_t i = 0; i < half; i += 2) {
+                const float ar = re[i], ai = im[i];
+                const float br = re[i + 1], bi = im[i + 1];
+                re[i] = ar + br;
+                im[i] = ai + bi;
+                re[i + 1] = ar - br;
+                im[i + 1] = ai - bi;
+            }
+            quarter = 2;
+        } else if (half >= 4) {
+            // First radix-4 stage (L == 1): all twiddles are unity
+            for (size_t i = 0; i < half; i += 4) {
+                const float t0r = re[i] + re[i + 1], t0i = im[i] + im[i + 1];
+                const float t1r = re[i] - re[i + 1], t1i = im[i] - im[i + 1];
+                const float t2r = re[i + 2] + re[i + 3], t2i = im[i + 2] + im[i + 3];
+                const float t3r = re[i + 2] - re[i + 3], t3i = im[i + 2] - im[i + 3];
+                re[i] = t0r + t2r;
+                im[i] = t0i + t2i;
+                re[i + 1] = t1r + t3i;
+                im[i + 1] = t1i - t3r;
+                re[i + 2] = t0r - t2r;
+                im[i + 2] = t0i - t2i;
+                re[i + 3] = t1r - t3i;
+                im[i + 3] = t1i + t3r;
+            }
+            quarter = 4;
+        }
+
+        const float* tw = stageTwiddles_.data();
+        for (; quarter * 4 <= half; quarter *= 4) {
+            const size_t L = quarter;
+            const float* w1r = tw;
+            const float* w1i = tw + L;
+            const float* w2r = tw + 2 * L;
+            const float* w2i = tw + 3 * L;
+            const float* w3r = tw + 4 * L;
+            const float* w3i = tw + 5 * L;
+            tw += 6 * L;
+
+            for (size_t base = 0; base < half; base += 4 * L) {
+                float* ar = re + base;
+                float* ai = im + base;
+                float* br = ar + L;
+                float* bi = ai + L;
+                float* cr = br + L;
+                float* ci = bi + L;
+                float* dr = cr + L;
+                float* di = ci + L;
+
+                // Unit-stride butterfly loop (auto-vectorized)
+                for (size_t k = 0; k < L; ++k) {
+                    const float bRe = br[k] * w2r[k] - bi[k] * w2i[k];
+                    const float bIm = br[k] * w2i[k] + bi[k] * w2r[k];
+                    const float cRe = cr[k] * w1r[k] - ci[k] * w1i[k];
+                    const float cIm = cr[k] * w1i[k] + ci[k] * w1r[k];
+                    const float dRe = dr[k] * w3r[k] - di[k] * w3i[k];
+                    const float dIm = dr[k] * w3i[k] + di[k] * w3r[k];
+
+                    const float t0r = ar[k] + bRe, t0i = ai[k] + bIm;
+                    const float t1r = ar[k] - bRe, t1i = ai[k] - bIm;
+                    const float t2r = cRe + dRe, t2i = cIm + dIm;
+                    const float t3r = cRe - dRe, t3i = cIm - dIm;
+
+                    ar[k] = t0r + t2r;
+                    ai[k] = t0i + t2i;
+                    br[k] = t1r + t3i;
+                    bi[k] = t1i - t3r;
+                    cr[k] = t0r - t2r;
+                    ci[k] = t0i - t2i;
+                    dr[k] = t1r - t3i;
+                    di[k] = t1i + t3r;
+                }
+            }
+        }
+    }
+
     size_t size_ = 0;
-    std::vector<size_t> bitReversalLUT_;
-    std::vector<Complex> twiddleFactors_;
-    std::vector<Complex> workBuffer_;
+    bool leadingRadix2_ = false;
+    std::vector<size_t> bitReversalLUT_;  // N/2 entries
+    std::vector<float> stageTwiddles_;    // Radix-4 stage twiddles (split)
+    std::vector<float> splitTwiddleRe_;   // Real-split twiddles W_N^k (real)
+    std::vector<float> splitTwiddleIm_;   // Real-split twiddles W_N^k (imag)
+    std::vector<float> workRe_;           // N/2 real parts
+    std::vector<float> workIm_;           // N/2 imaginary parts
 };
 
 } // namespace DSP
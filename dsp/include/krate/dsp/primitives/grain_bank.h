@@ -0,0 +1,119 @@
+// ==============================================================================
+// Layer 1: DSP Primitive - Grain Bank
+// ==============================================================================
+// Structure-of-arrays grain storage for block-based granular rendering.
+// Part of Granular Delay feature (spec 034)
+//
+// Where GrainPool hands out individual Grain structs, GrainBank keeps each
+// per-grain field in its own contiguous array so a renderer can stream one
+// grain's state through a tight per-sample loop, and keeps the active set as
+// a dense, oldest-first slot list so iteration never visits idle grains.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept, no allocations in process)
+// - Principle III: Modern C++ (C++20, value semantics)
+// - Principle IX: Layer 1 (no dependencies on Layer 2+)
+// ==============================================================================
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace Krate::DSP {
+
+/// Fixed-capacity structure-of-arrays grain storage with oldest-grain stealing.
+///
+/// Slots are indices into the public state arrays. acquire() is O(1): slots
+/// come from a free stack, and when the bank is full the oldest active grain
+/// is stolen from the head of the active ring. Active slots are kept in
+/// trigger order, so activeSlot(0) is always the oldest grain.
+class GrainBank {
+public:
+    static constexpr size_t kMaxGrains = 128;
+    static_assert((kMaxGrains & (kMaxGrains - 1)) == 0, "active ring needs a power-of-two size");
+
+    // =========================================================================
+    // Per-Grain State (indexed by slot)
+    // =========================================================================
+
+    std::array<float, kMaxGrains> readPosition{};       ///< Delay (samples) to read from
+    std::array<float, kMaxGrains> readIncrement{};      ///< Delay advance per sample (>= 0)
+    std::array<float, kMaxGrains> envelopePhase{};      ///< Progress through envelope [0, 1]
+    std::array<float, kMaxGrains> envelopeIncrement{};  ///< Envelope phase advance per sample
+    std::array<float, kMaxGrains> gainL{};              ///< Amplitude * left pan gain
+    std::array<float, kMaxGrains> gainR{};              ///< Amplitude * right pan gain
+    std::array<size_t, kMaxGrains> startSample{};       ///< Sample the grain was triggered on
+
+    GrainBank() noexcept { reset(); }
+
+    /// Deactivate all grains
+    void reset() noexcept {
+        activeHead_ = 0;
+        activeCount_ = 0;
+        freeCount_ = kMaxGrains;
+        for (size_t i = 0; i < kMaxGrains; ++i) {
+            // Pop order 0, 1, 2, ... for deterministic slot assignment
+            freeSlots_[i] = kMaxGrains - 1 - i;
+        }
+    }
+
+    /// Acquire a slot for a new grain, stealing the oldest grain if full
+    /// @param currentSample Sample the grain starts on (stored in startSample)
+    /// @return Slot index; the caller initializes the state arrays
+    [[nodiscard]] size_t acquire(size_t currentSample) noexcept {
+        size_t slot;
+        if (freeCount_ > 0) {
+            slot = freeSlots_[--freeCount_];
+        } else {
+            // Full - steal the oldest grain and move it to the back
+            slot = active_[activeHead_];
+            activeHead_ = (activeHead_ + 1) & kActiveMask;
+            --activeCount_;
+        }
+
+        active_[(activeHead_ + activeCount_) & kActiveMask] = slot;
+        ++activeCount_;
+        startSample[slot] = currentSample;
+        return slot;
+    }
+
+    /// Visit every active slot in trigger order, releasing those for which
+    /// @p keep returns false. Surviving slots keep their relative order.
+    /// @param keep Callable `bool(size_t slot)`
+    template <typename Fn>
+    void retainIf(Fn&& keep) noexcept {
+        size_t kept = 0;
+        for (size_t i = 0; i < activeCount_; ++i) {
+            const size_t slot = active_[(activeHead_ + i) & kActiveMask];
+            if (keep(slot)) {
+                active_[(activeHead_ + kept) & kActiveMask] = slot;
+                ++kept;
+            } else {
+                freeSlots_[freeCount_++] = slot;
+            }
+        }
+        activeCount_ = kept;
+    }
+
+    /// Number of active grains
+    [[nodiscard]] size_t activeCount() const noexcept { return activeCount_; }
+
+    /// Slot of the i-th active grain (0 = oldest)
+    [[nodiscard]] size_t activeSlot(size_t index) const noexcept {
+        return active_[(activeHead_ + index) & kActiveMask];
+    }
+
+    /// Get maximum grain capacity
+    [[nodiscard]] static constexpr size_t maxGrains() noexcept { return kMaxGrains; }
+
+private:
+    static constexpr size_t kActiveMask = kMaxGrains - 1;
+
+    std::array<size_t, kMaxGrains> active_{};     ///< Ring of active slots, oldest at activeHead_
+    std::array<size_t, kMaxGrains> freeSlots_{};
+    size_t activeHead_ = 0;
+    size_t activeCount_ = 0;
+    size_t freeCount_ = 0;
+};
+
+}  // namespace Krate::DSP
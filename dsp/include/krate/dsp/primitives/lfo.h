@@ -15,6 +15,7 @@
 #pragma once
 
 #include <krate/dsp/core/note_value.h>
+#include <krate/dsp/core/table_registry.h>
 
 #include <algorithm>
 #include <array>
@@ -22,7 +23,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <numbers>
-#include <vector>
+#include <span>
 
 namespace Krate {
 namespace DSP {
@@ -300,50 +301,49 @@ private:
     // =========================================================================
 
     void generateWavetables() noexcept {
-        // Resize wavetables
-        for (auto& table : wavetables_) {
-            table.resize(kTableSize);
+        // Tables are identical for every LFO, so share them across instances
+        for (size_t w = 0; w < wavetables_.size(); ++w) {
+            const TableKey key{TableFamily::LFOWaveform, static_cast<uint8_t>(w), kTableSize};
+            wavetables_[w] = TableRegistry::instance().acquire(key, [w](float* table, size_t size) {
+                fillWavetable(static_cast<Waveform>(w), table, size);
+            });
         }
+    }
 
+    static void fillWavetable(Waveform waveform, float* table, size_t size) noexcept {
         constexpr double twoPi = 2.0 * std::numbers::pi;
 
-        // Generate Sine wavetable
-        for (size_t i = 0; i < kTableSize; ++i) {
-            double phase = static_cast<double>(i) / static_cast<double>(kTableSize);
-            wavetables_[static_cast<size_t>(Waveform::Sine)][i] =
-                static_cast<float>(std::sin(twoPi * phase));
-        }
-
-        // Generate Triangle wavetable (0->1->0->-1->0 but starting at 0)
-        // Shape: rise from 0 to 1 in first quarter, fall to -1 by 3/4, rise back to 0
-        for (size_t i = 0; i < kTableSize; ++i) {
-            double phase = static_cast<double>(i) / static_cast<double>(kTableSize);
-            float value;
-            if (phase < 0.25) {
-                // 0 to 1
-                value = static_cast<float>(phase * 4.0);
-            } else if (phase < 0.75) {
-                // 1 to -1
-                value = static_cast<float>(2.0 - phase * 4.0);
-            } else {
-                // -1 to 0
-                value = static_cast<float>(phase * 4.0 - 4.0);
+        for (size_t i = 0; i < size; ++i) {
+            const double phase = static_cast<double>(i) / static_cast<double>(size);
+            float value = 0.0f;
+
+            switch (waveform) {
+                case Waveform::Sine:
+                    value = static_cast<float>(std::sin(twoPi * phase));
+                    break;
+                case Waveform::Triangle:
+                    // 0->1->0->-1->0: rise to 1 in the first quarter,
+                    // fall to -1 by 3/4, rise back to 0
+                    if (phase < 0.25) {
+                        value = static_cast<float>(phase * 4.0);
+                    } else if (phase < 0.75) {
+                        value = static_cast<float>(2.0 - phase * 4.0);
+                    } else {
+                        value = static_cast<float>(phase * 4.0 - 4.0);
+                    }
+                    break;
+                case Waveform::Sawtooth:
+                    // -1 to +1
+                    value = static_cast<float>(2.0 * phase - 1.0);
+                    break;
+                case Waveform::Square:
+                    // +1 for first half, -1 for second half
+                    value = (phase < 0.5) ? 1.0f : -1.0f;
+                    break;
+                default:
+                    break;
             }
-            wavetables_[static_cast<size_t>(Waveform::Triangle)][i] = value;
-        }
-
-        // Generate Sawtooth wavetable (-1 to +1)
-        for (size_t i = 0; i < kTableSize; ++i) {
-            double phase = static_cast<double>(i) / static_cast<double>(kTableSize);
-            wavetables_[static_cast<size_t>(Waveform::Sawtooth)][i] =
-                static_cast<float>(2.0 * phase - 1.0);
-        }
-
-        // Generate Square wavetable (+1 for first half, -1 for second half)
-        for (size_t i = 0; i < kTableSize; ++i) {
-            double phase = static_cast<double>(i) / static_cast<double>(kTableSize);
-            wavetables_[static_cast<size_t>(Waveform::Square)][i] =
-                (phase < 0.5) ? 1.0f : -1.0f;
+            table[i] = value;
         }
     }
 
@@ -461,8 +461,8 @@ private:
     float previousRandom_ = 0.0f;  // SmoothRandom: previous target
     float targetRandom_ = 0.0f;    // SmoothRandom: current target
 
-    // Wavetables (Sine, Triangle, Sawtooth, Square)
-    std::array<std::vector<float>, 4> wavetables_;
+    // Shared read-only wavetables from TableRegistry (Sine, Triangle, Sawtooth, Square)
+    std::array<std::span<const float>, 4> wavetables_{};
 
     // Crossfade state (for smooth waveform transitions)
     Waveform previousWaveform_ = Waveform::Sine;  // Waveform we were crossfading from (for reference)
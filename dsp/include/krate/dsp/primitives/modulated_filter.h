@@ -0,0 +1,367 @@
+// ==============================================================================
+// Layer 1: DSP Primitive - Modulated Filter
+// ==============================================================================
+// Trapezoidal state-variable filter (Simper/Cytomic TPT SVF) driven by a
+// control-rate coefficient engine. Exact coefficients are computed every
+// controlInterval samples and interpolated linearly per sample in between, so
+// LFO/envelope cutoff sweeps cost one coefficient calculation per interval
+// instead of one per sample.
+//
+// The SVF form is used (rather than biquad direct form) because its
+// coefficients can be interpolated without transient blow-ups, and its
+// steady-state response is identical to the RBJ cookbook Biquad for every
+// FilterType.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept, no allocations)
+// - Principle III: Modern C++ (C++20, value semantics)
+// - Principle IX: Layer 1 (depends only on Layer 0 / Biquad definitions)
+// - Principle X: DSP Constraints (denormal flushing, NaN reset)
+//
+// Reference: Andrew Simper, "Linear Trapezoidal Integrated SVF" (Cytomic)
+// ==============================================================================
+
+#pragma once
+
+#include <krate/dsp/core/db_utils.h>
+#include <krate/dsp/core/math_constants.h>
+#include <krate/dsp/primitives/biquad.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Krate {
+namespace DSP {
+
+// =============================================================================
+// SVF Coefficients
+// =============================================================================
+
+/// @brief Trapezoidal SVF coefficients
+///
+/// a1..a3 drive the integrators; the output is m0*input + m1*band + m2*low.
+struct SVFCoefficients {
+    float a1 = 1.0f;
+    float a2 = 0.0f;
+    float a3 = 0.0f;
+    float m0 = 1.0f;  ///< Input mix
+    float m1 = 0.0f;  ///< Bandpass mix
+    float m2 = 0.0f;  ///< Lowpass mix
+
+    /// Calculate coefficients matching BiquadCoefficients::calculate()
+    /// @param type Filter response type
+    /// @param frequency Cutoff/center frequency in Hz
+    /// @param Q Quality factor (0.1 to 30)
+    /// @param gainDb Gain in dB for shelf/peak types (ignored for others)
+    /// @param sampleRate Sample rate in Hz
+    [[nodiscard]] static SVFCoefficients calculate(
+        FilterType type,
+        float frequency,
+        float Q,
+        float gainDb,
+        float sampleRate
+    ) noexcept {
+        if (sampleRate <= 0.0f) {
+            return SVFCoefficients{};  // Bypass
+        }
+
+        frequency = detail::clampFrequency(frequency, sampleRate);
+        Q = detail::clampQ(Q);
+
+        float g = std::tan(kPi * frequency / sampleRate);
+        float k = 1.0f / Q;
+        float m0 = 0.0f, m1 = 0.0f, m2 = 0.0f;
+
+        switch (type) {
+            case FilterType::Lowpass:
+                m2 = 1.0f;
+                break;
+            case FilterType::Highpass:
+                m0 = 1.0f;
+                m1 = -k;
+                m2 = -1.0f;
+                break;
+            case FilterType::Bandpass:
+                // Constant 0 dB peak gain, as the cookbook bandpass
+                m1 = k;
+                break;
+            case FilterType::Notch:
+                m0 = 1.0f;
+                m1 = -k;
+                break;
+            case FilterType::Allpass:
+                m0 = 1.0f;
+                m1 = -2.0f * k;
+                break;
+            case FilterType::LowShelf: {
+                const float A = std::pow(10.0f, gainDb / 40.0f);
+                g /= std::sqrt(A);
+                m0 = 1.0f;
+                m1 = k * (A - 1.0f);
+                m2 = A * A - 1.0f;
+                break;
+            }
+            case FilterType::HighShelf: {
+                const float A = std::pow(10.0f, gainDb / 40.0f);
+                g *= std::sqrt(A);
+                m0 = A * A;
+                m1 = k * (1.0f - A) * A;
+                m2 = 1.0f - A * A;
+                break;
+            }
+            case FilterType::Peak: {
+                const float A = std::pow(10.0f, gainDb / 40.0f);
+                k = 1.0f / (Q * A);
+                m0 = 1.0f;
+                m1 = k * (A * A - 1.0f);
+                break;
+            }
+        }
+
+        SVFCoefficients coeffs;
+        coeffs.a1 = 1.0f / (1.0f + g * (g + k));
+        coeffs.a2 = g * coeffs.a1;
+        coeffs.a3 = g * coeffs.a2;
+        coeffs.m0 = m0;
+        coeffs.m1 = m1;
+        coeffs.m2 = m2;
+        return coeffs;
+    }
+};
+
+// =============================================================================
+// ModulatedFilter Class
+// =============================================================================
+
+/// @brief SVF with control-rate coefficient calculation and per-sample
+///        interpolation, for modulated cutoff/Q/gain.
+///
+/// Parameter setters only record the new values. At the start of each
+/// control segment (every controlInterval samples) the exact coefficients
+/// for the current parameters are computed, and the coefficients ramp
+/// linearly from where they are to that target across the segment. With
+/// static parameters no coefficients are recalculated at all.
+///
+/// @par Usage
+/// @code
+/// ModulatedFilter filter;
+/// filter.prepare(44100.0);
+/// filter.setParameters(FilterType::Lowpass, 800.0f, 2.0f);
+/// filter.snapToTarget();
+///
+/// // Per block, with an LFO-driven cutoff curve in Hz
+/// filter.processBlock(buffer, cutoffHz, numSamples);
+/// @endcode
+class ModulatedFilter {
+public:
+    static constexpr size_t kDefaultControlInterval = 16;
+    static constexpr size_t kMaxControlInterval = 256;
+
+    // =========================================================================
+    // Lifecycle
+    // =========================================================================
+
+    /// @brief Set the sample rate and snap to the current parameters
+    void prepare(double sampleRate) noexcept {
+        sampleRate_ = static_cast<float>(sampleRate);
+        snapToTarget();
+        reset();
+    }
+
+    /// @brief Clear filter state (coefficients are kept)
+    void reset() noexcept {
+        ic1eq_ = 0.0f;
+        ic2eq_ = 0.0f;
+    }
+
+    // =========================================================================
+    // Configuration
+    // =========================================================================
+
+    /// @brief Samples between exact coefficient calculations
+    /// @param samples Interval, clamped to [1, kMaxControlInterval]
+    void setControlInterval(size_t samples) noexcept {
+        controlInterval_ = std::clamp(samples, size_t{1}, kMaxControlInterval);
+    }
+
+    [[nodiscard]] size_t getControlInterval() const noexcept { return controlInterval_; }
+
+    /// @brief Set all target parameters (applied from the next control segment)
+    void setParameters(FilterType type, float cutoffHz, float Q, float gainDb = 0.0f) noexcept {
+        if (type != type_ || cutoffHz != cutoffHz_ || Q != q_ || gainDb != gainDb_) {
+            type_ = type;
+            cutoffHz_ = cutoffHz;
+            q_ = Q;
+            gainDb_ = gainDb;
+            dirty_ = true;
+        }
+    }
+
+    void setType(FilterType type) noexcept { setParameters(type, cutoffHz_, q_, gainDb_); }
+    void setCutoff(float hz) noexcept { setParameters(type_, hz, q_, gainDb_); }
+    void setQ(float Q) noexcept { setParameters(type_, cutoffHz_, Q, gainDb_); }
+    void setGain(float dB) noexcept { setParameters(type_, cutoffHz_, q_, dB); }
+
+    [[nodiscard]] FilterType getType() const noexcept { return type_; }
+    [[nodiscard]] float getCutoff() const noexcept { return cutoffHz_; }
+    [[nodiscard]] float getQ() const noexcept { return q_; }
+    [[nodiscard]] float getGain() const noexcept { return gainDb_; }
+
+    /// @brief Jump to the exact coefficients for the current parameters
+    void snapToTarget() noexcept {
+        coeffs_ = SVFCoefficients::calculate(type_, cutoffHz_, q_, gainDb_, sampleRate_);
+        segmentRemaining_ = 0;
+        dirty_ = false;
+    }
+
+    /// @brief Coefficients in use for the next sample
+    [[nodiscard]] const SVFCoefficients& coefficients() const noexcept { return coeffs_; }
+
+    // =========================================================================
+    // Processing
+    // =========================================================================
+
+    /// @brief Process one sample
+    [[nodiscard]] float process(float input) noexcept {
+        if (segmentRemaining_ == 0 && dirty_) {
+            beginSegment(cutoffHz_, controlInterval_);
+        }
+        run(&input, 1);
+        return input;
+    }
+
+    /// @brief Process a block in-place with the parameters last set
+    void processBlock(float* buffer, size_t numSamples) noexcept {
+        size_t i = 0;
+        while (i < numSamples) {
+            if (segmentRemaining_ == 0 && dirty_) {
+                beginSegment(cutoffHz_, controlInterval_);
+            }
+            // Static coefficients run to the end of the block
+            const size_t count = (segmentRemaining_ == 0)
+                ? numSamples - i
+                : std::min(segmentRemaining_, numSamples - i);
+            run(buffer + i, count);
+            i += count;
+        }
+    }
+
+    /// @brief Process a block in-place with a per-sample cutoff curve
+    ///
+    /// The curve is sampled at the end of each control segment; coefficients
+    /// are exact there and linearly interpolated in between.
+    ///
+    /// @param buffer Samples (modified in place)
+    /// @param cutoffHz Cutoff for each sample, numSamples values
+    /// @param numSamples Number of samples
+    void processBlock(float* buffer, const float* cutoffHz, size_t numSamples) noexcept {
+        if (numSamples == 0) {
+            return;
+        }
+
+        size_t i = 0;
+        while (i < numSamples) {
+            if (segmentRemaining_ == 0) {
+                const size_t length = std::min(controlInterval_, numSamples - i);
+                beginSegment(cutoffHz[i + length - 1], length);
+            }
+            const size_t count = std::min(segmentRemaining_, numSamples - i);
+            run(buffer + i, count);
+            i += count;
+        }
+        cutoffHz_ = cutoffHz[numSamples - 1];
+    }
+
+private:
+    /// @brief Start ramping towards the exact coefficients for cutoffHz
+    void beginSegment(float cutoffHz, size_t length) noexcept {
+        target_ = SVFCoefficients::calculate(type_, cutoffHz, q_, gainDb_, sampleRate_);
+        const float invLength = 1.0f / static_cast<float>(length);
+        step_.a1 = (target_.a1 - coeffs_.a1) * invLength;
+        step_.a2 = (target_.a2 - coeffs_.a2) * invLength;
+        step_.a3 = (target_.a3 - coeffs_.a3) * invLength;
+        step_.m0 = (target_.m0 - coeffs_.m0) * invLength;
+        step_.m1 = (target_.m1 - coeffs_.m1) * invLength;
+        step_.m2 = (target_.m2 - coeffs_.m2) * invLength;
+        segmentRemaining_ = length;
+        dirty_ = false;
+    }
+
+    /// @brief Filter count samples in place, ramping if a segment is active
+    /// @pre count <= segmentRemaining_ when a segment is active
+    void run(float* buffer, size_t count) noexcept {
+        if (segmentRemaining_ == 0) {
+            runSamples<false>(buffer, count);
+            return;
+        }
+
+        runSamples<true>(buffer, count);
+        segmentRemaining_ -= count;
+        if (segmentRemaining_ == 0) {
+            coeffs_ = target_;  // Land exactly on the target
+        }
+    }
+
+    /// @brief SVF loop; coefficients and state are held in locals because
+    ///        the buffer could otherwise alias them and force reloads
+    template <bool Ramp>
+    void runSamples(float* buffer, size_t count) noexcept {
+        SVFCoefficients c = coeffs_;
+        const SVFCoefficients d = step_;
+        float ic1eq = ic1eq_;
+        float ic2eq = ic2eq_;
+
+        for (size_t i = 0; i < count; ++i) {
+            if constexpr (Ramp) {
+                c.a1 += d.a1;
+                c.a2 += d.a2;
+                c.a3 += d.a3;
+                c.m0 += d.m0;
+                c.m1 += d.m1;
+                c.m2 += d.m2;
+            }
+
+            const float input = buffer[i];
+            if (!detail::isFiniteBits(input)) {
+                ic1eq = 0.0f;
+                ic2eq = 0.0f;
+                buffer[i] = 0.0f;
+                continue;
+            }
+
+            const float v3 = input - ic2eq;
+            const float v1 = c.a1 * ic1eq + c.a2 * v3;
+            const float v2 = ic2eq + c.a2 * ic1eq + c.a3 * v3;
+            ic1eq = detail::flushDenormal(2.0f * v1 - ic1eq);
+            ic2eq = detail::flushDenormal(2.0f * v2 - ic2eq);
+            buffer[i] = c.m0 * input + c.m1 * v1 + c.m2 * v2;
+        }
+
+        coeffs_ = c;
+        ic1eq_ = ic1eq;
+        ic2eq_ = ic2eq;
+    }
+
+    // Parameters
+    FilterType type_ = FilterType::Lowpass;
+    float cutoffHz_ = 1000.0f;
+    float q_ = kButterworthQ;
+    float gainDb_ = 0.0f;
+    float sampleRate_ = 44100.0f;
+    size_t controlInterval_ = kDefaultControlInterval;
+
+    // Coefficient engine
+    SVFCoefficients coeffs_;   ///< In use
+    SVFCoefficients target_;   ///< End of current segment
+    SVFCoefficients step_;     ///< Per-sample increment
+    size_t segmentRemaining_ = 0;
+    bool dirty_ = true;
+
+    // Integrator states
+    float ic1eq_ = 0.0f;
+    float ic2eq_ = 0.0f;
+};
+
+} // namespace DSP
+} // namespace Krate
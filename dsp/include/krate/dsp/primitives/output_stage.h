@@ -0,0 +1,309 @@
+// ==============================================================================
+// Layer 1: DSP Primitive - Output Stage
+// ==============================================================================
+// Fused tail of an effect's process(): dry capture, Mid/Side width on the wet
+// signal, dry/wet mix, equal-power crossfade from an outgoing signal and
+// output gain, applied in a single pass over the block.
+//
+// Per output sample the stage is one linear combination:
+//
+//   wet'  = M/S width of (wetL, wetR)
+//   out   = fadeIn * (dry * (1 - mix) + wet' * mix) + fadeOut * from
+//   out  *= gain
+//
+// While every smoother has settled and no crossfade runs, the coefficients
+// are constant for the block and the loop is a plain multiply-add over the
+// channels that the compiler vectorizes. While something ramps the same
+// coefficients are evaluated per sample.
+//
+// Stages left at their identity value (width 1, mix 1, gain 1, no crossfade)
+// cost nothing beyond the shared pass.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept, allocation only in prepare())
+// - Principle IX: Layer 1 (depends only on Layer 0 and smoother.h)
+// ==============================================================================
+
+#pragma once
+
+#include <krate/dsp/core/crossfade_utils.h>
+#include <krate/dsp/primitives/smoother.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Krate {
+namespace DSP {
+
+/// @brief Single-pass dry/width/mix/crossfade/gain stage for effect outputs.
+///
+/// @par Usage
+/// @code
+/// stage.captureDry(left, right, numSamples);   // before the wet processing
+/// ... process left/right in-place into the wet signal ...
+/// stage.process(left, right, numSamples);      // width, mix, gain in one pass
+/// @endcode
+///
+/// Samples past the captured dry length (blocks larger than maxBlockSize)
+/// get width and gain but no dry/wet mix, and do not advance the mix ramp.
+class OutputStage {
+public:
+    /// Default crossfade duration for startCrossfade()
+    static constexpr float kDefaultCrossfadeTimeMs = 50.0f;
+
+    /// @brief Allocate the dry buffers and configure the ramps
+    /// @param sampleRate Sample rate in Hz
+    /// @param maxBlockSize Largest block passed to captureDry()
+    /// @param smoothingTimeMs Smoothing time for width, mix and gain
+    void prepare(double sampleRate, size_t maxBlockSize,
+                 float smoothingTimeMs = kDefaultSmoothingTimeMs) {
+        sampleRate_ = static_cast<float>(sampleRate);
+        dryLeft_.assign(maxBlockSize, 0.0f);
+        dryRight_.assign(maxBlockSize, 0.0f);
+        dryCount_ = 0;
+
+        widthSmoother_.configure(smoothingTimeMs, sampleRate_);
+        mixSmoother_.configure(smoothingTimeMs, sampleRate_);
+        gainSmoother_.configure(smoothingTimeMs, sampleRate_);
+        setCrossfadeTime(kDefaultCrossfadeTimeMs);
+        snapParameters();
+    }
+
+    /// @brief Snap the ramps to their targets and drop any captured dry signal
+    void reset() noexcept {
+        snapParameters();
+        dryCount_ = 0;
+        crossfadePosition_ = 1.0f;
+        crossfadeActive_ = false;
+    }
+
+    // =========================================================================
+    // Parameters
+    // =========================================================================
+
+    /// @brief Set the stereo width factor (0 = mono, 1 = unchanged, 2 = double side)
+    void setWidth(float factor) noexcept {
+        widthSmoother_.setTarget(std::clamp(factor, 0.0f, 2.0f));
+    }
+
+    /// @brief Set the dry/wet mix (0 = dry, 1 = wet)
+    void setMix(float wet) noexcept {
+        mixSmoother_.setTarget(std::clamp(wet, 0.0f, 1.0f));
+    }
+
+    /// @brief Set the linear output gain
+    void setOutputGain(float gain) noexcept {
+        gainSmoother_.setTarget(std::max(gain, 0.0f));
+    }
+
+    /// @brief Jump width, mix and gain to their targets
+    void snapParameters() noexcept {
+        widthSmoother_.snapToTarget();
+        mixSmoother_.snapToTarget();
+        gainSmoother_.snapToTarget();
+    }
+
+    /// @brief Set the duration of crossfades started by startCrossfade()
+    void setCrossfadeTime(float ms) noexcept {
+        crossfadeIncrement_ = crossfadeIncrement(ms, static_cast<double>(sampleRate_));
+    }
+
+    /// @brief Start an equal-power crossfade from the signal passed to process()
+    void startCrossfade() noexcept {
+        crossfadePosition_ = 0.0f;
+        crossfadeActive_ = true;
+    }
+
+    /// @brief True while a crossfade is still running
+    [[nodiscard]] bool isCrossfading() const noexcept {
+        return crossfadeActive_;
+    }
+
+    // =========================================================================
+    // Processing
+    // =========================================================================
+
+    /// @brief Store the dry signal for the next process() call
+    void captureDry(const float* left, const float* right, size_t numSamples) noexcept {
+        dryCount_ = std::min(numSamples, dryLeft_.size());
+        std::copy(left, left + dryCount_, dryLeft_.data());
+        std::copy(right, right + dryCount_, dryRight_.data());
+    }
+
+    /// @brief Store the dry signal for the next processMono() call
+    void captureDry(const float* buffer, size_t numSamples) noexcept {
+        dryCount_ = std::min(numSamples, dryLeft_.size());
+        std::copy(buffer, buffer + dryCount_, dryLeft_.data());
+    }
+
+    /// @brief Captured dry signal (valid until the next process() call)
+    [[nodiscard]] const float* dryLeft() const noexcept { return dryLeft_.data(); }
+    [[nodiscard]] const float* dryRight() const noexcept { return dryRight_.data(); }
+
+    /// @brief Apply width, mix, crossfade and gain to the wet signal in-place
+    /// @param left Wet left channel, replaced by the output
+    /// @param right Wet right channel, replaced by the output
+    /// @param numSamples Number of samples per channel
+    /// @param fromLeft Outgoing left signal of a running crossfade (or nullptr)
+    /// @param fromRight Outgoing right signal of a running crossfade (or nullptr)
+    void process(float* left, float* right, size_t numSamples,
+                 const float* fromLeft = nullptr,
+                 const float* fromRight = nullptr) noexcept {
+        const size_t mixed = std::min(numSamples, dryCount_);
+        dryCount_ = 0;
+        processRange(left, right, 0, mixed, true, fromLeft, fromRight);
+        processRange(left, right, mixed, numSamples, false, fromLeft, fromRight);
+    }
+
+    /// @brief Mono variant: mix and gain (no width, no crossfade)
+    void processMono(float* buffer, size_t numSamples) noexcept {
+        const size_t mixed = std::min(numSamples, dryCount_);
+        dryCount_ = 0;
+        processMonoRange(buffer, 0, mixed, true);
+        processMonoRange(buffer, mixed, numSamples, false);
+    }
+
+private:
+    /// Output = same * wetOwn + cross * wetOther + dry * dryOwn + from * fromOwn
+    struct Coefficients {
+        float same;
+        float cross;
+        float dry;
+        float from;
+    };
+
+    [[nodiscard]] static Coefficients coefficients(float width, float mix, float gain,
+                                                   float fadeOut, float fadeIn) noexcept {
+        const float wet = gain * fadeIn * mix;
+        return {wet * 0.5f * (1.0f + width), wet * 0.5f * (1.0f - width),
+                gain * fadeIn * (1.0f - mix), gain * fadeOut};
+    }
+
+    [[nodiscard]] bool isSettled() const noexcept {
+        return !crossfadeActive_ && widthSmoother_.isComplete() &&
+               mixSmoother_.isComplete() && gainSmoother_.isComplete();
+    }
+
+    void processRange(float* left, float* right, size_t begin, size_t end, bool withDry,
+                      const float* fromLeft, const float* fromRight) noexcept {
+        if (begin >= end) return;
+
+        const bool withFrom = crossfadeActive_ && fromLeft != nullptr && fromRight != nullptr;
+        if (!withFrom && isSettled()) {
+            snapParameters();
+            const float mix = withDry ? mixSmoother_.getTarget() : 1.0f;
+            const auto c = coefficients(widthSmoother_.getTarget(), mix,
+                                        gainSmoother_.getTarget(), 0.0f, 1.0f);
+            if (c.same == 1.0f && c.cross == 0.0f && c.dry == 0.0f) return;
+
+            if (c.dry == 0.0f) {
+                for (size_t i = begin; i < end; ++i) {
+                    const float l = left[i];
+                    const float r = right[i];
+                    left[i] = c.same * l + c.cross * r;
+                    right[i] = c.same * r + c.cross * l;
+                }
+            } else {
+                const float* dryL = dryLeft_.data();
+                const float* dryR = dryRight_.data();
+                for (size_t i = begin; i < end; ++i) {
+                    const float l = left[i];
+                    const float r = right[i];
+                    left[i] = c.same * l + c.cross * r + c.dry * dryL[i];
+                    right[i] = c.same * r + c.cross * l + c.dry * dryR[i];
+                }
+            }
+            return;
+        }
+
+        for (size_t i = begin; i < end; ++i) {
+            const float width = widthSmoother_.process();
+            const float mix = withDry ? mixSmoother_.process() : 1.0f;
+            const float gain = gainSmoother_.process();
+
+            float fadeOut = 0.0f;
+            float fadeIn = 1.0f;
+            const bool fading = withFrom && crossfadeActive_;
+            if (fading) {
+                equalPowerGains(crossfadePosition_, fadeOut, fadeIn);
+                advanceCrossfade();
+            }
+
+            const auto c = coefficients(width, mix, gain, fadeOut, fadeIn);
+            const float l = left[i];
+            const float r = right[i];
+            float outL = c.same * l + c.cross * r;
+            float outR = c.same * r + c.cross * l;
+            if (withDry) {
+                outL += c.dry * dryLeft_[i];
+                outR += c.dry * dryRight_[i];
+            }
+            if (fading) {
+                outL += c.from * fromLeft[i];
+                outR += c.from * fromRight[i];
+            }
+            left[i] = outL;
+            right[i] = outR;
+        }
+    }
+
+    void processMonoRange(float* buffer, size_t begin, size_t end, bool withDry) noexcept {
+        if (begin >= end) return;
+
+        if (mixSmoother_.isComplete() && gainSmoother_.isComplete()) {
+            snapParameters();
+            const float mix = withDry ? mixSmoother_.getTarget() : 1.0f;
+            const float gain = gainSmoother_.getTarget();
+            const float wet = gain * mix;
+            const float dry = gain * (1.0f - mix);
+            if (wet == 1.0f && dry == 0.0f) return;
+
+            if (dry == 0.0f) {
+                for (size_t i = begin; i < end; ++i) {
+                    buffer[i] *= wet;
+                }
+            } else {
+                const float* dryMono = dryLeft_.data();
+                for (size_t i = begin; i < end; ++i) {
+                    buffer[i] = wet * buffer[i] + dry * dryMono[i];
+                }
+            }
+            return;
+        }
+
+        for (size_t i = begin; i < end; ++i) {
+            const float mix = withDry ? mixSmoother_.process() : 1.0f;
+            const float gain = gainSmoother_.process();
+            float out = gain * mix * buffer[i];
+            if (withDry) {
+                out += gain * (1.0f - mix) * dryLeft_[i];
+            }
+            buffer[i] = out;
+        }
+    }
+
+    void advanceCrossfade() noexcept {
+        crossfadePosition_ += crossfadeIncrement_;
+        if (crossfadePosition_ >= 1.0f) {
+            crossfadePosition_ = 1.0f;
+            crossfadeActive_ = false;
+        }
+    }
+
+    std::vector<float> dryLeft_;
+    std::vector<float> dryRight_;
+    size_t dryCount_ = 0;
+
+    OnePoleSmoother widthSmoother_{1.0f};
+    OnePoleSmoother mixSmoother_{1.0f};
+    OnePoleSmoother gainSmoother_{1.0f};
+
+    float sampleRate_ = 44100.0f;
+    float crossfadePosition_ = 1.0f;
+    float crossfadeIncrement_ = 0.0f;
+    bool crossfadeActive_ = false;
+};
+
+} // namespace DSP
+} // namespace Krate
@@ -2,12 +2,16 @@
 // Layer 1: DSP Primitive - Oversampler
 // ==============================================================================
 // Upsampling/downsampling primitive for anti-aliased nonlinear processing.
-// Supports 2x and 4x oversampling with configurable filter quality and latency modes.
+// Supports 2x, 4x and 8x oversampling with configurable filter quality and latency modes.
+//
+// Each 2x stage is a polyphase halfband filter that only computes the samples
+// that survive: upsampling never filters the stuffed zeros, and downsampling
+// never computes the samples it would discard.
 //
 // Constitution Compliance:
 // - Principle II: Real-Time Safety (noexcept, no allocations in process)
 // - Principle III: Modern C++ (RAII, constexpr, value semantics, C++20)
-// - Principle IX: Layer 1 (depends only on Layer 0 / standard library / BiquadCascade)
+// - Principle IX: Layer 1 (depends only on Layer 0 / standard library)
 // - Principle X: DSP Constraints (anti-aliasing for nonlinearities, denormal flushing)
 // - Principle XII: Test-First Development
 //
@@ -16,10 +20,11 @@
 
 #pragma once
 
-#include "biquad.h"
+#include <krate/dsp/core/db_utils.h>
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -41,12 +46,13 @@ template<size_t Factor, size_t NumChannels> class Oversampler;
 /// Oversampling factor
 enum class OversamplingFactor : uint8_t {
     TwoX = 2,   ///< 2x oversampling (44.1k -> 88.2k)
-    FourX = 4   ///< 4x oversampling (44.1k -> 176.4k)
+    FourX = 4,  ///< 4x oversampling (44.1k -> 176.4k)
+    EightX = 8  ///< 8x oversampling (44.1k -> 352.8k)
 };
 
 /// Filter quality preset affecting stopband rejection and latency
 enum class OversamplingQuality : uint8_t {
-    Economy,   ///< IIR 8-pole, ~48dB stopband, 0 latency
+    Economy,   ///< IIR allpass halfband, ~95dB stopband, 0 latency
     Standard,  ///< FIR 31-tap, ~80dB stopband, 15 samples latency (2x)
     High       ///< FIR 63-tap, ~100dB stopband, 31 samples latency (2x)
 };
@@ -119,6 +125,30 @@ constexpr std::array<float, 15> kHighFirCoeffs = {{
      0.0002854f    // h[±29]: (1/29π) * w[29]
 }};
 
+// -----------------------------------------------------------------------------
+// Polyphase IIR Halfband Coefficients
+// -----------------------------------------------------------------------------
+// Allpass-pair halfband: H(z) = 0.5 * (A0(z^2) + z^-1 * A1(z^2)), where A0 takes
+// the even-indexed coefficients and A1 the odd-indexed ones, each a cascade of
+// first-order allpass sections (a + z^-1) / (1 + a*z^-1).
+//
+// Design method: elliptic halfband (Valenzuela & Constantinides), as used by
+// Laurent de Soras' HIIR library. Transition bandwidth is relative to the
+// oversampled rate; the passband is flat to within 1e-8 dB.
+
+// First 2x stage: 8 coefficients, transition 0.04 -> ~99dB stopband
+// Passband flat to 18.5kHz at 44.1kHz (0.21 of the 2x rate)
+constexpr std::array<float, 8> kIirHalfbandCoeffs = {{
+    0.0406334609f, 0.1505051290f, 0.3007570560f, 0.4607745050f,
+    0.6095243149f, 0.7385038411f, 0.8492238104f, 0.9497427837f
+}};
+
+// Later stages (4x/8x): the signal already occupies at most 0.105 of the
+// stage rate, so a wide transition (0.12) reaches ~94dB with 5 coefficients
+constexpr std::array<float, 5> kIirHalfbandCoeffsRelaxed = {{
+    0.0479084548f, 0.1795116053f, 0.3678092846f, 0.5907180165f, 0.8484147912f
+}};
+
 } // namespace detail
 
 // =============================================================================
@@ -126,12 +156,22 @@ constexpr std::array<float, 15> kHighFirCoeffs = {{
 // =============================================================================
 
 /// @brief Symmetric FIR halfband filter for linear-phase oversampling.
-/// @tparam NumTaps Number of filter taps (must be odd)
+///
+/// process()/processBlock() filter at a single rate. upsampleBlock() and
+/// downsampleBlock() are the polyphase 2x forms: the zero-valued half of the
+/// taps is skipped, and the center tap reduces to a pure delay. The polyphase
+/// paths keep their own history, so use one form or the other per instance.
+///
+/// @tparam NumTaps Number of filter taps (must be odd, (NumTaps-1)/2 odd)
 template<size_t NumTaps>
 class HalfbandFilter {
 public:
     static_assert(NumTaps % 2 == 1, "Halfband filter must have odd number of taps");
     static constexpr size_t kLatency = (NumTaps - 1) / 2;
+    static_assert(kLatency % 2 == 1, "Center tap must fall on an odd index");
+
+    /// Taps applied to the even (non-center) polyphase branch
+    static constexpr size_t kPhaseLength = (NumTaps + 1) / 2;
 
     HalfbandFilter() noexcept {
         reset();
@@ -153,6 +193,11 @@ public:
                 coeffs_[kLatency + oddIdx] = coeffs[i];
             }
         }
+
+        // Polyphase branch: every even tap (the odd offsets from center)
+        for (size_t j = 0; j < kPhaseLength; ++j) {
+            phaseCoeffs_[j] = coeffs_[2 * j];
+        }
     }
 
     /// Process a single sample
@@ -184,9 +229,54 @@ public:
         }
     }
 
+    /// Zero-stuff and filter: numSamples in, 2 * numSamples out.
+    /// Equivalent to stuffing 2*x[i], 0 and calling processBlock().
+    /// @note output must not overlap input
+    void upsampleBlock(const float* input, float* output, size_t numSamples) noexcept {
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float* history = pushHistory(evenHistory_, input[i]);
+
+            float even = 0.0f;
+            for (size_t j = 0; j < kPhaseLength; ++j) {
+                even += phaseCoeffs_[j] * history[j];
+            }
+
+            // Stuffed input is 2*x, so the 0.5 center tap passes x through
+            output[2 * i] = detail::flushDenormal(2.0f * even);
+            output[2 * i + 1] = history[kCenterDelay];
+        }
+    }
+
+    /// Filter and decimate: 2 * numSamples in, numSamples out.
+    /// Equivalent to processBlock() followed by keeping every even sample.
+    /// @note Safe in-place (output == input)
+    void downsampleBlock(const float* input, float* output, size_t numSamples) noexcept {
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float evenSample = input[2 * i];
+            const float oddSample = input[2 * i + 1];
+
+            const float* history = pushHistory(evenHistory_, evenSample);
+            float sum = 0.0f;
+            for (size_t j = 0; j < kPhaseLength; ++j) {
+                sum += phaseCoeffs_[j] * history[j];
+            }
+
+            // Center tap reads the odd sample kLatency input samples back;
+            // oddHistory_ holds the previous odd samples, newest at [1]
+            sum += 0.5f * oddHistory_[historyPos_ + kCenterDelay + 1];
+            oddHistory_[historyPos_] = oddSample;
+            oddHistory_[historyPos_ + kPhaseLength] = oddSample;
+
+            output[i] = detail::flushDenormal(sum);
+        }
+    }
+
     /// Reset filter state
     void reset() noexcept {
         std::fill(delayLine_.begin(), delayLine_.end(), 0.0f);
+        std::fill(evenHistory_.begin(), evenHistory_.end(), 0.0f);
+        std::fill(oddHistory_.begin(), oddHistory_.end(), 0.0f);
+        historyPos_ = 0;
     }
 
     /// Get filter latency in samples
@@ -195,26 +285,145 @@ public:
     }
 
 private:
+    /// Base-rate delay of the center tap: (kLatency - 1) / 2
+    static constexpr size_t kCenterDelay = (kLatency - 1) / 2;
+
+    /// Push a sample into a mirrored history; returns a contiguous,
+    /// newest-first window of kPhaseLength samples
+    const float* pushHistory(std::array<float, 2 * kPhaseLength>& history, float sample) noexcept {
+        historyPos_ = (historyPos_ == 0) ? kPhaseLength - 1 : historyPos_ - 1;
+        history[historyPos_] = sample;
+        history[historyPos_ + kPhaseLength] = sample;
+        return history.data() + historyPos_;
+    }
+
     std::array<float, NumTaps> coeffs_{};
     std::array<float, NumTaps> delayLine_{};
+
+    // Polyphase state (upsampleBlock / downsampleBlock)
+    std::array<float, kPhaseLength> phaseCoeffs_{};
+    std::array<float, 2 * kPhaseLength> evenHistory_{};
+    std::array<float, 2 * kPhaseLength> oddHistory_{};
+    size_t historyPos_ = 0;
 };
 
 // Type aliases for quality levels
 using HalfbandFilterStandard = HalfbandFilter<detail::kStandardFirLength>;
 using HalfbandFilterHigh = HalfbandFilter<detail::kHighFirLength>;
 
+// =============================================================================
+// AllpassHalfbandFilter Class
+// =============================================================================
+
+/// @brief Polyphase IIR halfband filter built from two allpass branches.
+///
+/// Implements H(z) = 0.5 * (A0(z^2) + z^-1 * A1(z^2)) with both branches
+/// running at the base rate, so each 2x conversion costs one multiply per
+/// coefficient per base-rate sample:
+/// - upsampleBlock(): every input feeds both branches, which produce the even
+///   and odd output samples
+/// - downsampleBlock(): each input pair is split across the branches and the
+///   branch outputs are averaged
+///
+/// One instance holds the state for one direction; use separate instances for
+/// upsampling and downsampling.
+///
+/// @tparam NumCoeffs Number of allpass coefficients (see detail::kIirHalfbandCoeffs)
+template<size_t NumCoeffs>
+class AllpassHalfbandFilter {
+public:
+    static_assert(NumCoeffs >= 1, "Allpass halfband needs at least one coefficient");
+
+    /// Set the allpass coefficients (alternating A0, A1, A0, ...)
+    void setCoefficients(const std::array<float, NumCoeffs>& coeffs) noexcept {
+        coeffs_ = coeffs;
+    }
+
+    /// Upsample: numSamples in, 2 * numSamples out (unity passband gain)
+    /// @note output must not overlap input
+    void upsampleBlock(const float* input, float* output, size_t numSamples) noexcept {
+        for (size_t i = 0; i < numSamples; ++i) {
+            float even = input[i];
+            float odd = input[i];
+            processBranches(even, odd);
+            output[2 * i] = even;
+            output[2 * i + 1] = odd;
+        }
+        flushState();
+    }
+
+    /// Downsample: 2 * numSamples in, numSamples out
+    /// @note Safe in-place (output == input)
+    void downsampleBlock(const float* input, float* output, size_t numSamples) noexcept {
+        for (size_t i = 0; i < numSamples; ++i) {
+            float even = input[2 * i + 1];
+            float odd = input[2 * i];
+            processBranches(even, odd);
+            output[i] = 0.5f * (even + odd);
+        }
+        flushState();
+    }
+
+    /// Reset filter state
+    void reset() noexcept {
+        x_.fill(0.0f);
+        y_.fill(0.0f);
+    }
+
+private:
+    /// Run one sample through both allpass cascades
+    void processBranches(float& even, float& odd) noexcept {
+        size_t k = 0;
+        for (; k + 1 < NumCoeffs; k += 2) {
+            even = allpass(k, even);
+            odd = allpass(k + 1, odd);
+        }
+        if constexpr (NumCoeffs % 2 == 1) {
+            even = allpass(NumCoeffs - 1, even);
+        }
+    }
+
+    /// First-order allpass: y[n] = a * (x[n] - y[n-1]) + x[n-1]
+    float allpass(size_t k, float input) noexcept {
+        const float output = coeffs_[k] * (input - y_[k]) + x_[k];
+        x_[k] = input;
+        y_[k] = output;
+        return output;
+    }
+
+    /// Flush denormals once per block (the recursion decays towards zero)
+    void flushState() noexcept {
+        for (size_t k = 0; k < NumCoeffs; ++k) {
+            x_[k] = detail::flushDenormal(x_[k]);
+            y_[k] = detail::flushDenormal(y_[k]);
+        }
+    }
+
+    std::array<float, NumCoeffs> coeffs_{};
+    std::array<float, NumCoeffs> x_{};  ///< Previous input per section
+    std::array<float, NumCoeffs> y_{};  ///< Previous output per section
+};
+
+using AllpassHalfbandFirst = AllpassHalfbandFilter<detail::kIirHalfbandCoeffs.size()>;
+using AllpassHalfbandRelaxed = AllpassHalfbandFilter<detail::kIirHalfbandCoeffsRelaxed.size()>;
+
 // =============================================================================
 // Oversampler Class Template
 // =============================================================================
 
 /// @brief Upsampling/downsampling primitive for anti-aliased nonlinear processing.
 ///
-/// @tparam Factor Oversampling factor (2 or 4)
+/// Factor is reached with cascaded polyphase 2x stages. The first stage uses
+/// the steepest filter; later stages only need to reject images of an
+/// already band-limited signal and use cheaper filters (IIR mode).
+///
+/// @tparam Factor Oversampling factor (2, 4 or 8)
 /// @tparam NumChannels Number of audio channels (1 = mono, 2 = stereo)
 template<size_t Factor = 2, size_t NumChannels = 2>
 class Oversampler {
 public:
-    static_assert(Factor == 2 || Factor == 4, "Oversampler only supports 2x or 4x");
+    static_assert(Factor == 2 || Factor == 4 || Factor == 8,
+                  "Oversampler only supports 2x, 4x or 8x");
     static_assert(NumChannels >= 1 && NumChannels <= 2, "Oversampler supports 1-2 channels");
 
     // =========================================================================
@@ -236,9 +445,9 @@ public:
         return Factor;
     }
 
-    /// Number of cascaded 2x stages (1 for 2x, 2 for 4x)
+    /// Number of cascaded 2x stages (1 for 2x, 2 for 4x, 3 for 8x)
     static constexpr size_t numStages() noexcept {
-        return (Factor == 2) ? 1 : 2;
+        return (Factor == 2) ? 1 : (Factor == 4) ? 2 : 3;
     }
 
     /// Number of channels
@@ -284,10 +493,11 @@ public:
     /// Check if oversampler has been prepared
     [[nodiscard]] bool isPrepared() const noexcept { return prepared_; }
 
-    /// Get oversampling factor (2 or 4)
+    /// Get oversampling factor (2, 4 or 8)
     [[nodiscard]] constexpr size_t getFactor() const noexcept { return Factor; }
 
-    /// Get latency introduced by oversampling (in base-rate samples)
+    /// Get latency introduced by oversampling (in base-rate samples, rounded
+    /// to the nearest sample for 4x/8x whose group delay is fractional)
     [[nodiscard]] size_t getLatency() const noexcept { return latencySamples_; }
 
     /// Get current quality setting
@@ -358,10 +568,13 @@ private:
     bool prepared_ = false;
     bool useFir_ = false;
 
-    // IIR filters for Economy/ZeroLatency mode (per channel, per stage)
+    // IIR filters for Economy/ZeroLatency mode: steep first stage per channel,
+    // relaxed filters for the remaining stages (per channel, per stage)
     static constexpr size_t kNumStages = numStages();
-    std::array<BiquadCascade<4>, NumChannels * kNumStages> iirUpsampleFilters_;
-    std::array<BiquadCascade<4>, NumChannels * kNumStages> iirDownsampleFilters_;
+    std::array<AllpassHalfbandFirst, NumChannels> iirUpsampleFirst_;
+    std::array<AllpassHalfbandFirst, NumChannels> iirDownsampleFirst_;
+    std::array<AllpassHalfbandRelaxed, NumChannels * (kNumStages - 1)> iirUpsampleRelaxed_;
+    std::array<AllpassHalfbandRelaxed, NumChannels * (kNumStages - 1)> iirDownsampleRelaxed_;
 
     // FIR filters for Standard/High quality with LinearPhase mode
     std::array<HalfbandFilterStandard, NumChannels * kNumStages> firStandardUpsample_;
@@ -371,7 +584,7 @@ private:
 
     // Pre-allocated buffers
     std::vector<float> oversampledBuffer_;  // Size: maxBlockSize * Factor * NumChannels
-    std::vector<float> tempBuffer_;         // Temp buffer for FIR processing
+    std::vector<float> tempBuffer_;         // Intermediate-stage buffer
 
     // Internal helpers
     void configureIirFilters() noexcept;
@@ -379,6 +592,17 @@ private:
     size_t getFilterIndex(size_t channel, size_t stage) const noexcept {
         return channel * kNumStages + stage;
     }
+    size_t getRelaxedIndex(size_t channel, size_t stage) const noexcept {
+        return channel * (kNumStages - 1) + (stage - 1);
+    }
+
+    // Run the 2x stages in order; stageFn(stage, src, dst, numInputSamples)
+    template<typename StageFn>
+    void runUpsampleStages(const float* input, float* output, size_t numSamples,
+                           size_t channel, StageFn&& stageFn) noexcept;
+    template<typename StageFn>
+    void runDownsampleStages(const float* input, float* output, size_t numSamples,
+                             size_t channel, StageFn&& stageFn) noexcept;
 
     // IIR processing paths
     void upsampleIir(const float* input, float* output, size_t numSamples, size_t channel) noexcept;
@@ -405,6 +629,12 @@ using Oversampler2xMono = Oversampler<2, 1>;
 /// 4x mono oversampler
 using Oversampler4xMono = Oversampler<4, 1>;
 
+/// 8x stereo oversampler
+using Oversampler8x = Oversampler<8, 2>;
+
+/// 8x mono oversampler
+using Oversampler8xMono = Oversampler<8, 1>;
+
 // =============================================================================
 // Implementation
 // =============================================================================
@@ -447,15 +677,14 @@ void Oversampler<Factor, NumChannels>::prepare(
             latencyPerStage = detail::kHighFirLatency;
         }
 
-        // Total latency: up + down for each stage, converted to base rate samples
-        // For 2x: 1 stage, latency = 2 * latencyPerStage / 2 = latencyPerStage
-        // For 4x: 2 stages, latency = 2 * (latencyPerStage/2 + latencyPerStage/4)
-        if constexpr (Factor == 2) {
-            latencySamples_ = latencyPerStage;  // 15 or 31
-        } else {
-            // 4x: latencies accumulate across stages
-            latencySamples_ = latencyPerStage * 2;  // 30 or 62
-        }
+        // Up + down filter of stage s run at 2^s times the base rate, so
+        // their 2 * latencyPerStage samples are latencyPerStage / 2^(s-1)
+        // base-rate samples:
+        //   total = latencyPerStage * (1 + 1/2 + ... ) = latencyPerStage * (2^N - 1) / 2^(N-1)
+        // 2x: 15/31, 4x: 22.5/46.5, 8x: 26.25/54.25, rounded to the nearest sample
+        const size_t denominator = size_t{1} << (kNumStages - 1);
+        const size_t numerator = latencyPerStage * ((size_t{1} << kNumStages) - 1);
+        latencySamples_ = (numerator + denominator / 2) / denominator;
     }
 
     // Allocate oversampled buffer
@@ -479,39 +708,22 @@ void Oversampler<Factor, NumChannels>::prepare(
 
 template<size_t Factor, size_t NumChannels>
 void Oversampler<Factor, NumChannels>::configureIirFilters() noexcept {
-    // Calculate cutoff frequency for anti-aliasing
-    // Cutoff should be just below original Nyquist
-    const float baseCutoff = static_cast<float>(sampleRate_) * 0.45f;  // 45% of base Nyquist
-
-    // Configure each stage
-    for (size_t stage = 0; stage < kNumStages; ++stage) {
-        // Sample rate at this stage
-        const double stageSampleRate = sampleRate_ * (1 << (stage + 1));
-        const float stageCutoff = baseCutoff;  // Same cutoff in Hz
-
-        for (size_t ch = 0; ch < NumChannels; ++ch) {
-            const size_t idx = getFilterIndex(ch, stage);
-
-            // Configure as Butterworth lowpass
-            iirUpsampleFilters_[idx].setButterworth(
-                FilterType::Lowpass,
-                stageCutoff,
-                static_cast<float>(stageSampleRate)
-            );
-
-            iirDownsampleFilters_[idx].setButterworth(
-                FilterType::Lowpass,
-                stageCutoff,
-                static_cast<float>(stageSampleRate)
-            );
-        }
+    // Halfband filters are defined relative to the stage rate, so the same
+    // coefficients serve every base sample rate
+    for (auto& filter : iirUpsampleFirst_) {
+        filter.setCoefficients(detail::kIirHalfbandCoeffs);
+        filter.reset();
     }
-
-    // Reset filter states
-    for (auto& filter : iirUpsampleFilters_) {
+    for (auto& filter : iirDownsampleFirst_) {
+        filter.setCoefficients(detail::kIirHalfbandCoeffs);
+        filter.reset();
+    }
+    for (auto& filter : iirUpsampleRelaxed_) {
+        filter.setCoefficients(detail::kIirHalfbandCoeffsRelaxed);
         filter.reset();
     }
-    for (auto& filter : iirDownsampleFilters_) {
+    for (auto& filter : iirDownsampleRelaxed_) {
+        filter.setCoefficients(detail::kIirHalfbandCoeffsRelaxed);
         filter.reset();
     }
 }
@@ -555,12 +767,10 @@ void Oversampler<Factor, NumChannels>::configureFirFilters() noexcept {
 template<size_t Factor, size_t NumChannels>
 void Oversampler<Factor, NumChannels>::reset() noexcept {
     // Reset IIR filters
-    for (auto& filter : iirUpsampleFilters_) {
-        filter.reset();
-    }
-    for (auto& filter : iirDownsampleFilters_) {
-        filter.reset();
-    }
+    for (auto& filter : iirUpsampleFirst_) { filter.reset(); }
+    for (auto& filter : iirDownsampleFirst_) { filter.reset(); }
+    for (auto& filter : iirUpsampleRelaxed_) { filter.reset(); }
+    for (auto& filter : iirDownsampleRelaxed_) { filter.reset(); }
 
     // Reset FIR filters
     for (auto& filter : firStandardUpsample_) { filter.reset(); }
@@ -570,94 +780,90 @@ void Oversampler<Factor, NumChannels>::reset() noexcept {
 }
 
 // =============================================================================
-// IIR Processing Paths
+// Stage Sequencing
 // =============================================================================
 
 template<size_t Factor, size_t NumChannels>
-void Oversampler<Factor, NumChannels>::upsampleIir(
+template<typename StageFn>
+void Oversampler<Factor, NumChannels>::runUpsampleStages(
     const float* input,
     float* output,
     size_t numSamples,
-    size_t channel
+    size_t channel,
+    StageFn&& stageFn
 ) noexcept {
-    if constexpr (Factor == 2) {
-        // Single 2x stage: zero-stuff then filter
-        const size_t idx = getFilterIndex(channel, 0);
-
-        for (size_t i = 0; i < numSamples; ++i) {
-            // Zero-stuffing: insert sample, then zero
-            output[i * 2] = input[i] * 2.0f;  // Gain compensation
-            output[i * 2 + 1] = 0.0f;
-        }
-
-        // Apply lowpass filter
-        iirUpsampleFilters_[idx].processBlock(output, numSamples * 2);
-    } else {
-        // 4x: Two cascaded 2x stages
-        // Stage 1: 1x -> 2x
-        const size_t idx0 = getFilterIndex(channel, 0);
-        float* intermediate = output;  // Reuse output buffer
+    // Polyphase stages cannot run in place, so alternate between the temp
+    // buffer and output such that the last stage lands in output
+    float* temp = tempBuffer_.data() + (channel * maxBlockSize_ * Factor);
+    const float* src = input;
+    size_t stageSamples = numSamples;
 
-        for (size_t i = 0; i < numSamples; ++i) {
-            intermediate[i * 2] = input[i] * 2.0f;
-            intermediate[i * 2 + 1] = 0.0f;
-        }
-        iirUpsampleFilters_[idx0].processBlock(intermediate, numSamples * 2);
-
-        // Stage 2: 2x -> 4x (in-place expansion, work backwards)
-        const size_t idx1 = getFilterIndex(channel, 1);
-        for (size_t i = numSamples * 2; i > 0; --i) {
-            const size_t srcIdx = i - 1;
-            const size_t dstIdx = (i - 1) * 2;
-            output[dstIdx + 1] = 0.0f;
-            output[dstIdx] = intermediate[srcIdx] * 2.0f;
-        }
-        iirUpsampleFilters_[idx1].processBlock(output, numSamples * 4);
+    for (size_t stage = 0; stage < kNumStages; ++stage) {
+        float* dst = ((kNumStages - 1 - stage) % 2 == 0) ? output : temp;
+        stageFn(stage, src, dst, stageSamples);
+        src = dst;
+        stageSamples *= 2;
     }
 }
 
 template<size_t Factor, size_t NumChannels>
-void Oversampler<Factor, NumChannels>::downsampleIir(
+template<typename StageFn>
+void Oversampler<Factor, NumChannels>::runDownsampleStages(
     const float* input,
     float* output,
     size_t numSamples,
-    size_t channel
+    size_t channel,
+    StageFn&& stageFn
 ) noexcept {
-    // We need a temporary buffer for filtering since input is const
+    // Decimation is safe in place: intermediate stages share the temp buffer
     float* temp = tempBuffer_.data() + (channel * maxBlockSize_ * Factor);
-    std::copy(input, input + numSamples * Factor, temp);
+    const float* src = input;
+    size_t stageSamples = numSamples * (Factor / 2);
 
-    if constexpr (Factor == 2) {
-        // Single 2x stage: filter then decimate
-        const size_t idx = getFilterIndex(channel, 0);
-
-        // Apply lowpass filter
-        iirDownsampleFilters_[idx].processBlock(temp, numSamples * 2);
+    for (size_t stage = kNumStages; stage > 0; --stage) {
+        float* dst = (stage == 1) ? output : temp;
+        stageFn(stage - 1, src, dst, stageSamples);
+        src = dst;
+        stageSamples /= 2;
+    }
+}
 
-        // Decimate: take every 2nd sample
-        for (size_t i = 0; i < numSamples; ++i) {
-            output[i] = temp[i * 2];
-        }
-    } else {
-        // 4x: Two cascaded 2x stages (reverse order)
-        // Stage 1: 4x -> 2x
-        const size_t idx1 = getFilterIndex(channel, 1);
-        iirDownsampleFilters_[idx1].processBlock(temp, numSamples * 4);
-
-        // Decimate to 2x
-        for (size_t i = 0; i < numSamples * 2; ++i) {
-            temp[i] = temp[i * 2];
-        }
+// =============================================================================
+// IIR Processing Paths
+// =============================================================================
 
-        // Stage 2: 2x -> 1x
-        const size_t idx0 = getFilterIndex(channel, 0);
-        iirDownsampleFilters_[idx0].processBlock(temp, numSamples * 2);
+template<size_t Factor, size_t NumChannels>
+void Oversampler<Factor, NumChannels>::upsampleIir(
+    const float* input,
+    float* output,
+    size_t numSamples,
+    size_t channel
+) noexcept {
+    runUpsampleStages(input, output, numSamples, channel,
+        [this, channel](size_t stage, const float* src, float* dst, size_t n) {
+            if (stage == 0) {
+                iirUpsampleFirst_[channel].upsampleBlock(src, dst, n);
+            } else {
+                iirUpsampleRelaxed_[getRelaxedIndex(channel, stage)].upsampleBlock(src, dst, n);
+            }
+        });
+}
 
-        // Final decimation
-        for (size_t i = 0; i < numSamples; ++i) {
-            output[i] = temp[i * 2];
-        }
-    }
+template<size_t Factor, size_t NumChannels>
+void Oversampler<Factor, NumChannels>::downsampleIir(
+    const float* input,
+    float* output,
+    size_t numSamples,
+    size_t channel
+) noexcept {
+    runDownsampleStages(input, output, numSamples, channel,
+        [this, channel](size_t stage, const float* src, float* dst, size_t n) {
+            if (stage == 0) {
+                iirDownsampleFirst_[channel].downsampleBlock(src, dst, n);
+            } else {
+                iirDownsampleRelaxed_[getRelaxedIndex(channel, stage)].downsampleBlock(src, dst, n);
+            }
+        });
 }
 
 // =============================================================================
@@ -671,53 +877,15 @@ void Oversampler<Factor, NumChannels>::upsampleFir(
     size_t numSamples,
     size_t channel
 ) noexcept {
-    if constexpr (Factor == 2) {
-        // Single 2x stage: zero-stuff then filter
-        const size_t idx = getFilterIndex(channel, 0);
-
-        for (size_t i = 0; i < numSamples; ++i) {
-            // Zero-stuffing: insert sample, then zero
-            output[i * 2] = input[i] * 2.0f;  // Gain compensation
-            output[i * 2 + 1] = 0.0f;
-        }
-
-        // Apply FIR filter based on quality
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardUpsample_[idx].processBlock(output, numSamples * 2);
-        } else {
-            firHighUpsample_[idx].processBlock(output, numSamples * 2);
-        }
-    } else {
-        // 4x: Two cascaded 2x stages
-        const size_t idx0 = getFilterIndex(channel, 0);
-        const size_t idx1 = getFilterIndex(channel, 1);
-
-        // Stage 1: 1x -> 2x
-        for (size_t i = 0; i < numSamples; ++i) {
-            output[i * 2] = input[i] * 2.0f;
-            output[i * 2 + 1] = 0.0f;
-        }
-
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardUpsample_[idx0].processBlock(output, numSamples * 2);
-        } else {
-            firHighUpsample_[idx0].processBlock(output, numSamples * 2);
-        }
-
-        // Stage 2: 2x -> 4x (work backwards for in-place expansion)
-        for (size_t i = numSamples * 2; i > 0; --i) {
-            const size_t srcIdx = i - 1;
-            const size_t dstIdx = (i - 1) * 2;
-            output[dstIdx + 1] = 0.0f;
-            output[dstIdx] = output[srcIdx] * 2.0f;
-        }
-
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardUpsample_[idx1].processBlock(output, numSamples * 4);
-        } else {
-            firHighUpsample_[idx1].processBlock(output, numSamples * 4);
-        }
-    }
+    runUpsampleStages(input, output, numSamples, channel,
+        [this, channel](size_t stage, const float* src, float* dst, size_t n) {
+            const size_t idx = getFilterIndex(channel, stage);
+            if (quality_ == OversamplingQuality::Standard) {
+                firStandardUpsample_[idx].upsampleBlock(src, dst, n);
+            } else {
+                firHighUpsample_[idx].upsampleBlock(src, dst, n);
+            }
+        });
 }
 
 template<size_t Factor, size_t NumChannels>
@@ -727,54 +895,15 @@ void Oversampler<Factor, NumChannels>::downsampleFir(
     size_t numSamples,
     size_t channel
 ) noexcept {
-    // We need a temporary buffer for filtering since input is const
-    float* temp = tempBuffer_.data() + (channel * maxBlockSize_ * Factor);
-    std::copy(input, input + numSamples * Factor, temp);
-
-    if constexpr (Factor == 2) {
-        // Single 2x stage: filter then decimate
-        const size_t idx = getFilterIndex(channel, 0);
-
-        // Apply FIR filter based on quality
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardDownsample_[idx].processBlock(temp, numSamples * 2);
-        } else {
-            firHighDownsample_[idx].processBlock(temp, numSamples * 2);
-        }
-
-        // Decimate: take every 2nd sample
-        for (size_t i = 0; i < numSamples; ++i) {
-            output[i] = temp[i * 2];
-        }
-    } else {
-        // 4x: Two cascaded 2x stages (reverse order)
-        const size_t idx0 = getFilterIndex(channel, 0);
-        const size_t idx1 = getFilterIndex(channel, 1);
-
-        // Stage 1: 4x -> 2x
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardDownsample_[idx1].processBlock(temp, numSamples * 4);
-        } else {
-            firHighDownsample_[idx1].processBlock(temp, numSamples * 4);
-        }
-
-        // Decimate to 2x
-        for (size_t i = 0; i < numSamples * 2; ++i) {
-            temp[i] = temp[i * 2];
-        }
-
-        // Stage 2: 2x -> 1x
-        if (quality_ == OversamplingQuality::Standard) {
-            firStandardDownsample_[idx0].processBlock(temp, numSamples * 2);
-        } else {
-            firHighDownsample_[idx0].processBlock(temp, numSamples * 2);
-        }
-
-        // Final decimation
-        for (size_t i = 0; i < numSamples; ++i) {
-            output[i] = temp[i * 2];
-        }
-    }
+    runDownsampleStages(input, output, numSamples, channel,
+        [this, channel](size_t stage, const float* src, float* dst, size_t n) {
+            const size_t idx = getFilterIndex(channel, stage);
+            if (quality_ == OversamplingQuality::Standard) {
+                firStandardDownsample_[idx].downsampleBlock(src, dst, n);
+            } else {
+                firHighDownsample_[idx].downsampleBlock(src, dst, n);
+            }
+        });
 }
 
 // =============================================================================
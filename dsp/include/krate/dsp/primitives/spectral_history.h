@@ -0,0 +1,182 @@
+// ==============================================================================
+// Layer 1: DSP Primitive - Spectral History
+// ==============================================================================
+// Contiguous frame-major ring of complex spectra for per-bin spectral delays.
+// Replaces one DelayLine per bin (and per real/imag part) with a single
+// allocation: frame f stores numBins real values followed by numBins imaginary
+// values, so writing a frame is two contiguous copies and reading every bin at
+// its own fractional delay is a gather over a small, dense block of memory.
+//
+// Constitution Compliance:
+// - Principle II: Real-Time Safety (noexcept, allocation only in prepare())
+// - Principle III: Modern C++ (C++20, RAII)
+// - Principle IX: Layer 1 (depends only on Layer 0)
+// - Principle XII: Test-First Development
+//
+// Reference: specs/033-spectral-delay/spec.md
+// ==============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Krate {
+namespace DSP {
+
+// =============================================================================
+// SpectralHistory Class
+// =============================================================================
+
+/// @brief Frame-major circular store of split-complex spectra
+///
+/// Delay semantics match DelayLine::readLinear() at frame rate: a delay of 0
+/// returns the most recently written frame, delays are clamped to
+/// [0, maxDelayFrames()], and reads must happen before the frame for the
+/// current hop is written.
+///
+/// @code
+/// history.prepare(numBins, maxDelayFrames);
+/// // per hop:
+/// history.readLinear(delayFrames, delayedRe, delayedIm);
+/// float* re = history.writeReal();
+/// float* im = history.writeImag();
+/// // ... fill re/im for all bins ...
+/// history.advance();
+/// @endcode
+class SpectralHistory {
+public:
+    SpectralHistory() noexcept = default;
+    ~SpectralHistory() = default;
+
+    // Non-copyable, movable
+    SpectralHistory(const SpectralHistory&) = delete;
+    SpectralHistory& operator=(const SpectralHistory&) = delete;
+    SpectralHistory(SpectralHistory&&) noexcept = default;
+    SpectralHistory& operator=(SpectralHistory&&) noexcept = default;
+
+    // -------------------------------------------------------------------------
+    // Lifecycle
+    // -------------------------------------------------------------------------
+
+    /// @brief Allocate storage for the given bin count and maximum delay
+    /// @param numBins Complex bins per frame (fftSize/2+1)
+    /// @param maxDelayFrames Longest delay that can be read, in frames
+    /// @note NOT real-time safe (allocates memory)
+    void prepare(size_t numBins, size_t maxDelayFrames) noexcept {
+        numBins_ = numBins;
+        maxDelayFrames_ = maxDelayFrames;
+        // One slot per readable delay (0..max); the slot being written next
+        // holds the oldest frame until advance(), so no extra slot is needed.
+        numFrames_ = maxDelayFrames + 1;
+        frameStride_ = 2 * numBins;
+        data_.resize(numFrames_ * frameStride_);
+        reset();
+    }
+
+    /// @brief Clear all history and rewind the write position
+    /// @note Real-time safe
+    void reset() noexcept {
+        std::fill(data_.begin(), data_.end(), 0.0f);
+        writeFrame_ = 0;
+    }
+
+    // -------------------------------------------------------------------------
+    // Writing
+    // -------------------------------------------------------------------------
+
+    /// @brief Real parts of the frame that advance() will commit
+    [[nodiscard]] float* writeReal() noexcept {
+        return data_.data() + writeFrame_ * frameStride_;
+    }
+
+    /// @brief Imaginary parts of the frame that advance() will commit
+    [[nodiscard]] float* writeImag() noexcept {
+        return writeReal() + numBins_;
+    }
+
+    /// @brief Commit the current write frame and move to the next slot
+    void advance() noexcept {
+        if (numFrames_ == 0) return;
+        writeFrame_ = (writeFrame_ + 1 == numFrames_) ? 0 : writeFrame_ + 1;
+    }
+
+    /// @brief Copy a full frame and commit it
+    void write(const float* real, const float* imag) noexcept {
+        if (numFrames_ == 0) return;
+        std::copy(real, real + numBins_, writeReal());
+        std::copy(imag, imag + numBins_, writeImag());
+        advance();
+    }
+
+    // -------------------------------------------------------------------------
+    // Reading
+    // -------------------------------------------------------------------------
+
+    /// @brief Read one frame at an integer delay
+    /// @return Pointer to numBins real values (imaginary follow at +numBins)
+    [[nodiscard]] const float* frame(size_t delayFrames) const noexcept {
+        return data_.data() + frameIndex(std::min(delayFrames, maxDelayFrames_)) * frameStride_;
+    }
+
+    /// @brief Gather every bin at its own fractional delay (linear interpolation)
+    /// @param delayFrames Per-bin delay in frames (numBins values)
+    /// @param outReal Destination for numBins real values
+    /// @param outImag Destination for numBins imaginary values
+    /// @note Real-time safe. Bins sharing a delay read from the same two
+    ///       frames, so uniform delays degrade to contiguous streaming reads.
+    void readLinear(const float* delayFrames, float* outReal, float* outImag) const noexcept {
+        if (numFrames_ == 0) return;
+
+        const float maxDelay = static_cast<float>(maxDelayFrames_);
+        const float* base = data_.data();
+
+        for (size_t bin = 0; bin < numBins_; ++bin) {
+            const float clamped = std::clamp(delayFrames[bin], 0.0f, maxDelay);
+            const float intPart = std::floor(clamped);
+            const float frac = clamped - intPart;
+
+            const size_t d0 = static_cast<size_t>(intPart);
+            const size_t d1 = std::min(d0 + 1, maxDelayFrames_);
+
+            const float* f0 = base + frameIndex(d0) * frameStride_;
+            const float* f1 = base + frameIndex(d1) * frameStride_;
+
+            const float re0 = f0[bin];
+            const float im0 = f0[numBins_ + bin];
+            outReal[bin] = re0 + frac * (f1[bin] - re0);
+            outImag[bin] = im0 + frac * (f1[numBins_ + bin] - im0);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Query
+    // -------------------------------------------------------------------------
+
+    [[nodiscard]] size_t numBins() const noexcept { return numBins_; }
+    [[nodiscard]] size_t maxDelayFrames() const noexcept { return maxDelayFrames_; }
+    [[nodiscard]] bool isPrepared() const noexcept { return numFrames_ > 0; }
+
+    /// @brief Total floats held (for memory accounting)
+    [[nodiscard]] size_t storageSize() const noexcept { return data_.size(); }
+
+private:
+    /// @brief Ring slot holding the frame written (delay + 1) advances ago
+    [[nodiscard]] size_t frameIndex(size_t delay) const noexcept {
+        // delay <= maxDelayFrames_ < numFrames_, so one conditional wrap suffices
+        const size_t back = delay + 1;
+        return (writeFrame_ >= back) ? writeFrame_ - back : writeFrame_ + numFrames_ - back;
+    }
+
+    std::vector<float> data_;     ///< numFrames_ x [real[numBins] | imag[numBins]]
+    size_t numBins_ = 0;
+    size_t maxDelayFrames_ = 0;
+    size_t numFrames_ = 0;
+    size_t frameStride_ = 0;
+    size_t writeFrame_ = 0;
+};
+
+} // namespace DSP
+} // namespace Krate
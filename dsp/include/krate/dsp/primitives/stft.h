@@ -16,17 +16,24 @@
 
 #pragma once
 
+#include "delay_line.h"
 #include "fft.h"
 #include "spectral_buffer.h"
 #include "../core/window_functions.h"
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <span>
 #include <vector>
 
 namespace Krate {
 namespace DSP {
 
+// Both classes keep their streams in power-of-two rings: indices wrap with a
+// mask, and block copies are split into at most two contiguous segments, so
+// the per-call cost scales with the samples moved rather than the FFT size.
+
 // =============================================================================
 // STFT Class
 // =============================================================================
@@ -68,14 +75,15 @@ public:
         // Prepare internal FFT
         fft_.prepare(fftSize);
 
-        // Generate window
-        window_ = Window::generate(window, fftSize, kaiserBeta);
+        // Window coefficients (shared across instances)
+        window_ = Window::shared(window, fftSize, kaiserBeta);
 
-        // Allocate input buffer
+        // Allocate input ring
         // Size: fftSize + max expected batch size
         // For batch testing, we need room for multiple frames worth of input
         // Using 8*fftSize allows pushing up to 7*fftSize samples before processing
-        inputBuffer_.resize(fftSize * 8, 0.0f);
+        inputBuffer_.assign(nextPowerOf2(fftSize * 8), 0.0f);
+        inputMask_ = inputBuffer_.size() - 1;
 
         // Allocate windowed frame buffer
         windowedFrame_.resize(fftSize, 0.0f);
@@ -104,12 +112,21 @@ public:
     void pushSamples(const float* input, size_t numSamples) noexcept {
         if (input == nullptr || !isPrepared()) return;
 
-        // Copy samples into circular buffer
-        for (size_t i = 0; i < numSamples; ++i) {
-            inputBuffer_[writeIndex_] = input[i];
-            writeIndex_ = (writeIndex_ + 1) % inputBuffer_.size();
-            ++samplesAvailable_;
+        const size_t capacity = inputBuffer_.size();
+        samplesAvailable_ += numSamples;
+
+        // Only the newest `capacity` samples can survive in the ring
+        if (numSamples > capacity) {
+            writeIndex_ = (writeIndex_ + numSamples - capacity) & inputMask_;
+            input += numSamples - capacity;
+            numSamples = capacity;
         }
+
+        // Copy into the ring in at most two contiguous segments
+        const size_t first = std::min(numSamples, capacity - writeIndex_);
+        std::memcpy(inputBuffer_.data() + writeIndex_, input, first * sizeof(float));
+        std::memcpy(inputBuffer_.data(), input + first, (numSamples - first) * sizeof(float));
+        writeIndex_ = (writeIndex_ + numSamples) & inputMask_;
     }
 
     // -------------------------------------------------------------------------
@@ -132,13 +149,17 @@ public:
 
         // Calculate read position (start of current frame)
         // We want to read the oldest fftSize samples
-        const size_t bufSize = inputBuffer_.size();
-        size_t readIdx = (writeIndex_ + bufSize - samplesAvailable_) % bufSize;
+        const size_t readIdx = (writeIndex_ - samplesAvailable_) & inputMask_;
 
-        // Extract and window the frame
-        for (size_t i = 0; i < fftSize_; ++i) {
-            windowedFrame_[i] = inputBuffer_[readIdx] * window_[i];
-            readIdx = (readIdx + 1) % bufSize;
+        // Extract and window the frame (two contiguous segments of the ring)
+        const size_t first = std::min(fftSize_, inputBuffer_.size() - readIdx);
+        const float* segment = inputBuffer_.data() + readIdx;
+        for (size_t i = 0; i < first; ++i) {
+            windowedFrame_[i] = segment[i] * window_[i];
+        }
+        const float* wrapped = inputBuffer_.data();
+        for (size_t i = first; i < fftSize_; ++i) {
+            windowedFrame_[i] = wrapped[i - first] * window_[i];
         }
 
         // Perform FFT
@@ -163,12 +184,13 @@ public:
 
 private:
     FFT fft_;
-    std::vector<float> window_;
+    std::span<const float> window_;  // Shared (TableRegistry)
     std::vector<float> inputBuffer_;
     std::vector<float> windowedFrame_;
     WindowType windowType_ = WindowType::Hann;
     size_t fftSize_ = 0;
     size_t hopSize_ = 0;
+    size_t inputMask_ = 0;
     size_t writeIndex_ = 0;
     size_t samplesAvailable_ = 0;
 };
@@ -178,6 +200,10 @@ private:
 // =============================================================================
 
 /// @brief Overlap-Add synthesis for STFT reconstruction
+///
+/// The accumulator is a ring read from a moving head: each synthesized frame
+/// is added in place starting samplesAvailable() samples past the head, and
+/// pullSamples() copies out and clears only the samples it returns.
 class OverlapAdd {
 public:
     OverlapAdd() noexcept = default;
@@ -211,8 +237,8 @@ public:
         // Prepare internal FFT
         fft_.prepare(fftSize);
 
-        // Generate synthesis window and compute COLA normalization factor
-        synthesisWindow_ = Window::generate(window, fftSize, kaiserBeta);
+        // Synthesis window (shared across instances) and COLA normalization factor
+        synthesisWindow_ = Window::shared(window, fftSize, kaiserBeta);
 
         // Compute COLA sum: at any position, sum of overlapping windows
         // This is the same as what verifyCOLA computes
@@ -227,14 +253,17 @@ public:
         // Normalization: divide by COLA sum to get unity gain reconstruction
         colaNormalization_ = (colaSum > 0.0f) ? (1.0f / colaSum) : 1.0f;
 
-        // Output buffer needs to hold at least fftSize + hopSize for overlap-add
-        // We use 2*fftSize for safe margin
-        outputBuffer_.resize(fftSize * 2, 0.0f);
+        // Output ring holds the pending (ready) samples plus one frame being
+        // accumulated. 8*fftSize matches the STFT input ring, so every frame a
+        // single STFT push can produce fits before the caller pulls.
+        outputBuffer_.assign(nextPowerOf2(fftSize * 8), 0.0f);
+        outputMask_ = outputBuffer_.size() - 1;
 
         // IFFT result buffer
         ifftBuffer_.resize(fftSize, 0.0f);
 
         // Reset state
+        readIndex_ = 0;
         samplesReady_ = 0;
     }
 
@@ -242,6 +271,7 @@ public:
     /// @note Real-time safe
     void reset() noexcept {
         std::fill(outputBuffer_.begin(), outputBuffer_.end(), 0.0f);
+        readIndex_ = 0;
         samplesReady_ = 0;
     }
 
@@ -255,15 +285,26 @@ public:
     void synthesize(const SpectralBuffer& input) noexcept {
         if (!isPrepared() || !input.isPrepared()) return;
 
+        // Frame would overrun unread output (caller is not pulling): drop it
+        if (samplesReady_ + fftSize_ > outputBuffer_.size()) return;
+
         // Perform inverse FFT
         fft_.inverse(input.data(), ifftBuffer_.data());
 
-        // Overlap-add: Add IFFT result to output buffer with COLA normalization
+        // Overlap-add: Add IFFT result in place, one hop past the previous
+        // frame, with COLA normalization
         // Note: We use analysis-only windowing (window applied in STFT::analyze() only)
         // The Hann window at 50% overlap naturally satisfies COLA (sums to 1.0)
         // Synthesis window is not applied here to avoid Hann² which does NOT satisfy COLA at 50%
-        for (size_t i = 0; i < fftSize_; ++i) {
-            outputBuffer_[i] += ifftBuffer_[i] * colaNormalization_;
+        const size_t start = (readIndex_ + samplesReady_) & outputMask_;
+        const size_t first = std::min(fftSize_, outputBuffer_.size() - start);
+        float* segment = outputBuffer_.data() + start;
+        for (size_t i = 0; i < first; ++i) {
+            segment[i] += ifftBuffer_[i] * colaNormalization_;
+        }
+        float* wrapped = outputBuffer_.data();
+        for (size_t i = first; i < fftSize_; ++i) {
+            wrapped[i - first] += ifftBuffer_[i] * colaNormalization_;
         }
 
         // Mark hopSize more samples as ready
@@ -287,21 +328,16 @@ public:
     void pullSamples(float* output, size_t numSamples) noexcept {
         if (output == nullptr || numSamples > samplesReady_) return;
 
-        // Copy samples to output
-        std::copy(outputBuffer_.begin(),
-                  outputBuffer_.begin() + static_cast<std::ptrdiff_t>(numSamples),
-                  output);
-
-        // Shift remaining samples left
-        std::copy(outputBuffer_.begin() + static_cast<std::ptrdiff_t>(numSamples),
-                  outputBuffer_.end(),
-                  outputBuffer_.begin());
-
-        // Zero the freed portion at the end
-        std::fill(outputBuffer_.end() - static_cast<std::ptrdiff_t>(numSamples),
-                  outputBuffer_.end(),
-                  0.0f);
+        // Copy out and clear (ready for future accumulation) in at most two
+        // contiguous segments; nothing else in the ring moves
+        const size_t first = std::min(numSamples, outputBuffer_.size() - readIndex_);
+        float* head = outputBuffer_.data() + readIndex_;
+        std::memcpy(output, head, first * sizeof(float));
+        std::memset(head, 0, first * sizeof(float));
+        std::memcpy(output + first, outputBuffer_.data(), (numSamples - first) * sizeof(float));
+        std::memset(outputBuffer_.data(), 0, (numSamples - first) * sizeof(float));
 
+        readIndex_ = (readIndex_ + numSamples) & outputMask_;
         samplesReady_ -= numSamples;
     }
 
@@ -315,12 +351,14 @@ public:
 
 private:
     FFT fft_;
-    std::vector<float> synthesisWindow_;
+    std::span<const float> synthesisWindow_;  // Shared (TableRegistry)
     std::vector<float> outputBuffer_;
     std::vector<float> ifftBuffer_;
     float colaNormalization_ = 1.0f;
     size_t fftSize_ = 0;
     size_t hopSize_ = 0;
+    size_t outputMask_ = 0;
+    size_t readIndex_ = 0;     ///< Ring position of the next sample to pull
     size_t samplesReady_ = 0;
 };
 
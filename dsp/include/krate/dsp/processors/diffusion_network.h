@@ -24,6 +24,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <vector>
 
 namespace Krate {
 namespace DSP {
@@ -55,6 +56,14 @@ inline constexpr std::array<float, kNumDiffusionStages> kDelayRatiosL = {
 /// Stereo decorrelation multiplier for right channel
 inline constexpr float kStereoOffset = 1.127f;
 
+/// sin/cos of each stage's LFO phase offset (stage i: i * 45 degrees)
+inline constexpr std::array<float, kNumDiffusionStages> kStageLfoSin = {
+    0.0f, 0.70710678f, 1.0f, 0.70710678f, 0.0f, -0.70710678f, -1.0f, -0.70710678f
+};
+inline constexpr std::array<float, kNumDiffusionStages> kStageLfoCos = {
+    1.0f, 0.70710678f, 0.0f, -0.70710678f, -1.0f, -0.70710678f, 0.0f, 0.70710678f
+};
+
 // Note: kPi and kTwoPi are now defined in math_constants.h (Layer 0)
 
 // =============================================================================
@@ -154,6 +163,15 @@ private:
 /// - ModDepth: LFO modulation depth [0%, 100%]
 /// - ModRate: LFO rate [0.1Hz, 5Hz]
 ///
+/// Implementation:
+/// - Each stage is the AllpassStage recursion (single delay line, allpass
+///   interpolated read); L and R of a stage are interleaved in one buffer
+///   and processed as a lane pair
+/// - The 8 stage LFOs are one rotating sin/cos phasor plus fixed 45 degree
+///   offsets, so no trigonometry runs per sample
+/// - Smoothers that have settled are read as constants, and stages whose
+///   density enable has settled at zero are skipped for the whole block
+///
 /// Thread Safety:
 /// - Setters can be called from any thread
 /// - process() must be called from audio thread only
@@ -204,15 +222,15 @@ public:
         const float maxDelayMs = kBaseDelayMs * maxRatio + kMaxModDepthMs;
         const float maxDelaySeconds = maxDelayMs * 0.001f;
 
-        // Prepare all stages
-        for (size_t i = 0; i < kNumDiffusionStages; ++i) {
-            stagesL_[i].prepare(sampleRate, maxDelaySeconds);
-            stagesR_[i].prepare(sampleRate, maxDelaySeconds);
-        }
+        // One interleaved L/R delay region per stage (power-of-2 frames,
+        // with room for the second tap of the interpolated read)
+        maxDelaySamples_ = sampleRate * maxDelaySeconds;
+        stageFrames_ = nextPowerOf2(static_cast<size_t>(maxDelaySamples_) + 2);
+        frameMask_ = stageFrames_ - 1;
+        delayBuffer_.assign(kNumDiffusionStages * stageFrames_ * 2, 0.0f);
 
-        // Initialize LFO phase tracking
-        lfoPhase_ = 0.0f;
-        lfoPhaseIncrement_ = kTwoPi * kDefaultModRate / sampleRate;
+        // Initialize LFO phasor
+        setLfoIncrement(kDefaultModRate);
 
         // Prepare smoothers
         sizeSmoother_ = OnePoleSmoother(kDefaultSize / 100.0f);
@@ -247,11 +265,14 @@ public:
 
     /// @brief Reset all internal state.
     void reset() noexcept {
-        for (size_t i = 0; i < kNumDiffusionStages; ++i) {
-            stagesL_[i].reset();
-            stagesR_[i].reset();
+        std::fill(delayBuffer_.begin(), delayBuffer_.end(), 0.0f);
+        for (auto& state : interpState_) {
+            state.fill(0.0f);
         }
-        lfoPhase_ = 0.0f;
+        stageActive_.fill(true);
+        writeFrame_ = 0;
+        lfoSin_ = 0.0f;
+        lfoCos_ = 1.0f;
 
         // Snap smoothers to current targets
         sizeSmoother_.snapToTarget();
@@ -301,7 +322,7 @@ public:
     /// @param rateHz Rate in Hz [0.1Hz, 5Hz]
     void setModRate(float rateHz) noexcept {
         modRate_ = std::clamp(rateHz, kMinModRate, kMaxModRate);
-        lfoPhaseIncrement_ = kTwoPi * modRate_ / sampleRate_;
+        setLfoIncrement(modRate_);
     }
 
     // =========================================================================
@@ -328,78 +349,119 @@ public:
                  float* leftOut, float* rightOut,
                  size_t numSamples) noexcept {
         // Early exit for zero-length input
-        if (numSamples == 0) return;
+        if (numSamples == 0 || delayBuffer_.empty()) return;
+
+        // Settled smoothers are constant for the whole block
+        const bool sizeSettled = sizeSmoother_.isComplete();
+        const bool widthSettled = widthSmoother_.isComplete();
+        const bool modDepthSettled = modDepthSmoother_.isComplete();
+
+        // Gather the stages that contribute this block
+        std::array<size_t, kNumDiffusionStages> stages{};
+        std::array<bool, kNumDiffusionStages> enableSettled{};
+        size_t numStages = 0;
+        for (size_t i = 0; i < kNumDiffusionStages; ++i) {
+            const auto& enable = stageEnableSmoothers_[i];
+            enableSettled[i] = enable.isComplete();
+            const bool active = !(enableSettled[i] && enable.getTarget() < 0.001f);
+
+            // A stage coming back starts from silence, not stale history
+            if (active && !stageActive_[i]) {
+                clearStage(i);
+            }
+            stageActive_[i] = active;
+            if (active) {
+                stages[numStages++] = i;
+            }
+        }
+
+        // Renormalize the LFO phasor once per block (rotation rounding drift)
+        const float lfoNorm = 1.0f / std::sqrt(lfoSin_ * lfoSin_ + lfoCos_ * lfoCos_);
+        float lfoSin = lfoSin_ * lfoNorm;
+        float lfoCos = lfoCos_ * lfoNorm;
+
+        const float msToSamples = 0.001f * sampleRate_;
+        float* const buffer = delayBuffer_.data();
 
         for (size_t n = 0; n < numSamples; ++n) {
             // Update smoothed parameters
-            const float size = sizeSmoother_.process();
-            const float width = widthSmoother_.process();
-            const float modDepth = modDepthSmoother_.process();
+            const float size = sizeSettled ? sizeSmoother_.getTarget() : sizeSmoother_.process();
+            const float width = widthSettled ? widthSmoother_.getTarget() : widthSmoother_.process();
+            const float modDepth = modDepthSettled ? modDepthSmoother_.getTarget()
+                                                   : modDepthSmoother_.process();
 
             // Get current input samples
-            float sampleL = leftIn[n];
-            float sampleR = rightIn[n];
+            std::array<float, 2> sample = {leftIn[n], rightIn[n]};
 
             // Size=0% means bypass
             if (size < 0.001f) {
-                leftOut[n] = sampleL;
-                rightOut[n] = sampleR;
+                leftOut[n] = sample[0];
+                rightOut[n] = sample[1];
                 continue;
             }
 
-            // Process through each stage
-            for (size_t i = 0; i < kNumDiffusionStages; ++i) {
-                // Get stage enable level (for density crossfade)
-                const float stageEnable = stageEnableSmoothers_[i].process();
-
-                // Skip fully disabled stages
-                if (stageEnable < 0.001f) continue;
-
-                // Calculate modulated delay time for this stage
-                // We use the base LFO value and apply per-stage phase offset manually
-                // Phase offset: i * 45° = i * π/4 radians
-                const float stagePhaseOffset = static_cast<float>(i) * (kPi / 4.0f);
-                const float lfoValue = std::sin(lfoPhase_ + stagePhaseOffset);
-                const float modMs = modDepth * kMaxModDepthMs * lfoValue;
-
-                // Base delay time scaled by size
-                const float baseDelayMs = kBaseDelayMs * size;
-
-                // Left channel delay
-                const float delayMsL = baseDelayMs * kDelayRatiosL[i] + modMs;
-                const float delaySamplesL = delayMsL * 0.001f * sampleRate_;
-
-                // Right channel delay (with stereo offset)
-                const float delayMsR = baseDelayMs * kDelayRatiosL[i] * kStereoOffset + modMs;
-                const float delaySamplesR = delayMsR * 0.001f * sampleRate_;
+            // Base delay time scaled by size, and LFO depth, in samples
+            const float baseDelay = kBaseDelayMs * size * msToSamples;
+            const float modScale = modDepth * kMaxModDepthMs * msToSamples;
 
-                // Process through allpass stages
-                const float outL = stagesL_[i].process(sampleL, delaySamplesL);
-                const float outR = stagesR_[i].process(sampleR, delaySamplesR);
+            for (size_t k = 0; k < numStages; ++k) {
+                const size_t i = stages[k];
 
-                // Crossfade based on stage enable level
-                sampleL = sampleL + stageEnable * (outL - sampleL);
-                sampleR = sampleR + stageEnable * (outR - sampleR);
+                // Get stage enable level (for density crossfade)
+                const float stageEnable = enableSettled[i] ? stageEnableSmoothers_[i].getTarget()
+                                                           : stageEnableSmoothers_[i].process();
+
+                // sin(phase + i * 45 degrees) from the shared phasor
+                const float lfoValue = lfoSin * kStageLfoCos[i] + lfoCos * kStageLfoSin[i];
+                const float mod = modScale * lfoValue;
+
+                const float stageDelay = baseDelay * kDelayRatiosL[i];
+                const std::array<float, 2> delay = {stageDelay + mod,
+                                                    stageDelay * kStereoOffset + mod};
+
+                float* const stageBuffer = buffer + i * stageFrames_ * 2;
+                for (size_t ch = 0; ch < 2; ++ch) {
+                    // AllpassStage::process(): v[n-D] via allpass-interpolated
+                    // read (D - 1 for read-before-write), then
+                    // v[n] = x[n] + g * v[n-D], y[n] = -g * v[n] + v[n-D]
+                    const float readDelay = std::clamp(delay[ch], 1.0f, maxDelaySamples_) - 1.0f;
+                    const auto index0 = static_cast<size_t>(readDelay);
+                    const float frac = readDelay - static_cast<float>(index0);
+
+                    const float x0 = stageBuffer[((writeFrame_ - 1 - index0) & frameMask_) * 2 + ch];
+                    const float x1 = stageBuffer[((writeFrame_ - 2 - index0) & frameMask_) * 2 + ch];
+                    const float a = (1.0f - frac) / (1.0f + frac);
+                    const float delayedV = x0 + a * (interpState_[i][ch] - x1);
+                    interpState_[i][ch] = delayedV;
+
+                    const float v = sample[ch] + kAllpassCoeff * delayedV;
+                    const float out = -kAllpassCoeff * v + delayedV;
+                    stageBuffer[writeFrame_ * 2 + ch] = v;
+
+                    // Crossfade based on stage enable level
+                    sample[ch] += stageEnable * (out - sample[ch]);
+                }
             }
+            writeFrame_ = (writeFrame_ + 1) & frameMask_;
 
             // Apply stereo width
             // Width = 0%: mono (average)
             // Width = 100%: full stereo
-            const float mid = (sampleL + sampleR) * 0.5f;
-            const float side = (sampleL - sampleR) * 0.5f;
-            sampleL = mid + side * width;
-            sampleR = mid - side * width;
+            const float mid = (sample[0] + sample[1]) * 0.5f;
+            const float side = (sample[0] - sample[1]) * 0.5f;
 
             // Write output
-            leftOut[n] = sampleL;
-            rightOut[n] = sampleR;
+            leftOut[n] = mid + side * width;
+            rightOut[n] = mid - side * width;
 
-            // Advance LFO phase
-            lfoPhase_ += lfoPhaseIncrement_;
-            if (lfoPhase_ >= kTwoPi) {
-                lfoPhase_ -= kTwoPi;
-            }
+            // Advance LFO phase (rotate the phasor)
+            const float nextSin = lfoSin * lfoRotCos_ + lfoCos * lfoRotSin_;
+            lfoCos = lfoCos * lfoRotCos_ - lfoSin * lfoRotSin_;
+            lfoSin = nextSin;
         }
+
+        lfoSin_ = lfoSin;
+        lfoCos_ = lfoCos;
     }
 
 private:
@@ -429,13 +491,34 @@ private:
         }
     }
 
-    // Stage arrays
-    std::array<AllpassStage, kNumDiffusionStages> stagesL_;
-    std::array<AllpassStage, kNumDiffusionStages> stagesR_;
+    /// @brief Set the per-sample LFO phasor rotation for a rate in Hz.
+    void setLfoIncrement(float rateHz) noexcept {
+        const float increment = kTwoPi * rateHz / sampleRate_;
+        lfoRotSin_ = std::sin(increment);
+        lfoRotCos_ = std::cos(increment);
+    }
 
-    // Modulation (manual phase tracking for per-stage offset support)
-    float lfoPhase_ = 0.0f;
-    float lfoPhaseIncrement_ = 0.0f;
+    /// @brief Clear one stage's delay history and interpolation state.
+    void clearStage(size_t stage) noexcept {
+        auto first = delayBuffer_.begin() + static_cast<std::ptrdiff_t>(stage * stageFrames_ * 2);
+        std::fill(first, first + static_cast<std::ptrdiff_t>(stageFrames_ * 2), 0.0f);
+        interpState_[stage].fill(0.0f);
+    }
+
+    // Stage delay lines: [stage][frame][L, R], sharing one write position
+    std::vector<float> delayBuffer_;
+    size_t stageFrames_ = 0;
+    size_t frameMask_ = 0;
+    size_t writeFrame_ = 0;
+    float maxDelaySamples_ = 0.0f;
+    std::array<std::array<float, 2>, kNumDiffusionStages> interpState_{};  // Allpass interpolator
+    std::array<bool, kNumDiffusionStages> stageActive_{};
+
+    // Modulation: rotating phasor (sin, cos) of the stage-0 LFO phase
+    float lfoSin_ = 0.0f;
+    float lfoCos_ = 1.0f;
+    float lfoRotSin_ = 0.0f;
+    float lfoRotCos_ = 1.0f;
 
     // Parameter smoothers
     OnePoleSmoother sizeSmoother_;
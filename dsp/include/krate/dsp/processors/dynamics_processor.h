@@ -24,8 +24,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace Krate {
 namespace DSP {
@@ -54,6 +56,7 @@ enum class DynamicsDetectionMode : uint8_t {
 /// - RMS or Peak detection modes
 /// - Optional sidechain highpass filter
 /// - Optional lookahead for transparent limiting
+/// - Linked stereo block processing (processStereo())
 ///
 /// @par Constitution Compliance
 /// - Principle II: Real-Time Safety (noexcept, pre-allocated buffers)
@@ -127,14 +130,8 @@ public:
         envelopeFollower_.setReleaseTime(releaseTimeMs_);
         updateDetectionMode();
 
-        // Configure sidechain filter
-        sidechainFilter_.configure(
-            FilterType::Highpass,
-            sidechainCutoffHz_,
-            kButterworthQ,
-            0.0f,
-            sampleRate_
-        );
+        // Configure sidechain filters
+        configureSidechainFilters();
 
         // Configure gain smoother (5ms smoothing time for click-free changes)
         gainSmoother_.configure(5.0f, sampleRate_);
@@ -142,6 +139,15 @@ public:
         // Configure lookahead delay
         updateLookahead();
 
+        // Stereo path: gain buffer and one interleaved lookahead ring for both
+        // channels, sized for the longest lookahead plus the read-before-write
+        gainBuffer_.assign(std::max<size_t>(maxBlockSize, 1), 0.0f);
+        const auto maxLookaheadSamples =
+            static_cast<size_t>(kMaxLookaheadMs * 0.001f * sampleRate_);
+        const size_t ringFrames = std::bit_ceil(maxLookaheadSamples + 2);
+        lookaheadRing_.assign(ringFrames * 2, 0.0f);
+        lookaheadRingMask_ = ringFrames - 1;
+
         reset();
     }
 
@@ -150,8 +156,11 @@ public:
     void reset() noexcept {
         envelopeFollower_.reset();
         sidechainFilter_.reset();
+        sidechainFilterRight_.reset();
         gainSmoother_.reset();
         lookaheadDelay_.reset();
+        std::fill(lookaheadRing_.begin(), lookaheadRing_.end(), 0.0f);
+        lookaheadRingIndex_ = 0;
         currentGainReduction_ = 0.0f;
     }
 
@@ -234,6 +243,82 @@ public:
         }
     }
 
+    /// @brief Process a stereo pair with one linked detector, in-place
+    ///
+    /// Both channels drive a single detector (Peak: max of |L| and |R|;
+    /// RMS: root of the mean square) and receive the same gain, so the stereo
+    /// image holds under limiting. Detection and the gain computer run per
+    /// sample; the dB conversions only run while gain is being reduced, and
+    /// the gain is applied to both channels as block multiplies. Lookahead
+    /// uses one interleaved ring for both channels. With identical channels
+    /// the result matches processSample() on one of them.
+    ///
+    /// @param left Left channel buffer
+    /// @param right Right channel buffer
+    /// @param numSamples Number of samples per channel
+    /// @pre prepare() has been called
+    /// @note Shares detector state with processSample(); use one or the other
+    void processStereo(float* left, float* right, size_t numSamples) noexcept {
+        if (gainBuffer_.empty()) return;
+
+        const float makeup = dbToGain(autoMakeupEnabled_ ? calculateAutoMakeup() : makeupGain_dB_);
+        // Below the knee the gain computer returns 0 dB, no conversion needed
+        const float kneeStartLevel = dbToGain(kneeStart_dB_);
+
+        for (size_t offset = 0; offset < numSamples;) {
+            const size_t length = std::min(numSamples - offset, gainBuffer_.size());
+            float* blockL = left + offset;
+            float* blockR = right + offset;
+
+            // Linked detection and smoothed gain reduction (dB)
+            for (size_t i = 0; i < length; ++i) {
+                const float inL = sanitizeInput(blockL[i]);
+                const float inR = sanitizeInput(blockR[i]);
+                blockL[i] = inL;
+                blockR[i] = inR;
+
+                float detectL = inL;
+                float detectR = inR;
+                if (sidechainEnabled_) {
+                    detectL = sidechainFilter_.process(inL);
+                    detectR = sidechainFilterRight_.process(inR);
+                }
+                const float linked = (detectionMode_ == DynamicsDetectionMode::Peak)
+                    ? std::max(std::abs(detectL), std::abs(detectR))
+                    : std::sqrt((detectL * detectL + detectR * detectR) * 0.5f);
+
+                const float envelope = envelopeFollower_.processSample(linked);
+                const float gainReduction_dB = (envelope >= kneeStartLevel)
+                    ? computeGainReduction(gainToDb(envelope))
+                    : 0.0f;
+                gainSmoother_.setTarget(gainReduction_dB);
+                gainBuffer_[i] = gainSmoother_.process();
+            }
+            if (length > 0) {
+                currentGainReduction_ = detail::flushDenormal(-gainBuffer_[length - 1]);
+            }
+
+            // Linear gain including makeup
+            for (size_t i = 0; i < length; ++i) {
+                const float reduction = gainBuffer_[i];
+                gainBuffer_[i] = (reduction == 0.0f) ? makeup : dbToGain(-reduction) * makeup;
+            }
+
+            if (lookaheadSamples_ > 0) {
+                delayThroughLookaheadRing(blockL, blockR, length);
+            }
+
+            for (size_t i = 0; i < length; ++i) {
+                blockL[i] *= gainBuffer_[i];
+            }
+            for (size_t i = 0; i < length; ++i) {
+                blockR[i] *= gainBuffer_[i];
+            }
+
+            offset += length;
+        }
+    }
+
     // =========================================================================
     // Parameter Setters
     // =========================================================================
@@ -311,13 +396,7 @@ public:
     /// @param hz Cutoff in Hz, clamped to [20, 500]
     void setSidechainCutoff(float hz) noexcept {
         sidechainCutoffHz_ = std::clamp(hz, kMinSidechainHz, kMaxSidechainHz);
-        sidechainFilter_.configure(
-            FilterType::Highpass,
-            sidechainCutoffHz_,
-            kButterworthQ,
-            0.0f,
-            sampleRate_
-        );
+        configureSidechainFilters();
     }
 
     // =========================================================================
@@ -413,6 +492,51 @@ private:
         kneeEnd_dB_ = threshold_dB_ + kneeWidth_dB_ * 0.5f;
     }
 
+    /// @brief Configure the left/mono and right sidechain highpass filters
+    void configureSidechainFilters() noexcept {
+        sidechainFilter_.configure(
+            FilterType::Highpass,
+            sidechainCutoffHz_,
+            kButterworthQ,
+            0.0f,
+            sampleRate_
+        );
+        sidechainFilterRight_.configure(
+            FilterType::Highpass,
+            sidechainCutoffHz_,
+            kButterworthQ,
+            0.0f,
+            sampleRate_
+        );
+    }
+
+    /// @brief Replace NaN with 0 and Inf with +/-1e10 (FR-023)
+    [[nodiscard]] static float sanitizeInput(float input) noexcept {
+        if (detail::isNaN(input)) {
+            return 0.0f;
+        }
+        if (detail::isInf(input)) {
+            return (input > 0.0f) ? 1e10f : -1e10f;
+        }
+        return input;
+    }
+
+    /// @brief Delay a stereo block by the lookahead, the same way
+    ///        processSample() does with lookaheadDelay_ (read, then write)
+    void delayThroughLookaheadRing(float* left, float* right, size_t numSamples) noexcept {
+        float* ring = lookaheadRing_.data();
+        for (size_t i = 0; i < numSamples; ++i) {
+            const size_t readFrame = (lookaheadRingIndex_ - 1 - lookaheadSamples_) & lookaheadRingMask_;
+            const float delayedL = ring[readFrame * 2];
+            const float delayedR = ring[readFrame * 2 + 1];
+            ring[lookaheadRingIndex_ * 2] = left[i];
+            ring[lookaheadRingIndex_ * 2 + 1] = right[i];
+            lookaheadRingIndex_ = (lookaheadRingIndex_ + 1) & lookaheadRingMask_;
+            left[i] = delayedL;
+            right[i] = delayedR;
+        }
+    }
+
     /// @brief Update detection mode in envelope follower
     void updateDetectionMode() noexcept {
         switch (detectionMode_) {
@@ -467,6 +591,13 @@ private:
     OnePoleSmoother gainSmoother_;
     DelayLine lookaheadDelay_;
     Biquad sidechainFilter_;
+    Biquad sidechainFilterRight_;   ///< Right channel of processStereo()
+
+    // Stereo block state (allocated in prepare)
+    std::vector<float> gainBuffer_;
+    std::vector<float> lookaheadRing_;  ///< Interleaved L/R frames
+    size_t lookaheadRingMask_ = 0;
+    size_t lookaheadRingIndex_ = 0;
 };
 
 }  // namespace DSP
@@ -14,11 +14,14 @@
 #include <krate/dsp/core/grain_envelope.h>
 #include <krate/dsp/core/pitch_utils.h>
 #include <krate/dsp/primitives/delay_line.h>
+#include <krate/dsp/primitives/grain_bank.h>
 #include <krate/dsp/primitives/grain_pool.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <span>
 #include <utility>
-#include <vector>
 
 namespace Krate::DSP {
 
@@ -43,13 +46,16 @@ public:
     /// @param maxEnvelopeSize Maximum envelope lookup table size
     void prepare(double sampleRate, size_t maxEnvelopeSize = kDefaultEnvelopeSize) noexcept {
         sampleRate_ = sampleRate;
-        envelopeTableSize_ = maxEnvelopeSize;
 
-        // Pre-allocate envelope table
-        envelopeTable_.resize(maxEnvelopeSize);
+        // Fetch every envelope shape from the shared registry up front so
+        // setEnvelopeType() is a pointer swap (no locking or allocation)
+        for (size_t i = 0; i < kNumEnvelopeTypes; ++i) {
+            envelopeTables_[i] =
+                GrainEnvelope::shared(static_cast<GrainEnvelopeType>(i), maxEnvelopeSize);
+        }
 
-        // Generate default Hann envelope
-        regenerateEnvelope(GrainEnvelopeType::Hann);
+        // Default Hann envelope
+        selectEnvelope(GrainEnvelopeType::Hann);
     }
 
     /// Reset processor state
@@ -57,11 +63,11 @@ public:
         // Nothing to reset - stateless per-grain processing
     }
 
-    /// Set envelope type (regenerates lookup table)
+    /// Set envelope type (switches lookup table)
     /// @param type New envelope type
     void setEnvelopeType(GrainEnvelopeType type) noexcept {
         if (type != currentEnvelopeType_) {
-            regenerateEnvelope(type);
+            selectEnvelope(type);
         }
     }
 
@@ -106,6 +112,84 @@ public:
         grain.active = true;
     }
 
+    /// Initialize a GrainBank slot with given parameters
+    /// Same setup as the Grain overload, with amplitude and pan folded into
+    /// per-channel gains.
+    /// @param bank Grain bank owning the slot
+    /// @param slot Slot returned by GrainBank::acquire()
+    /// @param params Grain parameters
+    void initializeGrain(GrainBank& bank, size_t slot, const GrainParams& params) noexcept {
+        Grain grain{};
+        initializeGrain(grain, params);
+
+        bank.readPosition[slot] = grain.readPosition;
+        bank.readIncrement[slot] = std::abs(grain.playbackRate);
+        bank.envelopePhase[slot] = grain.envelopePhase;
+        bank.envelopeIncrement[slot] = grain.envelopeIncrement;
+        bank.gainL[slot] = grain.amplitude * grain.panL;
+        bank.gainR[slot] = grain.amplitude * grain.panR;
+    }
+
+    /// Render one grain into a block of accumulators
+    ///
+    /// The delay lines must already hold the block's input: sample i is read
+    /// as it would have been right after its own write, i.e.
+    /// (writtenSamples - 1 - i) writes ago. Samples at or past writtenSamples
+    /// (input not written, e.g. frozen) read the current buffer state.
+    ///
+    /// @param bank Grain bank owning the slot
+    /// @param slot Grain to render (its state is advanced in place)
+    /// @param delayBufferL Left channel delay buffer
+    /// @param delayBufferR Right channel delay buffer
+    /// @param maxReadDelay Largest delay (samples) a grain may read
+    /// @param accL Left accumulator for the block (added to)
+    /// @param accR Right accumulator for the block (added to)
+    /// @param begin First block sample to render
+    /// @param end One past the last block sample to render
+    /// @param writtenSamples Number of leading block samples that were written
+    /// @return One past the last rendered sample; less than @p end when the
+    ///         grain completed inside the range
+    size_t renderGrain(GrainBank& bank, size_t slot,
+                       const DelayLine& delayBufferL, const DelayLine& delayBufferR,
+                       float maxReadDelay, float* accL, float* accR,
+                       size_t begin, size_t end, size_t writtenSamples) noexcept {
+        float position = bank.readPosition[slot];
+        float phase = bank.envelopePhase[slot];
+        const float positionIncrement = bank.readIncrement[slot];
+        const float phaseIncrement = bank.envelopeIncrement[slot];
+        const float gainL = bank.gainL[slot];
+        const float gainR = bank.gainR[slot];
+        const float* table = envelopeTable_.data();
+        const size_t tableSize = envelopeTable_.size();
+
+        size_t i = begin;
+        while (i < end) {
+            const float envelope = GrainEnvelope::lookup(table, tableSize, phase);
+
+            const float delaySamples = std::clamp(position, 0.0f, maxReadDelay);
+            const size_t samplesAgo = (i < writtenSamples) ? writtenSamples - 1 - i : 0;
+            accL[i] += delayBufferL.readLinear(delaySamples, samplesAgo) * envelope * gainL;
+            accR[i] += delayBufferR.readLinear(delaySamples, samplesAgo) * envelope * gainR;
+
+            phase += phaseIncrement;
+            position += positionIncrement;
+            ++i;
+
+            if (phase >= 1.0f) {
+                break;
+            }
+        }
+
+        bank.readPosition[slot] = position;
+        bank.envelopePhase[slot] = phase;
+        return i;
+    }
+
+    /// Check if a bank grain has completed playback
+    [[nodiscard]] static bool isGrainComplete(const GrainBank& bank, size_t slot) noexcept {
+        return bank.envelopePhase[slot] >= 1.0f;
+    }
+
     /// Process one sample for a grain
     /// @param grain Grain state to process
     /// @param delayBufferL Left channel delay buffer
@@ -121,7 +205,7 @@ public:
 
         // Get envelope value
         const float envelope =
-            GrainEnvelope::lookup(envelopeTable_.data(), envelopeTableSize_,
+            GrainEnvelope::lookup(envelopeTable_.data(), envelopeTable_.size(),
                                   grain.envelopePhase);
 
         // Read from delay buffers with interpolation
@@ -158,14 +242,16 @@ public:
 
 private:
     static constexpr float kHalfPi = 1.5707963267948966f;
+    static constexpr size_t kNumEnvelopeTypes = 4;
 
-    void regenerateEnvelope(GrainEnvelopeType type) noexcept {
-        GrainEnvelope::generate(envelopeTable_.data(), envelopeTableSize_, type);
+    void selectEnvelope(GrainEnvelopeType type) noexcept {
+        envelopeTable_ = envelopeTables_[static_cast<size_t>(type)];
         currentEnvelopeType_ = type;
     }
 
-    std::vector<float> envelopeTable_;
-    size_t envelopeTableSize_ = kDefaultEnvelopeSize;
+    // Shared read-only tables (TableRegistry), one per GrainEnvelopeType
+    std::array<std::span<const float>, kNumEnvelopeTypes> envelopeTables_{};
+    std::span<const float> envelopeTable_;
     GrainEnvelopeType currentEnvelopeType_ = GrainEnvelopeType::Hann;
     double sampleRate_ = 44100.0;
 };
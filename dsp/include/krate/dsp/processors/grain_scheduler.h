@@ -14,6 +14,8 @@
 #include <krate/dsp/core/random.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 
 namespace Krate::DSP {
@@ -74,29 +76,63 @@ public:
         samplesUntilNextGrain_ -= 1.0f;
 
         if (samplesUntilNextGrain_ <= 0.0f) {
-            // Time for a new grain
-            if (mode_ == SchedulingMode::Asynchronous && jitter_ > 0.0f) {
-                // Add user-controllable jitter for stochastic timing
-                // jitter_ = 0: no variation (like sync mode)
-                // jitter_ = 1: ±50% variation (maximum randomness)
-                const float randomOffset = rng_.nextFloat();  // -1 to +1
-                const float jitterRange = jitter_ * 0.5f;     // Max ±50%
-                samplesUntilNextGrain_ = interonsetSamples_ * (1.0f + randomOffset * jitterRange);
-            } else {
-                // Regular intervals (sync mode or jitter = 0)
-                samplesUntilNextGrain_ = interonsetSamples_;
-            }
+            scheduleNext();
             return true;
         }
 
         return false;
     }
 
+    /// Process a block of samples
+    /// Produces the same triggers (and consumes the same random numbers) as
+    /// calling process() numSamples times, without the per-sample call.
+    /// @param numSamples Number of samples to advance
+    /// @param triggerOffsets Receives the offset of each trigger within the
+    ///        block, ascending. Must hold numSamples entries.
+    /// @return Number of triggers written to triggerOffsets
+    [[nodiscard]] size_t processBlock(size_t numSamples, size_t* triggerOffsets) noexcept {
+        size_t count = 0;
+        size_t pos = 0;
+
+        while (pos < numSamples) {
+            const auto remaining = static_cast<float>(numSamples - pos);
+            if (samplesUntilNextGrain_ > remaining) {
+                // No trigger before the end of the block
+                samplesUntilNextGrain_ -= remaining;
+                break;
+            }
+
+            // process() fires on the first decrement that reaches <= 0
+            const size_t step = (samplesUntilNextGrain_ <= 1.0f)
+                ? 1
+                : static_cast<size_t>(std::ceil(samplesUntilNextGrain_));
+            pos += step;
+            triggerOffsets[count++] = pos - 1;
+            scheduleNext();
+        }
+
+        return count;
+    }
+
     /// Seed RNG for reproducible behavior (useful for testing)
     /// @param seedValue Seed for random number generator
     void seed(uint32_t seedValue) noexcept { rng_ = Xorshift32(seedValue); }
 
 private:
+    void scheduleNext() noexcept {
+        if (mode_ == SchedulingMode::Asynchronous && jitter_ > 0.0f) {
+            // Add user-controllable jitter for stochastic timing
+            // jitter_ = 0: no variation (like sync mode)
+            // jitter_ = 1: ±50% variation (maximum randomness)
+            const float randomOffset = rng_.nextFloat();  // -1 to +1
+            const float jitterRange = jitter_ * 0.5f;     // Max ±50%
+            samplesUntilNextGrain_ = interonsetSamples_ * (1.0f + randomOffset * jitterRange);
+        } else {
+            // Regular intervals (sync mode or jitter = 0)
+            samplesUntilNextGrain_ = interonsetSamples_;
+        }
+    }
+
     void calculateInteronset() noexcept {
         // Interonset interval = samples per grain = sampleRate / density
         interonsetSamples_ = static_cast<float>(sampleRate_) / density_;
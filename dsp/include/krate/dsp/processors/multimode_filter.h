@@ -1,11 +1,12 @@
 // ==============================================================================
 // Layer 2: DSP Processor - Multimode Filter
 // ==============================================================================
-// Complete filter module composing Layer 1 primitives (Biquad, OnePoleSmoother,
-// Oversampler) into a unified filter processor with:
+// Complete filter module composing Layer 1 primitives (ModulatedFilter,
+// OnePoleSmoother, Oversampler) into a unified filter processor with:
 // - 8 filter types (LP/HP/BP/Notch/Allpass/LowShelf/HighShelf/Peak)
 // - Selectable slopes for LP/HP/BP/Notch (12/24/36/48 dB/oct)
-// - Coefficient smoothing for click-free modulation
+// - Coefficient smoothing for click-free modulation (control-rate
+//   coefficients, interpolated per sample)
 // - Optional pre-filter drive/saturation with oversampling
 //
 // Constitution Compliance:
@@ -21,6 +22,7 @@
 #pragma once
 
 #include <krate/dsp/primitives/biquad.h>
+#include <krate/dsp/primitives/modulated_filter.h>
 #include <krate/dsp/primitives/smoother.h>
 #include <krate/dsp/primitives/oversampler.h>
 #include <krate/dsp/core/db_utils.h>
@@ -68,8 +70,8 @@ enum class FilterSlope : uint8_t {
 
 /// @brief Layer 2 DSP Processor - Complete filter module with drive
 ///
-/// Composes Layer 1 primitives (Biquad, OnePoleSmoother, Oversampler) into
-/// a unified filter processor with:
+/// Composes Layer 1 primitives (ModulatedFilter, OnePoleSmoother, Oversampler)
+/// into a unified filter processor with:
 /// - 8 filter types (LP/HP/BP/Notch/Allpass/Shelf/Peak)
 /// - Selectable slopes for LP/HP/BP/Notch (12/24/36/48 dB/oct)
 /// - Coefficient smoothing for click-free modulation
@@ -153,6 +155,10 @@ public:
         // Pre-allocate oversampled buffer
         oversampledBuffer_.resize(maxBlockSize * 2);  // 2x oversampling
 
+        for (auto& stage : stages_) {
+            stage.prepare(sampleRate);
+        }
+
         // Reset filter state
         reset();
 
@@ -201,7 +207,9 @@ public:
     /// @brief Process single sample (for modulation sources)
     /// @param input Input sample
     /// @return Filtered output sample
-    /// @note Real-time safe. Recalculates coefficients per sample (expensive).
+    /// @note Real-time safe. Parameters are smoothed per sample; the stages
+    ///       recalculate coefficients every ModulatedFilter control interval
+    ///       and interpolate in between.
     [[nodiscard]] float processSample(float input) noexcept {
         if (!prepared_) {
             return input;
@@ -214,7 +222,7 @@ public:
         (void)gainSmooth_.process();
         (void)driveSmooth_.process();
 
-        // Update coefficients based on smoothed values
+        // Hand smoothed values to the stages (applied at their control rate)
         updateCoefficientsFromSmoothed();
 
         // Apply drive if enabled
@@ -233,6 +241,47 @@ public:
         return sample;
     }
 
+    /// @brief Process a buffer exactly as processSample() would, sample by sample
+    /// @param buffer Audio samples (in-place processing)
+    /// @param numSamples Number of samples to process
+    /// @note Real-time safe. Unlike process() there is no oversampled drive
+    ///       and no per-block coefficient snap, so this can replace a
+    ///       processSample() loop (e.g. in a feedback path). Once the
+    ///       parameter smoothers have settled, drive and the stages run as
+    ///       block loops; while they move it falls back to processSample().
+    void processSamples(float* buffer, size_t numSamples) noexcept {
+        if (!prepared_) {
+            return;
+        }
+
+        if (!cutoffSmooth_.isComplete() || !resonanceSmooth_.isComplete() ||
+            !gainSmooth_.isComplete() || !driveSmooth_.isComplete()) {
+            for (size_t i = 0; i < numSamples; ++i) {
+                buffer[i] = processSample(buffer[i]);
+            }
+            return;
+        }
+
+        // Settled smoothers return their target from process()
+        cutoffSmooth_.snapToTarget();
+        resonanceSmooth_.snapToTarget();
+        gainSmooth_.snapToTarget();
+        driveSmooth_.snapToTarget();
+        updateCoefficientsFromSmoothed();
+
+        if (drive_ > 0.0f) {
+            const float driveGain = dbToGain(driveSmooth_.getCurrentValue());
+            for (size_t i = 0; i < numSamples; ++i) {
+                buffer[i] = std::tanh(buffer[i] * driveGain);
+            }
+        }
+
+        const size_t activeStages = getActiveStages();
+        for (size_t s = 0; s < activeStages; ++s) {
+            stages_[s].processBlock(buffer, numSamples);
+        }
+    }
+
     // -------------------------------------------------------------------------
     // Parameter Setters (all real-time safe)
     // -------------------------------------------------------------------------
@@ -350,42 +399,38 @@ private:
 
     /// @brief Calculate and set coefficients for all active stages
     void updateCoefficients() noexcept {
-        const float sr = static_cast<float>(sampleRate_);
-        const size_t activeStages = getActiveStages();
+        setStageParameters(cutoff_, resonance_, gain_);
 
-        // For LP/HP/BP/Notch with multiple stages, use Butterworth Q values
-        if (activeStages > 1 && (type_ == FilterType::Lowpass ||
-                                  type_ == FilterType::Highpass ||
-                                  type_ == FilterType::Bandpass ||
-                                  type_ == FilterType::Notch)) {
-            for (size_t i = 0; i < activeStages; ++i) {
-                const float stageQ = butterworthQ(i, activeStages);
-                stages_[i].configure(type_, cutoff_, stageQ, gain_, sr);
-            }
-        } else {
-            // Single stage or Allpass/Shelf/Peak: use user-specified Q
-            stages_[0].configure(type_, cutoff_, resonance_, gain_, sr);
+        // Block processing applies target parameters immediately
+        const size_t activeStages = getActiveStages();
+        for (size_t i = 0; i < activeStages; ++i) {
+            stages_[i].snapToTarget();
         }
     }
 
-    /// @brief Update coefficients from smoothed values (for processSample)
+    /// @brief Update stage targets from smoothed values (for processSample)
     void updateCoefficientsFromSmoothed() noexcept {
-        const float sr = static_cast<float>(sampleRate_);
-        const float smoothedCutoff = cutoffSmooth_.getCurrentValue();
-        const float smoothedQ = resonanceSmooth_.getCurrentValue();
-        const float smoothedGain = gainSmooth_.getCurrentValue();
+        setStageParameters(cutoffSmooth_.getCurrentValue(),
+                           resonanceSmooth_.getCurrentValue(),
+                           gainSmooth_.getCurrentValue());
+    }
+
+    /// @brief Set target parameters on all active stages
+    void setStageParameters(float cutoff, float resonance, float gain) noexcept {
         const size_t activeStages = getActiveStages();
 
+        // For LP/HP/BP/Notch with multiple stages, use Butterworth Q values
         if (activeStages > 1 && (type_ == FilterType::Lowpass ||
                                   type_ == FilterType::Highpass ||
                                   type_ == FilterType::Bandpass ||
                                   type_ == FilterType::Notch)) {
             for (size_t i = 0; i < activeStages; ++i) {
                 const float stageQ = butterworthQ(i, activeStages);
-                stages_[i].configure(type_, smoothedCutoff, stageQ, smoothedGain, sr);
+                stages_[i].setParameters(type_, cutoff, stageQ, gain);
             }
         } else {
-            stages_[0].configure(type_, smoothedCutoff, smoothedQ, smoothedGain, sr);
+            // Single stage or Allpass/Shelf/Peak: use user-specified Q
+            stages_[0].setParameters(type_, cutoff, resonance, gain);
         }
     }
 
@@ -423,9 +468,9 @@ private:
     bool prepared_ = false;
 
     // Filter stages (always allocate 4, use activeStages_ based on slope/type)
-    // Using std::array<Biquad, 4> instead of BiquadCascade<N> template
-    // to allow runtime slope changes without template complexity
-    std::array<Biquad, kMaxStages> stages_;
+    // Using std::array instead of a cascade template to allow runtime slope
+    // changes without template complexity
+    std::array<ModulatedFilter, kMaxStages> stages_;
 
     // Parameter smoothing
     OnePoleSmoother cutoffSmooth_;
@@ -14,15 +14,17 @@
 // Quality Modes:
 // - Simple: Delay-line modulation (zero latency, audible artifacts)
 // - Granular: OLA grains (~46ms latency, good quality)
-// - PhaseVocoder: STFT-based (~116ms latency, excellent quality)
+// - PhaseVocoder: STFT-based (23-93ms latency by PhaseVocoderQuality, excellent quality)
 // ==============================================================================
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cmath>
 #include <memory>
+#include <span>
 #include <vector>
 #include <algorithm>
 
@@ -33,9 +35,8 @@
 
 // Layer 1 dependencies
 #include <krate/dsp/primitives/delay_line.h>
+#include <krate/dsp/primitives/fft.h>
 #include <krate/dsp/primitives/smoother.h>
-#include <krate/dsp/primitives/stft.h>
-#include <krate/dsp/primitives/spectral_buffer.h>
 #include <krate/dsp/core/window_functions.h>
 
 namespace Krate::DSP {
@@ -48,7 +49,14 @@ namespace Krate::DSP {
 enum class PitchMode : std::uint8_t {
     Simple = 0,      ///< Delay-line modulation, zero latency, audible artifacts
     Granular = 1,    ///< OLA grains, ~46ms latency, good quality
-    PhaseVocoder = 2 ///< STFT-based, ~116ms latency, excellent quality
+    PhaseVocoder = 2 ///< STFT-based, 23-93ms latency, excellent quality
+};
+
+/// Phase vocoder frame size (hop = fftSize / 4 at every size)
+enum class PhaseVocoderQuality : std::uint8_t {
+    Low = 0,     ///< 1024-point FFT, 256 hop, ~23ms latency at 44.1kHz
+    Medium = 1,  ///< 2048-point FFT, 512 hop, ~46ms latency
+    High = 2     ///< 4096-point FFT, 1024 hop, ~93ms latency (default)
 };
 
 // ==============================================================================
@@ -61,7 +69,8 @@ enum class PitchMode : std::uint8_t {
 /// Supports three quality modes with different latency/quality trade-offs:
 /// - Simple: Zero latency using delay-line modulation (audible artifacts)
 /// - Granular: Low latency (~46ms) using overlap-add grains
-/// - PhaseVocoder: High quality using STFT with phase locking (~116ms latency)
+/// - PhaseVocoder: High quality using STFT with phase locking (23-93ms latency,
+///   selected with setPhaseVocoderQuality())
 ///
 /// Formant preservation is available in Granular and PhaseVocoder modes
 /// to prevent the "chipmunk" effect when shifting vocals.
@@ -166,6 +175,17 @@ public:
     /// @note Real-time safe: no allocations, no blocking
     void process(const float* input, float* output, std::size_t numSamples) noexcept;
 
+    /// @brief Process a stereo pair with the same pitch settings
+    ///
+    /// Equivalent to two processors with identical parameters, but the
+    /// PhaseVocoder mode analyses both channels on the same hop with one set
+    /// of FFT plans and scratch buffers. In-place processing is supported.
+    ///
+    /// @pre numSamples <= maxBlockSize passed to prepare()
+    /// @note Real-time safe: no allocations, no blocking
+    void processStereo(const float* inputL, const float* inputR,
+                       float* outputL, float* outputR, std::size_t numSamples) noexcept;
+
     //=========================================================================
     // Parameters - Mode
     //=========================================================================
@@ -182,6 +202,17 @@ public:
     /// @return Current PitchMode
     [[nodiscard]] PitchMode getMode() const noexcept;
 
+    /// @brief Set the PhaseVocoder frame size (latency/CPU vs. quality)
+    ///
+    /// All sizes are prepared up front, so this is real-time safe. A change
+    /// clears the phase vocoder's stream state and changes its latency.
+    ///
+    /// @param quality Low (1024), Medium (2048) or High (4096, default)
+    void setPhaseVocoderQuality(PhaseVocoderQuality quality) noexcept;
+
+    /// @brief Get the PhaseVocoder frame size setting
+    [[nodiscard]] PhaseVocoderQuality getPhaseVocoderQuality() const noexcept;
+
     //=========================================================================
     // Parameters - Pitch
     //=========================================================================
@@ -251,7 +282,7 @@ public:
     /// Returns the algorithmic latency for the current mode:
     /// - Simple: 0 samples
     /// - Granular: ~grain_size samples (~2048 at 44.1kHz)
-    /// - PhaseVocoder: FFT_SIZE + HOP_SIZE samples (~5120 at 44.1kHz)
+    /// - PhaseVocoder: FFT size (1024, 2048 or 4096 by PhaseVocoderQuality)
     ///
     /// @return Latency in samples for current mode
     ///
@@ -726,11 +757,10 @@ public:
 
         // Pre-compute Hann window for crossfade (using first half: 0 to 1)
         // The first half of a Hann window rises smoothly from 0 to 1
-        // We allocate full window but only use first half for fade-in
+        // We fetch the full (shared) window but only use first half for fade-in
         crossfadeWindowSize_ = static_cast<std::size_t>(maxDelay_ * 0.5f);
         const std::size_t fullWindowSize = crossfadeWindowSize_ * 2;
-        crossfadeWindow_.resize(fullWindowSize);
-        Window::generateHann(crossfadeWindow_.data(), fullWindowSize);
+        crossfadeWindow_ = Window::shared(WindowType::Hann, fullWindowSize);
         // Only first half (indices 0 to crossfadeWindowSize_-1) will be used
 
         reset();
@@ -837,7 +867,7 @@ private:
     }
 
     std::vector<float> buffer_;
-    std::vector<float> crossfadeWindow_;
+    std::span<const float> crossfadeWindow_;  // Shared (TableRegistry)
     std::size_t grainSize_ = 0;
     std::size_t crossfadeWindowSize_ = 0;
     std::size_t bufferSize_ = 0;
@@ -865,89 +895,110 @@ private:
 /// 4. Resynthesizing using overlap-add
 ///
 /// Quality is significantly higher than delay-line methods, especially
-/// for large pitch shifts, at the cost of ~116ms latency.
+/// for large pitch shifts, at the cost of one FFT frame of latency.
+///
+/// The frame size is selected at runtime (PhaseVocoderQuality). prepare()
+/// builds one FFT plan, window and formant preserver per quality, and the
+/// stream buffers are sized for the largest frame and shared by all of
+/// them, so switching quality only clears state and never allocates.
+///
+/// Up to two channels share the framing: processStereo() analyses, shifts
+/// and resynthesizes both channels on the same hop through the same plans
+/// and scratch spectra.
 ///
 /// Sources:
 /// - Dolson, "The Phase Vocoder: A Tutorial"
 /// - Laroche & Dolson, "Improved Phase Vocoder Time-Scale Modification"
 ///
-/// Latency: FFT_SIZE + HOP_SIZE samples (~116ms at 44.1kHz with 4096 FFT)
+/// Latency: exactly fftSize samples (~93ms at 44.1kHz for High, ~23ms for Low)
 class PhaseVocoderPitchShifter {
 public:
-    static constexpr std::size_t kFFTSize = 4096;      // ~93ms at 44.1kHz
-    static constexpr std::size_t kHopSize = 1024;      // 25% overlap (4x)
+    static constexpr std::size_t kMaxFFTSize = 4096;            // ~93ms at 44.1kHz
+    static constexpr std::size_t kOverlap = 4;                  // Hop = fftSize / 4 (75% overlap)
+    static constexpr std::size_t kMaxHopSize = kMaxFFTSize / kOverlap;
+    static constexpr std::size_t kNumQualities = 3;
+    static constexpr std::size_t kMaxChannels = 2;
     // Note: kPi and kTwoPi are now defined in math_constants.h (Layer 0)
 
+    /// @brief FFT size used by a quality setting (1024, 2048 or 4096)
+    [[nodiscard]] static constexpr std::size_t fftSizeFor(PhaseVocoderQuality quality) noexcept {
+        return std::size_t{1024} << static_cast<std::size_t>(quality);
+    }
+
     PhaseVocoderPitchShifter() = default;
 
     void prepare(double sampleRate, std::size_t /*maxBlockSize*/) noexcept {
         sampleRate_ = static_cast<float>(sampleRate);
 
-        // Prepare STFT analysis
-        stft_.prepare(kFFTSize, kHopSize, WindowType::Hann);
-
-        // Prepare overlap-add synthesis
-        ola_.prepare(kFFTSize, kHopSize, WindowType::Hann);
-
-        // Prepare spectral buffers
-        analysisSpectrum_.prepare(kFFTSize);
-        synthesisSpectrum_.prepare(kFFTSize);
-
-        // Allocate phase tracking arrays
-        const std::size_t numBins = kFFTSize / 2 + 1;
-        prevPhase_.resize(numBins, 0.0f);
-        synthPhase_.resize(numBins, 0.0f);
-        magnitude_.resize(numBins, 0.0f);
-        frequency_.resize(numBins, 0.0f);
+        // One FFT plan, window and formant preserver per quality
+        for (std::size_t q = 0; q < kNumQualities; ++q) {
+            FramePlan& plan = plans_[q];
+            plan.fftSize = fftSizeFor(static_cast<PhaseVocoderQuality>(q));
+            plan.hopSize = plan.fftSize / kOverlap;
+            plan.fft.prepare(plan.fftSize);
+            plan.window = Window::shared(WindowType::Hann, plan.fftSize);
+
+            // COLA normalization: sum of the overlapping analysis windows
+            float colaSum = 0.0f;
+            for (std::size_t idx = 0; idx < plan.fftSize; idx += plan.hopSize) {
+                colaSum += plan.window[idx];
+            }
+            plan.colaNormalization = (colaSum > 0.0f) ? (1.0f / colaSum) : 1.0f;
 
-        // Calculate expected phase advance per bin per hop
-        // For bin k: expected_advance = 2π * k * hop_size / fft_size
-        expectedPhaseInc_.resize(numBins);
-        for (std::size_t k = 0; k < numBins; ++k) {
-            expectedPhaseInc_[k] = kTwoPi * static_cast<float>(k) *
-                                   static_cast<float>(kHopSize) /
-                                   static_cast<float>(kFFTSize);
+            plan.formantPreserver.prepare(plan.fftSize, sampleRate);
         }
 
-        // Output buffer for resampled output
-        outputBuffer_.resize(kFFTSize * 4, 0.0f);
-        outputReadPos_ = 0;
-        outputWritePos_ = 0;
-        outputSamplesReady_ = 0;
-
-        // Input buffer for accumulating samples
-        inputBuffer_.resize(kFFTSize * 4, 0.0f);
-        inputWritePos_ = 0;
-        inputSamplesReady_ = 0;
-
-        // Prepare formant preservation
-        formantPreserver_.prepare(kFFTSize, sampleRate);
-        originalEnvelope_.resize(numBins, 1.0f);
-        shiftedEnvelope_.resize(numBins, 1.0f);
-        shiftedMagnitude_.resize(numBins, 0.0f);
-
+        // Stream state and scratch, sized for the largest frame
+        const std::size_t maxBins = kMaxFFTSize / 2 + 1;
+        for (Channel& channel : channels_) {
+            channel.input.assign(kMaxFFTSize, 0.0f);
+            channel.overlap.assign(kMaxFFTSize, 0.0f);
+            channel.ready.assign(kMaxHopSize, 0.0f);
+            channel.prevPhase.assign(maxBins, 0.0f);
+            channel.synthPhase.assign(maxBins, 0.0f);
+        }
+        frame_.assign(kMaxFFTSize, 0.0f);
+        analysis_.assign(maxBins, Complex{});
+        synthesis_.assign(maxBins, Complex{});
+        magnitude_.assign(maxBins, 0.0f);
+        frequency_.assign(maxBins, 0.0f);
+        expectedPhaseInc_.assign(maxBins, 0.0f);
+        originalEnvelope_.assign(maxBins, 1.0f);
+        shiftedEnvelope_.assign(maxBins, 1.0f);
+        shiftedMagnitude_.assign(maxBins, 0.0f);
+
+        updateExpectedPhaseIncrements();
         reset();
     }
 
     void reset() noexcept {
-        stft_.reset();
-        ola_.reset();
-        analysisSpectrum_.reset();
-        synthesisSpectrum_.reset();
-        formantPreserver_.reset();
-
-        std::fill(prevPhase_.begin(), prevPhase_.end(), 0.0f);
-        std::fill(synthPhase_.begin(), synthPhase_.end(), 0.0f);
-        std::fill(inputBuffer_.begin(), inputBuffer_.end(), 0.0f);
-        std::fill(outputBuffer_.begin(), outputBuffer_.end(), 0.0f);
+        for (FramePlan& plan : plans_) {
+            plan.fft.reset();
+            plan.formantPreserver.reset();
+        }
+        for (Channel& channel : channels_) {
+            std::fill(channel.input.begin(), channel.input.end(), 0.0f);
+            std::fill(channel.overlap.begin(), channel.overlap.end(), 0.0f);
+            std::fill(channel.ready.begin(), channel.ready.end(), 0.0f);
+            std::fill(channel.prevPhase.begin(), channel.prevPhase.end(), 0.0f);
+            std::fill(channel.synthPhase.begin(), channel.synthPhase.end(), 0.0f);
+        }
         std::fill(originalEnvelope_.begin(), originalEnvelope_.end(), 1.0f);
         std::fill(shiftedEnvelope_.begin(), shiftedEnvelope_.end(), 1.0f);
+        hopFill_ = 0;
+    }
 
-        inputWritePos_ = 0;
-        inputSamplesReady_ = 0;
-        outputReadPos_ = 0;
-        outputWritePos_ = 0;
-        outputSamplesReady_ = 0;
+    /// @brief Select the frame size; clears the stream state when it changes
+    /// @note Real-time safe (all qualities are prepared up front)
+    void setQuality(PhaseVocoderQuality quality) noexcept {
+        if (quality == quality_) return;
+        quality_ = quality;
+        updateExpectedPhaseIncrements();
+        reset();
+    }
+
+    [[nodiscard]] PhaseVocoderQuality getQuality() const noexcept {
+        return quality_;
     }
 
     /// @brief Enable or disable formant preservation
@@ -962,81 +1013,130 @@ public:
 
     void process(const float* input, float* output, std::size_t numSamples,
                  float pitchRatio) noexcept {
-        // At unity pitch, pass through (with latency compensation)
-        if (std::abs(pitchRatio - 1.0f) < 0.0001f) {
-            processUnityPitch(input, output, numSamples);
-            return;
-        }
-
-        pitchRatio = std::clamp(pitchRatio, 0.25f, 4.0f);
+        const std::array<const float*, kMaxChannels> inputs{input, nullptr};
+        const std::array<float*, kMaxChannels> outputs{output, nullptr};
+        processChannels(inputs, outputs, 1, numSamples, pitchRatio);
+    }
 
-        // Push input samples to STFT
-        stft_.pushSamples(input, numSamples);
+    /// @brief Shift two channels with shared framing (in-place allowed)
+    void processStereo(const float* inputL, const float* inputR,
+                       float* outputL, float* outputR, std::size_t numSamples,
+                       float pitchRatio) noexcept {
+        const std::array<const float*, kMaxChannels> inputs{inputL, inputR};
+        const std::array<float*, kMaxChannels> outputs{outputL, outputR};
+        processChannels(inputs, outputs, 2, numSamples, pitchRatio);
+    }
 
-        // Process as many frames as possible
-        while (stft_.canAnalyze()) {
-            // Analyze frame
-            stft_.analyze(analysisSpectrum_);
+    [[nodiscard]] std::size_t getLatencySamples() const noexcept {
+        // An input sample leaves the overlap-add after every frame covering it
+        return fftSizeFor(quality_);
+    }
 
-            // Phase vocoder pitch shift
-            processFrame(pitchRatio);
+private:
+    /// Per-quality transform setup (built in prepare())
+    struct FramePlan {
+        FFT fft;
+        std::span<const float> window;  // Shared (TableRegistry)
+        FormantPreserver formantPreserver;
+        float colaNormalization = 1.0f;
+        std::size_t fftSize = 0;
+        std::size_t hopSize = 0;
+    };
+
+    /// Per-channel stream state (sized for kMaxFFTSize)
+    struct Channel {
+        std::vector<float> input;       // Last fftSize input samples, oldest first
+        std::vector<float> overlap;     // Overlap-add accumulator
+        std::vector<float> ready;       // Finished hop, emitted during the next hop
+        std::vector<float> prevPhase;   // Previous frame phases
+        std::vector<float> synthPhase;  // Accumulated synthesis phases
+    };
+
+    /// @brief Stream the channels through the frame engine
+    ///
+    /// Input fills the newest hop of each channel's frame while the previous
+    /// frame's finished hop is read out, so the latency is fftSize samples
+    /// regardless of block size.
+    void processChannels(const std::array<const float*, kMaxChannels>& inputs,
+                         const std::array<float*, kMaxChannels>& outputs,
+                         std::size_t numChannels, std::size_t numSamples,
+                         float pitchRatio) noexcept {
+        if (channels_[0].input.empty()) return;
+
+        // At unity pitch the spectrum passes through (keeping the latency)
+        const bool unity = std::abs(pitchRatio - 1.0f) < 0.0001f;
+        pitchRatio = std::clamp(pitchRatio, 0.25f, 4.0f);
 
-            // Synthesize frame
-            ola_.synthesize(synthesisSpectrum_);
-        }
+        const FramePlan& plan = plans_[static_cast<std::size_t>(quality_)];
+        const std::size_t newest = plan.fftSize - plan.hopSize;
 
-        // Pull available output samples
-        std::size_t samplesToOutput = std::min(numSamples, ola_.samplesAvailable());
-        if (samplesToOutput > 0) {
-            ola_.pullSamples(output, samplesToOutput);
-        }
+        std::size_t offset = 0;
+        while (offset < numSamples) {
+            const std::size_t count = std::min(numSamples - offset, plan.hopSize - hopFill_);
+            for (std::size_t c = 0; c < numChannels; ++c) {
+                Channel& channel = channels_[c];
+                std::copy_n(inputs[c] + offset, count, channel.input.data() + newest + hopFill_);
+                std::copy_n(channel.ready.data() + hopFill_, count, outputs[c] + offset);
+            }
+            hopFill_ += count;
+            offset += count;
 
-        // Zero any remaining output (during startup latency)
-        for (std::size_t i = samplesToOutput; i < numSamples; ++i) {
-            output[i] = 0.0f;
+            if (hopFill_ == plan.hopSize) {
+                for (std::size_t c = 0; c < numChannels; ++c) {
+                    processFrame(channels_[c], unity, pitchRatio);
+                }
+                hopFill_ = 0;
+            }
         }
     }
 
-    [[nodiscard]] std::size_t getLatencySamples() const noexcept {
-        // Total latency: FFT size + hop size
-        return kFFTSize + kHopSize;
-    }
+    /// @brief Analyse, shift and overlap-add one frame of a channel
+    void processFrame(Channel& channel, bool unity, float pitchRatio) noexcept {
+        FramePlan& plan = plans_[static_cast<std::size_t>(quality_)];
+        const std::size_t fftSize = plan.fftSize;
+        const std::size_t hopSize = plan.hopSize;
 
-private:
-    /// @brief Process unity pitch ratio with proper latency
-    void processUnityPitch(const float* input, float* output, std::size_t numSamples) noexcept {
-        // For unity, we still need to maintain consistent latency
-        stft_.pushSamples(input, numSamples);
-
-        while (stft_.canAnalyze()) {
-            stft_.analyze(analysisSpectrum_);
-            // Pass through spectrum unchanged
-            ola_.synthesize(analysisSpectrum_);
+        // Windowed analysis, then slide the input history by one hop
+        for (std::size_t i = 0; i < fftSize; ++i) {
+            frame_[i] = channel.input[i] * plan.window[i];
         }
-
-        std::size_t samplesToOutput = std::min(numSamples, ola_.samplesAvailable());
-        if (samplesToOutput > 0) {
-            ola_.pullSamples(output, samplesToOutput);
+        plan.fft.forward(frame_.data(), analysis_.data());
+        std::copy(channel.input.begin() + static_cast<std::ptrdiff_t>(hopSize),
+                  channel.input.begin() + static_cast<std::ptrdiff_t>(fftSize),
+                  channel.input.begin());
+
+        if (unity) {
+            plan.fft.inverse(analysis_.data(), frame_.data());
+        } else {
+            shiftSpectrum(channel, plan, pitchRatio);
+            plan.fft.inverse(synthesis_.data(), frame_.data());
         }
 
-        for (std::size_t i = samplesToOutput; i < numSamples; ++i) {
-            output[i] = 0.0f;
+        // Overlap-add; the oldest hop is complete
+        for (std::size_t i = 0; i < fftSize; ++i) {
+            channel.overlap[i] += frame_[i] * plan.colaNormalization;
         }
+        std::copy_n(channel.overlap.begin(), hopSize, channel.ready.begin());
+        std::copy(channel.overlap.begin() + static_cast<std::ptrdiff_t>(hopSize),
+                  channel.overlap.begin() + static_cast<std::ptrdiff_t>(fftSize),
+                  channel.overlap.begin());
+        std::fill(channel.overlap.begin() + static_cast<std::ptrdiff_t>(fftSize - hopSize),
+                  channel.overlap.begin() + static_cast<std::ptrdiff_t>(fftSize), 0.0f);
     }
 
-    /// @brief Phase vocoder frame processing
-    void processFrame(float pitchRatio) noexcept {
-        const std::size_t numBins = kFFTSize / 2 + 1;
+    /// @brief Phase vocoder pitch shift of analysis_ into synthesis_
+    void shiftSpectrum(Channel& channel, FramePlan& plan, float pitchRatio) noexcept {
+        const std::size_t numBins = plan.fftSize / 2 + 1;
 
         // Step 1: Extract magnitude and compute instantaneous frequency
         for (std::size_t k = 0; k < numBins; ++k) {
             // Get magnitude and phase
-            magnitude_[k] = analysisSpectrum_.getMagnitude(k);
-            float phase = analysisSpectrum_.getPhase(k);
+            magnitude_[k] = analysis_[k].magnitude();
+            float phase = analysis_[k].phase();
 
             // Compute phase difference from previous frame
-            float phaseDiff = phase - prevPhase_[k];
-            prevPhase_[k] = phase;
+            float phaseDiff = phase - channel.prevPhase[k];
+            channel.prevPhase[k] = phase;
 
             // Subtract expected phase increment to get deviation
             float deviation = phaseDiff - expectedPhaseInc_[k];
@@ -1052,11 +1152,11 @@ private:
 
         // Step 1b: Extract original spectral envelope if formant preservation enabled
         if (formantPreserve_) {
-            formantPreserver_.extractEnvelope(magnitude_.data(), originalEnvelope_.data());
+            plan.formantPreserver.extractEnvelope(magnitude_.data(), originalEnvelope_.data());
         }
 
         // Step 2: Pitch shift by scaling frequencies and resampling spectrum
-        synthesisSpectrum_.reset();
+        std::fill_n(synthesis_.begin(), numBins, Complex{});
 
         for (std::size_t k = 0; k < numBins; ++k) {
             // Map source bin to destination bin
@@ -1080,19 +1180,18 @@ private:
             float freq = frequency_[srcBin0] * pitchRatio;
 
             // Accumulate synthesis phase
-            synthPhase_[k] += freq;
-            synthPhase_[k] = wrapPhase(synthPhase_[k]);
+            channel.synthPhase[k] += freq;
+            channel.synthPhase[k] = wrapPhase(channel.synthPhase[k]);
 
             // Set synthesis bin (Cartesian form) - will be updated if formant preserve enabled
-            float real = mag * std::cos(synthPhase_[k]);
-            float imag = mag * std::sin(synthPhase_[k]);
-            synthesisSpectrum_.setCartesian(k, real, imag);
+            synthesis_[k] = {mag * std::cos(channel.synthPhase[k]),
+                             mag * std::sin(channel.synthPhase[k])};
         }
 
         // Step 3: Apply formant preservation if enabled
         if (formantPreserve_) {
             // Extract envelope of the shifted spectrum
-            formantPreserver_.extractEnvelope(shiftedMagnitude_.data(), shiftedEnvelope_.data());
+            plan.formantPreserver.extractEnvelope(shiftedMagnitude_.data(), shiftedEnvelope_.data());
 
             // Apply formant preservation: adjust magnitudes to preserve original envelope
             for (std::size_t k = 0; k < numBins; ++k) {
@@ -1108,13 +1207,23 @@ private:
                 float adjustedMag = shiftedMagnitude_[k] * ratio;
 
                 // Reconstruct Cartesian form with adjusted magnitude
-                float real = adjustedMag * std::cos(synthPhase_[k]);
-                float imag = adjustedMag * std::sin(synthPhase_[k]);
-                synthesisSpectrum_.setCartesian(k, real, imag);
+                synthesis_[k] = {adjustedMag * std::cos(channel.synthPhase[k]),
+                                 adjustedMag * std::sin(channel.synthPhase[k])};
             }
         }
     }
 
+    /// @brief Expected phase advance per bin per hop for the current quality
+    /// For bin k: expected_advance = 2π * k * hop_size / fft_size
+    void updateExpectedPhaseIncrements() noexcept {
+        const std::size_t fftSize = fftSizeFor(quality_);
+        const std::size_t numBins = std::min(expectedPhaseInc_.size(), fftSize / 2 + 1);
+        const float hopRatio = 1.0f / static_cast<float>(kOverlap);
+        for (std::size_t k = 0; k < numBins; ++k) {
+            expectedPhaseInc_[k] = kTwoPi * static_cast<float>(k) * hopRatio;
+        }
+    }
+
     /// @brief Wrap phase to [-π, π]
     [[nodiscard]] static float wrapPhase(float phase) noexcept {
         while (phase > kPi) phase -= kTwoPi;
@@ -1122,37 +1231,25 @@ private:
         return phase;
     }
 
-    // STFT analysis and synthesis
-    STFT stft_;
-    OverlapAdd ola_;
-
-    // Spectral buffers
-    SpectralBuffer analysisSpectrum_;
-    SpectralBuffer synthesisSpectrum_;
+    std::array<FramePlan, kNumQualities> plans_;
+    std::array<Channel, kMaxChannels> channels_;
+    PhaseVocoderQuality quality_ = PhaseVocoderQuality::High;
+    std::size_t hopFill_ = 0;  // Samples of the current hop already streamed
 
-    // Phase vocoder state
-    std::vector<float> prevPhase_;      // Previous frame phases
-    std::vector<float> synthPhase_;     // Accumulated synthesis phases
-    std::vector<float> magnitude_;      // Temporary magnitude storage
-    std::vector<float> frequency_;      // Instantaneous frequencies
-    std::vector<float> expectedPhaseInc_; // Expected phase increment per bin
+    // Shared frame scratch (one channel at a time)
+    std::vector<float> frame_;              // Windowed input / IFFT output
+    std::vector<Complex> analysis_;         // Analysis spectrum
+    std::vector<Complex> synthesis_;        // Shifted spectrum
+    std::vector<float> magnitude_;          // Temporary magnitude storage
+    std::vector<float> frequency_;          // Instantaneous frequencies
+    std::vector<float> expectedPhaseInc_;   // Expected phase increment per bin
 
     // Formant preservation
-    FormantPreserver formantPreserver_;
     std::vector<float> originalEnvelope_;  // Envelope of original spectrum
     std::vector<float> shiftedEnvelope_;   // Envelope of shifted spectrum
     std::vector<float> shiftedMagnitude_;  // Shifted magnitude for formant adjustment
     bool formantPreserve_ = false;
 
-    // I/O buffers for sample-level processing
-    std::vector<float> inputBuffer_;
-    std::vector<float> outputBuffer_;
-    std::size_t inputWritePos_ = 0;
-    std::size_t inputSamplesReady_ = 0;
-    std::size_t outputReadPos_ = 0;
-    std::size_t outputWritePos_ = 0;
-    std::size_t outputSamplesReady_ = 0;
-
     float sampleRate_ = 44100.0f;
 };
 
@@ -1170,9 +1267,12 @@ struct PitchShiftProcessor::Impl {
     std::size_t maxBlockSize = 512;
     bool prepared = false;
 
-    // Internal processors
+    // Internal processors (R instances serve processStereo(); the phase
+    // vocoder handles both channels itself)
     SimplePitchShifter simpleShifter;
+    SimplePitchShifter simpleShifterR;
     GranularPitchShifter granularShifter;
+    GranularPitchShifter granularShifterR;
     PhaseVocoderPitchShifter phaseVocoderShifter;
 
     // Parameter smoothers
@@ -1194,7 +1294,9 @@ inline void PitchShiftProcessor::prepare(double sampleRate, std::size_t maxBlock
 
     // Prepare all internal shifters
     pImpl_->simpleShifter.prepare(sampleRate, maxBlockSize);
+    pImpl_->simpleShifterR.prepare(sampleRate, maxBlockSize);
     pImpl_->granularShifter.prepare(sampleRate, maxBlockSize);
+    pImpl_->granularShifterR.prepare(sampleRate, maxBlockSize);
     pImpl_->phaseVocoderShifter.prepare(sampleRate, maxBlockSize);
 
     // Configure parameter smoothers (10ms smoothing time)
@@ -1210,7 +1312,9 @@ inline void PitchShiftProcessor::reset() noexcept {
     if (!pImpl_->prepared) return;
 
     pImpl_->simpleShifter.reset();
+    pImpl_->simpleShifterR.reset();
     pImpl_->granularShifter.reset();
+    pImpl_->granularShifterR.reset();
     pImpl_->phaseVocoderShifter.reset();
     pImpl_->semitoneSmoother.reset();
     pImpl_->semitoneSmoother.setTarget(pImpl_->semitones);
@@ -1258,6 +1362,39 @@ inline void PitchShiftProcessor::process(const float* input, float* output,
     }
 }
 
+inline void PitchShiftProcessor::processStereo(const float* inputL, const float* inputR,
+                                               float* outputL, float* outputR,
+                                               std::size_t numSamples) noexcept {
+    if (!pImpl_->prepared || inputL == nullptr || inputR == nullptr ||
+        outputL == nullptr || outputR == nullptr || numSamples == 0) {
+        return;
+    }
+
+    // Same parameter handling as process()
+    pImpl_->semitoneSmoother.setTarget(pImpl_->semitones);
+    pImpl_->centsSmoother.setTarget(pImpl_->cents);
+    pImpl_->semitoneSmoother.snapToTarget();
+    pImpl_->centsSmoother.snapToTarget();
+    const float pitchRatio = getPitchRatio();
+
+    switch (pImpl_->mode) {
+        case PitchMode::Simple:
+            pImpl_->simpleShifter.process(inputL, outputL, numSamples, pitchRatio);
+            pImpl_->simpleShifterR.process(inputR, outputR, numSamples, pitchRatio);
+            break;
+
+        case PitchMode::Granular:
+            pImpl_->granularShifter.process(inputL, outputL, numSamples, pitchRatio);
+            pImpl_->granularShifterR.process(inputR, outputR, numSamples, pitchRatio);
+            break;
+
+        case PitchMode::PhaseVocoder:
+            pImpl_->phaseVocoderShifter.processStereo(inputL, inputR, outputL, outputR,
+                                                      numSamples, pitchRatio);
+            break;
+    }
+}
+
 inline void PitchShiftProcessor::setMode(PitchMode mode) noexcept {
     pImpl_->mode = mode;
 }
@@ -1266,6 +1403,14 @@ inline PitchMode PitchShiftProcessor::getMode() const noexcept {
     return pImpl_->mode;
 }
 
+inline void PitchShiftProcessor::setPhaseVocoderQuality(PhaseVocoderQuality quality) noexcept {
+    pImpl_->phaseVocoderShifter.setQuality(quality);
+}
+
+inline PhaseVocoderQuality PitchShiftProcessor::getPhaseVocoderQuality() const noexcept {
+    return pImpl_->phaseVocoderShifter.getQuality();
+}
+
 inline void PitchShiftProcessor::setSemitones(float semitones) noexcept {
     // Clamp to valid range
     pImpl_->semitones = std::clamp(semitones, -24.0f, 24.0f);
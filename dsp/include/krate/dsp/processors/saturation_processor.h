@@ -8,7 +8,8 @@
 // - Automatic DC blocking after saturation
 // - Input/output gain staging [-24dB, +24dB]
 // - Dry/wet mix for parallel saturation
-// - Parameter smoothing for click-free modulation
+// - Parameter smoothing for click-free modulation (per-sample gain ramps)
+// - Selectable shaper accuracy: scalar reference or fast block kernels
 //
 // Constitution Compliance:
 // - Principle II: Real-Time Safety (noexcept, no allocations in process)
@@ -28,6 +29,7 @@
 #include <krate/dsp/core/db_utils.h>
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -56,6 +58,21 @@ enum class SaturationType : uint8_t {
     Diode = 4       ///< Soft asymmetric - subtle warmth
 };
 
+// =============================================================================
+// SaturationAccuracy Enumeration
+// =============================================================================
+
+/// @brief Waveshaper implementation selection
+///
+/// - Reference: std::tanh / std::exp transfer curves (the spec definitions)
+/// - Fast: branch-free rational/polynomial kernels written so the compiler
+///   can vectorize the block loop. Every type stays within
+///   SaturationProcessor::kFastMaxError (absolute) of the reference curve.
+enum class SaturationAccuracy : uint8_t {
+    Reference = 0,  ///< Exact scalar transfer functions (default)
+    Fast = 1        ///< Vectorizable approximations, max error kFastMaxError
+};
+
 // =============================================================================
 // SaturationProcessor Class
 // =============================================================================
@@ -100,6 +117,10 @@ public:
     static constexpr float kDefaultSmoothingMs = 5.0f; ///< Default smoothing time
     static constexpr float kDCBlockerCutoffHz = 10.0f; ///< DC blocker cutoff
 
+    /// Max absolute deviation of SaturationAccuracy::Fast from the reference
+    /// transfer curve, for any type and any finite input
+    static constexpr float kFastMaxError = 2e-4f;
+
     // -------------------------------------------------------------------------
     // Lifecycle (FR-019, FR-021)
     // -------------------------------------------------------------------------
@@ -173,47 +194,47 @@ public:
     ///
     /// @note Real-time safe: no allocations, O(N) complexity
     void process(float* buffer, size_t numSamples) noexcept {
+        if (numSamples == 0) {
+            return;
+        }
+
         // Store dry signal for mix blending
         for (size_t i = 0; i < numSamples; ++i) {
             oversampledBuffer_[i] = buffer[i];  // Temporarily use as dry buffer
         }
 
-        // Advance smoothers first to reach target values
-        // Run at base sample rate for click-free modulation
+        // Advance smoothers through the block at the base rate, keeping the
+        // start and end values. Gains then ramp linearly between the two, one
+        // step per (oversampled) sample, so drive automation has no block steps.
+        const float inputGainStart = inputGainSmoother_.getCurrentValue();
+        const float outputGainStart = outputGainSmoother_.getCurrentValue();
+        const float mixStart = mixSmoother_.getCurrentValue();
         for (size_t i = 0; i < numSamples; ++i) {
             (void)inputGainSmoother_.process();
             (void)outputGainSmoother_.process();
             (void)mixSmoother_.process();
         }
-
-        // Cache smoothed values for use in oversampled callback
-        const float inputGain = inputGainSmoother_.getCurrentValue();
-        const float outputGain = outputGainSmoother_.getCurrentValue();
-
-        // Process with oversampling
-        oversampler_.process(buffer, numSamples, [this, inputGain, outputGain](float* upsampled, size_t numOversampledSamples) {
-            // Apply saturation at oversampled rate
-            for (size_t i = 0; i < numOversampledSamples; ++i) {
-                // Apply input gain (drive)
-                float signal = upsampled[i] * inputGain;
-
-                // Apply saturation
-                signal = applySaturation(signal);
-
-                // Apply output gain (makeup)
-                upsampled[i] = signal * outputGain;
-            }
-        });
+        const float inputGainEnd = inputGainSmoother_.getCurrentValue();
+        const float outputGainEnd = outputGainSmoother_.getCurrentValue();
+        const float mixEnd = mixSmoother_.getCurrentValue();
+
+        // Process with oversampling. The callback captures two pointers so it
+        // fits std::function's small-buffer storage (no allocation).
+        const GainRamps ramps{inputGainStart, inputGainEnd, outputGainStart, outputGainEnd};
+        oversampler_.process(buffer, numSamples,
+            [this, &ramps](float* upsampled, size_t numOversampledSamples) {
+                shapeBlock(upsampled, numOversampledSamples, ramps);
+            });
 
         // Apply DC blocking after saturation
         dcBlocker_.processBlock(buffer, numSamples);
 
-        // Blend dry/wet using smoothed mix value
-        const float mix = mixSmoother_.getCurrentValue();
-        if (mix < 0.9999f) {  // Skip blending if fully wet
-            const float dryMix = 1.0f - mix;
+        // Blend dry/wet with a per-sample mix ramp
+        if (mixStart < 0.9999f || mixEnd < 0.9999f) {  // Skip blending if fully wet
+            const float mixStep = (mixEnd - mixStart) / static_cast<float>(numSamples);
             for (size_t i = 0; i < numSamples; ++i) {
-                buffer[i] = oversampledBuffer_[i] * dryMix + buffer[i] * mix;
+                const float mix = mixStart + mixStep * static_cast<float>(i + 1);
+                buffer[i] = oversampledBuffer_[i] * (1.0f - mix) + buffer[i] * mix;
             }
         }
     }
@@ -254,6 +275,45 @@ public:
         return dry * (1.0f - mix) + signal * mix;
     }
 
+    /// @brief Process a buffer exactly as processSample() would, sample by sample
+    ///
+    /// @param buffer Audio samples (in-place processing)
+    /// @param numSamples Number of samples to process
+    ///
+    /// @note Base rate like processSample(): no oversampling and no DC
+    ///       blocker, so it adds no latency inside a feedback loop. Once the
+    ///       gain and mix smoothers have settled the shaper runs as one block
+    ///       loop; while they move it falls back to processSample().
+    void processSamples(float* buffer, size_t numSamples) noexcept {
+        if (!inputGainSmoother_.isComplete() || !outputGainSmoother_.isComplete() ||
+            !mixSmoother_.isComplete()) {
+            for (size_t i = 0; i < numSamples; ++i) {
+                buffer[i] = processSample(buffer[i]);
+            }
+            return;
+        }
+
+        // Settled smoothers return their target from process()
+        inputGainSmoother_.snapToTarget();
+        outputGainSmoother_.snapToTarget();
+        mixSmoother_.snapToTarget();
+        const float inputGain = inputGainSmoother_.getCurrentValue();
+        const float outputGain = outputGainSmoother_.getCurrentValue();
+        const float mix = mixSmoother_.getCurrentValue();
+
+        if (mix < 0.0001f) {
+            return;
+        }
+
+        dispatchShaper(type_, accuracy_, [=](auto shaper) noexcept {
+            for (size_t i = 0; i < numSamples; ++i) {
+                const float dry = buffer[i];
+                const float signal = shaper(dry * inputGain) * outputGain;
+                buffer[i] = dry * (1.0f - mix) + signal * mix;
+            }
+        });
+    }
+
     // -------------------------------------------------------------------------
     // Parameter Setters (FR-006 to FR-012)
     // -------------------------------------------------------------------------
@@ -267,6 +327,17 @@ public:
         type_ = type;
     }
 
+    /// @brief Select reference or fast waveshaper kernels
+    ///
+    /// @param accuracy SaturationAccuracy::Fast trades at most kFastMaxError
+    ///        of transfer-curve accuracy for vectorizable block kernels
+    ///
+    /// @note Change is immediate (not smoothed); the curves differ by less
+    ///       than kFastMaxError so switching does not click
+    void setAccuracy(SaturationAccuracy accuracy) noexcept {
+        accuracy_ = accuracy;
+    }
+
     /// @brief Set input gain (pre-saturation drive)
     ///
     /// @param gainDb Gain in dB, clamped to [kMinGainDb, kMaxGainDb]
@@ -307,6 +378,11 @@ public:
         return type_;
     }
 
+    /// @brief Get current waveshaper accuracy
+    [[nodiscard]] SaturationAccuracy getAccuracy() const noexcept {
+        return accuracy_;
+    }
+
     /// @brief Get current input gain in dB
     [[nodiscard]] float getInputGain() const noexcept {
         return inputGainDb_;
@@ -335,6 +411,25 @@ public:
         return oversampler_.getLatency();
     }
 
+    // -------------------------------------------------------------------------
+    // Stateless Waveshaping
+    // -------------------------------------------------------------------------
+
+    /// @brief Apply a transfer curve to a block in-place (no gain, no filtering)
+    ///
+    /// @param type Saturation curve
+    /// @param accuracy Reference or fast kernels
+    /// @param buffer Samples to shape
+    /// @param numSamples Number of samples
+    static void saturateBlock(SaturationType type, SaturationAccuracy accuracy,
+                              float* buffer, size_t numSamples) noexcept {
+        dispatchShaper(type, accuracy, [=](auto shaper) noexcept {
+            for (size_t i = 0; i < numSamples; ++i) {
+                buffer[i] = shaper(buffer[i]);
+            }
+        });
+    }
+
 private:
     // -------------------------------------------------------------------------
     // Saturation Functions (FR-001 to FR-005)
@@ -401,30 +496,163 @@ private:
         }
     }
 
-    /// @brief Apply current saturation type to sample
-    [[nodiscard]] float applySaturation(float x) const noexcept {
-        switch (type_) {
-            case SaturationType::Tape:
-                return saturateTape(x);
+    // -------------------------------------------------------------------------
+    // Fast Kernels (SaturationAccuracy::Fast)
+    // -------------------------------------------------------------------------
+    // Branch-free (selects only) so block loops auto-vectorize. Each matches
+    // its reference curve to within kFastMaxError.
+
+    /// @brief tanh via Lambert continued fraction (7,6), |error| < 1e-4
+    [[nodiscard]] static float fastTanh(float x) noexcept {
+        // Beyond |x| = 5 the approximant is within 1e-4 of +/-1
+        const float xc = std::clamp(x, -5.0f, 5.0f);
+        const float x2 = xc * xc;
+        const float num = xc * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+        const float den = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+        return std::clamp(num / den, -1.0f, 1.0f);
+    }
+
+    /// @brief exp(-y) for y >= 0 by range reduction, |relative error| < 2e-7
+    [[nodiscard]] static float fastExpNegative(float y) noexcept {
+        constexpr float kLog2e = 1.44269504f;
+        constexpr float kLn2Hi = 0.693145751953125f;
+        constexpr float kLn2Lo = 1.42860677e-06f;
+
+        // Argument order maps NaN to the lower bound; exp(-87) is still normal
+        const float z = std::min(std::max(-87.0f, -y), 0.0f);
+        // z <= 0, so truncation rounds z*log2(e) to nearest (|r| <= ln2/2)
+        const auto n = static_cast<int32_t>(z * kLog2e - 0.5f);
+        const float fn = static_cast<float>(n);
+        const float r = (z - fn * kLn2Hi) - fn * kLn2Lo;
+
+        // Taylor series of e^r to r^6 on |r| <= 0.347
+        const float p = 1.0f + r * (1.0f + r * (0.5f + r * (1.0f / 6.0f
+                      + r * (1.0f / 24.0f + r * (1.0f / 120.0f + r * (1.0f / 720.0f))))));
+        return p * std::bit_cast<float>((n + 127) << 23);
+    }
+
+    [[nodiscard]] static float fastTape(float x) noexcept {
+        return fastTanh(x);
+    }
+
+    [[nodiscard]] static float fastTube(float x) noexcept {
+        const float x2 = x * x;
+        return fastTanh(x + 0.3f * x2 - 0.15f * x2 * x);
+    }
+
+    [[nodiscard]] static float fastTransistor(float x) noexcept {
+        constexpr float kThreshold = 0.5f;
+        constexpr float kKnee = 1.0f - kThreshold;
+
+        const float absX = std::abs(x);
+        const float excess = std::max(absX - kThreshold, 0.0f);
+        const float compressed = kThreshold + kKnee * fastTanh(excess * (1.0f / kKnee));
+        const float shaped = (x >= 0.0f) ? compressed : -compressed;
+        return (absX <= kThreshold) ? x : shaped;
+    }
+
+    [[nodiscard]] static float fastDiode(float x) noexcept {
+        // Evaluate both bias regions on clamped inputs, then select
+        const float forward = 1.0f - fastExpNegative(std::max(x, 0.0f) * 1.5f);
+        const float negative = std::min(x, 0.0f);
+        const float reverse = negative / (1.0f - 0.5f * negative);
+        return (x >= 0.0f) ? forward : reverse;
+    }
+
+    // -------------------------------------------------------------------------
+    // Shaping Engine
+    // -------------------------------------------------------------------------
+
+    /// @brief Call fn(shaper) with the shaper for (type, accuracy)
+    ///
+    /// One switch per block; fn receives a stateless lambda so the per-sample
+    /// loop inside it is specialized (and vectorized) for each curve.
+    template <typename Fn>
+    static void dispatchShaper(SaturationType type, SaturationAccuracy accuracy, Fn&& fn) noexcept {
+        if (accuracy == SaturationAccuracy::Fast) {
+            switch (type) {
+                case SaturationType::Tube:
+                    fn([](float x) noexcept { return fastTube(x); });
+                    return;
+                case SaturationType::Transistor:
+                    fn([](float x) noexcept { return fastTransistor(x); });
+                    return;
+                case SaturationType::Digital:
+                    fn([](float x) noexcept { return saturateDigital(x); });
+                    return;
+                case SaturationType::Diode:
+                    fn([](float x) noexcept { return fastDiode(x); });
+                    return;
+                case SaturationType::Tape:
+                default:
+                    fn([](float x) noexcept { return fastTape(x); });
+                    return;
+            }
+        }
+
+        switch (type) {
             case SaturationType::Tube:
-                return saturateTube(x);
+                fn([](float x) noexcept { return saturateTube(x); });
+                return;
             case SaturationType::Transistor:
-                return saturateTransistor(x);
+                fn([](float x) noexcept { return saturateTransistor(x); });
+                return;
             case SaturationType::Digital:
-                return saturateDigital(x);
+                fn([](float x) noexcept { return saturateDigital(x); });
+                return;
             case SaturationType::Diode:
-                return saturateDiode(x);
+                fn([](float x) noexcept { return saturateDiode(x); });
+                return;
+            case SaturationType::Tape:
             default:
-                return saturateTape(x);
+                fn([](float x) noexcept { return saturateTape(x); });
+                return;
         }
     }
 
+    /// @brief Smoothed gain values at the start and end of a block
+    struct GainRamps {
+        float inputStart;
+        float inputEnd;
+        float outputStart;
+        float outputEnd;
+    };
+
+    /// @brief Gain, shape and make up a block with linear per-sample gain ramps
+    ///
+    /// Sample i uses gain start + step * (i + 1), so the last sample lands on
+    /// the smoother's end-of-block value.
+    void shapeBlock(float* buffer, size_t numSamples, const GainRamps& ramps) const noexcept {
+        const float invLength = 1.0f / static_cast<float>(numSamples);
+        const float inputGainStart = ramps.inputStart;
+        const float inputGainStep = (ramps.inputEnd - ramps.inputStart) * invLength;
+        const float outputGainStart = ramps.outputStart;
+        const float outputGainStep = (ramps.outputEnd - ramps.outputStart) * invLength;
+
+        dispatchShaper(type_, accuracy_, [=](auto shaper) noexcept {
+            for (size_t i = 0; i < numSamples; ++i) {
+                const float t = static_cast<float>(i + 1);
+                const float inputGain = inputGainStart + inputGainStep * t;
+                const float outputGain = outputGainStart + outputGainStep * t;
+                buffer[i] = shaper(buffer[i] * inputGain) * outputGain;
+            }
+        });
+    }
+
+    /// @brief Apply current saturation type and accuracy to one sample
+    [[nodiscard]] float applySaturation(float x) const noexcept {
+        float y = x;
+        dispatchShaper(type_, accuracy_, [&y](auto shaper) noexcept { y = shaper(y); });
+        return y;
+    }
+
     // -------------------------------------------------------------------------
     // Private Members
     // -------------------------------------------------------------------------
 
     // Parameters
     SaturationType type_ = SaturationType::Tape;
+    SaturationAccuracy accuracy_ = SaturationAccuracy::Reference;
     float inputGainDb_ = 0.0f;
     float outputGainDb_ = 0.0f;
     float mix_ = 1.0f;
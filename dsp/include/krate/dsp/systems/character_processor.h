@@ -7,6 +7,9 @@
 // - DigitalVintage: Bit depth and sample rate reduction
 // - Clean: Unity gain passthrough
 //
+// CharacterEngine<N> keeps independent per-channel state; CharacterProcessor
+// is the stereo instantiation used by the delay effects.
+//
 // Constitution Compliance:
 // - Principle II: Real-Time Safety (noexcept, no allocations in process)
 // - Principle III: Modern C++ (C++20, RAII)
@@ -30,6 +33,7 @@
 #include <krate/dsp/core/crossfade_utils.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -57,7 +61,7 @@ enum class CharacterMode : uint8_t {
 };
 
 // =============================================================================
-// CharacterProcessor Class
+// CharacterEngine Class
 // =============================================================================
 
 /// @brief Layer 3 System Component - Analog character processor
@@ -65,6 +69,14 @@ enum class CharacterMode : uint8_t {
 /// Composes Layer 1-2 DSP components to provide four distinct character modes.
 /// Features 50ms equal-power crossfade between modes for click-free transitions.
 ///
+/// Every channel owns its own saturators, filters, noise generators and
+/// bit/rate reducers, so no filter or dither state bleeds between channels.
+/// Mode dispatch, parameter smoothing, the wow/flutter LFOs and the crossfade
+/// curve are evaluated once per block and applied to all channels, keeping
+/// the channels' modulation and mode transitions phase-coherent.
+///
+/// @tparam NumChannels Number of independent channels (1 = mono, 2 = stereo)
+///
 /// @par Constitution Compliance
 /// - Principle II: Real-Time Safety (noexcept, no allocations in process)
 /// - Principle III: Modern C++ (C++20, RAII)
@@ -73,15 +85,18 @@ enum class CharacterMode : uint8_t {
 ///
 /// @par Usage
 /// @code
-/// CharacterProcessor character;
+/// CharacterProcessor character;   // CharacterEngine<2>
 /// character.prepare(44100.0, 512);
 /// character.setMode(CharacterMode::Tape);
 /// character.setTapeSaturation(0.5f);
 ///
 /// // In process callback
-/// character.process(buffer, numSamples);
+/// character.processStereo(left, right, numSamples);
 /// @endcode
-class CharacterProcessor {
+template <size_t NumChannels = 2>
+class CharacterEngine {
+    static_assert(NumChannels >= 1, "CharacterEngine needs at least one channel");
+
 public:
     // =========================================================================
     // Constants
@@ -108,7 +123,7 @@ public:
     // =========================================================================
 
     /// @brief Default constructor
-    CharacterProcessor() noexcept = default;
+    CharacterEngine() noexcept = default;
 
     /// @brief Prepare for processing
     /// @param sampleRate Audio sample rate in Hz
@@ -122,24 +137,63 @@ public:
         if (crossfadeSamples_ < 1) crossfadeSamples_ = 1;
         crossfadeIncrement_ = 1.0f / static_cast<float>(crossfadeSamples_);
 
-        // Prepare sub-components
-        // Tape mode components
-        tapeSaturation_.prepare(sampleRate, maxBlockSize);
-        tapeSaturation_.setType(SaturationType::Tape);
-        tapeSaturation_.setMix(1.0f);
+        for (size_t ch = 0; ch < NumChannels; ++ch) {
+            Channel& c = channels_[ch];
+
+            // Tape mode components
+            c.tapeSaturation.prepare(sampleRate, maxBlockSize);
+            c.tapeSaturation.setType(SaturationType::Tape);
+            c.tapeSaturation.setMix(1.0f);
+            // Character coloration: fast kernels are well inside audibility
+            c.tapeSaturation.setAccuracy(SaturationAccuracy::Fast);
+
+            c.tapeHiss.prepare(static_cast<float>(sampleRate), maxBlockSize);
+            c.tapeHiss.setNoiseEnabled(NoiseType::TapeHiss, true);
+            c.tapeHiss.setNoiseLevel(NoiseType::TapeHiss, kDefaultTapeHissLevel);
+            // Set floor to 0dB so tape hiss is constant (not signal-dependent)
+            // Real tape hiss is present even during silence
+            c.tapeHiss.setTapeHissParams(0.0f, 0.0f);
+
+            c.tapeRolloff.prepare(sampleRate, maxBlockSize);
+            c.tapeRolloff.setType(FilterType::Lowpass);
+            c.tapeRolloff.setCutoff(kDefaultTapeRolloff);
+            c.tapeRolloff.setResonance(0.707f);
+
+            // BBD mode components
+            c.bbdSaturation.prepare(sampleRate, maxBlockSize);
+            c.bbdSaturation.setType(SaturationType::Tape);
+            c.bbdSaturation.setMix(1.0f);
+            c.bbdSaturation.setAccuracy(SaturationAccuracy::Fast);
+
+            c.bbdBandwidth.prepare(sampleRate, maxBlockSize);
+            c.bbdBandwidth.setType(FilterType::Lowpass);
+            c.bbdBandwidth.setCutoff(kDefaultBBDBandwidth);
+            c.bbdBandwidth.setResonance(0.707f);
+            c.bbdBandwidth.setSlope(FilterSlope::Slope24dB); // Steeper rolloff
+
+            c.bbdClockNoise.prepare(static_cast<float>(sampleRate), maxBlockSize);
+            c.bbdClockNoise.setNoiseEnabled(NoiseType::RadioStatic, true); // High-frequency noise
+            c.bbdClockNoise.setNoiseLevel(NoiseType::RadioStatic, kDefaultBBDClockNoise);
+
+            // Every generator starts from the same seed; advance each channel's
+            // RNG a different number of times so the channels stay uncorrelated
+            for (size_t i = 0; i < ch; ++i) {
+                c.tapeHiss.reset();
+                c.bbdClockNoise.reset();
+            }
+
+            // Digital vintage components
+            c.bitCrusher.prepare(sampleRate);
+            c.bitCrusher.setBitDepth(kDefaultDigitalBitDepth);
+            c.bitCrusher.setDither(kDefaultDigitalDither);
 
-        tapeHiss_.prepare(static_cast<float>(sampleRate), maxBlockSize);
-        tapeHiss_.setNoiseEnabled(NoiseType::TapeHiss, true);
-        tapeHiss_.setNoiseLevel(NoiseType::TapeHiss, kDefaultTapeHissLevel);
-        // Set floor to 0dB so tape hiss is constant (not signal-dependent)
-        // Real tape hiss is present even during silence
-        tapeHiss_.setTapeHissParams(0.0f, 0.0f);
+            c.sampleRateReducer.prepare(sampleRate);
+            c.sampleRateReducer.setReductionFactor(kDefaultDigitalSampleRateReduction);
 
-        tapeRolloff_.prepare(sampleRate, maxBlockSize);
-        tapeRolloff_.setType(FilterType::Lowpass);
-        tapeRolloff_.setCutoff(kDefaultTapeRolloff);
-        tapeRolloff_.setResonance(0.707f);
+            c.previousModeBuffer.resize(maxBlockSize);
+        }
 
+        // Shared modulation
         wowLfo_.prepare(sampleRate);
         wowLfo_.setWaveform(Waveform::Sine);
         wowLfo_.setFrequency(kDefaultWowRate);
@@ -148,34 +202,6 @@ public:
         flutterLfo_.setWaveform(Waveform::Sine);
         flutterLfo_.setFrequency(kDefaultFlutterRate);
 
-        // BBD mode components
-        bbdSaturation_.prepare(sampleRate, maxBlockSize);
-        bbdSaturation_.setType(SaturationType::Tape);
-        bbdSaturation_.setMix(1.0f);
-
-        bbdBandwidth_.prepare(sampleRate, maxBlockSize);
-        bbdBandwidth_.setType(FilterType::Lowpass);
-        bbdBandwidth_.setCutoff(kDefaultBBDBandwidth);
-        bbdBandwidth_.setResonance(0.707f);
-        bbdBandwidth_.setSlope(FilterSlope::Slope24dB); // Steeper rolloff
-
-        bbdClockNoise_.prepare(static_cast<float>(sampleRate), maxBlockSize);
-        bbdClockNoise_.setNoiseEnabled(NoiseType::RadioStatic, true); // High-frequency noise
-        bbdClockNoise_.setNoiseLevel(NoiseType::RadioStatic, kDefaultBBDClockNoise);
-
-        // Right channel noise generator (independent smoother for balanced stereo)
-        bbdClockNoiseR_.prepare(static_cast<float>(sampleRate), maxBlockSize);
-        bbdClockNoiseR_.setNoiseEnabled(NoiseType::RadioStatic, true);
-        bbdClockNoiseR_.setNoiseLevel(NoiseType::RadioStatic, kDefaultBBDClockNoise);
-
-        // Digital vintage components
-        bitCrusher_.prepare(sampleRate);
-        bitCrusher_.setBitDepth(kDefaultDigitalBitDepth);
-        bitCrusher_.setDither(kDefaultDigitalDither);
-
-        sampleRateReducer_.prepare(sampleRate);
-        sampleRateReducer_.setReductionFactor(kDefaultDigitalSampleRateReduction);
-
         // Parameter smoothers
         tapeSaturationSmoother_.configure(kSmoothingTimeMs, static_cast<float>(sampleRate));
         tapeSaturationSmoother_.setTarget(kDefaultTapeSaturation);
@@ -185,13 +211,11 @@ public:
         bbdSaturationSmoother_.setTarget(kDefaultBBDSaturation);
         bbdSaturationSmoother_.snapTo(kDefaultBBDSaturation);
 
-        // Allocate work buffers
-        workBufferL_.resize(maxBlockSize);
-        workBufferR_.resize(maxBlockSize);
-        previousModeBufferL_.resize(maxBlockSize);
-        previousModeBufferR_.resize(maxBlockSize);
+        // Allocate shared work buffers
+        modulationBuffer_.resize(maxBlockSize);
+        fadeOutBuffer_.resize(maxBlockSize);
+        fadeInBuffer_.resize(maxBlockSize);
         noiseBuffer_.resize(maxBlockSize);
-        noiseBufferR_.resize(maxBlockSize);
 
         reset();
     }
@@ -201,100 +225,58 @@ public:
         crossfadePosition_ = 1.0f; // Not crossfading
         previousMode_ = currentMode_;
 
-        tapeSaturation_.reset();
-        tapeHiss_.reset();
-        tapeRolloff_.reset();
-        wowLfo_.reset();
-        flutterLfo_.reset();
+        for (Channel& c : channels_) {
+            c.tapeSaturation.reset();
+            c.tapeHiss.reset();
+            c.tapeRolloff.reset();
 
-        bbdSaturation_.reset();
-        bbdBandwidth_.reset();
-        bbdClockNoise_.reset();
-        bbdClockNoiseR_.reset();
+            c.bbdSaturation.reset();
+            c.bbdBandwidth.reset();
+            c.bbdClockNoise.reset();
 
-        bitCrusher_.reset();
-        sampleRateReducer_.reset();
+            c.bitCrusher.reset();
+            c.sampleRateReducer.reset();
 
-        std::fill(workBufferL_.begin(), workBufferL_.end(), 0.0f);
-        std::fill(workBufferR_.begin(), workBufferR_.end(), 0.0f);
-        std::fill(previousModeBufferL_.begin(), previousModeBufferL_.end(), 0.0f);
-        std::fill(previousModeBufferR_.begin(), previousModeBufferR_.end(), 0.0f);
+            std::fill(c.previousModeBuffer.begin(), c.previousModeBuffer.end(), 0.0f);
+        }
+
+        wowLfo_.reset();
+        flutterLfo_.reset();
+
+        std::fill(modulationBuffer_.begin(), modulationBuffer_.end(), 0.0f);
+        std::fill(fadeOutBuffer_.begin(), fadeOutBuffer_.end(), 0.0f);
+        std::fill(fadeInBuffer_.begin(), fadeInBuffer_.end(), 0.0f);
         std::fill(noiseBuffer_.begin(), noiseBuffer_.end(), 0.0f);
-        std::fill(noiseBufferR_.begin(), noiseBufferR_.end(), 0.0f);
     }
 
     // =========================================================================
     // Processing
     // =========================================================================
 
-    /// @brief Process mono audio in-place
+    /// @brief Process all channels in-place
+    /// @param buffers NumChannels channel buffers (each modified in-place)
+    /// @param numSamples Number of samples per channel
+    void process(float* const* buffers, size_t numSamples) noexcept {
+        processChannels(buffers, NumChannels, numSamples);
+    }
+
+    /// @brief Process mono audio in-place through the first channel's state
     /// @param buffer Audio buffer (modified in-place)
     /// @param numSamples Number of samples to process
     void process(float* buffer, size_t numSamples) noexcept {
-        if (numSamples == 0) return;
-
-        // Process in chunks of maxBlockSize_ for safety
-        size_t offset = 0;
-        while (offset < numSamples) {
-            size_t chunkSize = std::min(numSamples - offset, maxBlockSize_);
-            processChunk(buffer + offset, chunkSize);
-            offset += chunkSize;
-        }
+        float* const buffers[1] = {buffer};
+        processChannels(buffers, 1, numSamples);
     }
 
-private:
-    /// @brief Process a single chunk (must be <= maxBlockSize_)
-    void processChunk(float* buffer, size_t numSamples) noexcept {
-        // Handle NaN inputs
-        for (size_t i = 0; i < numSamples; ++i) {
-            if (!std::isfinite(buffer[i])) {
-                buffer[i] = 0.0f;
-            }
-        }
-
-        // If crossfading, process both modes and blend
-        if (isCrossfading()) {
-            // Copy input for previous mode processing
-            std::copy(buffer, buffer + numSamples, previousModeBufferL_.data());
-
-            // Process current mode
-            processMode(buffer, numSamples, currentMode_);
-
-            // Process previous mode
-            processMode(previousModeBufferL_.data(), numSamples, previousMode_);
-
-            // Crossfade between modes (equal power) using Layer 0 utility
-            for (size_t i = 0; i < numSamples; ++i) {
-                float fadeOut, fadeIn;
-                equalPowerGains(crossfadePosition_, fadeOut, fadeIn);
-
-                buffer[i] = previousModeBufferL_[i] * fadeOut + buffer[i] * fadeIn;
-
-                crossfadePosition_ += crossfadeIncrement_;
-                if (crossfadePosition_ >= 1.0f) {
-                    crossfadePosition_ = 1.0f;
-                    break;
-                }
-            }
-        } else {
-            processMode(buffer, numSamples, currentMode_);
-        }
-    }
-
-public:
-
     /// @brief Process stereo audio in-place
     /// @param left Left channel buffer (modified in-place)
     /// @param right Right channel buffer (modified in-place)
     /// @param numSamples Number of samples per channel
-    void processStereo(float* left, float* right, size_t numSamples) noexcept {
-        // Process each channel with independent noise generators
-        // This ensures balanced stereo noise from the first sample
-        isRightChannel_ = false;
-        process(left, numSamples);
-        isRightChannel_ = true;
-        process(right, numSamples);
-        isRightChannel_ = false;  // Reset to default
+    void processStereo(float* left, float* right, size_t numSamples) noexcept
+        requires(NumChannels >= 2)
+    {
+        float* const buffers[2] = {left, right};
+        processChannels(buffers, 2, numSamples);
     }
 
     // =========================================================================
@@ -326,6 +308,11 @@ public:
         return sampleRate_;
     }
 
+    /// @brief Get number of channels
+    [[nodiscard]] static constexpr size_t getNumChannels() noexcept {
+        return NumChannels;
+    }
+
     // =========================================================================
     // Tape Mode Parameters
     // =========================================================================
@@ -338,12 +325,16 @@ public:
 
     /// @brief Set tape hiss level in dB
     void setTapeHissLevel(float levelDb) noexcept {
-        tapeHiss_.setNoiseLevel(NoiseType::TapeHiss, levelDb);
+        for (Channel& c : channels_) {
+            c.tapeHiss.setNoiseLevel(NoiseType::TapeHiss, levelDb);
+        }
     }
 
     /// @brief Set tape high-frequency rolloff frequency
     void setTapeRolloffFreq(float freqHz) noexcept {
-        tapeRolloff_.setCutoff(freqHz);
+        for (Channel& c : channels_) {
+            c.tapeRolloff.setCutoff(freqHz);
+        }
     }
 
     /// @brief Set wow modulation rate (Hz)
@@ -372,7 +363,9 @@ public:
 
     /// @brief Set BBD bandwidth limit (Hz)
     void setBBDBandwidth(float freqHz) noexcept {
-        bbdBandwidth_.setCutoff(freqHz);
+        for (Channel& c : channels_) {
+            c.bbdBandwidth.setCutoff(freqHz);
+        }
     }
 
     /// @brief Set BBD saturation amount [0, 1]
@@ -383,8 +376,9 @@ public:
 
     /// @brief Set BBD clock noise level in dB
     void setBBDClockNoiseLevel(float levelDb) noexcept {
-        bbdClockNoise_.setNoiseLevel(NoiseType::RadioStatic, levelDb);
-        bbdClockNoiseR_.setNoiseLevel(NoiseType::RadioStatic, levelDb);
+        for (Channel& c : channels_) {
+            c.bbdClockNoise.setNoiseLevel(NoiseType::RadioStatic, levelDb);
+        }
     }
 
     // =========================================================================
@@ -393,57 +387,150 @@ public:
 
     /// @brief Set bit depth [4, 16]
     void setDigitalBitDepth(float bits) noexcept {
-        bitCrusher_.setBitDepth(bits);
+        for (Channel& c : channels_) {
+            c.bitCrusher.setBitDepth(bits);
+        }
     }
 
     /// @brief Set sample rate reduction factor [1, 8]
     void setDigitalSampleRateReduction(float factor) noexcept {
-        sampleRateReducer_.setReductionFactor(factor);
+        for (Channel& c : channels_) {
+            c.sampleRateReducer.setReductionFactor(factor);
+        }
     }
 
     /// @brief Set dither amount [0, 1]
     void setDigitalDitherAmount(float amount) noexcept {
-        bitCrusher_.setDither(amount);
+        for (Channel& c : channels_) {
+            c.bitCrusher.setDither(amount);
+        }
     }
 
 private:
+    // =========================================================================
+    // Private Types
+    // =========================================================================
+
+    /// @brief Per-channel processing state
+    struct Channel {
+        // Tape mode
+        SaturationProcessor tapeSaturation;
+        NoiseGenerator tapeHiss;
+        MultimodeFilter tapeRolloff;
+
+        // BBD mode
+        SaturationProcessor bbdSaturation;
+        MultimodeFilter bbdBandwidth;
+        NoiseGenerator bbdClockNoise;
+
+        // Digital vintage mode
+        BitCrusher bitCrusher;
+        SampleRateReducer sampleRateReducer;
+
+        // Input copy rendered through the previous mode while crossfading
+        std::vector<float> previousModeBuffer;
+    };
+
     // =========================================================================
     // Private Methods
     // =========================================================================
 
+    /// @brief Process the first numChannels channels in maxBlockSize_ chunks
+    void processChannels(float* const* buffers, size_t numChannels,
+                         size_t numSamples) noexcept {
+        if (numSamples == 0) return;
+
+        // Process in chunks of maxBlockSize_ for safety
+        size_t offset = 0;
+        while (offset < numSamples) {
+            const size_t chunkSize = std::min(numSamples - offset, maxBlockSize_);
+            float* chunk[NumChannels] = {};
+            for (size_t ch = 0; ch < numChannels; ++ch) {
+                chunk[ch] = buffers[ch] + offset;
+            }
+            processChunk(chunk, numChannels, chunkSize);
+            offset += chunkSize;
+        }
+    }
+
+    /// @brief Process a single chunk (must be <= maxBlockSize_)
+    void processChunk(float* const* buffers, size_t numChannels,
+                      size_t numSamples) noexcept {
+        // Handle NaN inputs
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            float* buffer = buffers[ch];
+            for (size_t i = 0; i < numSamples; ++i) {
+                if (!std::isfinite(buffer[i])) {
+                    buffer[i] = 0.0f;
+                }
+            }
+        }
+
+        if (!isCrossfading()) {
+            processMode(buffers, numChannels, numSamples, currentMode_);
+            return;
+        }
+
+        // Crossfading: render the previous mode from a copy of the input
+        float* previous[NumChannels] = {};
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            previous[ch] = channels_[ch].previousModeBuffer.data();
+            std::copy(buffers[ch], buffers[ch] + numSamples, previous[ch]);
+        }
+
+        processMode(buffers, numChannels, numSamples, currentMode_);
+        processMode(previous, numChannels, numSamples, previousMode_);
+
+        // Equal-power gains are computed once and shared by every channel.
+        // Samples after the fade completes keep the current mode's output.
+        size_t fadeLength = 0;
+        while (fadeLength < numSamples) {
+            equalPowerGains(crossfadePosition_, fadeOutBuffer_[fadeLength],
+                            fadeInBuffer_[fadeLength]);
+            ++fadeLength;
+
+            crossfadePosition_ += crossfadeIncrement_;
+            if (crossfadePosition_ >= 1.0f) {
+                crossfadePosition_ = 1.0f;
+                break;
+            }
+        }
+
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            float* buffer = buffers[ch];
+            const float* prev = previous[ch];
+            for (size_t i = 0; i < fadeLength; ++i) {
+                buffer[i] = prev[i] * fadeOutBuffer_[i] + buffer[i] * fadeInBuffer_[i];
+            }
+        }
+    }
+
     /// @brief Process audio through a specific mode
-    void processMode(float* buffer, size_t numSamples, CharacterMode mode) noexcept {
+    void processMode(float* const* buffers, size_t numChannels, size_t numSamples,
+                     CharacterMode mode) noexcept {
         switch (mode) {
             case CharacterMode::Clean:
-                processClean(buffer, numSamples);
+                // Unity gain passthrough - no processing
                 break;
             case CharacterMode::Tape:
-                processTape(buffer, numSamples);
+                processTape(buffers, numChannels, numSamples);
                 break;
             case CharacterMode::BBD:
-                processBBD(buffer, numSamples);
+                processBBD(buffers, numChannels, numSamples);
                 break;
             case CharacterMode::DigitalVintage:
-                processDigitalVintage(buffer, numSamples);
+                processDigitalVintage(buffers, numChannels, numSamples);
                 break;
         }
     }
 
-    /// @brief Process Clean mode (passthrough)
-    void processClean(float* buffer, size_t numSamples) noexcept {
-        // Unity gain passthrough - no processing
-        (void)buffer;
-        (void)numSamples;
-    }
-
     /// @brief Process Tape mode
-    void processTape(float* buffer, size_t numSamples) noexcept {
-        // Apply wow/flutter modulation to amplitude (simplified)
+    void processTape(float* const* buffers, size_t numChannels, size_t numSamples) noexcept {
+        // Wow/flutter amplitude modulation (simplified), shared by all channels
         for (size_t i = 0; i < numSamples; ++i) {
             float wow = wowLfo_.process() * wowDepth_ * 0.02f;      // Max 2% variation
             float flutter = flutterLfo_.process() * flutterDepth_ * 0.01f; // Max 1% variation
-            float modulation = 1.0f + wow + flutter;
-            buffer[i] *= modulation;
+            modulationBuffer_[i] = 1.0f + wow + flutter;
         }
 
         // Update saturation drive from smoother
@@ -459,59 +546,75 @@ private:
         // Note: THD growth slows at high drive due to tanh compression and
         // the saturation processor's DC blocker attenuating harmonics.
         float driveDb = -17.0f + satAmount * 41.0f;  // -17dB to +24dB (41dB span)
-        tapeSaturation_.setInputGain(driveDb);
 
         // Apply makeup gain to maintain roughly unity output level
         // At low saturation: need full compensation for attenuation
         // At high saturation: tanh compresses heavily, need less makeup
         float makeupDb = -driveDb * (1.0f - satAmount * 0.75f);
         makeupDb = std::clamp(makeupDb, -10.0f, 18.0f);
-        tapeSaturation_.setOutputGain(makeupDb);
 
-        // Apply saturation
-        tapeSaturation_.process(buffer, numSamples);
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            Channel& c = channels_[ch];
+            float* buffer = buffers[ch];
 
-        // Apply high-frequency rolloff
-        tapeRolloff_.process(buffer, numSamples);
+            for (size_t i = 0; i < numSamples; ++i) {
+                buffer[i] *= modulationBuffer_[i];
+            }
 
-        // Generate and add hiss
-        tapeHiss_.process(noiseBuffer_.data(), numSamples);
-        for (size_t i = 0; i < numSamples; ++i) {
-            buffer[i] += noiseBuffer_[i];
+            // Apply saturation
+            c.tapeSaturation.setInputGain(driveDb);
+            c.tapeSaturation.setOutputGain(makeupDb);
+            c.tapeSaturation.process(buffer, numSamples);
+
+            // Apply high-frequency rolloff
+            c.tapeRolloff.process(buffer, numSamples);
+
+            // Generate and add hiss
+            c.tapeHiss.process(noiseBuffer_.data(), numSamples);
+            for (size_t i = 0; i < numSamples; ++i) {
+                buffer[i] += noiseBuffer_[i];
+            }
         }
     }
 
     /// @brief Process BBD mode
-    void processBBD(float* buffer, size_t numSamples) noexcept {
-        // Apply bandwidth limiting first
-        bbdBandwidth_.process(buffer, numSamples);
-
+    void processBBD(float* const* buffers, size_t numChannels, size_t numSamples) noexcept {
         // Update saturation from smoother
         float satAmount = bbdSaturationSmoother_.process();
         float driveDb = satAmount * 12.0f; // 0-12dB drive (softer than tape)
-        bbdSaturation_.setInputGain(driveDb);
 
-        // Apply soft saturation
-        bbdSaturation_.process(buffer, numSamples);
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            Channel& c = channels_[ch];
+            float* buffer = buffers[ch];
 
-        // Add clock noise - use appropriate generator for each channel
-        // This ensures balanced stereo noise from the first sample
-        NoiseGenerator& noiseGen = isRightChannel_ ? bbdClockNoiseR_ : bbdClockNoise_;
-        std::vector<float>& noiseBuf = isRightChannel_ ? noiseBufferR_ : noiseBuffer_;
+            // Apply bandwidth limiting first
+            c.bbdBandwidth.process(buffer, numSamples);
 
-        noiseGen.process(noiseBuf.data(), numSamples);
-        for (size_t i = 0; i < numSamples; ++i) {
-            buffer[i] += noiseBuf[i];
+            // Apply soft saturation
+            c.bbdSaturation.setInputGain(driveDb);
+            c.bbdSaturation.process(buffer, numSamples);
+
+            // Add clock noise from this channel's own generator, so every
+            // channel gets the same level from the first sample
+            c.bbdClockNoise.process(noiseBuffer_.data(), numSamples);
+            for (size_t i = 0; i < numSamples; ++i) {
+                buffer[i] += noiseBuffer_[i];
+            }
         }
     }
 
     /// @brief Process Digital Vintage mode
-    void processDigitalVintage(float* buffer, size_t numSamples) noexcept {
-        // Apply sample rate reduction first (creates aliasing)
-        sampleRateReducer_.process(buffer, numSamples);
+    void processDigitalVintage(float* const* buffers, size_t numChannels,
+                               size_t numSamples) noexcept {
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            Channel& c = channels_[ch];
 
-        // Apply bit crushing
-        bitCrusher_.process(buffer, numSamples);
+            // Apply sample rate reduction first (creates aliasing)
+            c.sampleRateReducer.process(buffers[ch], numSamples);
+
+            // Apply bit crushing
+            c.bitCrusher.process(buffers[ch], numSamples);
+        }
     }
 
     // =========================================================================
@@ -531,40 +634,35 @@ private:
     float crossfadeIncrement_ = 0.0f;
     size_t crossfadeSamples_ = 2205; // 50ms at 44.1kHz
 
-    // Tape mode components
-    SaturationProcessor tapeSaturation_;
-    NoiseGenerator tapeHiss_;
-    MultimodeFilter tapeRolloff_;
+    // Per-channel components
+    std::array<Channel, NumChannels> channels_;
+
+    // Shared tape modulation
     LFO wowLfo_;
     LFO flutterLfo_;
     float wowDepth_ = kDefaultWowDepth;
     float flutterDepth_ = kDefaultFlutterDepth;
 
-    // BBD mode components
-    SaturationProcessor bbdSaturation_;
-    MultimodeFilter bbdBandwidth_;
-    NoiseGenerator bbdClockNoise_;      ///< Left channel clock noise
-    NoiseGenerator bbdClockNoiseR_;     ///< Right channel clock noise (independent smoother)
-
-    // Digital vintage components
-    BitCrusher bitCrusher_;
-    SampleRateReducer sampleRateReducer_;
-
     // Parameter smoothers
     OnePoleSmoother tapeSaturationSmoother_;
     OnePoleSmoother bbdSaturationSmoother_;
 
-    // Work buffers
-    std::vector<float> workBufferL_;
-    std::vector<float> workBufferR_;
-    std::vector<float> previousModeBufferL_;
-    std::vector<float> previousModeBufferR_;
-    std::vector<float> noiseBuffer_;
-    std::vector<float> noiseBufferR_;    ///< Right channel noise buffer
-
-    // Channel tracking for stereo processing
-    bool isRightChannel_ = false;        ///< Used to select correct noise generator
+    // Shared work buffers
+    std::vector<float> modulationBuffer_;  ///< Wow/flutter gain per sample
+    std::vector<float> fadeOutBuffer_;     ///< Previous-mode crossfade gain
+    std::vector<float> fadeInBuffer_;      ///< Current-mode crossfade gain
+    std::vector<float> noiseBuffer_;       ///< Scratch for hiss / clock noise
 };
 
+// =============================================================================
+// Common Type Aliases
+// =============================================================================
+
+/// @brief Stereo character processor (the configuration every delay uses)
+using CharacterProcessor = CharacterEngine<2>;
+
+/// @brief Mono character processor
+using CharacterProcessorMono = CharacterEngine<1>;
+
 } // namespace DSP
 } // namespace Krate
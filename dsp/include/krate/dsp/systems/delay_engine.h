@@ -23,6 +23,7 @@
 #include <krate/dsp/primitives/delay_line.h>
 #include <krate/dsp/primitives/smoother.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -107,6 +108,20 @@ public:
     /// @brief Process stereo audio buffers.
     void process(float* left, float* right, size_t numSamples, const BlockContext& ctx) noexcept;
 
+    /// @brief Process a mono buffer with a per-sample delay time.
+    ///
+    /// delayMs[i] replaces the smoothed delay time for sample i (clamped to
+    /// [0, maxDelayMs]; NaN reads as 0), so modulated callers get a new read
+    /// position every sample. The smoother continues from the last value on
+    /// the next process() without a curve. nullptr behaves like process().
+    void process(float* buffer, size_t numSamples, const BlockContext& ctx,
+                 const float* delayMs) noexcept;
+
+    /// @brief Process stereo buffers with a per-sample delay time.
+    /// @see process(float*, size_t, const BlockContext&, const float*)
+    void process(float* left, float* right, size_t numSamples, const BlockContext& ctx,
+                 const float* delayMs) noexcept;
+
     // =========================================================================
     // Query Methods
     // =========================================================================
@@ -147,6 +162,8 @@ private:
     // Internal helpers
     void updateDelayTarget(const BlockContext& ctx) noexcept;
     [[nodiscard]] float msToSamples(float ms) const noexcept;
+    [[nodiscard]] float curveDelaySamples(float ms) const noexcept;
+    [[nodiscard]] size_t curveChunkCapacity() const noexcept;
 };
 
 // =============================================================================
@@ -311,6 +328,77 @@ inline void DelayEngine::process(float* left, float* right, size_t numSamples, c
     }
 }
 
+// The curve overloads write a chunk first and then read every sample of it
+// relative to where the write head was (readLinear(d, samplesAgo)), which
+// matches write-then-read per sample while keeping the reads independent.
+
+inline void DelayEngine::process(float* buffer, size_t numSamples, const BlockContext& ctx,
+                                 const float* delayMs) noexcept {
+    if (delayMs == nullptr) {
+        process(buffer, numSamples, ctx);
+        return;
+    }
+    if (!prepared_ || numSamples == 0) return;
+
+    const size_t capacity = curveChunkCapacity();
+
+    for (size_t offset = 0; offset < numSamples;) {
+        const size_t length = std::min(numSamples - offset, capacity);
+        float* chunk = buffer + offset;
+        const float* curve = delayMs + offset;
+
+        for (size_t i = 0; i < length; ++i) {
+            delayLine_.write(chunk[i]);
+        }
+        for (size_t i = 0; i < length; ++i) {
+            const float mix = mixSmoother_.process();
+            const float wet = delayLine_.readLinear(curveDelaySamples(curve[i]), length - 1 - i);
+            const float dryCoeff = killDry_ ? 0.0f : (1.0f - mix);
+            chunk[i] = chunk[i] * dryCoeff + wet * mix;
+        }
+        offset += length;
+    }
+
+    // Leave the smoother where the curve ended
+    delaySmoother_.snapTo(std::clamp(delayMs[numSamples - 1], 0.0f, maxDelayMs_));
+}
+
+inline void DelayEngine::process(float* left, float* right, size_t numSamples, const BlockContext& ctx,
+                                 const float* delayMs) noexcept {
+    if (delayMs == nullptr) {
+        process(left, right, numSamples, ctx);
+        return;
+    }
+    if (!prepared_ || numSamples == 0) return;
+
+    const size_t capacity = curveChunkCapacity();
+
+    for (size_t offset = 0; offset < numSamples;) {
+        const size_t length = std::min(numSamples - offset, capacity);
+        float* chunkL = left + offset;
+        float* chunkR = right + offset;
+        const float* curve = delayMs + offset;
+
+        for (size_t i = 0; i < length; ++i) {
+            delayLine_.write(chunkL[i]);
+            delayLineRight_.write(chunkR[i]);
+        }
+        for (size_t i = 0; i < length; ++i) {
+            const float mix = mixSmoother_.process();
+            const float delaySamples = curveDelaySamples(curve[i]);
+            const size_t samplesAgo = length - 1 - i;
+            const float wetL = delayLine_.readLinear(delaySamples, samplesAgo);
+            const float wetR = delayLineRight_.readLinear(delaySamples, samplesAgo);
+            const float dryCoeff = killDry_ ? 0.0f : (1.0f - mix);
+            chunkL[i] = chunkL[i] * dryCoeff + wetL * mix;
+            chunkR[i] = chunkR[i] * dryCoeff + wetR * mix;
+        }
+        offset += length;
+    }
+
+    delaySmoother_.snapTo(std::clamp(delayMs[numSamples - 1], 0.0f, maxDelayMs_));
+}
+
 inline float DelayEngine::getCurrentDelayMs() const noexcept {
     return delaySmoother_.getCurrentValue();
 }
@@ -331,5 +419,16 @@ inline float DelayEngine::msToSamples(float ms) const noexcept {
     return static_cast<float>(ms * sampleRate_ / 1000.0);
 }
 
+inline float DelayEngine::curveDelaySamples(float ms) const noexcept {
+    // Written so that NaN falls through to 0
+    return msToSamples(ms > 0.0f ? std::min(ms, maxDelayMs_) : 0.0f);
+}
+
+inline size_t DelayEngine::curveChunkCapacity() const noexcept {
+    // A read samplesAgo writes back at the longest delay must not land on
+    // a slot the chunk has already overwritten
+    return delayLine_.mask() - delayLine_.maxDelaySamples() + 1;
+}
+
 } // namespace DSP
 } // namespace Krate
@@ -70,6 +70,21 @@ public:
         return y;
     }
 
+    /// @brief Process a buffer in-place (same result as process() per sample)
+    void processBlock(float* buffer, size_t numSamples) noexcept {
+        constexpr float R = 0.995f;
+        float x1 = x1_;
+        float y1 = y1_;
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float x = buffer[i];
+            y1 = x - x1 + R * y1;
+            x1 = x;
+            buffer[i] = y1;
+        }
+        x1_ = x1;
+        y1_ = y1;
+    }
+
 private:
     float x1_ = 0.0f;  ///< Previous input
     float y1_ = 0.0f;  ///< Previous output
@@ -101,6 +116,10 @@ public:
     static constexpr float kMaxCrossFeedback = 1.0f;
     static constexpr float kSmoothingTimeMs = 20.0f;
 
+    /// Chunks shorter than this (delays under kMinChunkSamples samples) run
+    /// the per-sample loop instead of the block kernels
+    static constexpr size_t kMinChunkSamples = 8;
+
     // =========================================================================
     // Construction / Destruction
     // =========================================================================
@@ -155,9 +174,17 @@ public:
         saturatorL_.setInputGain(0.0f);  // No extra drive by default
         saturatorR_.setInputGain(0.0f);
 
-        // Allocate feedback buffers
-        feedbackBufferL_.resize(maxBlockSize);
-        feedbackBufferR_.resize(maxBlockSize);
+        // Allocate chunk buffers
+        const size_t chunkCapacity = std::max<size_t>(maxBlockSize, 1);
+        delayedL_.resize(chunkCapacity);
+        delayedR_.resize(chunkCapacity);
+        feedbackBufferL_.resize(chunkCapacity);
+        feedbackBufferR_.resize(chunkCapacity);
+        feedbackGain_.resize(chunkCapacity);
+        crossFeedback_.resize(chunkCapacity);
+        inputGain_.resize(chunkCapacity);
+        delayCurve_.resize(chunkCapacity);
+        modulationCurve_.resize(chunkCapacity);
 
         prepared_ = true;
     }
@@ -194,124 +221,104 @@ public:
 
     /// @brief Process mono audio buffer
     void process(float* buffer, size_t numSamples, const BlockContext& ctx) noexcept {
+        process(buffer, numSamples, ctx, nullptr, nullptr, nullptr);
+    }
+
+    /// @brief Process stereo audio buffers
+    void process(float* left, float* right, size_t numSamples, const BlockContext& ctx) noexcept {
+        process(left, right, numSamples, ctx, nullptr, nullptr, nullptr);
+    }
+
+    /// @brief Process mono audio with per-sample delay time, modulation and
+    ///        feedback
+    ///
+    /// delayMs[i] and feedback[i] replace the smoothed delay time and feedback
+    /// amount for sample i, so callers that smooth their own parameters can
+    /// hand them over without calling the setters inside their loop. The delay
+    /// time goes through the same crossfade as setDelayTimeMs(), so the read
+    /// position stays put until a change is large enough to crossfade.
+    /// modulationMs[i] is added to the read position of sample i without
+    /// crossfading (CrossfadingDelayLine::setModulationSamples()), so an LFO
+    /// glides the read and bends the pitch. Values are clamped like the
+    /// setters (NaN reads as 0) and the feedback curve is ignored while
+    /// frozen. Any pointer may be nullptr to use the setter value (no
+    /// modulation); after a curve the smoother continues from its last value.
+    ///
+    /// @param delayMs Delay time per sample in milliseconds, or nullptr
+    /// @param modulationMs Modulation offset per sample in milliseconds, or nullptr
+    /// @param feedback Feedback amount per sample, or nullptr
+    void process(float* buffer, size_t numSamples, const BlockContext& ctx,
+                 const float* delayMs, const float* modulationMs, const float* feedback) noexcept {
         if (!prepared_ || numSamples == 0) return;
 
+        startCurves(delayMs, modulationMs);
         hasProcessed_ = true;
 
         // Update delay target
         delaySmoother_.setTarget(targetDelayMs_);
-
-        for (size_t i = 0; i < numSamples; ++i) {
-            // Get smoothed values
-            const float feedback = feedbackSmoother_.process();
-            const float delayMs = delaySmoother_.process();
-            const float inputGain = inputMuteSmoother_.process();
-
-            // Set delay time on crossfading delay line (handles large changes smoothly)
-            delayLineL_.setDelayMs(delayMs);
-
-            // Read delayed sample first (read-before-write pattern)
-            // CrossfadingDelayLine handles the crossfading internally
-            const float delayed = delayLineL_.read();
-
-            // Calculate feedback signal
-            float feedbackSignal = delayed;
-
-            // Apply filter if enabled
-            if (filterEnabled_) {
-                feedbackSignal = filterL_.processSample(feedbackSignal);
-            }
-
-            // Apply saturation if enabled
-            if (saturationEnabled_) {
-                feedbackSignal = saturatorL_.processSample(feedbackSignal);
+        const float* feedbackCurve = frozen_ ? nullptr : feedback;
+
+        size_t offset = 0;
+        while (offset < numSamples) {
+            const size_t length = chunkLength(numSamples - offset, false,
+                                              delayMs != nullptr ? delayMs + offset : nullptr,
+                                              modulationMs != nullptr ? modulationMs + offset : nullptr);
+            const float* delayCurve = delayMs != nullptr ? delayCurve_.data() : nullptr;
+            const float* modulationCurve = modulationMs != nullptr ? modulationCurve_.data() : nullptr;
+            const float* feedbackChunk = feedbackCurve != nullptr ? feedbackCurve + offset : nullptr;
+            if (length < kMinChunkSamples) {
+                for (size_t i = 0; i < length; ++i) {
+                    processFrame(buffer[offset + i],
+                                 delayCurve != nullptr ? delayCurve + i : nullptr,
+                                 modulationCurve != nullptr ? modulationCurve + i : nullptr,
+                                 feedbackChunk != nullptr ? feedbackChunk + i : nullptr);
+                }
+            } else {
+                processChunk(buffer + offset, length, delayCurve, modulationCurve, feedbackChunk);
             }
-
-            // Apply DC blocking (prevents accumulation in feedback loop)
-            feedbackSignal = dcBlockerL_.process(feedbackSignal);
-
-            // Scale by feedback amount
-            feedbackSignal *= feedback;
-
-            // Combine input with feedback
-            const float input = buffer[i] * inputGain;
-            const float toDelay = input + feedbackSignal;
-
-            // Write mixed signal to delay line
-            delayLineL_.write(toDelay);
-
-            // Output is the delayed signal (wet only for feedback network)
-            buffer[i] = delayed;
+            offset += length;
         }
+
+        followCurves(delayMs, feedbackCurve, numSamples);
     }
 
-    /// @brief Process stereo audio buffers
-    void process(float* left, float* right, size_t numSamples, const BlockContext& ctx) noexcept {
+    /// @brief Process stereo audio with per-sample delay time, modulation and
+    ///        feedback
+    /// @see process(float*, size_t, const BlockContext&, const float*, const float*, const float*)
+    void process(float* left, float* right, size_t numSamples, const BlockContext& ctx,
+                 const float* delayMs, const float* modulationMs, const float* feedback) noexcept {
         if (!prepared_ || numSamples == 0) return;
 
+        startCurves(delayMs, modulationMs);
         hasProcessed_ = true;
 
         // Update delay target
         delaySmoother_.setTarget(targetDelayMs_);
-
-        for (size_t i = 0; i < numSamples; ++i) {
-            // Get smoothed values
-            const float feedback = feedbackSmoother_.process();
-            const float delayMs = delaySmoother_.process();
-            const float crossFeedback = crossFeedbackSmoother_.process();
-            const float inputGain = inputMuteSmoother_.process();
-
-            // Set delay time on crossfading delay lines (handles large changes smoothly)
-            delayLineL_.setDelayMs(delayMs);
-            delayLineR_.setDelayMs(delayMs);
-
-            // Read delayed samples first (read-before-write pattern)
-            // CrossfadingDelayLine handles the crossfading internally
-            const float delayedL = delayLineL_.read();
-            const float delayedR = delayLineR_.read();
-
-            // Calculate feedback signal
-            float feedbackL = delayedL;
-            float feedbackR = delayedR;
-
-            // Apply filter if enabled
-            if (filterEnabled_) {
-                feedbackL = filterL_.processSample(feedbackL);
-                feedbackR = filterR_.processSample(feedbackR);
-            }
-
-            // Apply saturation if enabled
-            if (saturationEnabled_) {
-                feedbackL = saturatorL_.processSample(feedbackL);
-                feedbackR = saturatorR_.processSample(feedbackR);
+        const float* feedbackCurve = frozen_ ? nullptr : feedback;
+
+        size_t offset = 0;
+        while (offset < numSamples) {
+            const size_t length = chunkLength(numSamples - offset, true,
+                                              delayMs != nullptr ? delayMs + offset : nullptr,
+                                              modulationMs != nullptr ? modulationMs + offset : nullptr);
+            const float* delayCurve = delayMs != nullptr ? delayCurve_.data() : nullptr;
+            const float* modulationCurve = modulationMs != nullptr ? modulationCurve_.data() : nullptr;
+            const float* feedbackChunk = feedbackCurve != nullptr ? feedbackCurve + offset : nullptr;
+            if (length < kMinChunkSamples) {
+                for (size_t i = 0; i < length; ++i) {
+                    processFrame(left[offset + i], right[offset + i],
+                                 delayCurve != nullptr ? delayCurve + i : nullptr,
+                                 modulationCurve != nullptr ? modulationCurve + i : nullptr,
+                                 feedbackChunk != nullptr ? feedbackChunk + i : nullptr);
+                }
+            } else {
+                processChunk(left + offset, right + offset, length, delayCurve, modulationCurve,
+                             feedbackChunk);
             }
-
-            // Apply DC blocking (prevents accumulation in feedback loop)
-            feedbackL = dcBlockerL_.process(feedbackL);
-            feedbackR = dcBlockerR_.process(feedbackR);
-
-            // Apply cross-feedback (stereo routing)
-            float crossedL, crossedR;
-            stereoCrossBlend(feedbackL, feedbackR, crossFeedback, crossedL, crossedR);
-
-            // Scale by feedback amount
-            crossedL *= feedback;
-            crossedR *= feedback;
-
-            // Combine input with feedback
-            const float inputL = left[i] * inputGain;
-            const float inputR = right[i] * inputGain;
-            const float toDelayL = inputL + crossedL;
-            const float toDelayR = inputR + crossedR;
-
-            // Write mixed signal to delay lines
-            delayLineL_.write(toDelayL);
-            delayLineR_.write(toDelayR);
-
-            // Output is the delayed signal
-            left[i] = delayedL;
-            right[i] = delayedR;
+            offset += length;
         }
+
+        followCurves(delayMs, feedbackCurve, numSamples);
     }
 
     // =========================================================================
@@ -482,9 +489,16 @@ private:
     DCBlocker dcBlockerL_;
     DCBlocker dcBlockerR_;
 
-    // Scratch buffers
+    // Chunk buffers: delayed output, processed feedback, smoothed gains
+    std::vector<float> delayedL_;
+    std::vector<float> delayedR_;
     std::vector<float> feedbackBufferL_;
     std::vector<float> feedbackBufferR_;
+    std::vector<float> feedbackGain_;
+    std::vector<float> crossFeedback_;
+    std::vector<float> inputGain_;
+    std::vector<float> delayCurve_;       ///< Chunk of the delay curve in samples
+    std::vector<float> modulationCurve_;  ///< Chunk of the modulation curve in samples
 
     // Feedback state
     float lastFeedbackL_ = 0.0f;
@@ -512,6 +526,313 @@ private:
     [[nodiscard]] float msToSamples(float ms) const noexcept {
         return static_cast<float>(ms * sampleRate_ / 1000.0);
     }
+
+    // Curve values are clamped like the setters; written so NaN falls to 0
+    [[nodiscard]] float curveDelayMs(float ms) const noexcept {
+        return ms > 0.0f ? std::min(ms, maxDelayMs_) : 0.0f;
+    }
+
+    [[nodiscard]] static float curveFeedback(float amount) noexcept {
+        return amount > kMinFeedback ? std::min(amount, kMaxFeedback) : kMinFeedback;
+    }
+
+    [[nodiscard]] float curveModulationSamples(float ms) const noexcept {
+        const float clampedMs = std::isnan(ms) ? 0.0f : std::clamp(ms, -maxDelayMs_, maxDelayMs_);
+        return msToSamples(clampedMs);
+    }
+
+    /// Before the first process() the delay lines snap to the curve, as
+    /// setDelayTimeMs() does, instead of crossfading in from the old delay.
+    /// Without a modulation curve the read positions are unmodulated.
+    void startCurves(const float* delayMs, const float* modulationMs) noexcept {
+        if (delayMs != nullptr && !hasProcessed_) {
+            const float startMs = curveDelayMs(delayMs[0]);
+            delaySmoother_.snapTo(startMs);
+            delayLineL_.snapToDelayMs(startMs);
+            delayLineR_.snapToDelayMs(startMs);
+        }
+        if (modulationMs == nullptr) {
+            delayLineL_.setModulationSamples(0.0f);
+            delayLineR_.setModulationSamples(0.0f);
+        }
+    }
+
+    /// Leave the smoothers on the last curve values so that a following
+    /// process() without curves continues from there
+    void followCurves(const float* delayMs, const float* feedback, size_t numSamples) noexcept {
+        if (delayMs != nullptr) {
+            delaySmoother_.snapTo(curveDelayMs(delayMs[numSamples - 1]));
+        }
+        if (feedback != nullptr) {
+            feedbackSmoother_.snapTo(curveFeedback(feedback[numSamples - 1]));
+        }
+    }
+
+    // =========================================================================
+    // Chunked Execution
+    // =========================================================================
+    // Every read in a chunk lands on history written before the chunk as long
+    // as the chunk is no longer than the shortest delay, so the whole chunk
+    // can be read first, run through filter/saturation/DC blocking as block
+    // loops, and written back. The result is identical to the per-sample loop.
+
+    /// Samples that can run as one chunk (at least 1). With curves, the
+    /// chunk's values are converted to samples into delayCurve_ and
+    /// modulationCurve_.
+    [[nodiscard]] size_t chunkLength(size_t remaining, bool stereo, const float* delayMs,
+                                     const float* modulationMs) noexcept {
+        float minDelay = std::min(delayLineL_.minTapDelaySamples(),
+                                  static_cast<float>(delayLineL_.maxDelaySamples()));
+        if (stereo) {
+            minDelay = std::min(minDelay, delayLineR_.minTapDelaySamples());
+        }
+        if (delayMs == nullptr) {
+            // The delay smoother moves monotonically towards its target and the
+            // taps only take its values, so these bound every delay in the chunk
+            const float smoothedMs = std::min(delaySmoother_.getCurrentValue(), delaySmoother_.getTarget());
+            minDelay = std::min(minDelay, smoothedMs * 0.001f * static_cast<float>(sampleRate_));
+        }
+        if (delayMs == nullptr && modulationMs == nullptr) {
+            return std::min({remaining, safeChunkLength(minDelay), delayedL_.size()});
+        }
+
+        // The taps only take curve values, and every read adds the modulation
+        // of its sample, so the curves bound the rest
+        const size_t limit = std::min(remaining, delayedL_.size());
+        float minModulation = 0.0f;
+        for (size_t i = 0; i < limit; ++i) {
+            if (delayMs != nullptr) {
+                delayCurve_[i] = curveDelayMs(delayMs[i]) * 0.001f * static_cast<float>(sampleRate_);
+                minDelay = std::min(minDelay, delayCurve_[i]);
+            }
+            if (modulationMs != nullptr) {
+                modulationCurve_[i] = curveModulationSamples(modulationMs[i]);
+                minModulation = std::min(minModulation, modulationCurve_[i]);
+            }
+            const size_t safe = safeChunkLength(minDelay + minModulation);
+            if (safe <= i + 1) {
+                return safe;
+            }
+        }
+        return limit;
+    }
+
+    /// Truncation leaves one sample of margin for rounding in the smoother
+    [[nodiscard]] static size_t safeChunkLength(float minDelay) noexcept {
+        return (minDelay >= 1.0f) ? static_cast<size_t>(minDelay) : 1;
+    }
+
+    /// True if the delay stays put for the whole chunk. A settled smoother
+    /// repeats its target, so one setDelayMs() stands in for the per-sample
+    /// calls; if that starts a crossfade the per-sample reads are needed.
+    [[nodiscard]] bool delayIsSettled(bool stereo) noexcept {
+        if (!delaySmoother_.isComplete()) {
+            return false;
+        }
+        const float delayMs = delaySmoother_.process();
+        delayLineL_.setDelayMs(delayMs);
+        if (stereo) {
+            delayLineR_.setDelayMs(delayMs);
+        }
+        return !delayLineL_.isCrossfading() && !(stereo && delayLineR_.isCrossfading());
+    }
+
+    /// Per-sample loop for one mono frame; the curve pointers (this sample's
+    /// delay and modulation in samples and feedback amount) replace the
+    /// smoothers if set
+    void processFrame(float& sample, const float* delayCurve, const float* modulationCurve,
+                      const float* feedbackCurve) noexcept {
+        // Get smoothed values
+        const float feedback = feedbackCurve != nullptr ? curveFeedback(*feedbackCurve)
+                                                        : feedbackSmoother_.process();
+        const float inputGain = inputMuteSmoother_.process();
+
+        // Set delay time on crossfading delay line (handles large changes smoothly)
+        if (delayCurve != nullptr) {
+            delayLineL_.setDelaySamples(*delayCurve);
+        } else {
+            delayLineL_.setDelayMs(delaySmoother_.process());
+        }
+        if (modulationCurve != nullptr) {
+            delayLineL_.setModulationSamples(*modulationCurve);
+        }
+
+        // Read delayed sample first (read-before-write pattern)
+        const float delayed = delayLineL_.read();
+
+        // Filter, saturation and DC blocking (prevents accumulation in feedback loop)
+        float feedbackSignal = delayed;
+        if (filterEnabled_) {
+            feedbackSignal = filterL_.processSample(feedbackSignal);
+        }
+        if (saturationEnabled_) {
+            feedbackSignal = saturatorL_.processSample(feedbackSignal);
+        }
+        feedbackSignal = dcBlockerL_.process(feedbackSignal);
+
+        // Combine input with scaled feedback and write to the delay line
+        delayLineL_.write(sample * inputGain + feedbackSignal * feedback);
+
+        // Output is the delayed signal (wet only for feedback network)
+        sample = delayed;
+    }
+
+    /// Per-sample loop for one stereo frame
+    void processFrame(float& left, float& right, const float* delayCurve,
+                      const float* modulationCurve, const float* feedbackCurve) noexcept {
+        // Get smoothed values
+        const float feedback = feedbackCurve != nullptr ? curveFeedback(*feedbackCurve)
+                                                        : feedbackSmoother_.process();
+        const float crossFeedback = crossFeedbackSmoother_.process();
+        const float inputGain = inputMuteSmoother_.process();
+
+        // Set delay time on crossfading delay lines (handles large changes smoothly)
+        if (delayCurve != nullptr) {
+            delayLineL_.setDelaySamples(*delayCurve);
+            delayLineR_.setDelaySamples(*delayCurve);
+        } else {
+            const float delayMs = delaySmoother_.process();
+            delayLineL_.setDelayMs(delayMs);
+            delayLineR_.setDelayMs(delayMs);
+        }
+        if (modulationCurve != nullptr) {
+            delayLineL_.setModulationSamples(*modulationCurve);
+            delayLineR_.setModulationSamples(*modulationCurve);
+        }
+
+        // Read delayed samples first (read-before-write pattern)
+        const float delayedL = delayLineL_.read();
+        const float delayedR = delayLineR_.read();
+
+        // Filter, saturation and DC blocking (prevents accumulation in feedback loop)
+        float feedbackL = delayedL;
+        float feedbackR = delayedR;
+        if (filterEnabled_) {
+            feedbackL = filterL_.processSample(feedbackL);
+            feedbackR = filterR_.processSample(feedbackR);
+        }
+        if (saturationEnabled_) {
+            feedbackL = saturatorL_.processSample(feedbackL);
+            feedbackR = saturatorR_.processSample(feedbackR);
+        }
+        feedbackL = dcBlockerL_.process(feedbackL);
+        feedbackR = dcBlockerR_.process(feedbackR);
+
+        // Apply cross-feedback (stereo routing)
+        float crossedL, crossedR;
+        stereoCrossBlend(feedbackL, feedbackR, crossFeedback, crossedL, crossedR);
+
+        // Combine input with scaled feedback and write to the delay lines
+        delayLineL_.write(left * inputGain + crossedL * feedback);
+        delayLineR_.write(right * inputGain + crossedR * feedback);
+
+        // Output is the delayed signal
+        left = delayedL;
+        right = delayedR;
+    }
+
+    /// Mono chunk: read all, process the feedback path as blocks, write all
+    void processChunk(float* buffer, size_t numSamples, const float* delayCurve,
+                      const float* modulationCurve, const float* feedbackCurve) noexcept {
+        loadFeedbackGain(feedbackCurve, numSamples);
+        inputMuteSmoother_.processBlock(inputGain_.data(), numSamples);
+
+        if (delayCurve != nullptr && modulationCurve != nullptr) {
+            delayLineL_.readAheadBlock(delayCurve, modulationCurve, delayedL_.data(), numSamples);
+        } else if (modulationCurve == nullptr && delayCurve == nullptr && delayIsSettled(false)) {
+            delayLineL_.readAheadBlock(delayedL_.data(), numSamples);
+        } else {
+            for (size_t i = 0; i < numSamples; ++i) {
+                if (delayCurve != nullptr) {
+                    delayLineL_.setDelaySamples(delayCurve[i]);
+                } else {
+                    delayLineL_.setDelayMs(delaySmoother_.process());
+                }
+                if (modulationCurve != nullptr) {
+                    delayLineL_.setModulationSamples(modulationCurve[i]);
+                }
+                delayedL_[i] = delayLineL_.readAhead(i);
+            }
+        }
+
+        std::copy_n(delayedL_.begin(), numSamples, feedbackBufferL_.begin());
+        processFeedbackPath(filterL_, saturatorL_, dcBlockerL_, feedbackBufferL_.data(), numSamples);
+
+        for (size_t i = 0; i < numSamples; ++i) {
+            delayLineL_.write(buffer[i] * inputGain_[i] + feedbackBufferL_[i] * feedbackGain_[i]);
+            buffer[i] = delayedL_[i];
+        }
+    }
+
+    /// Stereo chunk: read all, process the feedback path as blocks, write all
+    void processChunk(float* left, float* right, size_t numSamples, const float* delayCurve,
+                      const float* modulationCurve, const float* feedbackCurve) noexcept {
+        loadFeedbackGain(feedbackCurve, numSamples);
+        crossFeedbackSmoother_.processBlock(crossFeedback_.data(), numSamples);
+        inputMuteSmoother_.processBlock(inputGain_.data(), numSamples);
+
+        if (delayCurve != nullptr && modulationCurve != nullptr) {
+            delayLineL_.readAheadBlock(delayCurve, modulationCurve, delayedL_.data(), numSamples);
+            delayLineR_.readAheadBlock(delayCurve, modulationCurve, delayedR_.data(), numSamples);
+        } else if (modulationCurve == nullptr && delayCurve == nullptr && delayIsSettled(true)) {
+            delayLineL_.readAheadBlock(delayedL_.data(), numSamples);
+            delayLineR_.readAheadBlock(delayedR_.data(), numSamples);
+        } else {
+            for (size_t i = 0; i < numSamples; ++i) {
+                if (delayCurve != nullptr) {
+                    delayLineL_.setDelaySamples(delayCurve[i]);
+                    delayLineR_.setDelaySamples(delayCurve[i]);
+                } else {
+                    const float delayMs = delaySmoother_.process();
+                    delayLineL_.setDelayMs(delayMs);
+                    delayLineR_.setDelayMs(delayMs);
+                }
+                if (modulationCurve != nullptr) {
+                    delayLineL_.setModulationSamples(modulationCurve[i]);
+                    delayLineR_.setModulationSamples(modulationCurve[i]);
+                }
+                delayedL_[i] = delayLineL_.readAhead(i);
+                delayedR_[i] = delayLineR_.readAhead(i);
+            }
+        }
+
+        std::copy_n(delayedL_.begin(), numSamples, feedbackBufferL_.begin());
+        std::copy_n(delayedR_.begin(), numSamples, feedbackBufferR_.begin());
+        processFeedbackPath(filterL_, saturatorL_, dcBlockerL_, feedbackBufferL_.data(), numSamples);
+        processFeedbackPath(filterR_, saturatorR_, dcBlockerR_, feedbackBufferR_.data(), numSamples);
+
+        for (size_t i = 0; i < numSamples; ++i) {
+            float crossedL, crossedR;
+            stereoCrossBlend(feedbackBufferL_[i], feedbackBufferR_[i], crossFeedback_[i], crossedL, crossedR);
+            delayLineL_.write(left[i] * inputGain_[i] + crossedL * feedbackGain_[i]);
+            delayLineR_.write(right[i] * inputGain_[i] + crossedR * feedbackGain_[i]);
+            left[i] = delayedL_[i];
+            right[i] = delayedR_[i];
+        }
+    }
+
+    /// Chunk feedback gains from the curve or the smoother
+    void loadFeedbackGain(const float* feedbackCurve, size_t numSamples) noexcept {
+        if (feedbackCurve != nullptr) {
+            for (size_t i = 0; i < numSamples; ++i) {
+                feedbackGain_[i] = curveFeedback(feedbackCurve[i]);
+            }
+        } else {
+            feedbackSmoother_.processBlock(feedbackGain_.data(), numSamples);
+        }
+    }
+
+    /// Filter, saturation and DC blocking for one channel of a chunk
+    void processFeedbackPath(MultimodeFilter& filter, SaturationProcessor& saturator,
+                             DCBlocker& dcBlocker, float* buffer, size_t numSamples) noexcept {
+        if (filterEnabled_) {
+            filter.processSamples(buffer, numSamples);
+        }
+        if (saturationEnabled_) {
+            saturator.processSamples(buffer, numSamples);
+        }
+        dcBlocker.processBlock(buffer, numSamples);
+    }
 };
 
 } // namespace DSP
@@ -18,8 +18,11 @@
 // - Hot-swap with crossfade
 //
 // Design Notes:
-// - Hybrid sample-by-sample delay loop with block-based processor
-// - At 512 samples/44.1kHz, processor effects have ~11.6ms feedback latency
+// - Sample-by-sample delay loop; the feedback chain (processor, filter,
+//   limiter) runs on fixed kSubBlockSize chunks aligned to the stream, not to
+//   host blocks, so output is identical at any host buffer size
+// - Processed chunks come back through a one-chunk ring; the delay line read
+//   is shortened by kSubBlockSize so the loop period equals the delay time
 // ==============================================================================
 #pragma once
 
@@ -47,6 +50,10 @@ public:
     /// @brief Maximum delay time in milliseconds
     static constexpr float kMaxDelayMs = 10000.0f;
 
+    /// @brief Fixed block size of the feedback chain (processor, filter, limiter)
+    /// @note Delays shorter than this many samples are lengthened to it
+    static constexpr std::size_t kSubBlockSize = 32;
+
     /// @brief Default constructor
     FlexibleFeedbackNetwork() = default;
 
@@ -66,13 +73,17 @@ public:
         delayL_.prepare(sampleRate, kMaxDelaySeconds);
         delayR_.prepare(sampleRate, kMaxDelaySeconds);
 
-        // Pre-allocate processing buffers (sized to maxBlockSize)
-        feedbackL_.resize(maxBlockSize, 0.0f);
-        feedbackR_.resize(maxBlockSize, 0.0f);
-        processedL_.resize(maxBlockSize, 0.0f);
-        processedR_.resize(maxBlockSize, 0.0f);
-        oldProcessedL_.resize(maxBlockSize, 0.0f);
-        oldProcessedR_.resize(maxBlockSize, 0.0f);
+        // Pre-allocate feedback chain buffers (one sub-block each)
+        feedbackL_.assign(kSubBlockSize, 0.0f);
+        feedbackR_.assign(kSubBlockSize, 0.0f);
+        processedL_.assign(kSubBlockSize, 0.0f);
+        processedR_.assign(kSubBlockSize, 0.0f);
+        oldProcessedL_.assign(kSubBlockSize, 0.0f);
+        oldProcessedR_.assign(kSubBlockSize, 0.0f);
+        subBlockPos_ = 0;
+
+        // Chain components only ever see kSubBlockSize samples per call
+        const std::size_t chainBlockSize = std::max(maxBlockSize, kSubBlockSize);
 
         // Configure smoothers (20ms smoothing time)
         constexpr float kSmoothTimeMs = 20.0f;
@@ -82,16 +93,16 @@ public:
         delayTimeSmoother_.configure(kSmoothTimeMs, static_cast<float>(sampleRate));
 
         // Prepare filters
-        filterL_.prepare(sampleRate, maxBlockSize);
-        filterR_.prepare(sampleRate, maxBlockSize);
+        filterL_.prepare(sampleRate, chainBlockSize);
+        filterR_.prepare(sampleRate, chainBlockSize);
         filterL_.setType(FilterType::Lowpass);
         filterR_.setType(FilterType::Lowpass);
         filterL_.setCutoff(4000.0f);
         filterR_.setCutoff(4000.0f);
 
         // Prepare limiters for >100% feedback stability
-        limiterL_.prepare(sampleRate, maxBlockSize);
-        limiterR_.prepare(sampleRate, maxBlockSize);
+        limiterL_.prepare(sampleRate, chainBlockSize);
+        limiterR_.prepare(sampleRate, chainBlockSize);
         limiterL_.setDetectionMode(DynamicsDetectionMode::Peak);
         limiterR_.setDetectionMode(DynamicsDetectionMode::Peak);
         limiterL_.setThreshold(0.0f);  // 0 dB threshold
@@ -108,7 +119,7 @@ public:
 
         // Prepare injected processor if set
         if (processor_) {
-            processor_->prepare(sampleRate, maxBlockSize);
+            processor_->prepare(sampleRate, chainBlockSize);
         }
     }
 
@@ -131,9 +142,8 @@ public:
         std::fill(oldProcessedL_.begin(), oldProcessedL_.end(), 0.0f);
         std::fill(oldProcessedR_.begin(), oldProcessedR_.end(), 0.0f);
 
-        // Clear processed feedback state
-        lastProcessedFeedbackL_ = 0.0f;
-        lastProcessedFeedbackR_ = 0.0f;
+        // Restart the sub-block grid
+        subBlockPos_ = 0;
 
         // Reset injected processor
         if (processor_) {
@@ -154,10 +164,15 @@ public:
     /// @param right Right channel buffer (modified in-place)
     /// @param numSamples Number of samples to process
     /// @param ctx Block context for tempo sync
+    /// @note Output depends only on the input stream and parameter changes,
+    ///       not on how it is split into calls.
     void process(float* left, float* right, std::size_t numSamples,
                  [[maybe_unused]] const BlockContext& ctx) noexcept {
         if (numSamples == 0 || !left || !right) return;
 
+        const float msPerSample = 1000.0f / static_cast<float>(sampleRate_);
+        constexpr float kChainSamples = static_cast<float>(kSubBlockSize);
+
         // Process sample-by-sample for correct feedback loop behavior
         for (std::size_t i = 0; i < numSamples; ++i) {
             // Get smoothed parameters
@@ -172,8 +187,8 @@ public:
             // Effective feedback amount (interpolate to 100% in freeze mode)
             const float effectiveFeedback = feedback + freezeMix * (1.0f - feedback);
 
-            // Convert delay time to ms for CrossfadingDelayLine
-            const float delayMs = delayTimeSamples / static_cast<float>(sampleRate_) * 1000.0f;
+            // The chain adds kSubBlockSize samples, so read that much earlier
+            const float delayMs = std::max(0.0f, delayTimeSamples - kChainSamples) * msPerSample;
 
             // Set delay time on crossfading delay lines (handles large changes smoothly)
             delayL_.setDelayMs(delayMs);
@@ -184,90 +199,27 @@ public:
             const float delayedL = delayL_.read();
             const float delayedR = delayR_.read();
 
-            // Calculate feedback signal using processed feedback from previous block
-            const float feedbackSignalL = lastProcessedFeedbackL_ * effectiveFeedback;
-            const float feedbackSignalR = lastProcessedFeedbackR_ * effectiveFeedback;
+            // Slot subBlockPos_ holds the processed sample from one sub-block ago;
+            // it is the network output and the signal fed back into the delay
+            const float processedL = feedbackL_[subBlockPos_];
+            const float processedR = feedbackR_[subBlockPos_];
 
             // Combine input with feedback and write to delay line
-            delayL_.write(inputL + feedbackSignalL);
-            delayR_.write(inputR + feedbackSignalR);
-
-            // Store delay output for block-based processing (processor, filter, limiter)
-            feedbackL_[i] = delayedL;
-            feedbackR_[i] = delayedR;
-
-            // Update per-sample feedback for within-block responsiveness.
-            // When a processor is active, this provides "raw" feedback within the block,
-            // while the end-of-block update (after processor) provides processed feedback
-            // for the next block. This is a compromise: within-block gets immediate raw
-            // feedback, cross-block gets processed feedback with one-block latency.
-            lastProcessedFeedbackL_ = delayedL;
-            lastProcessedFeedbackR_ = delayedR;
-        }
-
-        // Apply injected processor to feedback signal (if present)
-        if (processor_) {
-            std::copy(feedbackL_.begin(), feedbackL_.begin() + numSamples, processedL_.begin());
-            std::copy(feedbackR_.begin(), feedbackR_.begin() + numSamples, processedR_.begin());
-
-            processor_->process(processedL_.data(), processedR_.data(), numSamples);
-
-            // Handle crossfade if hot-swapping
-            if (oldProcessor_ && crossfadePosition_ < crossfadeSamples_) {
-                std::copy(feedbackL_.begin(), feedbackL_.begin() + numSamples, oldProcessedL_.begin());
-                std::copy(feedbackR_.begin(), feedbackR_.begin() + numSamples, oldProcessedR_.begin());
-
-                oldProcessor_->process(oldProcessedL_.data(), oldProcessedR_.data(), numSamples);
-
-                for (std::size_t i = 0; i < numSamples; ++i) {
-                    const float fadePos = (crossfadePosition_ + static_cast<float>(i)) / crossfadeSamples_;
-                    const float newGain = std::min(1.0f, fadePos);
-                    const float oldGain = 1.0f - newGain;
-                    processedL_[i] = processedL_[i] * newGain + oldProcessedL_[i] * oldGain;
-                    processedR_[i] = processedR_[i] * newGain + oldProcessedR_[i] * oldGain;
-                }
-
-                crossfadePosition_ += static_cast<float>(numSamples);
-                if (crossfadePosition_ >= crossfadeSamples_) {
-                    oldProcessor_ = nullptr;
-                }
-            }
+            delayL_.write(inputL + processedL * effectiveFeedback);
+            delayR_.write(inputR + processedR * effectiveFeedback);
 
-            // Mix processed with dry feedback based on processor mix (smoothed per-sample)
-            for (std::size_t i = 0; i < numSamples; ++i) {
-                const float mix = processorMixSmoother_.process();
-                feedbackL_[i] = feedbackL_[i] * (1.0f - mix) + processedL_[i] * mix;
-                feedbackR_[i] = feedbackR_[i] * (1.0f - mix) + processedR_[i] * mix;
-            }
-        }
-
-        // Apply filter to feedback if enabled
-        if (filterEnabled_) {
-            filterL_.process(feedbackL_.data(), numSamples);
-            filterR_.process(feedbackR_.data(), numSamples);
-        }
+            left[i] = processedL;
+            right[i] = processedR;
 
-        // Apply limiting if feedback > 100%
-        if (feedbackAmount_ > 1.0f) {
-            limiterL_.process(feedbackL_.data(), numSamples);
-            limiterR_.process(feedbackR_.data(), numSamples);
+            // Queue the raw delay output for the next chain pass
+            feedbackL_[subBlockPos_] = delayedL;
+            feedbackR_[subBlockPos_] = delayedR;
 
-            // Apply soft clipping as safety net (catches transients during attack time)
-            for (std::size_t i = 0; i < numSamples; ++i) {
-                feedbackL_[i] = std::tanh(feedbackL_[i]);
-                feedbackR_[i] = std::tanh(feedbackR_[i]);
+            if (++subBlockPos_ == kSubBlockSize) {
+                subBlockPos_ = 0;
+                processFeedbackChain();
             }
         }
-
-        // Copy processed feedback to output
-        for (std::size_t i = 0; i < numSamples; ++i) {
-            left[i] = feedbackL_[i];
-            right[i] = feedbackR_[i];
-        }
-
-        // Store last PROCESSED feedback value for next block's feedback signal
-        lastProcessedFeedbackL_ = feedbackL_[numSamples - 1];
-        lastProcessedFeedbackR_ = feedbackR_[numSamples - 1];
     }
 
     // -------------------------------------------------------------------------
@@ -293,7 +245,7 @@ public:
 
         // Prepare new processor if we have a valid sample rate
         if (processor_ && sampleRate_ > 0) {
-            processor_->prepare(sampleRate_, maxBlockSize_);
+            processor_->prepare(sampleRate_, std::max(maxBlockSize_, kSubBlockSize));
         }
     }
 
@@ -390,8 +342,8 @@ public:
         delayTimeSmoother_.snapTo(msToSamples(delayTimeMs_));
 
         // Also snap CrossfadingDelayLines to avoid crossfade transient on init
-        delayL_.snapToDelayMs(delayTimeMs_);
-        delayR_.snapToDelayMs(delayTimeMs_);
+        delayL_.snapToDelayMs(chainCompensatedDelayMs(delayTimeMs_));
+        delayR_.snapToDelayMs(chainCompensatedDelayMs(delayTimeMs_));
     }
 
 private:
@@ -430,7 +382,9 @@ private:
     DynamicsProcessor limiterL_;
     DynamicsProcessor limiterR_;
 
-    // Pre-allocated buffers (resized in prepare() to maxBlockSize)
+    // Pre-allocated sub-block buffers (kSubBlockSize, sized in prepare())
+    // feedbackL_/R_ double as the processed-feedback ring: each slot is read
+    // (processed, one sub-block old) and then overwritten (raw) per sample
     std::vector<float> feedbackL_;
     std::vector<float> feedbackR_;
     std::vector<float> processedL_;
@@ -438,14 +392,79 @@ private:
     std::vector<float> oldProcessedL_;
     std::vector<float> oldProcessedR_;
 
-    // Last processed feedback (for block-based processor feedback path)
-    float lastProcessedFeedbackL_ = 0.0f;
-    float lastProcessedFeedbackR_ = 0.0f;
+    // Sub-block ring position (0..kSubBlockSize-1)
+    std::size_t subBlockPos_ = 0;
 
     // Helper methods
     float msToSamples(float ms) const noexcept {
         return static_cast<float>(ms * sampleRate_ / 1000.0);
     }
+
+    /// @brief Delay line read time that yields a loop period of delayMs
+    float chainCompensatedDelayMs(float delayMs) const noexcept {
+        const float chainMs = static_cast<float>(
+            static_cast<double>(kSubBlockSize) * 1000.0 / sampleRate_);
+        return std::max(0.0f, delayMs - chainMs);
+    }
+
+    /// @brief Run processor, filter and limiter on one full sub-block in place
+    void processFeedbackChain() noexcept {
+        constexpr std::size_t n = kSubBlockSize;
+
+        // Apply injected processor to feedback signal (if present)
+        if (processor_) {
+            std::copy_n(feedbackL_.begin(), n, processedL_.begin());
+            std::copy_n(feedbackR_.begin(), n, processedR_.begin());
+
+            processor_->process(processedL_.data(), processedR_.data(), n);
+
+            // Handle crossfade if hot-swapping
+            if (oldProcessor_ && crossfadePosition_ < crossfadeSamples_) {
+                std::copy_n(feedbackL_.begin(), n, oldProcessedL_.begin());
+                std::copy_n(feedbackR_.begin(), n, oldProcessedR_.begin());
+
+                oldProcessor_->process(oldProcessedL_.data(), oldProcessedR_.data(), n);
+
+                for (std::size_t i = 0; i < n; ++i) {
+                    const float fadePos = (crossfadePosition_ + static_cast<float>(i)) / crossfadeSamples_;
+                    const float newGain = std::min(1.0f, fadePos);
+                    const float oldGain = 1.0f - newGain;
+                    processedL_[i] = processedL_[i] * newGain + oldProcessedL_[i] * oldGain;
+                    processedR_[i] = processedR_[i] * newGain + oldProcessedR_[i] * oldGain;
+                }
+
+                crossfadePosition_ += static_cast<float>(n);
+                if (crossfadePosition_ >= crossfadeSamples_) {
+                    oldProcessor_ = nullptr;
+                }
+            }
+
+            // Mix processed with dry feedback based on processor mix (smoothed per-sample)
+            for (std::size_t i = 0; i < n; ++i) {
+                const float mix = processorMixSmoother_.process();
+                feedbackL_[i] = feedbackL_[i] * (1.0f - mix) + processedL_[i] * mix;
+                feedbackR_[i] = feedbackR_[i] * (1.0f - mix) + processedR_[i] * mix;
+            }
+        }
+
+        // Apply filter to feedback if enabled
+        if (filterEnabled_) {
+            filterL_.process(feedbackL_.data(), n);
+            filterR_.process(feedbackR_.data(), n);
+        }
+
+        // Apply limiting if feedback > 100%
+        if (feedbackAmount_ > 1.0f) {
+            limiterL_.process(feedbackL_.data(), n);
+            limiterR_.process(feedbackR_.data(), n);
+
+            // Apply soft clipping as safety net (catches transients during attack time)
+            for (std::size_t i = 0; i < n; ++i) {
+                feedbackL_[i] = std::tanh(feedbackL_[i]);
+                feedbackR_[i] = std::tanh(feedbackR_[i]);
+            }
+        }
+    }
 };
 
 } // namespace Krate::DSP
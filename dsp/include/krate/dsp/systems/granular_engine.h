@@ -4,6 +4,12 @@
 // Core granular synthesis engine combining pool, scheduler, and processing.
 // Part of Granular Delay feature (spec 034)
 //
+// Audio is rendered in chunks of up to kMaxBlockSize samples: the delay
+// buffers are written for the whole chunk first, then each active grain is
+// rendered through the chunk in one tight loop (GrainProcessor::renderGrain)
+// instead of every grain being visited once per sample. Output is identical
+// for any host block size.
+//
 // Constitution Compliance:
 // - Principle II: Real-Time Safety (noexcept, no allocations in process)
 // - Principle III: Modern C++ (C++20, RAII)
@@ -15,12 +21,15 @@
 #include <krate/dsp/core/grain_envelope.h>
 #include <krate/dsp/core/random.h>
 #include <krate/dsp/primitives/delay_line.h>
-#include <krate/dsp/primitives/grain_pool.h>
+#include <krate/dsp/primitives/grain_bank.h>
 #include <krate/dsp/primitives/smoother.h>
 #include <krate/dsp/processors/grain_processor.h>
 #include <krate/dsp/processors/grain_scheduler.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 
 namespace Krate::DSP {
 
@@ -32,6 +41,7 @@ public:
     static constexpr float kDefaultMaxDelaySeconds = 2.0f;
     static constexpr float kDefaultSmoothTimeMs = 20.0f;
     static constexpr float kFreezeCrossfadeMs = 50.0f;
+    static constexpr size_t kMaxBlockSize = 32;  ///< Internal render chunk
 
     /// Prepare engine for processing
     /// @param sampleRate Current sample rate
@@ -39,12 +49,17 @@ public:
     void prepare(double sampleRate, float maxDelaySeconds = kDefaultMaxDelaySeconds) noexcept {
         sampleRate_ = sampleRate;
 
-        // Prepare delay buffers
-        delayL_.prepare(sampleRate, maxDelaySeconds);
-        delayR_.prepare(sampleRate, maxDelaySeconds);
+        // Prepare delay buffers. Grains read relative to the write head as it
+        // was at their own sample, up to kMaxBlockSize writes back, so keep
+        // that much history beyond the longest readable delay.
+        maxReadDelay_ = static_cast<float>(
+            static_cast<size_t>(sampleRate * static_cast<double>(maxDelaySeconds)));
+        const float headroomSeconds =
+            static_cast<float>(static_cast<double>(kMaxBlockSize + 1) / sampleRate);
+        delayL_.prepare(sampleRate, maxDelaySeconds + headroomSeconds);
+        delayR_.prepare(sampleRate, maxDelaySeconds + headroomSeconds);
 
         // Prepare grain components
-        pool_.prepare(sampleRate);
         scheduler_.prepare(sampleRate);
         processor_.prepare(sampleRate);
 
@@ -67,7 +82,7 @@ public:
     void reset() noexcept {
         delayL_.reset();
         delayR_.reset();
-        pool_.reset();
+        bank_.reset();
         scheduler_.reset();
         processor_.reset();
 
@@ -175,73 +190,38 @@ public:
 
     // === Processing ===
 
-    /// Process stereo audio (most common case)
+    /// Process one stereo sample
     /// @param inputL Left input sample
     /// @param inputR Right input sample
     /// @param outputL Reference to left output sample
     /// @param outputR Reference to right output sample
     void process(float inputL, float inputR,
                  float& outputL, float& outputR) noexcept {
-        // Get smoothed parameters
-        const float smoothedGrainSize = grainSizeSmoother_.process();
-        const float smoothedPitch = pitchSmoother_.process();
-        const float smoothedPosition = positionSmoother_.process();
-        const float freezeAmount = freezeCrossfade_.process();
-
-        // Write to delay buffers (unless fully frozen)
-        if (freezeAmount < 1.0f) {
-            // Crossfade: blend new input with existing buffer during transition
-            const float writeAmount = 1.0f - freezeAmount;
-            delayL_.write(inputL * writeAmount);
-            delayR_.write(inputR * writeAmount);
-        } else if (!frozen_) {
-            // Not frozen, write normally
-            delayL_.write(inputL);
-            delayR_.write(inputR);
-        }
-
-        // Check if we should trigger a new grain
-        if (scheduler_.process()) {
-            triggerNewGrain(smoothedGrainSize, smoothedPitch, smoothedPosition);
-        }
+        processChunk(&inputL, &inputR, &outputL, &outputR, 1);
+    }
 
-        // Process all active grains
-        float sumL = 0.0f;
-        float sumR = 0.0f;
-        size_t activeCount = 0;
-
-        for (Grain* grain : pool_.activeGrains()) {
-            if (grain->active) {
-                auto [grainL, grainR] = processor_.processGrain(*grain, delayL_, delayR_);
-                sumL += grainL;
-                sumR += grainR;
-                ++activeCount;
-
-                // Check if grain completed
-                if (processor_.isGrainComplete(*grain)) {
-                    pool_.releaseGrain(grain);
-                }
-            }
+    /// Process a block of stereo audio
+    /// Equivalent to calling the per-sample overload numSamples times.
+    /// Outputs may alias the inputs.
+    /// @param inputL Left input buffer
+    /// @param inputR Right input buffer
+    /// @param outputL Left output buffer
+    /// @param outputR Right output buffer
+    /// @param numSamples Number of samples to process
+    void process(const float* inputL, const float* inputR,
+                 float* outputL, float* outputR, size_t numSamples) noexcept {
+        size_t offset = 0;
+        while (offset < numSamples) {
+            const size_t chunk = std::min(kMaxBlockSize, numSamples - offset);
+            processChunk(inputL + offset, inputR + offset,
+                         outputL + offset, outputR + offset, chunk);
+            offset += chunk;
         }
-
-        // Apply 1/sqrt(n) gain scaling to prevent output explosion from overlapping grains
-        // This keeps output level roughly constant regardless of how many grains overlap
-        // Smooth the gain factor to avoid clicks when grain count changes
-        const float targetGain = (activeCount > 0)
-            ? 1.0f / std::sqrt(static_cast<float>(activeCount))
-            : 1.0f;
-        gainScaleSmoother_.setTarget(targetGain);
-        const float smoothedGain = gainScaleSmoother_.process();
-
-        outputL = sumL * smoothedGain;
-        outputR = sumR * smoothedGain;
-
-        ++currentSample_;
     }
 
     /// Get current active grain count
     [[nodiscard]] size_t activeGrainCount() const noexcept {
-        return pool_.activeCount();
+        return bank_.activeCount();
     }
 
     /// Seed RNG for reproducible behavior (testing)
@@ -251,13 +231,99 @@ public:
     }
 
 private:
-    void triggerNewGrain(float grainSizeMs, float pitchSemitones,
-                         float positionMs) noexcept {
-        Grain* grain = pool_.acquireGrain(currentSample_);
-        if (grain == nullptr) {
-            return;  // No grain available (shouldn't happen with stealing)
+    /// Process up to kMaxBlockSize samples
+    void processChunk(const float* inputL, const float* inputR,
+                      float* outputL, float* outputR, size_t numSamples) noexcept {
+        const size_t triggerCount = scheduler_.processBlock(numSamples, triggerOffsets_.data());
+
+        // Per-sample control pass: smoothers, delay writes, trigger parameters.
+        // Writes always form a prefix of the chunk - once the freeze crossfade
+        // reaches 1 while frozen it stays there until the next setFreeze().
+        size_t writtenSamples = 0;
+        size_t nextTrigger = 0;
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float smoothedGrainSize = grainSizeSmoother_.process();
+            const float smoothedPitch = pitchSmoother_.process();
+            const float smoothedPosition = positionSmoother_.process();
+            const float freezeAmount = freezeCrossfade_.process();
+
+            // Write to delay buffers (unless fully frozen)
+            if (freezeAmount < 1.0f) {
+                // Crossfade: blend new input with existing buffer during transition
+                const float writeAmount = 1.0f - freezeAmount;
+                delayL_.write(inputL[i] * writeAmount);
+                delayR_.write(inputR[i] * writeAmount);
+                ++writtenSamples;
+            } else if (!frozen_) {
+                // Not frozen, write normally
+                delayL_.write(inputL[i]);
+                delayR_.write(inputR[i]);
+                ++writtenSamples;
+            }
+
+            if (nextTrigger < triggerCount && triggerOffsets_[nextTrigger] == i) {
+                triggerGrainSize_[nextTrigger] = smoothedGrainSize;
+                triggerPitch_[nextTrigger] = smoothedPitch;
+                triggerPosition_[nextTrigger] = smoothedPosition;
+                ++nextTrigger;
+            }
         }
 
+        std::fill_n(accL_.begin(), numSamples, 0.0f);
+        std::fill_n(accR_.begin(), numSamples, 0.0f);
+        std::fill_n(activeCounts_.begin(), numSamples, size_t{0});
+
+        // Render the grains segment by segment; a new grain joins (or steals
+        // a voice) at the sample it was triggered on
+        size_t segmentStart = 0;
+        for (size_t t = 0; t < triggerCount; ++t) {
+            const size_t offset = triggerOffsets_[t];
+            renderGrains(segmentStart, offset, writtenSamples);
+            triggerNewGrain(triggerGrainSize_[t], triggerPitch_[t], triggerPosition_[t], offset);
+            segmentStart = offset;
+        }
+        renderGrains(segmentStart, numSamples, writtenSamples);
+
+        for (size_t i = 0; i < numSamples; ++i) {
+            // Apply 1/sqrt(n) gain scaling to prevent output explosion from overlapping grains
+            // This keeps output level roughly constant regardless of how many grains overlap
+            // Smooth the gain factor to avoid clicks when grain count changes
+            const size_t activeCount = activeCounts_[i];
+            const float targetGain = (activeCount > 0)
+                ? 1.0f / std::sqrt(static_cast<float>(activeCount))
+                : 1.0f;
+            gainScaleSmoother_.setTarget(targetGain);
+            const float smoothedGain = gainScaleSmoother_.process();
+
+            outputL[i] = accL_[i] * smoothedGain;
+            outputR[i] = accR_[i] * smoothedGain;
+        }
+
+        currentSample_ += numSamples;
+    }
+
+    /// Render every active grain over [begin, end) of the current chunk,
+    /// releasing grains that complete
+    void renderGrains(size_t begin, size_t end, size_t writtenSamples) noexcept {
+        if (begin >= end) {
+            return;
+        }
+
+        bank_.retainIf([&](size_t slot) {
+            const size_t stop = processor_.renderGrain(
+                bank_, slot, delayL_, delayR_, maxReadDelay_,
+                accL_.data(), accR_.data(), begin, end, writtenSamples);
+            for (size_t i = begin; i < stop; ++i) {
+                ++activeCounts_[i];
+            }
+            return !GrainProcessor::isGrainComplete(bank_, slot);
+        });
+    }
+
+    void triggerNewGrain(float grainSizeMs, float pitchSemitones,
+                         float positionMs, size_t offset) noexcept {
+        const size_t slot = bank_.acquire(currentSample_ + offset);
+
         // Apply randomization (spray)
         float effectivePitch = pitchSemitones;
         if (pitchSpray_ > 0.0f) {
@@ -295,21 +361,23 @@ private:
             .envelopeType = envelopeType_
         };
 
-        processor_.initializeGrain(*grain, params);
+        processor_.initializeGrain(bank_, slot, params);
 
         // Apply texture-based amplitude variation (Phase 2.3)
         // At texture=0: amplitude is always 1.0 (uniform)
         // At texture=1: amplitude ranges from 0.2 to 1.0 (maximum variation)
         if (texture_ > 0.0f) {
             const float minAmplitude = 1.0f - texture_ * 0.8f;  // Range: 1.0 to 0.2
-            grain->amplitude = minAmplitude + rng_.nextUnipolar() * (1.0f - minAmplitude);
+            const float amplitude = minAmplitude + rng_.nextUnipolar() * (1.0f - minAmplitude);
+            bank_.gainL[slot] *= amplitude;
+            bank_.gainR[slot] *= amplitude;
         }
     }
 
     // Components
     DelayLine delayL_;
     DelayLine delayR_;
-    GrainPool pool_;
+    GrainBank bank_;
     GrainScheduler scheduler_;
     GrainProcessor processor_;
     Xorshift32 rng_{54321};
@@ -339,6 +407,16 @@ private:
     PitchQuantMode pitchQuantMode_ = PitchQuantMode::Off;  // Phase 2.2
     float texture_ = 0.0f;  // Phase 2.3: grain amplitude variation
 
+    // Chunk scratch (sized for kMaxBlockSize, no allocation)
+    std::array<float, kMaxBlockSize> accL_{};
+    std::array<float, kMaxBlockSize> accR_{};
+    std::array<size_t, kMaxBlockSize> activeCounts_{};
+    std::array<size_t, kMaxBlockSize> triggerOffsets_{};
+    std::array<float, kMaxBlockSize> triggerGrainSize_{};
+    std::array<float, kMaxBlockSize> triggerPitch_{};
+    std::array<float, kMaxBlockSize> triggerPosition_{};
+
+    float maxReadDelay_ = 0.0f;
     size_t currentSample_ = 0;
     double sampleRate_ = 44100.0;
 };
@@ -3,6 +3,8 @@
 // ==============================================================================
 // Routes modulation sources (LFO, EnvelopeFollower) to parameter destinations
 // with per-route depth control, bipolar/unipolar modes, and smooth transitions.
+// Each block, routed sources render into block buffers and are summed into
+// per-destination modulation buffers.
 //
 // Constitution Compliance:
 // - Principle II: Real-Time Safety (noexcept, no allocations in process)
@@ -20,8 +22,10 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cmath>
 #include <cstring>
 #include <utility>
+#include <vector>
 
 // Layer 0 dependencies
 #include <krate/dsp/core/db_utils.h>
@@ -77,6 +81,19 @@ public:
     /// @brief Get the output range of this source
     /// @return Pair of (minValue, maxValue)
     [[nodiscard]] virtual std::pair<float, float> getSourceRange() const noexcept = 0;
+
+    /// @brief Render this block's output values
+    ///
+    /// Called by ModulationMatrix::process() once per block for every source
+    /// with an active route. The default holds getCurrentValue() for the
+    /// whole block, which suits sources advanced by their owner. Audio-rate
+    /// sources override this and advance themselves here.
+    ///
+    /// @param output Destination for numSamples values
+    /// @param numSamples Number of samples in the block
+    virtual void processBlock(float* output, size_t numSamples) noexcept {
+        std::fill_n(output, numSamples, getCurrentValue());
+    }
 };
 
 // =============================================================================
@@ -106,8 +123,8 @@ struct ModulationRoute {
     bool inUse = false;                            ///< Whether this slot is in use
 
     // Internal state
-    OnePoleSmoother depthSmoother;                 ///< Smooth depth transitions
-    float currentModulation = 0.0f;                ///< Computed during process()
+    float smoothedDepth = 0.0f;                    ///< Depth smoother state (target: depth)
+    float currentModulation = 0.0f;                ///< Last sample of the previous block
 };
 
 // =============================================================================
@@ -126,6 +143,14 @@ struct ModulationRoute {
 /// - Smooth depth changes to prevent zipper noise (FR-011)
 /// - Real-time safe: noexcept, no allocations in process (FR-014)
 ///
+/// @par Block Processing
+/// process() renders each routed source once into a block buffer, advances
+/// every route's depth smoother to its end-of-block value in closed form and
+/// ramps linearly towards it, and sums the routes into per-destination
+/// buffers. Only destinations with an active route are rendered.
+/// getModulationBuffer() exposes the per-sample offsets; getModulatedValue()
+/// and getCurrentModulation() report the last sample of the block.
+///
 /// @par Usage
 /// @code
 /// ModulationMatrix matrix;
@@ -141,6 +166,9 @@ struct ModulationRoute {
 /// // In process callback
 /// matrix.process(numSamples);
 /// float delayTime = matrix.getModulatedValue(0, baseDelayTime);
+///
+/// // Or per sample
+/// matrix.getModulatedValues(0, baseDelayTime, delayTimes, numSamples);
 /// @endcode
 class ModulationMatrix {
 public:
@@ -151,21 +179,21 @@ public:
     /// @brief Default constructor
     ModulationMatrix() noexcept = default;
 
-    /// @brief Prepare matrix for processing
+    /// @brief Prepare matrix for processing (allocates block buffers)
     /// @param sampleRate Audio sample rate in Hz
     /// @param maxBlockSize Maximum samples per process() call
     /// @param maxRoutes Maximum number of routes (default: 32)
     void prepare(double sampleRate, size_t maxBlockSize,
                  size_t maxRoutes = kMaxModulationRoutes) noexcept {
         sampleRate_ = sampleRate;
-        maxBlockSize_ = maxBlockSize;
+        maxBlockSize_ = std::max<size_t>(maxBlockSize, 1);
         maxRoutes_ = std::min(maxRoutes, kMaxModulationRoutes);
 
-        // Configure all route smoothers
-        for (auto& route : routes_) {
-            route.depthSmoother.configure(kModulationSmoothingTimeMs,
-                                          static_cast<float>(sampleRate));
-        }
+        depthCoeff_ = calculateOnePolCoefficient(kModulationSmoothingTimeMs,
+                                                 static_cast<float>(sampleRate));
+
+        sourceBuffers_.assign(kMaxModulationSources * maxBlockSize_, 0.0f);
+        destinationBuffers_.assign(kMaxModulationDestinations * maxBlockSize_, 0.0f);
 
         reset();
     }
@@ -174,10 +202,11 @@ public:
     void reset() noexcept {
         // Clear modulation sums
         modulationSums_.fill(0.0f);
+        destinationActive_.fill(false);
 
-        // Reset route smoothers
+        // Snap depth smoothers to their targets
         for (auto& route : routes_) {
-            route.depthSmoother.snapTo(route.depth);
+            route.smoothedDepth = route.depth;
             route.currentModulation = 0.0f;
         }
     }
@@ -282,10 +311,7 @@ public:
                 routes_[i].currentModulation = 0.0f;
 
                 // Initialize smoother to current depth
-                routes_[i].depthSmoother.configure(
-                    kModulationSmoothingTimeMs,
-                    static_cast<float>(sampleRate_));
-                routes_[i].depthSmoother.snapTo(depth);
+                routes_[i].smoothedDepth = depth;
 
                 ++numRoutes_;
                 return static_cast<int>(i);
@@ -311,7 +337,6 @@ public:
         depth = std::clamp(depth, 0.0f, 1.0f);
 
         routes_[routeIndex].depth = depth;
-        routes_[routeIndex].depthSmoother.setTarget(depth);
     }
 
     /// @brief Set route enabled state
@@ -341,7 +366,7 @@ public:
             return 0.0f;
         }
 
-        return routes_[routeIndex].depthSmoother.getCurrentValue();
+        return routes_[routeIndex].smoothedDepth;
     }
 
     /// @brief Check if route is enabled
@@ -365,67 +390,15 @@ public:
 
     /// @brief Process all routes for a block
     /// @param numSamples Number of samples in current block
+    /// @note Calls larger than maxBlockSize are processed in chunks; the
+    ///       modulation buffers then hold the final chunk.
     void process(size_t numSamples) noexcept {
-        // Clear modulation sums
-        modulationSums_.fill(0.0f);
-
-        // Process each active route
-        for (size_t i = 0; i < maxRoutes_; ++i) {
-            auto& route = routes_[i];
-
-            if (!route.inUse || !route.enabled) {
-                route.currentModulation = 0.0f;
-                continue;
-            }
-
-            // Advance depth smoother
-            // Process numSamples steps but just use the final value
-            float smoothedDepth = 0.0f;
-            for (size_t s = 0; s < numSamples; ++s) {
-                smoothedDepth = route.depthSmoother.process();
-            }
-
-            // Get source value
-            ModulationSource* source = sources_[route.sourceId];
-            if (source == nullptr) {
-                route.currentModulation = 0.0f;
-                continue;
-            }
-
-            float sourceValue = source->getCurrentValue();
-
-            // Handle NaN (FR-018)
-            if (detail::isNaN(sourceValue)) {
-                sourceValue = 0.0f;
-            }
-
-            // Apply mode conversion
-            float mappedValue = sourceValue;
-            if (route.mode == ModulationMode::Unipolar) {
-                // Convert [-1, +1] to [0, 1]
-                mappedValue = (sourceValue + 1.0f) * 0.5f;
-            }
-
-            // Get destination range
-            const auto& dest = destinations_[route.destinationId];
-            float range = dest.maxValue - dest.minValue;
-            float halfRange = range * 0.5f;
-
-            // Calculate modulation amount
-            // For bipolar: sourceValue * depth * halfRange
-            // For unipolar: mappedValue * depth * halfRange (but shifted)
-            float modulation;
-            if (route.mode == ModulationMode::Bipolar) {
-                modulation = mappedValue * smoothedDepth * halfRange;
-            } else {
-                // Unipolar: full range modulation but only positive
-                modulation = mappedValue * smoothedDepth * halfRange;
-            }
-
-            route.currentModulation = modulation;
+        if (sourceBuffers_.empty()) {
+            return;  // Not prepared
+        }
 
-            // Accumulate to destination
-            modulationSums_[route.destinationId] += modulation;
+        for (size_t offset = 0; offset < numSamples; offset += maxBlockSize_) {
+            processChunk(std::min(maxBlockSize_, numSamples - offset));
         }
     }
 
@@ -462,6 +435,41 @@ public:
         return modulationSums_[destinationId];
     }
 
+    /// @brief Get the per-sample modulation offsets of the last block
+    /// @param destinationId Destination identifier
+    /// @return Sum of all route contributions for each sample of the last
+    ///         process() block, or nullptr if no active route targets the
+    ///         destination (its offset is zero)
+    [[nodiscard]] const float* getModulationBuffer(uint8_t destinationId) const noexcept {
+        if (destinationId >= kMaxModulationDestinations ||
+            !destinationActive_[destinationId]) {
+            return nullptr;
+        }
+
+        return destinationBuffer(destinationId);
+    }
+
+    /// @brief Get per-sample modulated parameter values for the last block
+    /// @param destinationId Destination identifier
+    /// @param baseValue Base parameter value (before modulation)
+    /// @param output Destination for numSamples values, clamped to the
+    ///        destination range
+    /// @param numSamples Samples to write (at most the last block's length)
+    void getModulatedValues(uint8_t destinationId, float baseValue,
+                            float* output, size_t numSamples) const noexcept {
+        const float* modulation = getModulationBuffer(destinationId);
+        if (modulation == nullptr) {
+            std::fill_n(output, numSamples, getModulatedValue(destinationId, baseValue));
+            return;
+        }
+
+        const auto& dest = destinations_[destinationId];
+        numSamples = std::min(numSamples, lastBlockSize_);
+        for (size_t i = 0; i < numSamples; ++i) {
+            output[i] = std::clamp(baseValue + modulation[i], dest.minValue, dest.maxValue);
+        }
+    }
+
     // =========================================================================
     // Query Methods
     // =========================================================================
@@ -487,10 +495,103 @@ public:
     }
 
 private:
+    [[nodiscard]] float* sourceBuffer(size_t sourceId) noexcept {
+        return sourceBuffers_.data() + sourceId * maxBlockSize_;
+    }
+
+    [[nodiscard]] float* destinationBuffer(size_t destinationId) noexcept {
+        return destinationBuffers_.data() + destinationId * maxBlockSize_;
+    }
+
+    [[nodiscard]] const float* destinationBuffer(size_t destinationId) const noexcept {
+        return destinationBuffers_.data() + destinationId * maxBlockSize_;
+    }
+
+    /// @brief Render sources and routes for numSamples <= maxBlockSize_
+    void processChunk(size_t numSamples) noexcept {
+        lastBlockSize_ = numSamples;
+        modulationSums_.fill(0.0f);
+        destinationActive_.fill(false);
+
+        // Render each routed source once, whatever its number of routes
+        std::array<bool, kMaxModulationSources> sourceRendered{};
+        for (size_t r = 0; r < maxRoutes_; ++r) {
+            const auto& route = routes_[r];
+            if (!route.inUse || !route.enabled) {
+                continue;
+            }
+
+            ModulationSource* source = sources_[route.sourceId];
+            if (source != nullptr && !sourceRendered[route.sourceId]) {
+                float* buffer = sourceBuffer(route.sourceId);
+                source->processBlock(buffer, numSamples);
+
+                // Handle NaN (FR-018)
+                for (size_t i = 0; i < numSamples; ++i) {
+                    buffer[i] = detail::isNaN(buffer[i]) ? 0.0f : buffer[i];
+                }
+                sourceRendered[route.sourceId] = true;
+            }
+
+            if (!destinationActive_[route.destinationId]) {
+                std::fill_n(destinationBuffer(route.destinationId), numSamples, 0.0f);
+                destinationActive_[route.destinationId] = true;
+            }
+        }
+
+        // Closed-form depth smoothing: coefficient^numSamples
+        const float decay = std::pow(depthCoeff_, static_cast<float>(numSamples));
+        const float invNumSamples = 1.0f / static_cast<float>(numSamples);
+
+        for (size_t r = 0; r < maxRoutes_; ++r) {
+            auto& route = routes_[r];
+
+            if (!route.inUse || !route.enabled || sources_[route.sourceId] == nullptr) {
+                route.currentModulation = 0.0f;
+                continue;
+            }
+
+            // Depth: ramp linearly to the one-pole smoother's end-of-block value
+            const float depthStart = route.smoothedDepth;
+            float depthEnd = route.depth + decay * (depthStart - route.depth);
+            if (std::abs(depthEnd - route.depth) < kCompletionThreshold) {
+                depthEnd = route.depth;
+            }
+            route.smoothedDepth = depthEnd;
+            const float depthStep = (depthEnd - depthStart) * invNumSamples;
+
+            // Mode mapping as scale/offset: Unipolar maps [-1, +1] to [0, 1]
+            const auto& dest = destinations_[route.destinationId];
+            const float halfRange = (dest.maxValue - dest.minValue) * 0.5f;
+            const bool unipolar = (route.mode == ModulationMode::Unipolar);
+            const float mapScale = unipolar ? 0.5f : 1.0f;
+            const float mapOffset = unipolar ? 0.5f : 0.0f;
+
+            const float* source = sourceBuffer(route.sourceId);
+            float* out = destinationBuffer(route.destinationId);
+            float modulation = 0.0f;
+            for (size_t i = 0; i < numSamples; ++i) {
+                const float depth = depthStart + depthStep * static_cast<float>(i + 1);
+                modulation = (source[i] * mapScale + mapOffset) * depth * halfRange;
+                out[i] += modulation;
+            }
+
+            route.currentModulation = modulation;
+        }
+
+        for (size_t d = 0; d < kMaxModulationDestinations; ++d) {
+            if (destinationActive_[d]) {
+                modulationSums_[d] = destinationBuffer(d)[numSamples - 1];
+            }
+        }
+    }
+
     // Sample rate for smoothing calculations
     double sampleRate_ = 44100.0;
     size_t maxBlockSize_ = 512;
     size_t maxRoutes_ = kMaxModulationRoutes;
+    float depthCoeff_ = 0.0f;       // One-pole depth smoothing coefficient
+    size_t lastBlockSize_ = 0;
 
     // Source pointers (not owned)
     std::array<ModulationSource*, kMaxModulationSources> sources_ = {};
@@ -501,11 +602,16 @@ private:
     size_t numDestinations_ = 0;
 
     // Routes
-    mutable std::array<ModulationRoute, kMaxModulationRoutes> routes_ = {};
+    std::array<ModulationRoute, kMaxModulationRoutes> routes_ = {};
     size_t numRoutes_ = 0;
 
-    // Per-destination modulation sums (computed during process)
+    // Per-destination modulation sums (last sample of the block)
     std::array<float, kMaxModulationDestinations> modulationSums_ = {};
+
+    // Block buffers (maxBlockSize_ samples per source / destination)
+    std::vector<float> sourceBuffers_;
+    std::vector<float> destinationBuffers_;
+    std::array<bool, kMaxModulationDestinations> destinationActive_ = {};
 };
 
 }  // namespace DSP
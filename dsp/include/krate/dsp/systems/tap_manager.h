@@ -9,6 +9,8 @@
 // - Preset patterns: Quarter, Dotted Eighth, Triplet, Golden Ratio, Fibonacci
 // - Tempo sync support via NoteValue
 // - Click-free parameter changes (20ms smoothing)
+// - Structure-of-arrays tap state; only audible taps are rendered, as a
+//   compacted lane list rebuilt every kTapControlBlockSize samples
 //
 // Feature: 023-tap-manager
 // Layer: 3 (System Component)
@@ -114,14 +116,17 @@ static constexpr float kDottedEighthMultiplier = 0.75f;
 /// @brief Triplet multiplier (~0.667 × quarter)
 static constexpr float kTripletMultiplier = 2.0f / 3.0f;
 
+/// @brief Control-rate interval in samples (pan law, filter coefficients, lane list)
+static constexpr size_t kTapControlBlockSize = 32;
+
 // =============================================================================
 // Tap Structure (Internal)
 // =============================================================================
 
-/// @brief Internal representation of a single delay tap
-/// @note This is an implementation detail, not part of public API
+/// @brief Configuration of a single delay tap
+/// @note This is an implementation detail, not part of public API. The
+///       smoothing and filter state lives in TapManager's per-tap arrays.
 struct Tap {
-    // Configuration
     bool enabled = false;
     TapTimeMode timeMode = TapTimeMode::FreeRunning;
     float timeMs = 0.0f;
@@ -132,21 +137,6 @@ struct Tap {
     float filterCutoff = kDefaultFilterCutoff;
     float filterQ = kDefaultFilterQ;
     float feedbackAmount = 0.0f;    // 0 to 100 (%)
-
-    // Smoothers (20ms transition time)
-    OnePoleSmoother delaySmoother{};
-    OnePoleSmoother levelSmoother{};
-    OnePoleSmoother panSmoother{};
-    OnePoleSmoother cutoffSmoother{};
-
-    // Filter (configured via configure() method)
-    Biquad filter{};
-    float cachedSampleRate = 44100.0f;
-
-    // Computed state
-    float currentGain = 0.0f;       // Linear gain from levelDb
-    float currentPanL = 0.707f;     // Left pan coefficient
-    float currentPanR = 0.707f;     // Right pan coefficient
 };
 
 // =============================================================================
@@ -162,6 +152,13 @@ struct Tap {
 /// All processing methods are noexcept and allocation-free after prepare().
 /// Memory is allocated only in prepare().
 ///
+/// @par Processing Model
+/// Delay time and level are smoothed per sample. Every kTapControlBlockSize
+/// samples the taps that are audible (or fading) are packed into contiguous
+/// lanes; silent taps only advance their smoothers in closed form. Pan gains
+/// are evaluated at control rate and ramped linearly in between, and filter
+/// coefficients follow the smoothed cutoff at control rate.
+///
 /// @par Usage
 /// @code
 /// TapManager taps;
@@ -306,12 +303,26 @@ public:
     /// @pre prepare() has been called
     /// @post Output contains mixed dry + wet signal based on dryWetMix
     /// @note In-place processing supported (leftIn == leftOut).
+    ///       Feedback is sample-accurate (taps may be shorter than a block).
     ///       All 16 taps can be active without dropouts (SC-001).
     ///       CPU < 2% for 16 active taps at 44.1kHz stereo (SC-007).
     void process(const float* leftIn, const float* rightIn,
                  float* leftOut, float* rightOut,
                  size_t numSamples) noexcept;
 
+    /// @brief Process stereo audio with a per-sample delay-time scale
+    ///
+    /// Every tap reads at its delay time multiplied by delayScale[i] (e.g. a
+    /// tape motor's speed curve), so modulation is sample-accurate regardless
+    /// of block size. The scaled time replaces the tap's delay-time smoother,
+    /// so the curve should itself be smooth.
+    ///
+    /// @param delayScale Per-sample delay-time factors (numSamples floats, >= 0)
+    /// @note Other parameters and guarantees as process() above.
+    void process(const float* leftIn, const float* rightIn,
+                 float* leftOut, float* rightOut,
+                 const float* delayScale, size_t numSamples) noexcept;
+
     // =========================================================================
     // Queries
     // =========================================================================
@@ -359,12 +370,40 @@ private:
         return quarterNoteMs * getBeatsForNote(note);
     }
 
-    /// @brief Update filter coefficients for a tap
+    /// @brief Update filter coefficients for a tap (at its current smoothed cutoff)
     void updateTapFilter(size_t tapIndex) noexcept;
 
     /// @brief Calculate constant-power pan coefficients
     void calcPanCoefficients(float pan, float& outL, float& outR) const noexcept;
 
+    /// @brief Pack audible taps into lanes and advance control-rate state
+    void beginControlBlock(size_t numSamples) noexcept;
+
+    /// @brief Write lane state back to the per-tap arrays
+    void endControlBlock() noexcept;
+
+    /// @brief Shared process() body; delayScale is only read when Scaled
+    template <bool Scaled>
+    void processTaps(const float* leftIn, const float* rightIn,
+                     float* leftOut, float* rightOut,
+                     const float* delayScale, size_t numSamples) noexcept;
+
+    /// @brief One OnePoleSmoother::process() step on raw state
+    [[nodiscard]] static float smoothStep(float current, float target, float coeff) noexcept {
+        if (std::abs(current - target) < kCompletionThreshold) {
+            return target;
+        }
+        return detail::flushDenormal(target + coeff * (current - target));
+    }
+
+    /// @brief Advance smoother state by numSamples steps in closed form
+    [[nodiscard]] float smoothAdvance(float current, float target, size_t numSamples) const noexcept {
+        if (std::abs(current - target) < kCompletionThreshold) {
+            return target;
+        }
+        return detail::flushDenormal(target + smoothCoeffPow_[numSamples] * (current - target));
+    }
+
     /// @brief Apply soft limiter to prevent feedback runaway (FR-021)
     [[nodiscard]] static float softLimit(float sample) noexcept {
         // Simple tanh-based soft clipper
@@ -402,6 +441,43 @@ private:
     DelayLine delayLine_;           // Shared delay buffer
     OnePoleSmoother masterLevelSmoother_;
     OnePoleSmoother dryWetSmoother_;
+
+    // Per-tap smoothing and filter state (index = tap)
+    float smoothCoeff_ = 0.0f;                                    // 20ms one-pole coefficient
+    std::array<float, kTapControlBlockSize + 1> smoothCoeffPow_{};  // smoothCoeff_^n
+    std::array<float, kMaxTaps> delayCurrent_{};    // samples
+    std::array<float, kMaxTaps> delayTarget_{};
+    std::array<float, kMaxTaps> gainCurrent_{};
+    std::array<float, kMaxTaps> gainTarget_{};
+    std::array<float, kMaxTaps> panCurrent_{};
+    std::array<float, kMaxTaps> panGainL_{};        // Pan law evaluated at panGainFor_
+    std::array<float, kMaxTaps> panGainR_{};
+    std::array<float, kMaxTaps> panGainFor_{};
+    std::array<float, kMaxTaps> cutoffCurrent_{};
+    std::array<BiquadCoefficients, kMaxTaps> filterCoeffs_{};
+    std::array<float, kMaxTaps> filterZ1_{};
+    std::array<float, kMaxTaps> filterZ2_{};
+
+    // Audible taps for the current control block, packed (index = lane)
+    size_t laneCount_ = 0;
+    std::array<size_t, kMaxTaps> laneTap_{};
+    std::array<float, kMaxTaps> laneDelay_{};
+    std::array<float, kMaxTaps> laneDelayTarget_{};
+    std::array<float, kMaxTaps> laneGain_{};
+    std::array<float, kMaxTaps> laneGainTarget_{};
+    std::array<float, kMaxTaps> lanePanL_{};
+    std::array<float, kMaxTaps> lanePanR_{};
+    std::array<float, kMaxTaps> lanePanStepL_{};
+    std::array<float, kMaxTaps> lanePanStepR_{};
+    std::array<float, kMaxTaps> laneFeedback_{};
+    std::array<float, kMaxTaps> laneB0_{};
+    std::array<float, kMaxTaps> laneB1_{};
+    std::array<float, kMaxTaps> laneB2_{};
+    std::array<float, kMaxTaps> laneA1_{};
+    std::array<float, kMaxTaps> laneA2_{};
+    std::array<float, kMaxTaps> laneZ1_{};
+    std::array<float, kMaxTaps> laneZ2_{};
+    std::array<float, kMaxTaps> laneSample_{};
 };
 
 // =============================================================================
@@ -417,33 +493,30 @@ inline void TapManager::prepare(float sampleRate, size_t /*maxBlockSize*/,
     const float maxDelaySeconds = maxDelayMs * 0.001f;
     delayLine_.prepare(static_cast<double>(sampleRate), maxDelaySeconds);
 
+    // Per-tap smoothers share one 20ms coefficient
+    smoothCoeff_ = calculateOnePolCoefficient(kTapSmoothingMs, sampleRate);
+    smoothCoeffPow_[0] = 1.0f;
+    for (size_t n = 1; n < smoothCoeffPow_.size(); ++n) {
+        smoothCoeffPow_[n] = smoothCoeffPow_[n - 1] * smoothCoeff_;
+    }
+
     // Initialize all 16 taps
-    for (auto& tap : taps_) {
-        tap.enabled = false;
-        tap.timeMode = TapTimeMode::FreeRunning;
-        tap.timeMs = 0.0f;
-        tap.noteValue = NoteValue::Quarter;
-        tap.levelDb = 0.0f;
-        tap.pan = 0.0f;
-        tap.filterMode = TapFilterMode::Bypass;
-        tap.filterCutoff = kDefaultFilterCutoff;
-        tap.filterQ = kDefaultFilterQ;
-        tap.feedbackAmount = 0.0f;
-
-        // Initialize smoothers (20ms smoothing time)
-        tap.delaySmoother.configure(kTapSmoothingMs, sampleRate);
-        tap.levelSmoother.configure(kTapSmoothingMs, sampleRate);
-        tap.panSmoother.configure(kTapSmoothingMs, sampleRate);
-        tap.cutoffSmoother.configure(kTapSmoothingMs, sampleRate);
-
-        // Store sample rate for filter configuration
-        tap.cachedSampleRate = sampleRate;
-
-        // Initial computed state
-        tap.currentGain = 0.0f;
-        tap.currentPanL = 0.707f;
-        tap.currentPanR = 0.707f;
+    for (size_t t = 0; t < kMaxTaps; ++t) {
+        taps_[t] = Tap{};
+
+        delayCurrent_[t] = 0.0f;
+        delayTarget_[t] = 0.0f;
+        gainCurrent_[t] = 0.0f;
+        gainTarget_[t] = 0.0f;
+        panCurrent_[t] = 0.0f;
+        calcPanCoefficients(0.0f, panGainL_[t], panGainR_[t]);
+        panGainFor_[t] = 0.0f;
+        cutoffCurrent_[t] = kDefaultFilterCutoff;
+        filterCoeffs_[t] = BiquadCoefficients{};
+        filterZ1_[t] = 0.0f;
+        filterZ2_[t] = 0.0f;
     }
+    laneCount_ = 0;
 
     // Master smoothers
     masterLevelSmoother_.configure(kTapSmoothingMs, sampleRate);
@@ -456,17 +529,19 @@ inline void TapManager::prepare(float sampleRate, size_t /*maxBlockSize*/,
 inline void TapManager::reset() noexcept {
     delayLine_.reset();
 
-    for (auto& tap : taps_) {
-        // Use setTarget + snapToTarget for smoother reset
-        tap.delaySmoother.setTarget(msToSamples(tap.timeMs));
-        tap.delaySmoother.snapToTarget();
-        tap.levelSmoother.setTarget(tap.enabled ? dbToGain(tap.levelDb) : 0.0f);
-        tap.levelSmoother.snapToTarget();
-        tap.panSmoother.setTarget(tap.pan);
-        tap.panSmoother.snapToTarget();
-        tap.cutoffSmoother.setTarget(tap.filterCutoff);
-        tap.cutoffSmoother.snapToTarget();
-        tap.filter.reset();
+    for (size_t t = 0; t < kMaxTaps; ++t) {
+        const auto& tap = taps_[t];
+
+        // Snap all smoothing state to the current targets
+        delayTarget_[t] = msToSamples(tap.timeMs);
+        delayCurrent_[t] = delayTarget_[t];
+        gainTarget_[t] = tap.enabled ? dbToGain(tap.levelDb) : 0.0f;
+        gainCurrent_[t] = gainTarget_[t];
+        panCurrent_[t] = tap.pan;
+        cutoffCurrent_[t] = tap.filterCutoff;
+        updateTapFilter(t);
+        filterZ1_[t] = 0.0f;
+        filterZ2_[t] = 0.0f;
     }
 
     masterLevelSmoother_.setTarget(dbToGain(masterLevelDb_));
@@ -530,15 +605,15 @@ inline void TapManager::setTapFeedback(size_t tapIndex, float amount) noexcept {
 inline void TapManager::updateTapFilter(size_t tapIndex) noexcept {
     if (tapIndex >= kMaxTaps) return;
 
-    auto& tap = taps_[tapIndex];
+    const auto& tap = taps_[tapIndex];
     switch (tap.filterMode) {
         case TapFilterMode::Lowpass:
-            tap.filter.configure(FilterType::Lowpass, tap.filterCutoff, tap.filterQ,
-                                 0.0f, tap.cachedSampleRate);
+            filterCoeffs_[tapIndex] = BiquadCoefficients::calculate(
+                FilterType::Lowpass, cutoffCurrent_[tapIndex], tap.filterQ, 0.0f, sampleRate_);
             break;
         case TapFilterMode::Highpass:
-            tap.filter.configure(FilterType::Highpass, tap.filterCutoff, tap.filterQ,
-                                 0.0f, tap.cachedSampleRate);
+            filterCoeffs_[tapIndex] = BiquadCoefficients::calculate(
+                FilterType::Highpass, cutoffCurrent_[tapIndex], tap.filterQ, 0.0f, sampleRate_);
             break;
         case TapFilterMode::Bypass:
         default:
@@ -676,9 +751,99 @@ inline void TapManager::calcPanCoefficients(float pan, float& outL, float& outR)
     outR = std::sin(theta);
 }
 
+inline void TapManager::beginControlBlock(size_t numSamples) noexcept {
+    const float invNumSamples = 1.0f / static_cast<float>(numSamples);
+    laneCount_ = 0;
+
+    for (size_t t = 0; t < kMaxTaps; ++t) {
+        const auto& tap = taps_[t];
+
+        // Pan and cutoff are control-rate: advance them over the whole block
+        const float panStart = panCurrent_[t];
+        panCurrent_[t] = smoothAdvance(panStart, tap.pan, numSamples);
+
+        if (tap.filterMode != TapFilterMode::Bypass && cutoffCurrent_[t] != tap.filterCutoff) {
+            cutoffCurrent_[t] = smoothAdvance(cutoffCurrent_[t], tap.filterCutoff, numSamples);
+            updateTapFilter(t);
+        }
+
+        // Silent and staying silent: only the delay smoother needs to move
+        if (gainCurrent_[t] == 0.0f && gainTarget_[t] == 0.0f) {
+            delayCurrent_[t] = smoothAdvance(delayCurrent_[t], delayTarget_[t], numSamples);
+            continue;
+        }
+
+        const size_t lane = laneCount_++;
+        laneTap_[lane] = t;
+        laneDelay_[lane] = delayCurrent_[t];
+        laneDelayTarget_[lane] = delayTarget_[t];
+        laneGain_[lane] = gainCurrent_[t];
+        laneGainTarget_[lane] = gainTarget_[t];
+        laneFeedback_[lane] = tap.feedbackAmount * 0.01f;
+
+        // Pan gains ramp linearly from the block start to the block end value
+        if (panGainFor_[t] != panStart) {
+            calcPanCoefficients(panStart, panGainL_[t], panGainR_[t]);
+        }
+        lanePanL_[lane] = panGainL_[t];
+        lanePanR_[lane] = panGainR_[t];
+        if (panCurrent_[t] != panStart) {
+            calcPanCoefficients(panCurrent_[t], panGainL_[t], panGainR_[t]);
+        }
+        panGainFor_[t] = panCurrent_[t];
+        lanePanStepL_[lane] = (panGainL_[t] - lanePanL_[lane]) * invNumSamples;
+        lanePanStepR_[lane] = (panGainR_[t] - lanePanR_[lane]) * invNumSamples;
+
+        // Bypassed taps run an identity section with zero state
+        if (tap.filterMode != TapFilterMode::Bypass) {
+            const auto& c = filterCoeffs_[t];
+            laneB0_[lane] = c.b0;
+            laneB1_[lane] = c.b1;
+            laneB2_[lane] = c.b2;
+            laneA1_[lane] = c.a1;
+            laneA2_[lane] = c.a2;
+            laneZ1_[lane] = filterZ1_[t];
+            laneZ2_[lane] = filterZ2_[t];
+        } else {
+            laneB0_[lane] = 1.0f;
+            laneB1_[lane] = 0.0f;
+            laneB2_[lane] = 0.0f;
+            laneA1_[lane] = 0.0f;
+            laneA2_[lane] = 0.0f;
+            laneZ1_[lane] = 0.0f;
+            laneZ2_[lane] = 0.0f;
+        }
+    }
+}
+
+inline void TapManager::endControlBlock() noexcept {
+    for (size_t lane = 0; lane < laneCount_; ++lane) {
+        const size_t t = laneTap_[lane];
+        delayCurrent_[t] = laneDelay_[lane];
+        gainCurrent_[t] = laneGain_[lane];
+        if (taps_[t].filterMode != TapFilterMode::Bypass) {
+            filterZ1_[t] = laneZ1_[lane];
+            filterZ2_[t] = laneZ2_[lane];
+        }
+    }
+}
+
 inline void TapManager::process(const float* leftIn, const float* rightIn,
                                  float* leftOut, float* rightOut,
                                  size_t numSamples) noexcept {
+    processTaps<false>(leftIn, rightIn, leftOut, rightOut, nullptr, numSamples);
+}
+
+inline void TapManager::process(const float* leftIn, const float* rightIn,
+                                 float* leftOut, float* rightOut,
+                                 const float* delayScale, size_t numSamples) noexcept {
+    processTaps<true>(leftIn, rightIn, leftOut, rightOut, delayScale, numSamples);
+}
+
+template <bool Scaled>
+void TapManager::processTaps(const float* leftIn, const float* rightIn,
+                             float* leftOut, float* rightOut,
+                             const float* delayScale, size_t numSamples) noexcept {
     // Set target for master smoothers
     const float targetMasterGain = (masterLevelDb_ <= kMinLevelDb)
                                     ? 0.0f
@@ -687,105 +852,111 @@ inline void TapManager::process(const float* leftIn, const float* rightIn,
     masterLevelSmoother_.setTarget(targetMasterGain);
     dryWetSmoother_.setTarget(targetWetMix);
 
-    for (size_t i = 0; i < numSamples; ++i) {
-        // Read input (mono sum for delay line)
-        const float inputL = leftIn[i];
-        const float inputR = rightIn[i];
-        const float inputMono = (inputL + inputR) * 0.5f;
+    // Per-tap targets are constant for the whole call
+    for (size_t t = 0; t < kMaxTaps; ++t) {
+        const auto& tap = taps_[t];
 
-        // Accumulate feedback from all taps
-        float feedbackSum = 0.0f;
-
-        // Mix all tap outputs
-        float wetL = 0.0f;
-        float wetR = 0.0f;
+        // Calculate effective delay time (samples)
+        float delayTimeMs = tap.timeMs;
+        if (tap.timeMode == TapTimeMode::TempoSynced) {
+            delayTimeMs = calcTempoSyncMs(tap.noteValue);
+            delayTimeMs = std::min(delayTimeMs, maxDelayMs_);
+        }
+        delayTarget_[t] = msToSamples(delayTimeMs);
 
-        for (size_t t = 0; t < kMaxTaps; ++t) {
-            auto& tap = taps_[t];
+        // Calculate target gain (FR-010: -96dB = silence)
+        gainTarget_[t] = (tap.enabled && tap.levelDb > kMinLevelDb) ? dbToGain(tap.levelDb) : 0.0f;
+    }
 
-            // Calculate effective delay time (samples)
-            float delayTimeMs = tap.timeMs;
-            if (tap.timeMode == TapTimeMode::TempoSynced) {
-                delayTimeMs = calcTempoSyncMs(tap.noteValue);
-                delayTimeMs = std::min(delayTimeMs, maxDelayMs_);
+    for (size_t offset = 0; offset < numSamples; offset += kTapControlBlockSize) {
+        const size_t blockSize = std::min(kTapControlBlockSize, numSamples - offset);
+        beginControlBlock(blockSize);
+        const size_t lanes = laneCount_;
+
+        for (size_t i = offset; i < offset + blockSize; ++i) {
+            // Read input (mono sum for delay line)
+            const float inputL = leftIn[i];
+            const float inputR = rightIn[i];
+            const float inputMono = (inputL + inputR) * 0.5f;
+
+            // Smooth (or scale) delay time and smooth gain (FR-006, FR-011)
+            if constexpr (Scaled) {
+                const float scale = delayScale[i];
+                for (size_t l = 0; l < lanes; ++l) {
+                    laneDelay_[l] = laneDelayTarget_[l] * scale;
+                }
+            } else {
+                for (size_t l = 0; l < lanes; ++l) {
+                    laneDelay_[l] = smoothStep(laneDelay_[l], laneDelayTarget_[l], smoothCoeff_);
+                }
+            }
+            for (size_t l = 0; l < lanes; ++l) {
+                laneGain_[l] = smoothStep(laneGain_[l], laneGainTarget_[l], smoothCoeff_);
             }
-            const float targetDelaySamples = msToSamples(delayTimeMs);
 
-            // Smooth delay time (FR-006)
-            tap.delaySmoother.setTarget(targetDelaySamples);
-            const float delaySamples = tap.delaySmoother.process();
+            // Read from delay line with interpolation (SC-003: within 1 sample accuracy)
+            for (size_t l = 0; l < lanes; ++l) {
+                laneSample_[l] = delayLine_.readLinear(laneDelay_[l]);
+            }
 
-            // Calculate target gain (FR-010: -96dB = silence)
-            float targetGain = 0.0f;
-            if (tap.enabled && tap.levelDb > kMinLevelDb) {
-                targetGain = dbToGain(tap.levelDb);
+            // Apply filter (FR-015 to FR-018), TDF2 per lane
+            for (size_t l = 0; l < lanes; ++l) {
+                const float x = laneSample_[l];
+                const float y = laneB0_[l] * x + laneZ1_[l];
+                laneZ1_[l] = detail::flushDenormal(laneB1_[l] * x - laneA1_[l] * y + laneZ2_[l]);
+                laneZ2_[l] = detail::flushDenormal(laneB2_[l] * x - laneA2_[l] * y);
+                laneSample_[l] = y;
             }
 
-            // Smooth gain (FR-011)
-            tap.levelSmoother.setTarget(targetGain);
-            const float gain = tap.levelSmoother.process();
+            // Gain, pan and mix all tap outputs
+            float wetL = 0.0f;
+            float wetR = 0.0f;
+            float feedbackSum = 0.0f;
+            for (size_t l = 0; l < lanes; ++l) {
+                lanePanL_[l] += lanePanStepL_[l];
+                lanePanR_[l] += lanePanStepR_[l];
 
-            // Skip processing if gain is negligible
-            if (gain < 1e-6f) continue;
+                const float sample = laneSample_[l] * laneGain_[l];
+                wetL += sample * lanePanL_[l];
+                wetR += sample * lanePanR_[l];
 
-            // Read from delay line with interpolation (SC-003: within 1 sample accuracy)
-            float sample = delayLine_.readLinear(delaySamples);
-
-            // Apply filter (FR-015 to FR-018)
-            if (tap.filterMode != TapFilterMode::Bypass) {
-                // Smooth filter cutoff (FR-018)
-                tap.cutoffSmoother.setTarget(tap.filterCutoff);
-                const float smoothedCutoff = tap.cutoffSmoother.process();
-
-                // Only update if cutoff changed significantly (avoid per-sample coeff calc)
-                if (std::abs(smoothedCutoff - tap.cutoffSmoother.getTarget()) > 1.0f) {
-                    if (tap.filterMode == TapFilterMode::Lowpass) {
-                        tap.filter.configure(FilterType::Lowpass, smoothedCutoff, tap.filterQ,
-                                             0.0f, tap.cachedSampleRate);
-                    } else {
-                        tap.filter.configure(FilterType::Highpass, smoothedCutoff, tap.filterQ,
-                                             0.0f, tap.cachedSampleRate);
-                    }
-                }
-                sample = tap.filter.process(sample);
+                // Accumulate feedback (FR-019, FR-020)
+                feedbackSum += sample * laneFeedback_[l];
             }
 
-            // Apply gain
-            sample *= gain;
+            // Limit feedback to prevent runaway (FR-021)
+            if (std::abs(feedbackSum) > 1.0f) {
+                feedbackSum = softLimit(feedbackSum);
+            }
 
-            // Calculate pan coefficients (constant-power)
-            tap.panSmoother.setTarget(tap.pan);
-            const float smoothedPan = tap.panSmoother.process();
-            float panL, panR;
-            calcPanCoefficients(smoothedPan, panL, panR);
+            // Write to delay line (input + feedback)
+            delayLine_.write(inputMono + feedbackSum);
 
-            // Add to stereo output
-            wetL += sample * panL;
-            wetR += sample * panR;
+            // Apply master level and mix
+            const float masterGain = masterLevelSmoother_.process();
+            const float wetMix = dryWetSmoother_.process();
+            const float dryMix = 1.0f - wetMix;
 
-            // Accumulate feedback (FR-019, FR-020)
-            feedbackSum += sample * (tap.feedbackAmount * 0.01f);
-        }
+            wetL *= masterGain;
+            wetR *= masterGain;
 
-        // Limit feedback to prevent runaway (FR-021)
-        if (std::abs(feedbackSum) > 1.0f) {
-            feedbackSum = softLimit(feedbackSum);
+            // Output dry/wet mix
+            leftOut[i] = inputL * dryMix + wetL * wetMix;
+            rightOut[i] = inputR * dryMix + wetR * wetMix;
         }
 
-        // Write to delay line (input + feedback)
-        delayLine_.write(inputMono + feedbackSum);
-
-        // Apply master level and mix
-        const float masterGain = masterLevelSmoother_.process();
-        const float wetMix = dryWetSmoother_.process();
-        const float dryMix = 1.0f - wetMix;
-
-        wetL *= masterGain;
-        wetR *= masterGain;
+        endControlBlock();
+    }
 
-        // Output dry/wet mix
-        leftOut[i] = inputL * dryMix + wetL * wetMix;
-        rightOut[i] = inputR * dryMix + wetR * wetMix;
+    // Leave every tap (audible or not) at the last scaled time so a later
+    // unscaled process() smooths on from where the curve ended
+    if constexpr (Scaled) {
+        if (numSamples > 0) {
+            const float scale = delayScale[numSamples - 1];
+            for (size_t t = 0; t < kMaxTaps; ++t) {
+                delayCurrent_[t] = delayTarget_[t] * scale;
+            }
+        }
     }
 }
 
@@ -0,0 +1,72 @@
+// ==============================================================================
+// Denormal Scope - Unit Tests
+// ==============================================================================
+// Layer 0: Core Utilities
+// Constitution Principle VIII: Testing Discipline
+//
+// Tests for: dsp/include/krate/dsp/core/denormal_scope.h
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <krate/dsp/core/db_utils.h>
+#include <krate/dsp/core/denormal_scope.h>
+
+#include <limits>
+
+using namespace Krate::DSP;
+
+namespace {
+
+// volatile keeps the products from being folded at compile time
+volatile float gSmallest = std::numeric_limits<float>::min();
+volatile float gHalf = 0.5f;
+
+float halveSmallestNormal() {
+    return gSmallest * gHalf;
+}
+
+} // namespace
+
+TEST_CASE("ScopedFlushToZero flushes denormal results and restores the mode", "[dsp][core][denormal_scope]") {
+    if (!ScopedFlushToZero::isSupported()) {
+        WARN("No flush-to-zero mode on this platform");
+        return;
+    }
+
+    const bool wasActive = ScopedFlushToZero::isActive();
+    {
+        const ScopedFlushToZero scope;
+        REQUIRE(ScopedFlushToZero::isActive());
+        REQUIRE(halveSmallestNormal() == 0.0f);
+    }
+    REQUIRE(ScopedFlushToZero::isActive() == wasActive);
+
+    if (!wasActive) {
+        REQUIRE(halveSmallestNormal() > 0.0f);
+    }
+}
+
+TEST_CASE("Nested ScopedFlushToZero keeps the outer mode", "[dsp][core][denormal_scope]") {
+    if (!ScopedFlushToZero::isSupported()) {
+        WARN("No flush-to-zero mode on this platform");
+        return;
+    }
+
+    const ScopedFlushToZero outer;
+    {
+        const ScopedFlushToZero inner;
+        REQUIRE(ScopedFlushToZero::isActive());
+    }
+    REQUIRE(ScopedFlushToZero::isActive());
+}
+
+TEST_CASE("flushDenormal follows the KRATE_DSP_ASSUME_FTZ policy", "[dsp][core][denormal_scope]") {
+    if constexpr (kAssumeFlushToZero) {
+        REQUIRE(detail::flushDenormal(1e-20f) == 1e-20f);
+    } else {
+        REQUIRE(detail::flushDenormal(1e-20f) == 0.0f);
+        REQUIRE(detail::flushDenormal(-1e-20f) == 0.0f);
+    }
+    REQUIRE(detail::flushDenormal(1e-3f) == 1e-3f);
+}
@@ -0,0 +1,94 @@
+// ==============================================================================
+// Layer 0: Core Utility Tests - Shared Table Registry
+// ==============================================================================
+// Tests for TableRegistry and the shared table accessors built on it
+// (Window::shared, GrainEnvelope::shared).
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <krate/dsp/core/grain_envelope.h>
+#include <krate/dsp/core/table_registry.h>
+#include <krate/dsp/core/window_functions.h>
+
+#include <array>
+#include <vector>
+
+using namespace Krate::DSP;
+
+TEST_CASE("TableRegistry generates each table once", "[core][table-registry]") {
+    auto& registry = TableRegistry::instance();
+    const TableKey key{TableFamily::Window, 200, 33, 1.5f};
+
+    int generated = 0;
+    auto fill = [&](float* output, size_t size) {
+        ++generated;
+        for (size_t i = 0; i < size; ++i) {
+            output[i] = static_cast<float>(i);
+        }
+    };
+
+    const auto first = registry.acquire(key, fill);
+    const size_t countAfterFirst = registry.tableCount();
+    const auto second = registry.acquire(key, fill);
+
+    REQUIRE(generated == 1);
+    REQUIRE(first.size() == 33);
+    REQUIRE(first.data() == second.data());
+    REQUIRE(first[32] == 32.0f);
+    REQUIRE(registry.tableCount() == countAfterFirst);
+}
+
+TEST_CASE("TableRegistry keys distinguish every field", "[core][table-registry]") {
+    auto& registry = TableRegistry::instance();
+    auto fill = [](float* output, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            output[i] = 1.0f;
+        }
+    };
+
+    const auto base = registry.acquire({TableFamily::Window, 201, 16, 0.0f}, fill);
+    const std::array<TableKey, 4> others{{
+        {TableFamily::GrainEnvelope, 201, 16, 0.0f},
+        {TableFamily::Window, 202, 16, 0.0f},
+        {TableFamily::Window, 201, 17, 0.0f},
+        {TableFamily::Window, 201, 16, 2.0f},
+    }};
+
+    for (const auto& key : others) {
+        REQUIRE(registry.acquire(key, fill).data() != base.data());
+    }
+}
+
+TEST_CASE("Window::shared matches Window::generate", "[core][table-registry][window]") {
+    for (auto type : {WindowType::Hann, WindowType::Hamming, WindowType::Blackman}) {
+        const auto shared = Window::shared(type, 1024);
+        const auto generated = Window::generate(type, 1024);
+        REQUIRE(std::vector<float>(shared.begin(), shared.end()) == generated);
+        REQUIRE(Window::shared(type, 1024).data() == shared.data());
+    }
+
+    SECTION("Kaiser tables are keyed by beta") {
+        const auto beta5 = Window::shared(WindowType::Kaiser, 512, 5.0f);
+        const auto beta9 = Window::shared(WindowType::Kaiser, 512, 9.0f);
+        REQUIRE(beta5.data() != beta9.data());
+        REQUIRE(std::vector<float>(beta5.begin(), beta5.end()) ==
+                Window::generate(WindowType::Kaiser, 512, 5.0f));
+    }
+
+    SECTION("beta is ignored for other window types") {
+        REQUIRE(Window::shared(WindowType::Hann, 256, 3.0f).data() ==
+                Window::shared(WindowType::Hann, 256, 7.0f).data());
+    }
+}
+
+TEST_CASE("GrainEnvelope::shared matches GrainEnvelope::generate", "[core][table-registry][grain]") {
+    for (auto type : {GrainEnvelopeType::Hann, GrainEnvelopeType::Trapezoid,
+                      GrainEnvelopeType::Sine, GrainEnvelopeType::Blackman}) {
+        std::vector<float> expected(2048);
+        GrainEnvelope::generate(expected.data(), expected.size(), type);
+
+        const auto shared = GrainEnvelope::shared(type, 2048);
+        REQUIRE(std::vector<float>(shared.begin(), shared.end()) == expected);
+    }
+}
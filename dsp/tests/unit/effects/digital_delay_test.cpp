@@ -666,6 +666,142 @@ TEST_CASE("DigitalDelay modulation waveforms (FR-023 to FR-030)", "[features][di
     }
 }
 
+namespace {
+
+/// Frequency of each window of a sine from its rising zero crossings
+std::vector<float> windowFrequencies(const std::vector<float>& signal, size_t start,
+                                     size_t window, double sampleRate) {
+    std::vector<float> frequencies;
+    for (size_t begin = start; begin + window <= signal.size(); begin += window) {
+        double first = -1.0;
+        double last = -1.0;
+        int crossings = 0;
+        for (size_t i = begin + 1; i < begin + window; ++i) {
+            if (signal[i - 1] < 0.0f && signal[i] >= 0.0f) {
+                const double t = static_cast<double>(i - 1) +
+                                 signal[i - 1] / (signal[i - 1] - signal[i]);
+                if (crossings == 0) first = t;
+                last = t;
+                ++crossings;
+            }
+        }
+        if (crossings >= 2) {
+            frequencies.push_back(static_cast<float>((crossings - 1) * sampleRate / (last - first)));
+        }
+    }
+    return frequencies;
+}
+
+} // namespace
+
+TEST_CASE("DigitalDelay modulated output is independent of block size",
+          "[features][digital-delay][modulation][US6]") {
+    constexpr size_t kMaxBlock = 512;
+    constexpr size_t kNumSamples = 44100;
+
+    std::vector<float> inputL(kNumSamples, 0.0f);
+    for (size_t i = 0; i < 8820; ++i) {
+        inputL[i] = 0.5f * std::sin(2.0f * 3.14159265f * 440.0f * static_cast<float>(i) / 44100.0f);
+    }
+
+    // Runs with a fixed block pattern; the delay time changes by a small and
+    // a large amount on the same samples either way
+    auto render = [&](const std::vector<size_t>& pattern) {
+        DigitalDelay delay;
+        delay.prepare(44100.0, kMaxBlock, 2000.0f);
+        delay.setEra(DigitalEra::Pristine);
+        delay.setTime(100.0f);
+        delay.setFeedback(0.5f);
+        delay.setMix(1.0f);
+        delay.setModulationDepth(0.6f);
+        delay.setModulationRate(3.0f);
+        delay.snapParameters();
+
+        BlockContext ctx;
+        ctx.sampleRate = 44100.0;
+        ctx.blockSize = kMaxBlock;
+
+        std::vector<float> left = inputL;
+        std::vector<float> right(kNumSamples);
+        for (size_t i = 0; i < kNumSamples; ++i) right[i] = -left[i];
+
+        size_t offset = 0;
+        for (size_t b = 0; offset < kNumSamples; ++b) {
+            if (offset >= 22050) {
+                delay.setTime(250.0f);
+            } else if (offset >= 11025) {
+                delay.setTime(101.0f);
+            }
+            const size_t length = std::min(pattern[b % pattern.size()], kNumSamples - offset);
+            delay.process(left.data() + offset, right.data() + offset, length, ctx);
+            offset += length;
+        }
+        left.insert(left.end(), right.begin(), right.end());
+        return left;
+    };
+
+    // Block boundaries in both patterns land on the time changes
+    const std::vector<float> expected = render({441});
+    const std::vector<float> actual = render({1, 63, 160, 217});
+
+    size_t mismatches = 0;
+    float maxError = 0.0f;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const float error = std::abs(actual[i] - expected[i]);
+        if (error > 0.0f) ++mismatches;
+        maxError = std::max(maxError, error);
+    }
+    INFO("mismatches " << mismatches << ", max error " << maxError);
+    REQUIRE(maxError < 1e-5f);
+}
+
+TEST_CASE("DigitalDelay time change does not bend the pitch",
+          "[features][digital-delay][modulation][time]") {
+    // A 2 ms change smoothed over 20 ms moves the delay by less than a sample
+    // per sample; it must wait for the crossfade rather than glide the read
+    // position like a modulation
+    for (float newTimeMs : {502.0f, 498.0f}) {
+        DigitalDelay delay;
+        delay.prepare(44100.0, 512, 2000.0f);
+        delay.setEra(DigitalEra::Pristine);
+        delay.setTime(500.0f);
+        delay.setFeedback(0.0f);
+        delay.setMix(1.0f);
+        delay.setModulationDepth(0.0f);
+        delay.snapParameters();
+
+        BlockContext ctx;
+        ctx.sampleRate = 44100.0;
+        ctx.blockSize = 512;
+
+        constexpr size_t kNumSamples = 88200;
+        constexpr size_t kChange = 44100;
+        std::vector<float> left(kNumSamples);
+        for (size_t i = 0; i < kNumSamples; ++i) {
+            left[i] = 0.5f * std::sin(2.0f * 3.14159265f * 1000.0f * static_cast<float>(i) / 44100.0f);
+        }
+        std::vector<float> right = left;
+
+        for (size_t offset = 0; offset < kNumSamples; offset += 512) {
+            if (offset == kChange - kChange % 512) {
+                delay.setTime(newTimeMs);
+            }
+            const size_t length = std::min<size_t>(512, kNumSamples - offset);
+            delay.process(left.data() + offset, right.data() + offset, length, ctx);
+        }
+
+        // Skip the first echo's onset; 256-sample windows catch short bends
+        const auto frequencies = windowFrequencies(left, 23040, 256, 44100.0);
+        float worst = 0.0f;
+        for (float frequency : frequencies) {
+            worst = std::max(worst, std::abs(frequency - 1000.0f));
+        }
+        INFO("new time " << newTimeMs << " ms, worst deviation " << worst << " Hz");
+        REQUIRE_FALSE(frequencies.empty());
+        REQUIRE(worst < 10.0f);
+    }
+}
+
 // =============================================================================
 // Phase 9: Mix and Output Tests (FR-031, FR-032)
 // =============================================================================
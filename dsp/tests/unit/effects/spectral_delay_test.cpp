@@ -2586,3 +2586,91 @@ TEST_CASE("SpectralDelay feedback transition doesn't cause distortion",
         REQUIRE(finalPeak < peakBeforeDrop * 0.5f);  // Decayed significantly
     }
 }
+
+// =============================================================================
+// Cartesian Processing Mode
+// =============================================================================
+
+TEST_CASE("SpectralDelay defaults to the Cartesian kernel",
+          "[spectral-delay][processing-mode]") {
+    SpectralDelay delay;
+    REQUIRE(delay.getProcessingMode() == SpectralProcessingMode::Cartesian);
+
+    delay.setProcessingMode(SpectralProcessingMode::Polar);
+    REQUIRE(delay.getProcessingMode() == SpectralProcessingMode::Polar);
+}
+
+TEST_CASE("SpectralDelay Cartesian kernel matches polar reference",
+          "[spectral-delay][processing-mode]") {
+    struct Settings {
+        const char* name;
+        float feedback;
+        float spreadMs;
+        float diffusion;
+        float stereoWidth;
+        bool freezeMidway;
+    };
+    const std::array<Settings, 5> cases = {{
+        {"plain delay", 0.0f, 0.0f, 0.0f, 0.0f, false},
+        {"feedback with spread", 0.9f, 300.0f, 0.0f, 0.0f, false},
+        {"overdriven feedback", 1.2f, 0.0f, 0.0f, 0.0f, false},
+        {"diffusion and width", 0.6f, 150.0f, 0.7f, 0.8f, false},
+        {"freeze with drift", 0.5f, 100.0f, 0.3f, 0.5f, true},
+    }};
+
+    for (const auto& settings : cases) {
+        DYNAMIC_SECTION(settings.name) {
+            std::array<SpectralDelay, 2> delays;
+            delays[0].setProcessingMode(SpectralProcessingMode::Polar);
+            delays[1].setProcessingMode(SpectralProcessingMode::Cartesian);
+
+            for (auto& delay : delays) {
+                delay.setFFTSize(1024);
+                delay.prepare(44100.0, 512);
+                delay.seedRng(4242);
+                delay.setBaseDelayMs(120.0f);
+                delay.setSpreadMs(settings.spreadMs);
+                delay.setFeedback(settings.feedback);
+                delay.setFeedbackTilt(0.3f);
+                delay.setDiffusion(settings.diffusion);
+                delay.setStereoWidth(settings.stereoWidth);
+                delay.setDryWetMix(100.0f);
+                delay.snapParameters();
+            }
+
+            auto ctx = makeTestContext();
+            constexpr std::size_t kBlockSize = 512;
+            std::array<std::vector<float>, 2> left{std::vector<float>(kBlockSize),
+                                                   std::vector<float>(kBlockSize)};
+            std::array<std::vector<float>, 2> right{std::vector<float>(kBlockSize),
+                                                    std::vector<float>(kBlockSize)};
+
+            float maxDiff = 0.0f;
+            float peak = 0.0f;
+            for (int block = 0; block < 120; ++block) {
+                if (settings.freezeMidway && block == 40) {
+                    for (auto& delay : delays) delay.setFreezeEnabled(true);
+                }
+                for (std::size_t d = 0; d < 2; ++d) {
+                    generateSine(left[d].data(), kBlockSize, 330.0f + 7.0f * static_cast<float>(block),
+                                 44100.0f, 0.5f);
+                    generateSine(right[d].data(), kBlockSize, 550.0f, 44100.0f, 0.4f);
+                    if (block >= 60) {
+                        std::fill(left[d].begin(), left[d].end(), 0.0f);
+                        std::fill(right[d].begin(), right[d].end(), 0.0f);
+                    }
+                    delays[d].process(left[d].data(), right[d].data(), kBlockSize, ctx);
+                }
+                for (std::size_t i = 0; i < kBlockSize; ++i) {
+                    maxDiff = std::max(maxDiff, std::abs(left[0][i] - left[1][i]));
+                    maxDiff = std::max(maxDiff, std::abs(right[0][i] - right[1][i]));
+                    peak = std::max(peak, std::abs(left[0][i]));
+                }
+            }
+
+            INFO("Reference peak: " << peak << ", max difference: " << maxDiff);
+            REQUIRE(peak > 0.01f);
+            REQUIRE(maxDiff < 1e-3f);
+        }
+    }
+}
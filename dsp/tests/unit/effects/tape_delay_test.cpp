@@ -16,6 +16,7 @@
 
 #include <array>
 #include <cmath>
+#include <vector>
 
 using Catch::Approx;
 using namespace Krate::DSP;
@@ -1124,6 +1125,77 @@ TEST_CASE("REGRESSION: Mono processing dry/wet mix works", "[features][tape-dela
     }
 }
 
+TEST_CASE("REGRESSION: Dry mix covers blocks larger than maxBlockSize", "[features][tape-delay][mix][regression]") {
+    TapeDelay delay;
+    delay.prepare(44100.0, 512, 2000.0f);
+    delay.setMotorSpeed(500.0f);
+    delay.setFeedback(0.0f);
+    delay.setMix(0.0f);
+    delay.reset();
+
+    // Previously only the first 4096 samples received the dry mix
+    std::vector<float> left(10000, 0.5f);
+    std::vector<float> right(10000, -0.5f);
+    delay.process(left.data(), right.data(), left.size());
+
+    for (size_t i = 100; i < left.size(); ++i) {
+        REQUIRE(left[i] == Approx(0.5f).margin(0.01f));
+        REQUIRE(right[i] == Approx(-0.5f).margin(0.01f));
+    }
+
+    std::vector<float> mono(10000, 0.25f);
+    delay.process(mono.data(), mono.size());
+    REQUIRE(mono.back() == Approx(0.25f).margin(0.01f));
+}
+
+TEST_CASE("Motor inertia is sample-accurate regardless of block size", "[features][tape-delay][motor-controller]") {
+    auto render = [](size_t blockSize) {
+        TapeDelay delay;
+        delay.prepare(44100.0, 512, 2000.0f);
+        delay.setFeedback(0.0f);
+        delay.setMix(1.0f);
+        delay.setHeadEnabled(1, false);
+        delay.setHeadEnabled(2, false);
+        delay.setMotorSpeed(100.0f);
+
+        // Let CharacterProcessor's block-rate saturation smoothing settle so
+        // only the motor path is compared
+        std::array<float, 16> silence{};
+        for (int i = 0; i < 4000; ++i) {
+            delay.process(silence.data(), silence.data(), silence.size());
+        }
+        delay.reset();
+
+        // Speed change mid-stream: the head sweeps from 100 ms toward 400 ms
+        delay.setMotorSpeed(400.0f);
+
+        std::vector<float> left(22050);
+        for (size_t i = 0; i < left.size(); ++i) {
+            left[i] = std::sin(2.0f * 3.14159265f * 440.0f * static_cast<float>(i) / 44100.0f);
+        }
+        std::vector<float> right = left;
+        for (size_t offset = 0; offset < left.size(); offset += blockSize) {
+            const size_t n = std::min(blockSize, left.size() - offset);
+            delay.process(left.data() + offset, right.data() + offset, n);
+        }
+        return left;
+    };
+
+    const auto small = render(32);
+    const auto large = render(512);
+
+    // The pitch-bent echo must be identical whether the host uses small or
+    // large buffers (the motor curve used to be applied once per block)
+    float maxDiff = 0.0f;
+    float peak = 0.0f;
+    for (size_t i = 0; i < small.size(); ++i) {
+        maxDiff = std::max(maxDiff, std::abs(small[i] - large[i]));
+        peak = std::max(peak, std::abs(small[i]));
+    }
+    REQUIRE(peak > 0.1f);
+    REQUIRE(maxDiff < 1e-3f);
+}
+
 // =============================================================================
 // FR-024: Age Control Affects Artifact Intensity
 // =============================================================================
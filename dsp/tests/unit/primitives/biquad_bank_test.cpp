@@ -0,0 +1,163 @@
+// ==============================================================================
+// Layer 1: DSP Primitive Tests - Biquad Bank
+// ==============================================================================
+// Tests for BiquadBank: lane equivalence with Biquad/BiquadCascade, planar and
+// interleaved layouts, per-channel coefficients, block-level NaN recovery.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <krate/dsp/primitives/biquad_bank.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace Krate::DSP;
+using Catch::Approx;
+
+namespace {
+
+constexpr float kSampleRate = 44100.0f;
+
+std::vector<float> makeNoise(size_t numSamples, uint32_t seed) {
+    std::vector<float> noise(numSamples);
+    uint32_t state = seed;
+    for (auto& sample : noise) {
+        state = state * 1664525u + 1013904223u;
+        sample = static_cast<float>(state >> 8) / 8388608.0f - 1.0f;
+    }
+    return noise;
+}
+
+} // namespace
+
+TEST_CASE("BiquadBank defaults to bypass", "[primitives][biquad_bank][layer1]") {
+    BiquadBank<2, 3> bank;
+    auto left = makeNoise(64, 1);
+    auto right = makeNoise(64, 2);
+    const auto leftIn = left;
+    const auto rightIn = right;
+
+    bank.processStereo(left.data(), right.data(), 64);
+
+    REQUIRE(left == leftIn);
+    REQUIRE(right == rightIn);
+}
+
+TEST_CASE("BiquadBank stereo lanes match independent Biquads", "[primitives][biquad_bank][layer1]") {
+    BiquadBank<2> bank;
+    bank.configure(FilterType::Lowpass, 3000.0f, 0.9f, 0.0f, kSampleRate);
+
+    Biquad referenceL;
+    Biquad referenceR;
+    referenceL.configure(FilterType::Lowpass, 3000.0f, 0.9f, 0.0f, kSampleRate);
+    referenceR.configure(FilterType::Lowpass, 3000.0f, 0.9f, 0.0f, kSampleRate);
+
+    auto left = makeNoise(1000, 1);
+    auto right = makeNoise(1000, 2);
+    auto expectedL = left;
+    auto expectedR = right;
+    referenceL.processBlock(expectedL.data(), 1000);
+    referenceR.processBlock(expectedR.data(), 1000);
+
+    // Uneven block sizes exercise state carry-over
+    bank.processStereo(left.data(), right.data(), 300);
+    bank.processStereo(left.data() + 300, right.data() + 300, 700);
+
+    for (size_t i = 0; i < 1000; ++i) {
+        REQUIRE(left[i] == Approx(expectedL[i]).margin(1e-6f));
+        REQUIRE(right[i] == Approx(expectedR[i]).margin(1e-6f));
+    }
+}
+
+TEST_CASE("BiquadBank cascade matches BiquadCascade", "[primitives][biquad_bank][layer1]") {
+    BiquadBank<1, 4> bank;
+    bank.setButterworth(FilterType::Highpass, 500.0f, kSampleRate);
+
+    BiquadCascade<4> reference;
+    reference.setButterworth(FilterType::Highpass, 500.0f, kSampleRate);
+
+    auto signal = makeNoise(2048, 3);
+    auto expected = signal;
+    reference.processBlock(expected.data(), expected.size());
+
+    float* channels[1] = {signal.data()};
+    bank.processBlock(channels, signal.size());
+
+    for (size_t i = 0; i < signal.size(); ++i) {
+        REQUIRE(signal[i] == Approx(expected[i]).margin(1e-5f));
+    }
+}
+
+TEST_CASE("BiquadBank per-channel coefficients and interleaved layout", "[primitives][biquad_bank][layer1]") {
+    constexpr size_t kChannels = 4;
+    constexpr size_t kFrames = 512;
+    const std::array<float, kChannels> cutoffs = {200.0f, 1000.0f, 5000.0f, 12000.0f};
+
+    BiquadBank<kChannels> bank;
+    std::array<Biquad, kChannels> reference;
+    for (size_t ch = 0; ch < kChannels; ++ch) {
+        const auto coeffs = BiquadCoefficients::calculate(
+            FilterType::Bandpass, cutoffs[ch], 2.0f, 0.0f, kSampleRate);
+        bank.setStage(0, ch, coeffs);
+        reference[ch].setCoefficients(coeffs);
+        REQUIRE(bank.coefficients(0, ch).b0 == coeffs.b0);
+    }
+
+    auto frames = makeNoise(kFrames * kChannels, 4);
+    auto expected = frames;
+    for (size_t i = 0; i < kFrames; ++i) {
+        for (size_t ch = 0; ch < kChannels; ++ch) {
+            expected[i * kChannels + ch] = reference[ch].process(expected[i * kChannels + ch]);
+        }
+    }
+
+    bank.processInterleaved(frames.data(), kFrames);
+
+    for (size_t i = 0; i < frames.size(); ++i) {
+        REQUIRE(frames[i] == Approx(expected[i]).margin(1e-6f));
+    }
+}
+
+TEST_CASE("BiquadBank clears only the channel that went non-finite", "[primitives][biquad_bank][layer1]") {
+    BiquadBank<2> bank;
+    bank.configure(FilterType::Lowpass, 1000.0f, 0.707f, 0.0f, kSampleRate);
+
+    std::vector<float> left(64, 0.5f);
+    std::vector<float> right(64, 0.5f);
+    left[10] = std::numeric_limits<float>::quiet_NaN();
+
+    bank.processStereo(left.data(), right.data(), 64);
+
+    for (size_t i = 0; i < 64; ++i) {
+        REQUIRE(left[i] == 0.0f);
+        REQUIRE(std::isfinite(right[i]));
+    }
+    REQUIRE(right[63] > 0.1f);
+
+    // Next block starts from cleared state
+    std::fill(left.begin(), left.end(), 0.5f);
+    bank.processStereo(left.data(), right.data(), 64);
+    for (float s : left) {
+        REQUIRE(std::isfinite(s));
+    }
+    REQUIRE(left[63] > 0.1f);
+}
+
+TEST_CASE("BiquadBank flushes denormal state at block end", "[primitives][biquad_bank][layer1]") {
+    BiquadBank<1> bank;
+    bank.configure(FilterType::Lowpass, 1000.0f, 0.707f, 0.0f, kSampleRate);
+
+    std::vector<float> buffer(64, 1e-30f);
+    float* channels[1] = {buffer.data()};
+    bank.processBlock(channels, buffer.size());
+
+    std::fill(buffer.begin(), buffer.end(), 0.0f);
+    bank.processBlock(channels, buffer.size());
+    for (float s : buffer) {
+        REQUIRE(s == 0.0f);
+    }
+}
@@ -786,3 +786,113 @@ TEST_CASE("CrossfadingDelayLine equal-power vs linear at midpoint",
     REQUIRE(outputAtMidpoint > 1.2f);  // Proves it's equal-power, not linear
     REQUIRE(outputAtMidpoint < 1.5f);  // But not unreasonably high
 }
+
+// =============================================================================
+// Look-Ahead Reads
+// =============================================================================
+
+TEST_CASE("CrossfadingDelayLine readAhead matches read after the pending writes",
+          "[delay][crossfade][chunk]") {
+    CrossfadingDelayLine sequential;
+    CrossfadingDelayLine chunked;
+    for (auto* delay : {&sequential, &chunked}) {
+        delay->prepare(44100.0, 0.1f);
+        delay->snapToDelaySamples(300.5f);
+    }
+
+    constexpr size_t kChunk = 64;
+    std::array<float, kChunk> expected{};
+    std::array<float, kChunk> actual{};
+    std::array<float, kChunk> block{};
+    size_t n = 0;
+
+    for (int c = 0; c < 60; ++c) {
+        // Start a crossfade part way through
+        const float delaySamples = (c < 20) ? 300.5f : 1200.25f;
+
+        const bool settled = !chunked.isCrossfading() && c != 20;
+        if (settled) {
+            chunked.readAheadBlock(block.data(), kChunk);
+        }
+        for (size_t i = 0; i < kChunk; ++i) {
+            chunked.setDelaySamples(delaySamples);
+            actual[i] = chunked.readAhead(i);
+        }
+        for (size_t i = 0; i < kChunk; ++i, ++n) {
+            const float input = std::sin(static_cast<float>(n) * 0.01f);
+            sequential.setDelaySamples(delaySamples);
+            expected[i] = sequential.read();
+            sequential.write(input);
+            chunked.write(input);
+        }
+
+        for (size_t i = 0; i < kChunk; ++i) {
+            REQUIRE(actual[i] == expected[i]);
+            if (settled) {
+                REQUIRE(block[i] == expected[i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("CrossfadingDelayLine readAheadBlock follows delay and modulation curves",
+          "[delay][crossfade][chunk]") {
+    CrossfadingDelayLine sequential;
+    CrossfadingDelayLine chunked;
+    for (auto* delay : {&sequential, &chunked}) {
+        delay->prepare(44100.0, 0.1f);
+        delay->snapToDelaySamples(300.0f);
+    }
+
+    constexpr size_t kChunk = 64;
+    std::array<float, kChunk> delayCurve{};
+    std::array<float, kChunk> modulationCurve{};
+    std::array<float, kChunk> expected{};
+    std::array<float, kChunk> actual{};
+    size_t n = 0;
+
+    for (int c = 0; c < 60; ++c) {
+        // Vibrato around a creeping delay, jumping to 1200 part way through
+        for (size_t i = 0; i < kChunk; ++i) {
+            const float t = static_cast<float>(n + i);
+            delayCurve[i] = ((c < 20) ? 300.0f : 1200.0f) + 0.01f * t;
+            modulationCurve[i] = 40.0f * std::sin(t * 0.003f);
+        }
+
+        chunked.readAheadBlock(delayCurve.data(), modulationCurve.data(), actual.data(), kChunk);
+        for (size_t i = 0; i < kChunk; ++i, ++n) {
+            const float input = std::sin(static_cast<float>(n) * 0.01f);
+            sequential.setDelaySamples(delayCurve[i]);
+            sequential.setModulationSamples(modulationCurve[i]);
+            expected[i] = sequential.read();
+            sequential.write(input);
+            chunked.write(input);
+        }
+
+        for (size_t i = 0; i < kChunk; ++i) {
+            REQUIRE(actual[i] == expected[i]);
+        }
+    }
+}
+
+TEST_CASE("CrossfadingDelayLine modulation moves the read position without crossfading",
+          "[delay][crossfade]") {
+    CrossfadingDelayLine delay;
+    delay.prepare(44100.0, 0.1f);
+    delay.snapToDelaySamples(300.0f);
+
+    // The offset goes straight to the read position, even a large one
+    delay.setModulationSamples(150.0f);
+    REQUIRE_FALSE(delay.isCrossfading());
+    REQUIRE(delay.getCurrentDelaySamples() == 450.0f);
+
+    // A small time change leaves the read position alone...
+    delay.setModulationSamples(0.0f);
+    delay.setDelaySamples(302.0f);
+    REQUIRE_FALSE(delay.isCrossfading());
+    REQUIRE(delay.getCurrentDelaySamples() == 300.0f);
+
+    // ...and a large one crossfades
+    delay.setDelaySamples(1000.0f);
+    REQUIRE(delay.isCrossfading());
+}
@@ -286,6 +286,66 @@ TEST_CASE("FFT round-trip error < 0.0001%", "[fft][roundtrip][US2]") {
     }
 }
 
+// ==============================================================================
+// Real-Input Packing Tests
+// ==============================================================================
+
+TEST_CASE("FFT forward matches direct DFT for radix-2 and radix-4 stage layouts",
+          "[fft][forward][packing]") {
+    // N/2 = 128 (even log2, pure radix-4) and N/2 = 256 (odd log2, leading radix-2)
+    const std::array<size_t, 4> sizes = {8, 16, 256, 512};
+
+    for (size_t fftSize : sizes) {
+        DYNAMIC_SECTION("FFT size " << fftSize) {
+            FFT fft;
+            fft.prepare(fftSize);
+
+            // Deterministic broadband input (no symmetry to hide packing errors)
+            std::vector<float> input(fftSize);
+            uint32_t state = 12345;
+            for (auto& s : input) {
+                state = state * 1664525u + 1013904223u;
+                s = static_cast<float>(state >> 8) / 8388608.0f - 1.0f;
+            }
+
+            std::vector<Complex> spectrum(fft.numBins());
+            fft.forward(input.data(), spectrum.data());
+
+            double maxError = 0.0;
+            for (size_t k = 0; k < fft.numBins(); ++k) {
+                double re = 0.0;
+                double im = 0.0;
+                for (size_t n = 0; n < fftSize; ++n) {
+                    const double angle = -2.0 * std::numbers::pi * static_cast<double>(k * n)
+                                       / static_cast<double>(fftSize);
+                    re += input[n] * std::cos(angle);
+                    im += input[n] * std::sin(angle);
+                }
+                maxError = std::max(maxError, std::abs(re - spectrum[k].real));
+                maxError = std::max(maxError, std::abs(im - spectrum[k].imag));
+            }
+
+            REQUIRE(maxError < 1e-3);
+        }
+    }
+}
+
+TEST_CASE("FFT inverse ignores imaginary parts of DC and Nyquist bins", "[fft][inverse][packing]") {
+    FFT fft;
+    fft.prepare(512);
+
+    std::vector<Complex> spectrum(fft.numBins());
+    spectrum[0] = {256.0f, 3.0f};
+    spectrum[256] = {0.0f, -7.0f};
+
+    std::vector<float> output(512);
+    fft.inverse(spectrum.data(), output.data());
+
+    for (float s : output) {
+        REQUIRE(s == Approx(0.5f).margin(1e-6f));
+    }
+}
+
 // ==============================================================================
 // Real-Time Safety Tests (T094)
 // ==============================================================================
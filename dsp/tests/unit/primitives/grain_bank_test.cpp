@@ -0,0 +1,141 @@
+// Layer 1: DSP Primitive Tests - Grain Bank
+// Part of Granular Delay feature (spec 034)
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <krate/dsp/primitives/grain_bank.h>
+
+#include <deque>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace Krate::DSP;
+
+namespace {
+
+std::vector<size_t> activeSlots(const GrainBank& bank) {
+    std::vector<size_t> slots;
+    for (size_t i = 0; i < bank.activeCount(); ++i) {
+        slots.push_back(bank.activeSlot(i));
+    }
+    return slots;
+}
+
+} // namespace
+
+TEST_CASE("GrainBank starts empty", "[primitives][grain][layer1]") {
+    GrainBank bank;
+    REQUIRE(bank.activeCount() == 0);
+    REQUIRE(GrainBank::maxGrains() == 128);
+}
+
+TEST_CASE("GrainBank acquire hands out distinct slots in trigger order", "[primitives][grain][layer1]") {
+    GrainBank bank;
+
+    std::set<size_t> seen;
+    for (size_t i = 0; i < GrainBank::kMaxGrains; ++i) {
+        const size_t slot = bank.acquire(i * 10);
+        REQUIRE(slot < GrainBank::kMaxGrains);
+        REQUIRE(bank.startSample[slot] == i * 10);
+        seen.insert(slot);
+    }
+
+    REQUIRE(seen.size() == GrainBank::kMaxGrains);
+    REQUIRE(bank.activeCount() == GrainBank::kMaxGrains);
+
+    // Active list is oldest first
+    for (size_t i = 1; i < bank.activeCount(); ++i) {
+        REQUIRE(bank.startSample[bank.activeSlot(i - 1)] < bank.startSample[bank.activeSlot(i)]);
+    }
+}
+
+TEST_CASE("GrainBank steals the oldest grain when full", "[primitives][grain][layer1]") {
+    GrainBank bank;
+    for (size_t i = 0; i < GrainBank::kMaxGrains; ++i) {
+        (void)bank.acquire(i);
+    }
+
+    const size_t oldest = bank.activeSlot(0);
+    const size_t secondOldest = bank.activeSlot(1);
+
+    const size_t stolen = bank.acquire(1000);
+
+    REQUIRE(stolen == oldest);
+    REQUIRE(bank.activeCount() == GrainBank::kMaxGrains);
+    REQUIRE(bank.activeSlot(0) == secondOldest);
+    REQUIRE(bank.activeSlot(bank.activeCount() - 1) == stolen);
+    REQUIRE(bank.startSample[stolen] == 1000);
+}
+
+TEST_CASE("GrainBank keeps trigger order across steals and releases", "[primitives][grain][layer1]") {
+    // Reference model: start samples of the active grains, oldest first
+    GrainBank bank;
+    std::deque<size_t> expected;
+    std::mt19937 rng(7);
+    size_t steals = 0;
+
+    for (size_t sample = 0; sample < 5000; ++sample) {
+        if (rng() % 64 == 0) {
+            // Release a pseudo-random subset
+            const size_t modulus = 2 + rng() % 5;
+            bank.retainIf([&](size_t slot) { return bank.startSample[slot] % modulus != 0; });
+            std::erase_if(expected, [&](size_t start) { return start % modulus == 0; });
+        }
+
+        (void)bank.acquire(sample);
+        if (expected.size() == GrainBank::kMaxGrains) {
+            expected.pop_front();
+            ++steals;
+        }
+        expected.push_back(sample);
+
+        REQUIRE(bank.activeCount() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            REQUIRE(bank.startSample[bank.activeSlot(i)] == expected[i]);
+        }
+    }
+    REQUIRE(steals > 100);
+}
+
+TEST_CASE("GrainBank retainIf releases slots and keeps order", "[primitives][grain][layer1]") {
+    GrainBank bank;
+    for (size_t i = 0; i < 6; ++i) {
+        (void)bank.acquire(i);
+    }
+    const std::vector<size_t> before = activeSlots(bank);
+
+    SECTION("visits every active grain oldest first") {
+        std::vector<size_t> visited;
+        bank.retainIf([&](size_t slot) {
+            visited.push_back(slot);
+            return true;
+        });
+        REQUIRE(visited == before);
+        REQUIRE(bank.activeCount() == 6);
+    }
+
+    SECTION("released grains are dropped, survivors keep their order") {
+        // Release grains started on odd samples
+        bank.retainIf([&](size_t slot) { return bank.startSample[slot] % 2 == 0; });
+
+        REQUIRE(bank.activeCount() == 3);
+        REQUIRE(activeSlots(bank) == std::vector<size_t>{before[0], before[2], before[4]});
+    }
+
+    SECTION("released slots are reused") {
+        bank.retainIf([](size_t) { return false; });
+        REQUIRE(bank.activeCount() == 0);
+
+        std::set<size_t> reused;
+        for (size_t i = 0; i < GrainBank::kMaxGrains; ++i) {
+            reused.insert(bank.acquire(100 + i));
+        }
+        REQUIRE(reused.size() == GrainBank::kMaxGrains);
+    }
+
+    SECTION("reset deactivates everything") {
+        bank.reset();
+        REQUIRE(bank.activeCount() == 0);
+    }
+}
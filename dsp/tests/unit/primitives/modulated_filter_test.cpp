@@ -0,0 +1,220 @@
+// ==============================================================================
+// Layer 1: DSP Primitive Tests - Modulated Filter
+// ==============================================================================
+// Tests for SVFCoefficients and the control-rate ModulatedFilter engine.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <krate/dsp/primitives/modulated_filter.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace Krate::DSP;
+using Catch::Approx;
+
+namespace {
+
+constexpr float kSampleRate = 44100.0f;
+
+constexpr std::array<FilterType, 8> kAllTypes = {
+    FilterType::Lowpass, FilterType::Highpass, FilterType::Bandpass, FilterType::Notch,
+    FilterType::Allpass, FilterType::LowShelf, FilterType::HighShelf, FilterType::Peak
+};
+
+// Per-sample cutoff sweep (exponential LFO between 200 Hz and 8 kHz)
+std::vector<float> makeSweep(size_t numSamples, float rateHz) {
+    std::vector<float> cutoff(numSamples);
+    for (size_t i = 0; i < numSamples; ++i) {
+        const float phase = kTwoPi * rateHz * static_cast<float>(i) / kSampleRate;
+        cutoff[i] = 200.0f * std::pow(40.0f, 0.5f + 0.5f * std::sin(phase));
+    }
+    return cutoff;
+}
+
+std::vector<float> makeNoise(size_t numSamples) {
+    std::vector<float> noise(numSamples);
+    uint32_t state = 12345;
+    for (auto& sample : noise) {
+        state = state * 1664525u + 1013904223u;
+        sample = static_cast<float>(state >> 8) / 8388608.0f - 1.0f;
+    }
+    return noise;
+}
+
+} // namespace
+
+// ==============================================================================
+// SVFCoefficients
+// ==============================================================================
+
+TEST_CASE("SVF response matches the cookbook Biquad for every type", "[primitives][modulated_filter][layer1]") {
+    for (FilterType type : kAllTypes) {
+        for (float frequency : {200.0f, 1000.0f, 8000.0f}) {
+            for (float q : {0.707f, 4.0f}) {
+                ModulatedFilter svf;
+                svf.setParameters(type, frequency, q, 6.0f);
+                svf.prepare(kSampleRate);
+
+                Biquad biquad;
+                biquad.configure(type, frequency, q, 6.0f, kSampleRate);
+
+                float maxError = 0.0f;
+                for (int i = 0; i < 2048; ++i) {
+                    const float x = (i == 0) ? 1.0f : 0.0f;
+                    maxError = std::max(maxError, std::abs(svf.process(x) - biquad.process(x)));
+                }
+
+                INFO("type " << static_cast<int>(type) << " f " << frequency << " Q " << q);
+                REQUIRE(maxError < 1e-4f);
+            }
+        }
+    }
+}
+
+TEST_CASE("SVFCoefficients returns bypass for invalid sample rate", "[primitives][modulated_filter][layer1]") {
+    const auto coeffs = SVFCoefficients::calculate(FilterType::Lowpass, 1000.0f, 0.707f, 0.0f, 0.0f);
+    REQUIRE(coeffs.m0 == 1.0f);
+    REQUIRE(coeffs.m1 == 0.0f);
+    REQUIRE(coeffs.m2 == 0.0f);
+}
+
+// ==============================================================================
+// Control-Rate Engine
+// ==============================================================================
+
+TEST_CASE("ModulatedFilter ramps coefficients linearly over one control interval", "[primitives][modulated_filter][layer1]") {
+    ModulatedFilter filter;
+    filter.setParameters(FilterType::Lowpass, 500.0f, 0.707f);
+    filter.prepare(kSampleRate);
+    filter.setControlInterval(16);
+
+    const auto start = filter.coefficients();
+    const auto target = SVFCoefficients::calculate(FilterType::Lowpass, 4000.0f, 0.707f, 0.0f, kSampleRate);
+    filter.setCutoff(4000.0f);
+
+    std::array<float, 16> buffer{};
+    filter.processBlock(buffer.data(), 8);
+    REQUIRE(filter.coefficients().a1 == Approx(0.5f * (start.a1 + target.a1)).margin(1e-6f));
+    REQUIRE(filter.coefficients().a3 == Approx(0.5f * (start.a3 + target.a3)).margin(1e-6f));
+
+    filter.processBlock(buffer.data(), 8);
+    REQUIRE(filter.coefficients().a1 == target.a1);
+    REQUIRE(filter.coefficients().a2 == target.a2);
+    REQUIRE(filter.coefficients().a3 == target.a3);
+}
+
+TEST_CASE("ModulatedFilter per-sample and block processing agree", "[primitives][modulated_filter][layer1]") {
+    ModulatedFilter a;
+    ModulatedFilter b;
+    for (auto* f : {&a, &b}) {
+        f->setParameters(FilterType::Bandpass, 700.0f, 3.0f);
+        f->prepare(kSampleRate);
+        f->setCutoff(2500.0f);
+    }
+
+    auto input = makeNoise(300);
+    auto blockOut = input;
+    b.processBlock(blockOut.data(), 100);
+    b.processBlock(blockOut.data() + 100, 200);
+
+    for (size_t i = 0; i < input.size(); ++i) {
+        REQUIRE(a.process(input[i]) == Approx(blockOut[i]).margin(1e-6f));
+    }
+}
+
+TEST_CASE("ModulatedFilter cutoff curve tracks per-sample exact coefficients", "[primitives][modulated_filter][layer1]") {
+    constexpr size_t kNumSamples = 8192;
+    const auto cutoff = makeSweep(kNumSamples, 3.0f);
+    const auto input = makeNoise(kNumSamples);
+
+    for (size_t interval : {size_t{16}, size_t{32}}) {
+        ModulatedFilter reference;
+        ModulatedFilter controlRate;
+        for (auto* f : {&reference, &controlRate}) {
+            f->setParameters(FilterType::Lowpass, cutoff[0], 2.0f);
+            f->prepare(kSampleRate);
+        }
+        reference.setControlInterval(1);
+        controlRate.setControlInterval(interval);
+
+        auto exact = input;
+        auto approx = input;
+        for (size_t offset = 0; offset < kNumSamples; offset += 512) {
+            reference.processBlock(exact.data() + offset, cutoff.data() + offset, 512);
+            controlRate.processBlock(approx.data() + offset, cutoff.data() + offset, 512);
+        }
+
+        double errorEnergy = 0.0;
+        double signalEnergy = 0.0;
+        for (size_t i = 0; i < kNumSamples; ++i) {
+            const double diff = exact[i] - approx[i];
+            errorEnergy += diff * diff;
+            signalEnergy += static_cast<double>(exact[i]) * exact[i];
+        }
+        const double errorDb = 10.0 * std::log10(errorEnergy / signalEnergy);
+
+        INFO("Control interval " << interval << ": error " << errorDb << " dB");
+        REQUIRE(errorDb < -50.0);
+    }
+}
+
+TEST_CASE("ModulatedFilter coefficients are exact at control points", "[primitives][modulated_filter][layer1]") {
+    ModulatedFilter filter;
+    filter.setParameters(FilterType::Peak, 1000.0f, 1.0f, 9.0f);
+    filter.prepare(kSampleRate);
+    filter.setControlInterval(32);
+
+    const auto cutoff = makeSweep(64, 50.0f);
+    std::vector<float> buffer(64, 0.0f);
+    filter.processBlock(buffer.data(), cutoff.data(), 32);
+
+    const auto expected = SVFCoefficients::calculate(FilterType::Peak, cutoff[31], 1.0f, 9.0f, kSampleRate);
+    REQUIRE(filter.coefficients().a1 == expected.a1);
+    REQUIRE(filter.coefficients().m1 == expected.m1);
+    REQUIRE(filter.getCutoff() == cutoff[31]);
+}
+
+TEST_CASE("ModulatedFilter stays stable under fast resonant sweeps", "[primitives][modulated_filter][layer1]") {
+    constexpr size_t kNumSamples = 44100;
+    std::vector<float> cutoff(kNumSamples);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        // 40 Hz square-ish jumps between extremes
+        cutoff[i] = ((i / 551) % 2 == 0) ? 20.0f : 20000.0f;
+    }
+    auto buffer = makeNoise(kNumSamples);
+
+    ModulatedFilter filter;
+    filter.setParameters(FilterType::Lowpass, 20.0f, 20.0f);
+    filter.prepare(kSampleRate);
+    filter.setControlInterval(32);
+    filter.processBlock(buffer.data(), cutoff.data(), kNumSamples);
+
+    for (float sample : buffer) {
+        REQUIRE(std::isfinite(sample));
+        REQUIRE(std::abs(sample) < 100.0f);
+    }
+}
+
+TEST_CASE("ModulatedFilter resets on non-finite input", "[primitives][modulated_filter][layer1]") {
+    ModulatedFilter filter;
+    filter.prepare(kSampleRate);
+
+    (void)filter.process(1.0f);
+    REQUIRE(filter.process(std::numeric_limits<float>::quiet_NaN()) == 0.0f);
+    REQUIRE(filter.process(0.0f) == 0.0f);
+}
+
+TEST_CASE("ModulatedFilter control interval is clamped", "[primitives][modulated_filter][layer1]") {
+    ModulatedFilter filter;
+    REQUIRE(filter.getControlInterval() == ModulatedFilter::kDefaultControlInterval);
+
+    filter.setControlInterval(0);
+    REQUIRE(filter.getControlInterval() == 1);
+
+    filter.setControlInterval(100000);
+    REQUIRE(filter.getControlInterval() == ModulatedFilter::kMaxControlInterval);
+}
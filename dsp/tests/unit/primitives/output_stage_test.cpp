@@ -0,0 +1,206 @@
+// ==============================================================================
+// Layer 1: DSP Primitive Tests - Output Stage
+// ==============================================================================
+// Tests for: dsp/include/krate/dsp/primitives/output_stage.h
+// ==============================================================================
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <krate/dsp/core/crossfade_utils.h>
+#include <krate/dsp/primitives/output_stage.h>
+#include <krate/dsp/primitives/smoother.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Krate::DSP;
+using Catch::Approx;
+
+namespace {
+
+constexpr double kSampleRate = 44100.0;
+constexpr size_t kBlockSize = 256;
+constexpr float kSmoothingMs = 20.0f;
+
+struct Stereo {
+    std::vector<float> left;
+    std::vector<float> right;
+};
+
+Stereo makeSignal(size_t n, float phase) {
+    Stereo s{std::vector<float>(n), std::vector<float>(n)};
+    for (size_t i = 0; i < n; ++i) {
+        s.left[i] = std::sin(0.05f * static_cast<float>(i) + phase);
+        s.right[i] = 0.5f * std::cos(0.031f * static_cast<float>(i) - phase);
+    }
+    return s;
+}
+
+/// The separate width, mix and gain loops the stage replaces
+struct ReferenceChain {
+    OnePoleSmoother width{1.0f};
+    OnePoleSmoother mix{1.0f};
+    OnePoleSmoother gain{1.0f};
+
+    ReferenceChain() {
+        width.configure(kSmoothingMs, static_cast<float>(kSampleRate));
+        mix.configure(kSmoothingMs, static_cast<float>(kSampleRate));
+        gain.configure(kSmoothingMs, static_cast<float>(kSampleRate));
+    }
+
+    void process(const Stereo& dry, Stereo& wet) {
+        const size_t n = wet.left.size();
+        for (size_t i = 0; i < n; ++i) {
+            const float w = width.process();
+            const float mid = (wet.left[i] + wet.right[i]) * 0.5f;
+            const float side = (wet.left[i] - wet.right[i]) * 0.5f * w;
+            wet.left[i] = mid + side;
+            wet.right[i] = mid - side;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            const float m = mix.process();
+            wet.left[i] = dry.left[i] * (1.0f - m) + wet.left[i] * m;
+            wet.right[i] = dry.right[i] * (1.0f - m) + wet.right[i] * m;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            const float g = gain.process();
+            wet.left[i] *= g;
+            wet.right[i] *= g;
+        }
+    }
+};
+
+} // namespace
+
+TEST_CASE("OutputStage at identity leaves the wet signal untouched", "[primitives][output_stage][layer1]") {
+    OutputStage stage;
+    stage.prepare(kSampleRate, kBlockSize, kSmoothingMs);
+
+    const Stereo dry = makeSignal(kBlockSize, 0.3f);
+    Stereo wet = makeSignal(kBlockSize, 1.1f);
+    const Stereo original = wet;
+
+    stage.captureDry(dry.left.data(), dry.right.data(), kBlockSize);
+    stage.process(wet.left.data(), wet.right.data(), kBlockSize);
+
+    REQUIRE(wet.left == original.left);
+    REQUIRE(wet.right == original.right);
+}
+
+TEST_CASE("OutputStage matches separate width, mix and gain passes", "[primitives][output_stage][layer1]") {
+    OutputStage stage;
+    stage.prepare(kSampleRate, kBlockSize, kSmoothingMs);
+    ReferenceChain reference;
+
+    // Settled start, then ramps on all three parameters
+    stage.setWidth(0.4f);
+    stage.setMix(0.7f);
+    stage.setOutputGain(0.8f);
+    stage.snapParameters();
+    reference.width.snapTo(0.4f);
+    reference.mix.snapTo(0.7f);
+    reference.gain.snapTo(0.8f);
+
+    for (int block = 0; block < 16; ++block) {
+        if (block == 4) {
+            stage.setWidth(1.8f);
+            stage.setMix(0.2f);
+            stage.setOutputGain(1.5f);
+            reference.width.setTarget(1.8f);
+            reference.mix.setTarget(0.2f);
+            reference.gain.setTarget(1.5f);
+        }
+
+        const Stereo dry = makeSignal(kBlockSize, 0.1f * static_cast<float>(block));
+        Stereo wet = makeSignal(kBlockSize, 2.0f + 0.1f * static_cast<float>(block));
+        Stereo expected = wet;
+
+        stage.captureDry(dry.left.data(), dry.right.data(), kBlockSize);
+        stage.process(wet.left.data(), wet.right.data(), kBlockSize);
+        reference.process(dry, expected);
+
+        for (size_t i = 0; i < kBlockSize; ++i) {
+            REQUIRE(wet.left[i] == Approx(expected.left[i]).margin(1e-5f));
+            REQUIRE(wet.right[i] == Approx(expected.right[i]).margin(1e-5f));
+        }
+    }
+}
+
+TEST_CASE("OutputStage crossfades equal-power from the outgoing signal", "[primitives][output_stage][layer1]") {
+    OutputStage stage;
+    stage.prepare(kSampleRate, kBlockSize, kSmoothingMs);
+    stage.setCrossfadeTime(2.0f);  // 88.2 samples
+    stage.setOutputGain(0.5f);
+    stage.snapParameters();
+
+    const float increment = crossfadeIncrement(2.0f, kSampleRate);
+    std::vector<float> fromL(kBlockSize, 1.0f);
+    std::vector<float> fromR(kBlockSize, -1.0f);
+    std::vector<float> left(kBlockSize, 0.25f);
+    std::vector<float> right(kBlockSize, 0.5f);
+
+    stage.startCrossfade();
+    REQUIRE(stage.isCrossfading());
+    stage.process(left.data(), right.data(), kBlockSize, fromL.data(), fromR.data());
+    REQUIRE_FALSE(stage.isCrossfading());
+
+    float position = 0.0f;
+    for (size_t i = 0; i < kBlockSize; ++i) {
+        float fadeOut = 0.0f;
+        float fadeIn = 1.0f;
+        if (position < 1.0f) {
+            equalPowerGains(position, fadeOut, fadeIn);
+            position = std::min(position + increment, 1.0f);
+        }
+        REQUIRE(left[i] == Approx(0.5f * (fadeOut * 1.0f + fadeIn * 0.25f)).margin(1e-6f));
+        REQUIRE(right[i] == Approx(0.5f * (fadeOut * -1.0f + fadeIn * 0.5f)).margin(1e-6f));
+    }
+}
+
+TEST_CASE("OutputStage leaves samples past the dry capacity wet", "[primitives][output_stage][layer1]") {
+    constexpr size_t kCapacity = 64;
+    OutputStage stage;
+    stage.prepare(kSampleRate, kCapacity, kSmoothingMs);
+    stage.setMix(0.0f);
+    stage.snapParameters();
+
+    std::vector<float> dryL(2 * kCapacity, 1.0f);
+    std::vector<float> dryR(2 * kCapacity, 1.0f);
+    std::vector<float> left(2 * kCapacity, 0.5f);
+    std::vector<float> right(2 * kCapacity, 0.5f);
+
+    stage.captureDry(dryL.data(), dryR.data(), 2 * kCapacity);
+    stage.process(left.data(), right.data(), 2 * kCapacity);
+
+    REQUIRE(left[0] == 1.0f);
+    REQUIRE(left[kCapacity - 1] == 1.0f);
+    REQUIRE(left[kCapacity] == 0.5f);
+    REQUIRE(right[2 * kCapacity - 1] == 0.5f);
+}
+
+TEST_CASE("OutputStage mono mix matches the stereo mix", "[primitives][output_stage][layer1]") {
+    OutputStage mono;
+    OutputStage stereo;
+    for (auto* stage : {&mono, &stereo}) {
+        stage->prepare(kSampleRate, kBlockSize, kSmoothingMs);
+        stage->setMix(0.9f);
+        stage->snapParameters();
+        stage->setMix(0.3f);
+    }
+
+    const Stereo dry = makeSignal(kBlockSize, 0.7f);
+    Stereo wet = makeSignal(kBlockSize, 1.9f);
+    std::vector<float> monoWet = wet.left;
+
+    mono.captureDry(dry.left.data(), kBlockSize);
+    mono.processMono(monoWet.data(), kBlockSize);
+    stereo.captureDry(dry.left.data(), dry.left.data(), kBlockSize);
+    stereo.process(wet.left.data(), wet.right.data(), kBlockSize);
+
+    // With width 1 the left channel does not depend on the right
+    for (size_t i = 0; i < kBlockSize; ++i) {
+        REQUIRE(monoWet[i] == Approx(wet.left[i]).margin(1e-6f));
+    }
+}
@@ -1,7 +1,7 @@
 // ==============================================================================
 // Layer 1: DSP Primitive - Oversampler Tests
 // ==============================================================================
-// Tests for Oversampler class (2x/4x upsampling/downsampling for anti-aliased
+// Tests for Oversampler class (2x/4x/8x upsampling/downsampling for anti-aliased
 // nonlinear processing).
 // Following Constitution Principle XII: Test-First Development
 // ==============================================================================
@@ -728,15 +728,16 @@ TEST_CASE("Oversampler4x latency values match spec", "[oversampler][latency][spe
         REQUIRE(os.isUsingFir() == false);
     }
 
-    SECTION("Standard + LinearPhase = 30 samples (2 stages * 15)") {
+    // The second stage runs at twice the rate, so it adds half its samples
+    SECTION("Standard + LinearPhase = 23 samples (15 + 7.5, rounded)") {
         os.prepare(44100.0, 512, OversamplingQuality::Standard, OversamplingMode::LinearPhase);
-        REQUIRE(os.getLatency() == 30);
+        REQUIRE(os.getLatency() == 23);
         REQUIRE(os.isUsingFir() == true);
     }
 
-    SECTION("High + LinearPhase = 62 samples (2 stages * 31)") {
+    SECTION("High + LinearPhase = 47 samples (31 + 15.5, rounded)") {
         os.prepare(44100.0, 512, OversamplingQuality::High, OversamplingMode::LinearPhase);
-        REQUIRE(os.getLatency() == 62);
+        REQUIRE(os.getLatency() == 47);
         REQUIRE(os.isUsingFir() == true);
     }
 }
@@ -1140,3 +1141,171 @@ TEST_CASE("Quality modes produce different filter responses", "[oversampler][qua
         REQUIRE(osLinear.isUsingFir() == true);
     }
 }
+
+// =============================================================================
+// Polyphase Halfband Tests
+// =============================================================================
+// Each 2x stage computes only the samples that survive. The FIR polyphase
+// paths must match zero-stuffing/decimating around the full-rate filter.
+
+TEST_CASE("HalfbandFilter polyphase blocks match full-rate filtering", "[oversampler][polyphase]") {
+    constexpr size_t blockSize = 200;
+
+    auto checkFilter = [](auto polyUp, auto polyDown, auto refUp, auto refDown,
+                          const float* coeffs, size_t numCoeffs) {
+        polyUp.setCoefficients(coeffs, numCoeffs);
+        polyDown.setCoefficients(coeffs, numCoeffs);
+        refUp.setCoefficients(coeffs, numCoeffs);
+        refDown.setCoefficients(coeffs, numCoeffs);
+
+        std::array<float, blockSize> input{};
+        std::array<float, blockSize * 2> upsampled{};
+        std::array<float, blockSize * 2> reference{};
+        std::array<float, blockSize> decimated{};
+
+        // Several blocks so history carries across calls
+        for (size_t block = 0; block < 4; ++block) {
+            for (size_t i = 0; i < blockSize; ++i) {
+                const float n = static_cast<float>(block * blockSize + i);
+                input[i] = std::sin(n * 0.37f) + 0.3f * std::cos(n * 1.9f);
+            }
+
+            polyUp.upsampleBlock(input.data(), upsampled.data(), blockSize);
+            for (size_t i = 0; i < blockSize; ++i) {
+                reference[i * 2] = input[i] * 2.0f;
+                reference[i * 2 + 1] = 0.0f;
+            }
+            refUp.processBlock(reference.data(), blockSize * 2);
+
+            for (size_t i = 0; i < blockSize * 2; ++i) {
+                REQUIRE(upsampled[i] == Approx(reference[i]).margin(1e-6f));
+            }
+
+            polyDown.downsampleBlock(upsampled.data(), decimated.data(), blockSize);
+            std::copy(upsampled.begin(), upsampled.end(), reference.begin());
+            refDown.processBlock(reference.data(), blockSize * 2);
+
+            for (size_t i = 0; i < blockSize; ++i) {
+                REQUIRE(decimated[i] == Approx(reference[i * 2]).margin(1e-6f));
+            }
+        }
+    };
+
+    SECTION("Standard (31-tap)") {
+        checkFilter(HalfbandFilterStandard{}, HalfbandFilterStandard{},
+                    HalfbandFilterStandard{}, HalfbandFilterStandard{},
+                    detail::kStandardFirCoeffs.data(), detail::kStandardFirCoeffs.size());
+    }
+
+    SECTION("High (63-tap)") {
+        checkFilter(HalfbandFilterHigh{}, HalfbandFilterHigh{},
+                    HalfbandFilterHigh{}, HalfbandFilterHigh{},
+                    detail::kHighFirCoeffs.data(), detail::kHighFirCoeffs.size());
+    }
+}
+
+TEST_CASE("Economy IIR upsampling rejects images", "[oversampler][polyphase][spectral]") {
+    // A tone zero-stuffed to 88.2kHz images at 44.1kHz minus the tone; the
+    // allpass halfband must leave the image far below the tone
+    constexpr size_t blockSize = 4096;
+    constexpr float sampleRate = 44100.0f;
+
+    // Tone and image both centred on DFT bins of the 2x-rate analysis
+    const float binWidth = sampleRate * 2.0f / static_cast<float>(blockSize);
+    const float toneFreq = 700.0f * binWidth;    // ~15.07kHz
+    const float imageFreq = sampleRate - toneFreq;
+
+    Oversampler2xMono os;
+    os.prepare(sampleRate, blockSize);
+
+    std::array<float, blockSize> input{};
+    std::array<float, blockSize * 2> upsampled{};
+    generateSineWave(input.data(), blockSize, toneFreq, sampleRate);
+    os.upsample(input.data(), upsampled.data(), blockSize);
+
+    // Skip the filter's start-up transient
+    const float* steady = upsampled.data() + blockSize;
+    const float tone = measureMagnitudeAtFrequency(steady, blockSize, toneFreq, sampleRate * 2.0f);
+    const float image = measureMagnitudeAtFrequency(steady, blockSize, imageFreq, sampleRate * 2.0f);
+
+    INFO("Tone: " << toDb(tone) << " dB, image: " << toDb(image) << " dB");
+    REQUIRE(toDb(tone) > -1.0f);
+    REQUIRE(toDb(image) - toDb(tone) < -80.0f);
+}
+
+TEST_CASE("Oversampler8x", "[oversampler][8x]") {
+    constexpr size_t blockSize = 1024;
+    constexpr float sampleRate = 44100.0f;
+
+    SECTION("callback receives 8x samples") {
+        Oversampler8x os;
+        os.prepare(sampleRate, blockSize);
+        REQUIRE(os.getFactor() == 8);
+        REQUIRE(Oversampler8x::numStages() == 3);
+
+        std::array<float, blockSize> left{}, right{};
+        size_t receivedSamples = 0;
+        os.process(left.data(), right.data(), blockSize,
+            [&receivedSamples](float*, float*, size_t n) { receivedSamples = n; });
+
+        REQUIRE(receivedSamples == blockSize * 8);
+    }
+
+    SECTION("preserves passband in both modes") {
+        for (auto mode : {OversamplingMode::ZeroLatency, OversamplingMode::LinearPhase}) {
+            Oversampler8xMono os;
+            os.prepare(sampleRate, blockSize, OversamplingQuality::High, mode);
+
+            std::array<float, blockSize> buffer{};
+            generateSineWave(buffer.data(), blockSize, 5000.0f, sampleRate);
+            const float inputLevel = calculateRMS(buffer.data() + blockSize / 2, blockSize / 2);
+
+            os.process(buffer.data(), blockSize, [](float*, size_t) {});
+
+            const float outputLevel = calculateRMS(buffer.data() + blockSize / 2, blockSize / 2);
+            const float levelDiff = 20.0f * std::log10(outputLevel / inputLevel);
+            INFO("Mode " << static_cast<int>(mode) << ": " << levelDiff << " dB");
+            REQUIRE(std::abs(levelDiff) < 0.1f);
+        }
+    }
+
+    SECTION("LinearPhase latency matches the measured group delay") {
+        // Centroid of the impulse response (symmetric, so equal to its delay)
+        const auto measure = [](auto& os, float& centroid) {
+            constexpr size_t kImpulseAt = 64;
+            std::array<float, blockSize> buffer{};
+            buffer[kImpulseAt] = 1.0f;
+            os.process(buffer.data(), blockSize, [](float*, size_t) {});
+
+            double weighted = 0.0;
+            double sum = 0.0;
+            for (size_t i = 0; i < blockSize; ++i) {
+                weighted += static_cast<double>(i) * buffer[i];
+                sum += buffer[i];
+            }
+            centroid = static_cast<float>(weighted / sum) - static_cast<float>(kImpulseAt);
+        };
+
+        for (auto quality : {OversamplingQuality::Standard, OversamplingQuality::High}) {
+            Oversampler2xMono os2;
+            Oversampler4xMono os4;
+            Oversampler8xMono os8;
+            os2.prepare(sampleRate, blockSize, quality, OversamplingMode::LinearPhase);
+            os4.prepare(sampleRate, blockSize, quality, OversamplingMode::LinearPhase);
+            os8.prepare(sampleRate, blockSize, quality, OversamplingMode::LinearPhase);
+
+            float delay2 = 0.0f;
+            float delay4 = 0.0f;
+            float delay8 = 0.0f;
+            measure(os2, delay2);
+            measure(os4, delay4);
+            measure(os8, delay8);
+
+            INFO("Quality " << static_cast<int>(quality) << ": measured " << delay2 << " / "
+                 << delay4 << " / " << delay8);
+            REQUIRE(std::abs(static_cast<float>(os2.getLatency()) - delay2) <= 0.5f);
+            REQUIRE(std::abs(static_cast<float>(os4.getLatency()) - delay4) <= 0.5f);
+            REQUIRE(std::abs(static_cast<float>(os8.getLatency()) - delay8) <= 0.5f);
+        }
+    }
+}
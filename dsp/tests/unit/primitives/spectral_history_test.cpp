@@ -0,0 +1,156 @@
+// ==============================================================================
+// Layer 1: DSP Primitive Tests - Spectral History
+// ==============================================================================
+// Test-First Development (Constitution Principle XII)
+//
+// Tests for: dsp/include/krate/dsp/primitives/spectral_history.h
+// Reference: specs/033-spectral-delay/spec.md
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <krate/dsp/primitives/spectral_history.h>
+#include <krate/dsp/primitives/delay_line.h>
+
+#include <vector>
+
+using namespace Krate::DSP;
+using Catch::Approx;
+
+namespace {
+
+/// Write frame n with real = n + bin/1000, imag = -(n + bin/1000)
+void writeTestFrame(SpectralHistory& history, size_t frameNumber) {
+    float* re = history.writeReal();
+    float* im = history.writeImag();
+    for (size_t bin = 0; bin < history.numBins(); ++bin) {
+        const float value = static_cast<float>(frameNumber) + static_cast<float>(bin) * 0.001f;
+        re[bin] = value;
+        im[bin] = -value;
+    }
+    history.advance();
+}
+
+} // namespace
+
+// ==============================================================================
+// Lifecycle
+// ==============================================================================
+
+TEST_CASE("SpectralHistory prepare sizes a single contiguous store", "[spectral_history][prepare]") {
+    SpectralHistory history;
+    REQUIRE_FALSE(history.isPrepared());
+
+    history.prepare(513, 86);
+
+    REQUIRE(history.isPrepared());
+    REQUIRE(history.numBins() == 513);
+    REQUIRE(history.maxDelayFrames() == 86);
+    // (maxDelay + 1) frames of real + imag
+    REQUIRE(history.storageSize() == 87 * 2 * 513);
+}
+
+TEST_CASE("SpectralHistory reset clears frames", "[spectral_history][reset]") {
+    SpectralHistory history;
+    history.prepare(8, 4);
+    for (size_t n = 1; n <= 3; ++n) writeTestFrame(history, n);
+
+    history.reset();
+
+    std::vector<float> delays(8, 0.0f);
+    std::vector<float> re(8, 1.0f);
+    std::vector<float> im(8, 1.0f);
+    history.readLinear(delays.data(), re.data(), im.data());
+    for (size_t bin = 0; bin < 8; ++bin) {
+        REQUIRE(re[bin] == 0.0f);
+        REQUIRE(im[bin] == 0.0f);
+    }
+}
+
+// ==============================================================================
+// Reading
+// ==============================================================================
+
+TEST_CASE("SpectralHistory integer delays return the matching frame", "[spectral_history][read]") {
+    SpectralHistory history;
+    history.prepare(4, 6);
+    for (size_t n = 1; n <= 10; ++n) writeTestFrame(history, n);
+
+    // Delay 0 = most recent frame (10), delay 6 = frame 4
+    for (size_t delay = 0; delay <= 6; ++delay) {
+        const float* frame = history.frame(delay);
+        const float expected = static_cast<float>(10 - delay);
+        REQUIRE(frame[0] == Approx(expected));
+        REQUIRE(frame[3] == Approx(expected + 0.003f));
+        REQUIRE(frame[4 + 3] == Approx(-(expected + 0.003f)));
+    }
+}
+
+TEST_CASE("SpectralHistory gathers per-bin fractional delays", "[spectral_history][read]") {
+    SpectralHistory history;
+    history.prepare(4, 8);
+    for (size_t n = 1; n <= 12; ++n) writeTestFrame(history, n);
+
+    const std::vector<float> delays = {0.0f, 1.5f, 3.25f, 100.0f};
+    std::vector<float> re(4);
+    std::vector<float> im(4);
+    history.readLinear(delays.data(), re.data(), im.data());
+
+    REQUIRE(re[0] == Approx(12.0f));
+    REQUIRE(re[1] == Approx(10.5f + 0.001f));
+    REQUIRE(re[2] == Approx(8.75f + 0.002f));
+    REQUIRE(re[3] == Approx(4.0f + 0.003f));  // Clamped to max delay (8)
+    REQUIRE(im[1] == Approx(-(10.5f + 0.001f)));
+}
+
+TEST_CASE("SpectralHistory matches DelayLine::readLinear per bin", "[spectral_history][read]") {
+    // Same frame rate / max delay derivation as SpectralDelay
+    constexpr size_t kNumBins = 17;
+    constexpr double kFrameRate = 44100.0 / 512.0;
+    constexpr float kMaxSeconds = 2.0f;
+
+    std::vector<DelayLine> lines(kNumBins);
+    for (auto& line : lines) line.prepare(kFrameRate, kMaxSeconds);
+
+    SpectralHistory history;
+    history.prepare(kNumBins, lines[0].maxDelaySamples());
+
+    std::vector<float> delays(kNumBins);
+    for (size_t bin = 0; bin < kNumBins; ++bin) {
+        delays[bin] = 0.37f + static_cast<float>(bin) * 10.9f;  // Includes > max
+    }
+
+    std::vector<float> re(kNumBins);
+    std::vector<float> im(kNumBins);
+
+    for (size_t frame = 0; frame < 400; ++frame) {
+        history.readLinear(delays.data(), re.data(), im.data());
+        for (size_t bin = 0; bin < kNumBins; ++bin) {
+            REQUIRE(re[bin] == Approx(lines[bin].readLinear(delays[bin])).margin(1e-5f));
+        }
+
+        float* writeRe = history.writeReal();
+        float* writeIm = history.writeImag();
+        for (size_t bin = 0; bin < kNumBins; ++bin) {
+            const float value = static_cast<float>((frame * 31 + bin * 7) % 97) - 48.0f;
+            lines[bin].write(value);
+            writeRe[bin] = value;
+            writeIm[bin] = 0.0f;
+        }
+        history.advance();
+    }
+}
+
+TEST_CASE("SpectralHistory write() copies and commits a frame", "[spectral_history][write]") {
+    SpectralHistory history;
+    history.prepare(3, 2);
+
+    const std::vector<float> re = {1.0f, 2.0f, 3.0f};
+    const std::vector<float> im = {-1.0f, -2.0f, -3.0f};
+    history.write(re.data(), im.data());
+
+    const float* frame = history.frame(0);
+    REQUIRE(frame[1] == 2.0f);
+    REQUIRE(frame[3 + 2] == -3.0f);
+}
@@ -13,6 +13,7 @@
 
 #include <krate/dsp/primitives/stft.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <numbers>
@@ -568,3 +569,113 @@ TEST_CASE("Full STFT -> modify spectrum -> OLA pipeline", "[stft][ola][integrati
         }
     }
 }
+
+// ==============================================================================
+// Ring Buffer Streaming Tests
+// ==============================================================================
+
+namespace {
+
+/// Stream input through STFT -> OLA in host-sized blocks, the way SpectralDelay
+/// drives it, and return the concatenated OLA output stream.
+std::vector<float> streamRoundTrip(const std::vector<float>& input, size_t fftSize,
+                                   size_t hopSize, size_t blockSize) {
+    STFT stft;
+    stft.prepare(fftSize, hopSize, WindowType::Hann);
+    OverlapAdd ola;
+    ola.prepare(fftSize, hopSize, WindowType::Hann);
+    SpectralBuffer spectrum;
+    spectrum.prepare(fftSize);
+
+    std::vector<float> stream;
+    std::vector<float> block(blockSize);
+    for (size_t pos = 0; pos < input.size(); pos += blockSize) {
+        const size_t n = std::min(blockSize, input.size() - pos);
+        stft.pushSamples(input.data() + pos, n);
+        while (stft.canAnalyze()) {
+            stft.analyze(spectrum);
+            ola.synthesize(spectrum);
+        }
+        const size_t toPull = std::min(n, ola.samplesAvailable());
+        ola.pullSamples(block.data(), toPull);
+        stream.insert(stream.end(), block.begin(), block.begin() + static_cast<std::ptrdiff_t>(toPull));
+    }
+    return stream;
+}
+
+} // anonymous namespace
+
+TEST_CASE("STFT-ISTFT round-trip is independent of host block size",
+          "[stft][ola][roundtrip][ring]") {
+    const size_t fftSize = 4096;
+    const size_t hopSize = 1024;  // 75% overlap
+
+    // Long enough to wrap both rings (8 * fftSize) several times
+    const size_t signalLength = fftSize * 24;
+    std::vector<float> input(signalLength);
+    generateSine(input.data(), signalLength, 440.0f, kTestSampleRate);
+
+    // OLA stream sample k reconstructs input sample k once the first
+    // fftSize samples (partial overlap) have passed
+    const size_t checkStart = fftSize;
+    const size_t checkLength = signalLength - 3 * fftSize;
+
+    // 32/37: many pulls per hop; 8192: several frames synthesized per pull
+    for (size_t blockSize : {size_t{32}, size_t{37}, size_t{1000}, size_t{8192}}) {
+        INFO("block size " << blockSize);
+        const auto stream = streamRoundTrip(input, fftSize, hopSize, blockSize);
+        REQUIRE(stream.size() >= checkStart + checkLength);
+
+        const float error = calculateRelativeError(
+            input.data() + checkStart, stream.data() + checkStart, checkLength);
+        REQUIRE(error < 0.01f);
+    }
+}
+
+TEST_CASE("OverlapAdd pullSamples returns the same stream for any pull size",
+          "[ola][output][ring]") {
+    const size_t fftSize = 1024;
+    const size_t hopSize = 256;
+
+    std::vector<float> input(fftSize * 4);
+    generateSine(input.data(), input.size(), 1000.0f, kTestSampleRate);
+
+    auto run = [&](size_t pullSize) {
+        STFT stft;
+        stft.prepare(fftSize, hopSize, WindowType::Hann);
+        OverlapAdd ola;
+        ola.prepare(fftSize, hopSize, WindowType::Hann);
+        SpectralBuffer spectrum;
+        spectrum.prepare(fftSize);
+
+        // All input at once: every frame is synthesized before the first pull
+        stft.pushSamples(input.data(), input.size());
+        while (stft.canAnalyze()) {
+            stft.analyze(spectrum);
+            ola.synthesize(spectrum);
+        }
+
+        std::vector<float> out;
+        std::vector<float> chunk(pullSize);
+        while (ola.samplesAvailable() > 0) {
+            const size_t n = std::min(pullSize, ola.samplesAvailable());
+            ola.pullSamples(chunk.data(), n);
+            out.insert(out.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(n));
+        }
+        return out;
+    };
+
+    const auto reference = run(hopSize);
+    REQUIRE(reference.size() == ((input.size() - fftSize) / hopSize + 1) * hopSize);
+
+    for (size_t pullSize : {size_t{1}, size_t{31}, size_t{4096}}) {
+        INFO("pull size " << pullSize);
+        const auto out = run(pullSize);
+        REQUIRE(out == reference);
+    }
+
+    // Fully overlapped region reconstructs the input
+    const float error = calculateRelativeError(
+        input.data() + fftSize, reference.data() + fftSize, reference.size() - fftSize);
+    REQUIRE(error < 0.01f);
+}
@@ -1981,3 +1981,144 @@ TEST_CASE("DiffusionNetwork processes correctly with extreme settings", "[diffus
         REQUIRE_FALSE(std::isinf(leftOut[512]));
     }
 }
+
+// ==============================================================================
+// Interleaved Kernel
+// ==============================================================================
+
+namespace {
+
+// Reference for the interleaved kernel: separate L/R AllpassStages with an
+// exact (double phase) sine LFO per stage, as the network used to run
+struct DiffusionReference {
+    DiffusionReference(float size, float modDepth, float modRate)
+        : size_(size), modDepth_(modDepth),
+          increment_(static_cast<double>(kTestTwoPi * modRate / kTestSampleRate)) {
+        const float maxDelaySeconds =
+            (kBaseDelayMs * kDelayRatiosL[kNumDiffusionStages - 1] * kStereoOffset + kMaxModDepthMs) * 0.001f;
+        for (size_t i = 0; i < kNumDiffusionStages; ++i) {
+            left_[i].prepare(kTestSampleRate, maxDelaySeconds);
+            right_[i].prepare(kTestSampleRate, maxDelaySeconds);
+        }
+    }
+
+    void process(float& l, float& r) {
+        for (size_t i = 0; i < kNumDiffusionStages; ++i) {
+            const double phase = increment_ * static_cast<double>(n_) + static_cast<double>(i) * (kTestPi / 4.0);
+            const float modMs = modDepth_ * kMaxModDepthMs * static_cast<float>(std::sin(phase));
+            const float baseMs = kBaseDelayMs * size_ * kDelayRatiosL[i];
+            l = left_[i].process(l, (baseMs + modMs) * 0.001f * kTestSampleRate);
+            r = right_[i].process(r, (baseMs * kStereoOffset + modMs) * 0.001f * kTestSampleRate);
+        }
+        ++n_;
+    }
+
+    std::array<AllpassStage, kNumDiffusionStages> left_;
+    std::array<AllpassStage, kNumDiffusionStages> right_;
+    float size_;
+    float modDepth_;
+    double increment_;
+    size_t n_ = 0;
+};
+
+// Run the network in kTestBlockSize blocks over noise; returns {outL, outR, refL, refR}
+std::array<std::vector<float>, 4> renderAgainstReference(float size, float modDepth, float modRate,
+                                                         size_t numSamples) {
+    DiffusionNetwork diffuser;
+    diffuser.prepare(kTestSampleRate, kTestBlockSize);
+    diffuser.setSize(size * 100.0f);
+    diffuser.setModDepth(modDepth * 100.0f);
+    diffuser.setModRate(modRate);
+    diffuser.reset();
+    DiffusionReference reference(size, modDepth, modRate);
+
+    std::array<std::vector<float>, 4> out;
+    for (auto& v : out) {
+        v.resize(numSamples);
+    }
+    std::vector<float> inL(numSamples);
+    std::vector<float> inR(numSamples);
+    generateWhiteNoise(inL.data(), numSamples, 1);
+    generateWhiteNoise(inR.data(), numSamples, 2);
+
+    for (size_t offset = 0; offset < numSamples; offset += kTestBlockSize) {
+        diffuser.process(inL.data() + offset, inR.data() + offset,
+                         out[0].data() + offset, out[1].data() + offset, kTestBlockSize);
+    }
+    for (size_t n = 0; n < numSamples; ++n) {
+        float l = inL[n];
+        float r = inR[n];
+        reference.process(l, r);
+        out[2][n] = l;
+        out[3][n] = r;
+    }
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("DiffusionNetwork interleaved kernel matches per-stage AllpassStages", "[diffusion][kernel]") {
+    const auto out = renderAgainstReference(0.7f, 0.0f, 1.0f, 8192);
+
+    float maxError = 0.0f;
+    for (size_t n = 0; n < out[0].size(); ++n) {
+        maxError = std::max({maxError, std::abs(out[0][n] - out[2][n]), std::abs(out[1][n] - out[3][n])});
+    }
+    REQUIRE(maxError < 1e-5f);
+}
+
+TEST_CASE("DiffusionNetwork phasor LFO keeps the per-stage sine reference level", "[diffusion][kernel]") {
+    // Modulated allpass-interpolated reads are very sensitive to where each
+    // integer-delay crossing lands, so compare level per channel, not samples
+    const auto out = renderAgainstReference(0.7f, 0.6f, 3.0f, 32768);
+
+    for (size_t ch = 0; ch < 2; ++ch) {
+        double energy = 0.0;
+        double referenceEnergy = 0.0;
+        for (size_t n = 0; n < out[ch].size(); ++n) {
+            REQUIRE(std::isfinite(out[ch][n]));
+            energy += static_cast<double>(out[ch][n]) * out[ch][n];
+            referenceEnergy += static_cast<double>(out[ch + 2][n]) * out[ch + 2][n];
+        }
+        const double levelDb = 10.0 * std::log10(energy / referenceEnergy);
+        INFO("channel " << ch << ": level difference " << levelDb << " dB");
+        REQUIRE(std::abs(levelDb) < 0.5);
+    }
+}
+
+TEST_CASE("DiffusionNetwork stage re-enabled by density starts from silence", "[diffusion][kernel]") {
+    DiffusionNetwork diffuser;
+    diffuser.prepare(kTestSampleRate, kTestBlockSize);
+    diffuser.setSize(100.0f);
+    diffuser.setWidth(100.0f);
+    diffuser.reset();
+
+    std::array<float, kTestBlockSize> inL{};
+    std::array<float, kTestBlockSize> inR{};
+    std::array<float, kTestBlockSize> outL{};
+    std::array<float, kTestBlockSize> outR{};
+
+    // Fill every stage with signal, then drop to 4 stages and let it settle
+    generateWhiteNoise(inL.data(), kTestBlockSize);
+    generateWhiteNoise(inR.data(), kTestBlockSize, 7);
+    diffuser.process(inL.data(), inR.data(), outL.data(), outR.data(), kTestBlockSize);
+    diffuser.setDensity(50.0f);
+    inL.fill(0.0f);
+    inR.fill(0.0f);
+    for (int block = 0; block < 20; ++block) {
+        diffuser.process(inL.data(), inR.data(), outL.data(), outR.data(), kTestBlockSize);
+    }
+
+    // Flush the remaining 4 stages completely
+    for (int block = 0; block < 200; ++block) {
+        diffuser.process(inL.data(), inR.data(), outL.data(), outR.data(), kTestBlockSize);
+    }
+
+    // Bringing the stages back must not replay their old history
+    diffuser.setDensity(100.0f);
+    diffuser.process(inL.data(), inR.data(), outL.data(), outR.data(), kTestBlockSize);
+    for (size_t i = 0; i < kTestBlockSize; ++i) {
+        REQUIRE(std::abs(outL[i]) < 1e-6f);
+        REQUIRE(std::abs(outR[i]) < 1e-6f);
+    }
+}
@@ -1003,3 +1003,77 @@ TEST_CASE("US8: Lookahead helps with limiting accuracy", "[dynamics][US8]") {
     REQUIRE(avgNoLA < thresholdLinear * 2.0f);
     REQUIRE(avgWithLA < thresholdLinear * 2.0f);
 }
+
+// =============================================================================
+// Linked Stereo
+// =============================================================================
+
+TEST_CASE("processStereo with identical channels matches processSample", "[dynamics][stereo]") {
+    for (auto mode : {DynamicsDetectionMode::Peak, DynamicsDetectionMode::RMS}) {
+        for (float lookaheadMs : {0.0f, 2.0f}) {
+            DynamicsProcessor mono;
+            DynamicsProcessor stereo;
+            for (auto* dp : {&mono, &stereo}) {
+                dp->prepare(44100.0, 256);
+                dp->setThreshold(-12.0f);
+                dp->setRatio(8.0f);
+                dp->setKneeWidth(6.0f);
+                dp->setAttackTime(1.0f);
+                dp->setReleaseTime(50.0f);
+                dp->setDetectionMode(mode);
+                dp->setLookahead(lookaheadMs);
+                dp->setSidechainEnabled(true);
+                dp->setMakeupGain(3.0f);
+            }
+
+            // Bursts that move in and out of gain reduction
+            constexpr size_t kNumSamples = 4096;
+            std::vector<float> input(kNumSamples);
+            for (size_t i = 0; i < kNumSamples; ++i) {
+                const float burst = ((i / 700) % 2 == 0) ? 1.0f : 0.05f;
+                input[i] = burst * std::sin(static_cast<float>(i) * 0.07f);
+            }
+
+            std::vector<float> left = input;
+            std::vector<float> right = input;
+            stereo.processStereo(left.data(), right.data(), kNumSamples);
+
+            INFO("mode " << static_cast<int>(mode) << ", lookahead " << lookaheadMs);
+            for (size_t i = 0; i < kNumSamples; ++i) {
+                const float expected = mono.processSample(input[i]);
+                REQUIRE(left[i] == Approx(expected).margin(1e-5f));
+                REQUIRE(right[i] == left[i]);
+            }
+            REQUIRE(stereo.getCurrentGainReduction() == Approx(mono.getCurrentGainReduction()).margin(1e-4f));
+        }
+    }
+}
+
+TEST_CASE("processStereo applies one gain to both channels", "[dynamics][stereo]") {
+    DynamicsProcessor dp;
+    dp.prepare(44100.0, 512);
+    dp.setThreshold(-6.0f);
+    dp.setRatio(100.0f);
+    dp.setAttackTime(0.1f);
+    dp.setDetectionMode(DynamicsDetectionMode::Peak);
+
+    // A loud left channel drives the limiter; the quiet right channel must
+    // be turned down by the same amount instead of passing untouched
+    constexpr size_t kNumSamples = 2048;
+    std::vector<float> inputL(kNumSamples);
+    std::vector<float> inputR(kNumSamples);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        inputL[i] = std::sin(static_cast<float>(i) * 0.05f);
+        inputR[i] = 0.1f * std::sin(static_cast<float>(i) * 0.031f);
+    }
+    std::vector<float> left = inputL;
+    std::vector<float> right = inputR;
+    dp.processStereo(left.data(), right.data(), kNumSamples);
+
+    for (size_t i = 1024; i < kNumSamples; ++i) {
+        if (std::abs(inputL[i]) > 0.1f && std::abs(inputR[i]) > 0.01f) {
+            REQUIRE(right[i] / inputR[i] == Approx(left[i] / inputL[i]).epsilon(1e-4));
+        }
+    }
+    REQUIRE(dp.getCurrentGainReduction() < -3.0f);
+}
@@ -6,8 +6,10 @@
 
 #include <krate/dsp/processors/grain_scheduler.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <vector>
 
 using namespace Krate::DSP;
 using Catch::Approx;
@@ -379,3 +381,56 @@ TEST_CASE("GrainScheduler seed produces reproducible sequence", "[processors][sc
         REQUIRE(foundDifference);
     }
 }
+
+TEST_CASE("GrainScheduler processBlock matches per-sample process", "[processors][scheduler][layer2]") {
+    auto perSampleTriggers = [](SchedulingMode mode, float jitter, float density) {
+        GrainScheduler scheduler;
+        scheduler.prepare(44100.0);
+        scheduler.setMode(mode);
+        scheduler.setJitter(jitter);
+        scheduler.setDensity(density);
+        scheduler.seed(7);
+        std::vector<size_t> triggers;
+        for (size_t i = 0; i < 44100; ++i) {
+            if (scheduler.process()) {
+                triggers.push_back(i);
+            }
+        }
+        return triggers;
+    };
+
+    auto blockTriggers = [](SchedulingMode mode, float jitter, float density, size_t blockSize) {
+        GrainScheduler scheduler;
+        scheduler.prepare(44100.0);
+        scheduler.setMode(mode);
+        scheduler.setJitter(jitter);
+        scheduler.setDensity(density);
+        scheduler.seed(7);
+        std::vector<size_t> triggers;
+        std::vector<size_t> offsets(blockSize);
+        for (size_t start = 0; start < 44100; start += blockSize) {
+            const size_t n = std::min(blockSize, size_t{44100} - start);
+            const size_t count = scheduler.processBlock(n, offsets.data());
+            for (size_t k = 0; k < count; ++k) {
+                triggers.push_back(start + offsets[k]);
+            }
+        }
+        return triggers;
+    };
+
+    for (const float density : {1.0f, 37.0f, 100.0f}) {
+        for (const float jitter : {0.0f, 1.0f}) {
+            const auto expectedAsync = perSampleTriggers(SchedulingMode::Asynchronous, jitter, density);
+            const auto expectedSync = perSampleTriggers(SchedulingMode::Synchronous, jitter, density);
+            REQUIRE_FALSE(expectedAsync.empty());
+
+            for (const size_t blockSize : {size_t{1}, size_t{32}, size_t{37}, size_t{512}}) {
+                INFO("density " << density << ", jitter " << jitter << ", block " << blockSize);
+                REQUIRE(blockTriggers(SchedulingMode::Asynchronous, jitter, density, blockSize) ==
+                        expectedAsync);
+                REQUIRE(blockTriggers(SchedulingMode::Synchronous, jitter, density, blockSize) ==
+                        expectedSync);
+            }
+        }
+    }
+}
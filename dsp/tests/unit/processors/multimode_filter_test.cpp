@@ -666,6 +666,70 @@ TEST_CASE("MultimodeFilter processSample works correctly", "[multimode][sample][
     }
 }
 
+TEST_CASE("MultimodeFilter processSample settles on the smoothed cutoff", "[multimode][sample][US4]") {
+    // processSample hands smoothed parameters to control-rate stages; once
+    // smoothing finishes the response must equal a fixed filter at the target
+    MultimodeFilter filter;
+    filter.prepare(44100.0, 512);
+    filter.setType(FilterType::Lowpass);
+    filter.setSlope(FilterSlope::Slope24dB);
+    filter.setCutoff(500.0f);
+
+    std::vector<float> input(8192);
+    generateWhiteNoise(input.data(), input.size());
+
+    Biquad24dB reference;
+    reference.setButterworth(FilterType::Lowpass, 4000.0f, 44100.0f);
+
+    float maxSettledError = 0.0f;
+    for (size_t i = 0; i < input.size(); ++i) {
+        if (i == 1024) {
+            filter.setCutoff(4000.0f);
+        }
+        const float out = filter.processSample(input[i]);
+        const float expected = reference.process(input[i]);
+        if (i >= 6144) {
+            maxSettledError = std::max(maxSettledError, std::abs(out - expected));
+        }
+        REQUIRE(std::isfinite(out));
+    }
+
+    INFO("Max settled error: " << maxSettledError);
+    REQUIRE(maxSettledError < 1e-3f);
+}
+
+TEST_CASE("MultimodeFilter processSamples matches a processSample loop", "[multimode][sample][US4]") {
+    MultimodeFilter perSample;
+    MultimodeFilter block;
+    for (auto* filter : {&perSample, &block}) {
+        filter->prepare(44100.0, 512);
+        filter->setType(FilterType::Bandpass);
+        filter->setSlope(FilterSlope::Slope24dB);
+        filter->setCutoff(700.0f);
+        filter->setDrive(6.0f);
+    }
+
+    std::vector<float> input(8192);
+    generateWhiteNoise(input.data(), input.size());
+    std::vector<float> output = input;
+
+    // Cutoff moves at 1024 (smoothing fallback), then settles (block kernels)
+    for (size_t offset = 0; offset < input.size(); offset += 256) {
+        if (offset == 1024) {
+            perSample.setCutoff(3000.0f);
+            block.setCutoff(3000.0f);
+        }
+        for (size_t i = offset; i < offset + 256; ++i) {
+            input[i] = perSample.processSample(input[i]);
+        }
+        block.processSamples(output.data() + offset, 256);
+    }
+
+    for (size_t i = 0; i < input.size(); ++i) {
+        REQUIRE(output[i] == input[i]);
+    }
+}
+
 TEST_CASE("MultimodeFilter output is valid", "[multimode][safety]") {
     MultimodeFilter filter;
     filter.prepare(44100.0, 512);
@@ -2127,3 +2127,121 @@ TEST_CASE("PitchShiftProcessor clamps out-of-range parameters", "[pitch][edge][T
         REQUIRE(ratio >= minRatio * 0.99f);
     }
 }
+
+// ==============================================================================
+// Phase Vocoder Quality and Stereo Processing
+// ==============================================================================
+
+TEST_CASE("PhaseVocoder quality sets frame size and latency", "[pitch][quality]") {
+    PitchShiftProcessor shifter;
+    shifter.prepare(kTestSampleRate, kTestBlockSize);
+    shifter.setMode(PitchMode::PhaseVocoder);
+
+    REQUIRE(shifter.getPhaseVocoderQuality() == PhaseVocoderQuality::High);
+    REQUIRE(shifter.getLatencySamples() == 4096);
+
+    shifter.setPhaseVocoderQuality(PhaseVocoderQuality::Medium);
+    REQUIRE(shifter.getLatencySamples() == 2048);
+
+    shifter.setPhaseVocoderQuality(PhaseVocoderQuality::Low);
+    REQUIRE(shifter.getLatencySamples() == 1024);
+
+    // Quality survives prepare()
+    shifter.prepare(48000.0, kTestBlockSize);
+    REQUIRE(shifter.getPhaseVocoderQuality() == PhaseVocoderQuality::Low);
+    REQUIRE(shifter.getLatencySamples() == 1024);
+}
+
+TEST_CASE("PhaseVocoder latency is independent of block size", "[pitch][quality]") {
+    // A unity-ratio impulse should come out exactly getLatencySamples() late
+    for (size_t blockSize : {size_t{64}, size_t{333}, size_t{512}}) {
+        PitchShiftProcessor shifter;
+        shifter.prepare(kTestSampleRate, 512);
+        shifter.setMode(PitchMode::PhaseVocoder);
+        shifter.setPhaseVocoderQuality(PhaseVocoderQuality::Low);
+
+        constexpr size_t numSamples = 4096;
+        std::vector<float> input(numSamples, 0.0f);
+        std::vector<float> output(numSamples, 0.0f);
+        input[100] = 1.0f;
+
+        for (size_t offset = 0; offset < numSamples; offset += blockSize) {
+            const size_t n = std::min(blockSize, numSamples - offset);
+            shifter.process(input.data() + offset, output.data() + offset, n);
+        }
+
+        size_t peakIndex = 0;
+        for (size_t i = 1; i < numSamples; ++i) {
+            if (std::abs(output[i]) > std::abs(output[peakIndex])) peakIndex = i;
+        }
+        INFO("Block size " << blockSize);
+        REQUIRE(peakIndex == 100 + shifter.getLatencySamples());
+    }
+}
+
+TEST_CASE("PhaseVocoder Low quality produces correct pitch shift", "[pitch][quality][SC-001]") {
+    PitchShiftProcessor shifter;
+    shifter.prepare(kTestSampleRate, kTestBlockSize);
+    shifter.setMode(PitchMode::PhaseVocoder);
+    shifter.setPhaseVocoderQuality(PhaseVocoderQuality::Low);
+    shifter.setSemitones(12.0f);
+
+    constexpr size_t numSamples = 16384;
+    std::vector<float> input(numSamples);
+    std::vector<float> output(numSamples);
+    generateSine(input.data(), numSamples, 440.0f, kTestSampleRate);
+
+    for (size_t offset = 0; offset < numSamples; offset += kTestBlockSize) {
+        size_t blockSize = std::min(kTestBlockSize, numSamples - offset);
+        shifter.process(input.data() + offset, output.data() + offset, blockSize);
+    }
+
+    // The short frame leaves hop-rate AM (172Hz sidebands) that fools both
+    // autocorrelation and the FFT peak; zero crossings follow the carrier
+    const float* measureStart = output.data() + numSamples / 2;
+    float detectedFreq = estimateFrequency(measureStart, numSamples / 2, kTestSampleRate);
+
+    float expectedFreq = 880.0f;
+    float tolerance = expectedFreq * 0.00289f;
+    INFO("Detected frequency: " << detectedFreq << " Hz (expected: " << expectedFreq << ")");
+    REQUIRE(detectedFreq == Approx(expectedFreq).margin(tolerance));
+}
+
+TEST_CASE("processStereo matches two mono processors", "[pitch][stereo]") {
+    for (PitchMode mode : {PitchMode::Simple, PitchMode::Granular, PitchMode::PhaseVocoder}) {
+        PitchShiftProcessor stereo;
+        PitchShiftProcessor monoL;
+        PitchShiftProcessor monoR;
+        for (auto* shifter : {&stereo, &monoL, &monoR}) {
+            shifter->prepare(kTestSampleRate, kTestBlockSize);
+            shifter->setMode(mode);
+            shifter->setSemitones(7.0f);
+            shifter->setCents(-20.0f);
+        }
+
+        constexpr size_t numSamples = 8192;
+        std::vector<float> left(numSamples);
+        std::vector<float> right(numSamples);
+        generateSine(left.data(), numSamples, 330.0f, kTestSampleRate);
+        generateWhiteNoise(right.data(), numSamples, 7);
+
+        std::vector<float> stereoL(numSamples);
+        std::vector<float> stereoR(numSamples);
+        std::vector<float> expectedL(numSamples);
+        std::vector<float> expectedR(numSamples);
+
+        for (size_t offset = 0; offset < numSamples; offset += kTestBlockSize) {
+            const size_t n = std::min(kTestBlockSize, numSamples - offset);
+            stereo.processStereo(left.data() + offset, right.data() + offset,
+                                 stereoL.data() + offset, stereoR.data() + offset, n);
+            monoL.process(left.data() + offset, expectedL.data() + offset, n);
+            monoR.process(right.data() + offset, expectedR.data() + offset, n);
+        }
+
+        INFO("Mode " << static_cast<int>(mode));
+        for (size_t i = 0; i < numSamples; ++i) {
+            REQUIRE(stereoL[i] == Approx(expectedL[i]).margin(1e-6f));
+            REQUIRE(stereoR[i] == Approx(expectedR[i]).margin(1e-6f));
+        }
+    }
+}
@@ -13,6 +13,7 @@
 // - US5: Oversampling [US5]
 // - US6: DC Blocking [US6]
 // - US7: Real-Time Safety [US7]
+// - Block shaping engine: fast kernels and gain ramps [engine]
 //
 // Success Criteria tags:
 // - [SC-001] through [SC-008]
@@ -445,6 +446,10 @@ TEST_CASE("US3: Output gain scales final level", "[saturation][US3]") {
     sat0dB.setMix(1.0f);
     sat6dB.setMix(1.0f);
 
+    // Settle the gain smoothers so the measurement excludes the ramp
+    sat0dB.reset();
+    sat6dB.reset();
+
     // Generate same sine wave
     std::vector<float> buf0dB(1024), buf6dB(1024);
     generateSine(buf0dB.data(), 1024, 1000.0f, kSampleRate, 0.5f);
@@ -1021,6 +1026,161 @@ TEST_CASE("US7: Maximum drive produces heavy saturation without overflow", "[sat
     REQUIRE(saturationRatio > 0.5f);  // > 50% of samples near saturation
 }
 
+// ==============================================================================
+// Block Shaping Engine [engine]
+// ==============================================================================
+
+TEST_CASE("Fast kernels stay within kFastMaxError of the reference curves", "[saturation][engine]") {
+    constexpr size_t kNumPoints = 200001;
+    std::vector<float> input(kNumPoints);
+    for (size_t i = 0; i < kNumPoints; ++i) {
+        input[i] = -40.0f + 80.0f * static_cast<float>(i) / static_cast<float>(kNumPoints - 1);
+    }
+
+    for (auto type : {SaturationType::Tape, SaturationType::Tube, SaturationType::Transistor,
+                      SaturationType::Digital, SaturationType::Diode}) {
+        std::vector<float> reference = input;
+        std::vector<float> fast = input;
+        SaturationProcessor::saturateBlock(type, SaturationAccuracy::Reference,
+                                           reference.data(), kNumPoints);
+        SaturationProcessor::saturateBlock(type, SaturationAccuracy::Fast,
+                                           fast.data(), kNumPoints);
+
+        float maxError = 0.0f;
+        for (size_t i = 0; i < kNumPoints; ++i) {
+            maxError = std::max(maxError, std::abs(fast[i] - reference[i]));
+        }
+
+        INFO("Type " << static_cast<int>(type) << " max error: " << maxError);
+        REQUIRE(maxError <= SaturationProcessor::kFastMaxError);
+    }
+}
+
+TEST_CASE("Fast accuracy tracks reference processing end to end", "[saturation][engine]") {
+    for (auto type : {SaturationType::Tape, SaturationType::Tube, SaturationType::Transistor,
+                      SaturationType::Digital, SaturationType::Diode}) {
+        SaturationProcessor reference;
+        SaturationProcessor fast;
+        for (auto* sat : {&reference, &fast}) {
+            sat->prepare(44100.0, 512);
+            sat->setType(type);
+            sat->setInputGain(18.0f);
+            sat->setOutputGain(-6.0f);
+            sat->setMix(0.7f);
+        }
+        fast.setAccuracy(SaturationAccuracy::Fast);
+        REQUIRE(fast.getAccuracy() == SaturationAccuracy::Fast);
+        REQUIRE(reference.getAccuracy() == SaturationAccuracy::Reference);
+
+        std::vector<float> a(512);
+        std::vector<float> b(512);
+        float maxError = 0.0f;
+        for (int block = 0; block < 8; ++block) {
+            for (size_t i = 0; i < 512; ++i) {
+                const float t = static_cast<float>(block * 512 + static_cast<int>(i)) / kSampleRate;
+                a[i] = 0.8f * std::sin(kTwoPi * 220.0f * t);
+            }
+            b = a;
+            reference.process(a.data(), 512);
+            fast.process(b.data(), 512);
+            for (size_t i = 0; i < 512; ++i) {
+                maxError = std::max(maxError, std::abs(a[i] - b[i]));
+            }
+        }
+
+        INFO("Type " << static_cast<int>(type) << " max output difference: " << maxError);
+        REQUIRE(maxError < 1e-3f);
+    }
+}
+
+TEST_CASE("Drive automation ramps per sample across large blocks", "[saturation][engine][SC-005]") {
+    // Digital stays linear at this level, so the output is the input times
+    // the gain trajectory. Holding the end-of-block gain for a whole block
+    // would leave a step of ~0.04 at the block boundary.
+    constexpr size_t kBlockSize = 512;
+    constexpr float kAmplitude = 0.003f;
+    constexpr float kFrequency = 100.0f;
+
+    for (auto accuracy : {SaturationAccuracy::Reference, SaturationAccuracy::Fast}) {
+        SaturationProcessor sat;
+        sat.prepare(44100.0, kBlockSize);
+        sat.setType(SaturationType::Digital);
+        sat.setAccuracy(accuracy);
+        sat.setInputGain(0.0f);
+        sat.setOutputGain(-24.0f);
+        sat.setMix(1.0f);
+        sat.reset();
+
+        std::vector<float> buffer(kBlockSize);
+        float prevSample = 0.0f;
+        float maxDerivative = 0.0f;
+        for (int block = 0; block < 4; ++block) {
+            if (block == 1) {
+                sat.setOutputGain(24.0f);
+            }
+            for (size_t i = 0; i < kBlockSize; ++i) {
+                const float t = static_cast<float>(block * static_cast<int>(kBlockSize)
+                                                   + static_cast<int>(i)) / kSampleRate;
+                buffer[i] = kAmplitude * std::sin(kTwoPi * kFrequency * t);
+            }
+            sat.process(buffer.data(), kBlockSize);
+            for (float s : buffer) {
+                maxDerivative = std::max(maxDerivative, std::abs(s - prevSample));
+                prevSample = s;
+            }
+        }
+
+        // Steepest slope of the settled (+24 dB) sine
+        const float settledSlope = kAmplitude * dbToGain(24.0f) * kTwoPi * kFrequency / kSampleRate;
+        INFO("Max derivative " << maxDerivative << ", settled sine slope " << settledSlope);
+        REQUIRE(maxDerivative < 3.0f * settledSlope);
+    }
+}
+
+TEST_CASE("processSamples matches a processSample loop", "[saturation][engine]") {
+    for (auto type : {SaturationType::Tape, SaturationType::Tube, SaturationType::Diode}) {
+        SaturationProcessor perSample;
+        SaturationProcessor block;
+        for (auto* sat : {&perSample, &block}) {
+            sat->prepare(44100.0, 512);
+            sat->setType(type);
+            sat->setInputGain(6.0f);
+            sat->setMix(0.7f);
+            sat->reset();
+        }
+
+        std::vector<float> expected(4096);
+        for (size_t i = 0; i < expected.size(); ++i) {
+            expected[i] = 0.8f * std::sin(kTwoPi * 220.0f * static_cast<float>(i) / kSampleRate);
+        }
+        std::vector<float> actual = expected;
+
+        // Drive moves at 1024 (smoothing fallback), then settles (block kernel)
+        for (size_t offset = 0; offset < expected.size(); offset += 256) {
+            if (offset == 1024) {
+                perSample.setInputGain(18.0f);
+                block.setInputGain(18.0f);
+            }
+            for (size_t i = offset; i < offset + 256; ++i) {
+                expected[i] = perSample.processSample(expected[i]);
+            }
+            block.processSamples(actual.data() + offset, 256);
+        }
+
+        for (size_t i = 0; i < expected.size(); ++i) {
+            REQUIRE(actual[i] == expected[i]);
+        }
+    }
+}
+
+TEST_CASE("Accuracy accessors are noexcept", "[saturation][engine]") {
+    static_assert(noexcept(std::declval<SaturationProcessor>().setAccuracy(SaturationAccuracy::Fast)));
+    static_assert(noexcept(std::declval<SaturationProcessor>().getAccuracy()));
+    static_assert(noexcept(SaturationProcessor::saturateBlock(
+        SaturationType::Tape, SaturationAccuracy::Fast, nullptr, 0)));
+    SUCCEED("Accuracy API verified noexcept via static_assert");
+}
+
 // ==============================================================================
 // Enumeration Tests
 // ==============================================================================
@@ -1032,3 +1192,8 @@ TEST_CASE("SaturationType enumeration values", "[saturation][enum]") {
     REQUIRE(static_cast<uint8_t>(SaturationType::Digital) == 3);
     REQUIRE(static_cast<uint8_t>(SaturationType::Diode) == 4);
 }
+
+TEST_CASE("SaturationAccuracy enumeration values", "[saturation][enum]") {
+    REQUIRE(static_cast<uint8_t>(SaturationAccuracy::Reference) == 0);
+    REQUIRE(static_cast<uint8_t>(SaturationAccuracy::Fast) == 1);
+}
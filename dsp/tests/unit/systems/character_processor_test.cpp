@@ -17,6 +17,7 @@
 #include <chrono>
 #include <cmath>
 #include <numeric>
+#include <vector>
 
 using Catch::Approx;
 using namespace Krate::DSP;
@@ -1149,6 +1150,123 @@ TEST_CASE("CharacterProcessor BBD mode produces balanced stereo noise from first
     REQUIRE(std::abs(rmsDbL - rmsDbR) < 1.0);
 }
 
+// =============================================================================
+// Per-Channel State Tests
+// =============================================================================
+// Each channel owns its filters, saturators and noise generators, while the
+// wow/flutter LFOs, smoothers and crossfade advance once per block for all
+// channels.
+
+TEST_CASE("CharacterProcessor channels share wow/flutter phase",
+          "[systems][character-processor][tape][stereo]") {
+    constexpr double kSampleRate = 44100.0;
+    constexpr size_t kBlockSize = 512;
+
+    CharacterProcessor character;
+    character.prepare(kSampleRate, kBlockSize);
+    character.setMode(CharacterMode::Tape);
+    character.reset();  // Cancel crossfade
+    character.setTapeHissLevel(-96.0f);
+    character.setTapeWowRate(5.0f);
+    character.setTapeWowDepth(1.0f);
+    character.setTapeFlutterRate(10.0f);
+    character.setTapeFlutterDepth(1.0f);
+
+    std::vector<float> input(kBlockSize);
+    std::vector<float> left(kBlockSize);
+    std::vector<float> right(kBlockSize);
+
+    float maxDifference = 0.0f;
+    for (int block = 0; block < 20; ++block) {
+        generateSine(input.data(), kBlockSize, 440.0f, static_cast<float>(kSampleRate), 0.5f);
+        std::copy(input.begin(), input.end(), left.begin());
+        std::copy(input.begin(), input.end(), right.begin());
+
+        character.processStereo(left.data(), right.data(), kBlockSize);
+
+        for (size_t i = 0; i < kBlockSize; ++i) {
+            maxDifference = std::max(maxDifference, std::abs(left[i] - right[i]));
+        }
+    }
+
+    // Identical input differs only by the (independent) -96 dB hiss
+    INFO("Max L/R difference: " << maxDifference);
+    REQUIRE(maxDifference < 1e-3f);
+}
+
+TEST_CASE("CharacterProcessor filter state does not bleed between channels",
+          "[systems][character-processor][bbd][stereo]") {
+    constexpr double kSampleRate = 44100.0;
+    constexpr size_t kBlockSize = 256;
+
+    CharacterProcessor loaded;
+    CharacterProcessor silent;
+    for (CharacterProcessor* character : {&loaded, &silent}) {
+        character->prepare(kSampleRate, kBlockSize);
+        character->setMode(CharacterMode::BBD);
+        character->reset();  // Cancel crossfade
+        character->setBBDBandwidth(3000.0f);
+    }
+
+    std::vector<float> loadedL(kBlockSize), loadedR(kBlockSize);
+    std::vector<float> silentL(kBlockSize), silentR(kBlockSize);
+
+    for (int block = 0; block < 8; ++block) {
+        generateSine(loadedL.data(), kBlockSize, 1000.0f, static_cast<float>(kSampleRate), 0.9f);
+        std::fill(loadedR.begin(), loadedR.end(), 0.0f);
+        std::fill(silentL.begin(), silentL.end(), 0.0f);
+        std::fill(silentR.begin(), silentR.end(), 0.0f);
+
+        loaded.processStereo(loadedL.data(), loadedR.data(), kBlockSize);
+        silent.processStereo(silentL.data(), silentR.data(), kBlockSize);
+
+        // The right channel only ever sees its own (silent) input plus noise
+        for (size_t i = 0; i < kBlockSize; ++i) {
+            REQUIRE(loadedR[i] == silentR[i]);
+        }
+    }
+}
+
+TEST_CASE("CharacterProcessorMono matches the left channel of CharacterProcessor",
+          "[systems][character-processor][mono]") {
+    constexpr double kSampleRate = 44100.0;
+    constexpr size_t kBlockSize = 128;
+
+    CharacterProcessorMono mono;
+    CharacterProcessor stereo;
+    mono.prepare(kSampleRate, kBlockSize);
+    stereo.prepare(kSampleRate, kBlockSize);
+    STATIC_REQUIRE(CharacterProcessorMono::getNumChannels() == 1);
+    STATIC_REQUIRE(CharacterProcessor::getNumChannels() == 2);
+
+    std::vector<float> monoBuffer(kBlockSize);
+    std::vector<float> left(kBlockSize), right(kBlockSize);
+
+    // Switch modes mid-stream so crossfades are covered too
+    const std::array<CharacterMode, 4> modes = {
+        CharacterMode::Tape, CharacterMode::BBD,
+        CharacterMode::DigitalVintage, CharacterMode::Clean};
+
+    for (int block = 0; block < 64; ++block) {
+        if (block % 16 == 0) {
+            const CharacterMode mode = modes[static_cast<size_t>(block / 16)];
+            mono.setMode(mode);
+            stereo.setMode(mode);
+        }
+
+        generateSine(monoBuffer.data(), kBlockSize, 330.0f, static_cast<float>(kSampleRate), 0.5f);
+        std::copy(monoBuffer.begin(), monoBuffer.end(), left.begin());
+        generateSine(right.data(), kBlockSize, 550.0f, static_cast<float>(kSampleRate), 0.5f);
+
+        mono.process(monoBuffer.data(), kBlockSize);
+        stereo.processStereo(left.data(), right.data(), kBlockSize);
+
+        for (size_t i = 0; i < kBlockSize; ++i) {
+            REQUIRE(monoBuffer[i] == left[i]);
+        }
+    }
+}
+
 // =============================================================================
 // Lifecycle Stress Test
 // =============================================================================
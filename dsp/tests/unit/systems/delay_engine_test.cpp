@@ -15,9 +15,11 @@
 
 #include <krate/dsp/systems/delay_engine.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <numeric>
+#include <vector>
 
 using Catch::Approx;
 using namespace Krate::DSP;
@@ -739,3 +741,83 @@ TEST_CASE("DelayEngine handles tempo=0 (clamps to 20 BPM)", "[delay][systems][ed
     REQUIRE(currentMs <= 10000.0f);
     REQUIRE(currentMs == Approx(3000.0f).margin(10.0f));
 }
+
+// =============================================================================
+// Per-Sample Delay Curve
+// =============================================================================
+
+TEST_CASE("DelayEngine delay curve is block-size independent", "[delay][systems][curve]") {
+    constexpr size_t kNumSamples = 8192;
+    std::vector<float> delayMs(kNumSamples);
+    std::vector<float> inputL(kNumSamples);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        const float t = static_cast<float>(i);
+        delayMs[i] = 5.0f + 4.0f * std::sin(t * 0.002f);
+        inputL[i] = std::sin(t * 0.05f);
+    }
+
+    for (bool stereo : {false, true}) {
+        DelayEngine perSample;
+        DelayEngine block;
+        for (auto* delay : {&perSample, &block}) {
+            delay->prepare(44100.0, 512, 20.0f);
+            delay->setMix(0.7f);
+        }
+        auto ctx = makeTestContext();
+
+        std::vector<float> expectedL = inputL;
+        std::vector<float> expectedR(kNumSamples);
+        std::vector<float> actualL = inputL;
+        std::vector<float> actualR(kNumSamples);
+        for (size_t i = 0; i < kNumSamples; ++i) {
+            expectedR[i] = actualR[i] = -0.5f * inputL[i];
+        }
+
+        for (size_t i = 0; i < kNumSamples; ++i) {
+            if (stereo) {
+                perSample.process(&expectedL[i], &expectedR[i], 1, ctx, &delayMs[i]);
+            } else {
+                perSample.process(&expectedL[i], 1, ctx, &delayMs[i]);
+            }
+        }
+        for (size_t offset = 0; offset < kNumSamples; offset += 512) {
+            if (stereo) {
+                block.process(&actualL[offset], &actualR[offset], 512, ctx, &delayMs[offset]);
+            } else {
+                block.process(&actualL[offset], 512, ctx, &delayMs[offset]);
+            }
+        }
+
+        INFO("stereo " << stereo);
+        for (size_t i = 0; i < kNumSamples; ++i) {
+            REQUIRE(actualL[i] == expectedL[i]);
+            if (stereo) {
+                REQUIRE(actualR[i] == expectedR[i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("DelayEngine delay curve moves the read position every sample", "[delay][systems][curve]") {
+    DelayEngine delay;
+    delay.prepare(44100.0, 1024, 1000.0f);
+    delay.setMix(1.0f);
+    delay.setKillDry(true);
+    auto ctx = makeTestContext();
+
+    // The delay grows half a sample per sample from 441, so an impulse at 0
+    // comes out where n - d(n) = 0, at n = 882 (a fixed delay gives 441)
+    constexpr size_t kNumSamples = 1024;
+    std::vector<float> delayMs(kNumSamples);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        delayMs[i] = (441.0f + 0.5f * static_cast<float>(i)) / 44.1f;
+    }
+    std::vector<float> buffer(kNumSamples);
+    generateImpulse(buffer.data(), kNumSamples);
+
+    delay.process(buffer.data(), kNumSamples, ctx, delayMs.data());
+
+    const auto peak = std::max_element(buffer.begin(), buffer.end());
+    REQUIRE(std::distance(buffer.begin(), peak) == 882);
+    REQUIRE(delay.getCurrentDelayMs() == Approx(delayMs.back()));
+}
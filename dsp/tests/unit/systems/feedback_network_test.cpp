@@ -1767,3 +1767,205 @@ TEST_CASE("FeedbackNetwork cross-feedback works with freeze mode", "[feedback][U
     REQUIRE(leftMax > 0.01f);
     REQUIRE(rightMax > 0.01f);
 }
+
+// =============================================================================
+// Chunked Execution
+// =============================================================================
+
+TEST_CASE("FeedbackNetwork chunked execution matches per-sample execution", "[feedback][chunk]") {
+    // Block size 1 always takes the per-sample path; larger blocks run in
+    // chunks bounded by the delay. Short delays exercise the fallback.
+    for (float delayMs : {0.1f, 1.0f, 20.0f, 250.0f}) {
+        for (bool stereo : {false, true}) {
+            FeedbackNetwork perSample;
+            FeedbackNetwork chunked;
+            for (auto* network : {&perSample, &chunked}) {
+                network->prepare(44100.0, 512, 1000.0f);
+                network->setFeedbackAmount(0.8f);
+                network->setDelayTimeMs(delayMs);
+                network->setFilterEnabled(true);
+                network->setFilterType(FilterType::Lowpass);
+                network->setFilterCutoff(3000.0f);
+                network->setSaturationEnabled(true);
+                network->setSaturationDrive(6.0f);
+                network->setCrossFeedbackAmount(0.4f);
+            }
+            auto ctx = createTestContext();
+
+            constexpr size_t kNumSamples = 44100;
+            std::vector<float> inputL(kNumSamples, 0.0f);
+            for (size_t i = 0; i < 4410; ++i) {
+                inputL[i] = std::sin(static_cast<float>(i) * 0.05f) * 0.8f;
+            }
+            std::vector<float> expectedL = inputL;
+            std::vector<float> expectedR(kNumSamples);
+            std::vector<float> actualL = inputL;
+            std::vector<float> actualR(kNumSamples);
+            for (size_t i = 0; i < kNumSamples; ++i) {
+                expectedR[i] = actualR[i] = -0.5f * inputL[i];
+            }
+
+            const auto changeParameters = [delayMs](FeedbackNetwork& network, size_t position) {
+                if (position == 11025) {
+                    network.setDelayTimeMs(delayMs * 3.0f + 10.0f);
+                    network.setFilterCutoff(800.0f);
+                } else if (position == 22050) {
+                    network.setFeedbackAmount(0.3f);
+                    network.setSaturationDrive(12.0f);
+                    network.setCrossFeedbackAmount(0.9f);
+                } else if (position == 33075) {
+                    network.setFreeze(true);
+                }
+            };
+
+            for (size_t i = 0; i < kNumSamples; ++i) {
+                changeParameters(perSample, i);
+                if (stereo) {
+                    perSample.process(&expectedL[i], &expectedR[i], 1, ctx);
+                } else {
+                    perSample.process(&expectedL[i], 1, ctx);
+                }
+            }
+
+            // Block boundaries land on the parameter changes (multiples of 441)
+            for (size_t offset = 0; offset < kNumSamples; offset += 441) {
+                changeParameters(chunked, offset);
+                if (stereo) {
+                    chunked.process(&actualL[offset], &actualR[offset], 441, ctx);
+                } else {
+                    chunked.process(&actualL[offset], 441, ctx);
+                }
+            }
+
+            INFO("delay " << delayMs << " ms, stereo " << stereo);
+            size_t mismatches = 0;
+            for (size_t i = 0; i < kNumSamples; ++i) {
+                if (actualL[i] != expectedL[i] || (stereo && actualR[i] != expectedR[i])) {
+                    ++mismatches;
+                }
+            }
+            REQUIRE(mismatches == 0);
+        }
+    }
+}
+
+TEST_CASE("FeedbackNetwork per-sample curves are block-size independent", "[feedback][chunk][curve]") {
+    // Vibrato around each base delay, a jump that crossfades half way, a slow
+    // time change that stays under the crossfade threshold and a moving
+    // feedback amount; 0.5 ms keeps most chunks on the frame path
+    for (float baseMs : {0.5f, 20.0f, 250.0f}) {
+        for (bool stereo : {false, true}) {
+            FeedbackNetwork perSample;
+            FeedbackNetwork chunked;
+            for (auto* network : {&perSample, &chunked}) {
+                network->prepare(44100.0, 512, 1000.0f);
+                network->setFilterEnabled(true);
+                network->setFilterType(FilterType::Lowpass);
+                network->setFilterCutoff(3000.0f);
+                network->setSaturationEnabled(true);
+                network->setCrossFeedbackAmount(0.4f);
+            }
+            auto ctx = createTestContext();
+
+            constexpr size_t kNumSamples = 44100;
+            std::vector<float> delayMs(kNumSamples);
+            std::vector<float> modulationMs(kNumSamples);
+            std::vector<float> feedback(kNumSamples);
+            std::vector<float> inputL(kNumSamples, 0.0f);
+            for (size_t i = 0; i < kNumSamples; ++i) {
+                const float t = static_cast<float>(i);
+                const float base = (i < 22050) ? baseMs : baseMs * 3.0f + 10.0f;
+                delayMs[i] = base + 0.5f * std::sin(t * 0.0001f);
+                modulationMs[i] = 0.1f * base * std::sin(t * 0.0007f);
+                feedback[i] = 0.6f + 0.3f * std::sin(t * 0.0002f);
+                if (i < 4410) {
+                    inputL[i] = std::sin(t * 0.05f) * 0.8f;
+                }
+            }
+            std::vector<float> expectedL = inputL;
+            std::vector<float> expectedR(kNumSamples);
+            std::vector<float> actualL = inputL;
+            std::vector<float> actualR(kNumSamples);
+            for (size_t i = 0; i < kNumSamples; ++i) {
+                expectedR[i] = actualR[i] = -0.5f * inputL[i];
+            }
+
+            for (size_t i = 0; i < kNumSamples; ++i) {
+                if (stereo) {
+                    perSample.process(&expectedL[i], &expectedR[i], 1, ctx, &delayMs[i],
+                                      &modulationMs[i], &feedback[i]);
+                } else {
+                    perSample.process(&expectedL[i], 1, ctx, &delayMs[i], &modulationMs[i], &feedback[i]);
+                }
+            }
+            for (size_t offset = 0; offset < kNumSamples; offset += 441) {
+                if (stereo) {
+                    chunked.process(&actualL[offset], &actualR[offset], 441, ctx,
+                                    &delayMs[offset], &modulationMs[offset], &feedback[offset]);
+                } else {
+                    chunked.process(&actualL[offset], 441, ctx, &delayMs[offset],
+                                    &modulationMs[offset], &feedback[offset]);
+                }
+            }
+
+            INFO("base delay " << baseMs << " ms, stereo " << stereo);
+            size_t mismatches = 0;
+            for (size_t i = 0; i < kNumSamples; ++i) {
+                if (actualL[i] != expectedL[i] || (stereo && actualR[i] != expectedR[i])) {
+                    ++mismatches;
+                }
+            }
+            REQUIRE(mismatches == 0);
+        }
+    }
+}
+
+TEST_CASE("FeedbackNetwork modulation curve moves the read position every sample", "[feedback][curve]") {
+    FeedbackNetwork network;
+    network.prepare(44100.0, 1024, 1000.0f);
+    auto ctx = createTestContext();
+
+    // The modulation grows half a sample per sample on top of 441 samples.
+    // Reading before the write puts an impulse at 0 where n - 1 - d(n) = 0,
+    // at n = 884 (a fixed delay gives 442)
+    constexpr size_t kNumSamples = 1024;
+    std::vector<float> delayMs(kNumSamples, 10.0f);
+    std::vector<float> modulationMs(kNumSamples);
+    std::vector<float> feedback(kNumSamples, 0.0f);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        modulationMs[i] = 0.5f * static_cast<float>(i) / 44.1f;
+    }
+    std::vector<float> buffer(kNumSamples, 0.0f);
+    buffer[0] = 1.0f;
+
+    network.process(buffer.data(), kNumSamples, ctx, delayMs.data(), modulationMs.data(),
+                    feedback.data());
+
+    const auto peak = std::max_element(buffer.begin(), buffer.end(),
+                                       [](float a, float b) { return std::abs(a) < std::abs(b); });
+    REQUIRE(std::distance(buffer.begin(), peak) == 884);
+    REQUIRE(network.getCurrentDelayMs() == Approx(10.0f));
+}
+
+TEST_CASE("FeedbackNetwork delay curve crossfades instead of moving the read position",
+          "[feedback][curve]") {
+    FeedbackNetwork network;
+    network.prepare(44100.0, 1024, 1000.0f);
+    auto ctx = createTestContext();
+
+    // The delay time creeps from 441 to 442 samples; like setDelayTimeMs()
+    // that is under the crossfade threshold, so the impulse stays at 442
+    constexpr size_t kNumSamples = 1024;
+    std::vector<float> delayMs(kNumSamples);
+    std::vector<float> feedback(kNumSamples, 0.0f);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        delayMs[i] = (441.0f + static_cast<float>(i) / kNumSamples) / 44.1f;
+    }
+    std::vector<float> buffer(kNumSamples, 0.0f);
+    buffer[0] = 1.0f;
+
+    network.process(buffer.data(), kNumSamples, ctx, delayMs.data(), nullptr, feedback.data());
+
+    REQUIRE(buffer[442] == Approx(1.0f).margin(1e-4));
+    REQUIRE(network.getCurrentDelayMs() == Approx(delayMs.back()));
+}
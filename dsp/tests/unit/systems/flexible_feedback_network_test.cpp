@@ -9,6 +9,8 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <vector>
@@ -994,3 +996,134 @@ TEST_CASE("FlexibleFeedbackNetwork feedback filter", "[systems][flexible-feedbac
     }
 }
 
+
+// ==============================================================================
+// FlexibleFeedbackNetwork Sub-Block Determinism Tests
+// ==============================================================================
+
+namespace {
+
+/// Render a fixed impulse train through a network using the given host block size
+std::vector<float> renderWithBlockSize(std::size_t blockSize, float feedback,
+                                       bool useProcessor, bool useFilter) {
+    constexpr std::size_t kTotalSamples = 16384;
+
+    MockFeedbackProcessor mock;
+    mock.gain = 0.7f;
+
+    FlexibleFeedbackNetwork network;
+    network.prepare(44100.0, 4096);
+    if (useProcessor) {
+        network.setProcessor(&mock);
+        network.setProcessorMix(100.0f);
+    }
+    network.setFilterEnabled(useFilter);
+    network.setFilterCutoff(3000.0f);
+    network.setDelayTimeMs(23.0f);
+    network.setFeedbackAmount(feedback);
+    network.snapParameters();
+
+    std::vector<float> left(kTotalSamples, 0.0f);
+    std::vector<float> right(kTotalSamples, 0.0f);
+    for (std::size_t i = 0; i < kTotalSamples; i += 3001) {
+        left[i] = 1.0f;
+        right[i] = -0.5f;
+    }
+
+    BlockContext ctx;
+    ctx.sampleRate = 44100.0;
+
+    for (std::size_t pos = 0; pos < kTotalSamples; pos += blockSize) {
+        const std::size_t n = std::min(blockSize, kTotalSamples - pos);
+        ctx.blockSize = n;
+        network.process(left.data() + pos, right.data() + pos, n, ctx);
+    }
+
+    return left;
+}
+
+} // namespace
+
+TEST_CASE("FlexibleFeedbackNetwork output is independent of host block size",
+          "[systems][flexible-feedback][subblock]") {
+    for (const bool useProcessor : {false, true}) {
+        for (const float feedback : {0.6f, 1.1f}) {  // 1.1 engages limiter + tanh
+            const auto reference = renderWithBlockSize(4096, feedback, useProcessor, true);
+
+            for (const std::size_t blockSize : {std::size_t{1}, std::size_t{37}, std::size_t{64},
+                                                std::size_t{500}, std::size_t{1024}}) {
+                INFO("processor = " << useProcessor << ", feedback = " << feedback
+                     << ", blockSize = " << blockSize);
+                const auto rendered = renderWithBlockSize(blockSize, feedback, useProcessor, true);
+                REQUIRE(rendered == reference);
+            }
+        }
+    }
+}
+
+TEST_CASE("FlexibleFeedbackNetwork processor runs on every loop pass",
+          "[systems][flexible-feedback][subblock]") {
+    MockFeedbackProcessor mock;
+    mock.gain = 0.5f;
+
+    FlexibleFeedbackNetwork network;
+    network.prepare(44100.0, 512);
+    network.setProcessor(&mock);
+    network.setProcessorMix(100.0f);
+    network.setDelayTimeMs(10.0f);  // 441 samples
+    network.setFeedbackAmount(1.0f);
+    network.snapParameters();
+
+    std::vector<float> left(2048, 0.0f);
+    std::vector<float> right(2048, 0.0f);
+    left[0] = 1.0f;
+
+    BlockContext ctx;
+    ctx.sampleRate = 44100.0;
+    ctx.blockSize = 512;
+    for (std::size_t pos = 0; pos < left.size(); pos += 512) {
+        network.process(left.data() + pos, right.data() + pos, 512, ctx);
+    }
+
+    // Repeats at multiples of the delay, each attenuated by the processor again
+    const auto peakNear = [&left](std::size_t center) {
+        float peak = 0.0f;
+        for (std::size_t i = center - 4; i <= center + 4; ++i) {
+            peak = std::max(peak, std::abs(left[i]));
+        }
+        return peak;
+    };
+
+    REQUIRE(peakNear(441) == Approx(0.5f).margin(0.01f));
+    REQUIRE(peakNear(882) == Approx(0.25f).margin(0.01f));
+    REQUIRE(peakNear(1323) == Approx(0.125f).margin(0.01f));
+
+    // Processor always sees fixed sub-blocks
+    REQUIRE(mock.lastNumSamples == FlexibleFeedbackNetwork::kSubBlockSize);
+}
+
+TEST_CASE("FlexibleFeedbackNetwork benchmark", "[systems][flexible-feedback][benchmark][!benchmark]") {
+    MockFeedbackProcessor mock;
+    mock.gain = 0.9f;
+
+    FlexibleFeedbackNetwork network;
+    network.prepare(44100.0, 512);
+    network.setProcessor(&mock);
+    network.setFilterEnabled(true);
+    network.setDelayTimeMs(250.0f);
+    network.setFeedbackAmount(0.7f);
+    network.snapParameters();
+
+    std::array<float, 512> left{};
+    std::array<float, 512> right{};
+    left[0] = 1.0f;
+
+    BlockContext ctx;
+    ctx.sampleRate = 44100.0;
+    ctx.blockSize = 512;
+
+    BENCHMARK("stereo 512 samples, processor + filter") {
+        network.process(left.data(), right.data(), 512, ctx);
+        return left[0];
+    };
+}
@@ -67,6 +67,34 @@ private:
     float maxValue_;
 };
 
+/// Audio-rate source: renders a linear ramp and counts its block renders
+class RampModulationSource : public ModulationSource {
+public:
+    explicit RampModulationSource(float step) : step_(step) {}
+
+    [[nodiscard]] float getCurrentValue() const noexcept override {
+        return value_;
+    }
+
+    [[nodiscard]] std::pair<float, float> getSourceRange() const noexcept override {
+        return {-1.0f, 1.0f};
+    }
+
+    void processBlock(float* output, size_t numSamples) noexcept override {
+        ++renderCount;
+        for (size_t i = 0; i < numSamples; ++i) {
+            value_ += step_;
+            output[i] = value_;
+        }
+    }
+
+    int renderCount = 0;
+
+private:
+    float step_;
+    float value_ = 0.0f;
+};
+
 } // anonymous namespace
 
 // =============================================================================
@@ -1086,3 +1114,109 @@ TEST_CASE("Depth changes are glitch-free with smoothing", "[modulation][polish]"
     // 5 time constants for 99% = 100ms, so 1.45ms ≈ 7.25% of full transition
     REQUIRE(maxChange < 0.5f); // Conservative limit - smoothing prevents full jumps
 }
+
+// =============================================================================
+// Block Processing: per-sample modulation buffers
+// =============================================================================
+
+TEST_CASE("process() renders per-sample modulation buffers", "[modulation][block]") {
+    ModulationMatrix matrix;
+    matrix.prepare(44100.0, 256, 32);
+
+    RampModulationSource ramp(0.001f);
+    matrix.registerSource(0, &ramp);
+    matrix.registerDestination(0, 0.0f, 100.0f, "Time");
+    matrix.registerDestination(1, 0.0f, 100.0f, "Unrouted");
+    matrix.createRoute(0, 0, 0.5f, ModulationMode::Bipolar);
+
+    matrix.process(256);
+
+    const float* buffer = matrix.getModulationBuffer(0);
+    REQUIRE(buffer != nullptr);
+    for (size_t i = 0; i < 256; ++i) {
+        const float source = 0.001f * static_cast<float>(i + 1);
+        REQUIRE(buffer[i] == Approx(source * 0.5f * 50.0f).margin(1e-4f));
+    }
+
+    // Scalar queries report the end of the block
+    REQUIRE(matrix.getCurrentModulation(0) == Approx(buffer[255]));
+
+    // Destinations without an active route are not rendered
+    REQUIRE(matrix.getModulationBuffer(1) == nullptr);
+    REQUIRE(matrix.getModulationBuffer(200) == nullptr);
+}
+
+TEST_CASE("Each routed source renders once per block", "[modulation][block]") {
+    ModulationMatrix matrix;
+    matrix.prepare(44100.0, 128, 32);
+
+    RampModulationSource ramp(0.01f);
+    matrix.registerSource(0, &ramp);
+    matrix.registerDestination(0, 0.0f, 1.0f, "A");
+    matrix.registerDestination(1, 0.0f, 1.0f, "B");
+    matrix.createRoute(0, 0, 1.0f, ModulationMode::Bipolar);
+    matrix.createRoute(0, 1, 1.0f, ModulationMode::Unipolar);
+
+    matrix.process(128);
+    REQUIRE(ramp.renderCount == 1);
+
+    // Blocks larger than maxBlockSize are processed in chunks
+    matrix.process(300);
+    REQUIRE(ramp.renderCount == 4);
+}
+
+TEST_CASE("Depth smoothing ramps to the one-pole value at block end", "[modulation][block]") {
+    constexpr size_t kBlock = 64;
+    ModulationMatrix matrix;
+    matrix.prepare(44100.0, kBlock, 32);
+
+    MockModulationSource source(1.0f);
+    matrix.registerSource(0, &source);
+    matrix.registerDestination(0, -1.0f, 1.0f, "Test");
+    const int route = matrix.createRoute(0, 0, 0.0f, ModulationMode::Bipolar);
+
+    OnePoleSmoother reference;
+    reference.configure(kModulationSmoothingTimeMs, 44100.0f);
+    reference.snapTo(0.0f);
+
+    matrix.setRouteDepth(route, 1.0f);
+    reference.setTarget(1.0f);
+
+    for (int block = 0; block < 8; ++block) {
+        matrix.process(kBlock);
+        float expected = 0.0f;
+        for (size_t i = 0; i < kBlock; ++i) {
+            expected = reference.process();
+        }
+        REQUIRE(matrix.getRouteDepth(route) == Approx(expected).margin(1e-5f));
+
+        // Within the block, the buffer climbs monotonically (no steps)
+        const float* buffer = matrix.getModulationBuffer(0);
+        REQUIRE(buffer != nullptr);
+        for (size_t i = 1; i < kBlock; ++i) {
+            REQUIRE(buffer[i] >= buffer[i - 1]);
+        }
+    }
+}
+
+TEST_CASE("getModulatedValues() clamps per-sample values to the destination range", "[modulation][block]") {
+    ModulationMatrix matrix;
+    matrix.prepare(44100.0, 64, 32);
+
+    RampModulationSource ramp(1.0f / 32.0f);
+    matrix.registerSource(0, &ramp);
+    matrix.registerDestination(0, 0.0f, 10.0f, "Test");
+    matrix.registerDestination(1, 0.0f, 10.0f, "Unrouted");
+    matrix.createRoute(0, 0, 1.0f, ModulationMode::Bipolar);
+    matrix.process(64);
+
+    std::array<float, 64> values{};
+    matrix.getModulatedValues(0, 5.0f, values.data(), values.size());
+    REQUIRE(values[0] == Approx(5.0f + 5.0f / 32.0f));
+    REQUIRE(values[15] == Approx(7.5f));
+    REQUIRE(values[63] == Approx(10.0f));  // 5 + 10 clamped
+
+    matrix.getModulatedValues(1, 3.0f, values.data(), values.size());
+    REQUIRE(values[0] == 3.0f);
+    REQUIRE(values[63] == 3.0f);
+}
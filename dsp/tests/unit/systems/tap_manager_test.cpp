@@ -956,6 +956,130 @@ TEST_CASE("TapManager: 16 active taps process without dropouts (SC-001)", "[tap-
     }
 }
 
+// =============================================================================
+// Control-Rate Processing Tests
+// =============================================================================
+
+TEST_CASE("TapManager: Feedback is sample-accurate for taps shorter than a control block", "[tap-manager][processing]") {
+    auto tm = createPreparedTapManager();
+
+    // 10-sample tap, well below kTapControlBlockSize
+    tm.setTapEnabled(0, true);
+    tm.setTapTimeMs(0, 10.0f * 1000.0f / kTestSampleRate);
+    tm.setTapLevelDb(0, 0.0f);
+    tm.setTapFeedback(0, 50.0f);
+    tm.setDryWetMix(100.0f);
+    tm.reset();
+
+    auto input = generateImpulse(256);
+    auto outputL = generateSilence(256);
+    auto outputR = generateSilence(256);
+    tm.process(input.data(), input.data(), outputL.data(), outputR.data(), 256);
+
+    const size_t first = findFirstPeak(outputL, 0.1f);
+    REQUIRE(first < 20);
+
+    // Each recirculation arrives one tap period later at half the level
+    for (size_t echo = 1; echo <= 3; ++echo) {
+        const size_t expected = first * (echo + 1);
+        REQUIRE(expected < outputL.size());
+        INFO("echo " << echo << " at " << expected);
+        REQUIRE(outputL[expected] == Approx(outputL[first] * std::pow(0.5f, static_cast<float>(echo))).margin(1e-3f));
+    }
+}
+
+TEST_CASE("TapManager: Silent taps keep tracking their delay time", "[tap-manager][processing]") {
+    auto tm = createPreparedTapManager();
+
+    tm.setTapTimeMs(0, 100.0f);
+    tm.setTapLevelDb(0, 0.0f);
+    tm.setDryWetMix(100.0f);
+    tm.reset();
+
+    // Retime while the tap is disabled (and therefore not rendered)
+    tm.setTapTimeMs(0, 10.0f);
+    auto silence = generateSilence(kTestBlockSize);
+    auto outL = generateSilence(kTestBlockSize);
+    auto outR = generateSilence(kTestBlockSize);
+    for (int block = 0; block < 100; ++block) {
+        tm.process(silence.data(), silence.data(), outL.data(), outR.data(), kTestBlockSize);
+    }
+
+    // Enable and let the level fade in before sending an impulse
+    tm.setTapEnabled(0, true);
+    for (int block = 0; block < 20; ++block) {
+        tm.process(silence.data(), silence.data(), outL.data(), outR.data(), kTestBlockSize);
+    }
+
+    const size_t length = 1024;
+    auto input = generateImpulse(length);
+    auto outputL = generateSilence(length);
+    auto outputR = generateSilence(length);
+    tm.process(input.data(), input.data(), outputL.data(), outputR.data(), length);
+
+    const int64_t peak = static_cast<int64_t>(findFirstPeak(outputL, 0.1f));
+    REQUIRE(std::abs(peak - 441) <= 1);
+}
+
+TEST_CASE("TapManager: Delay scale curve sets the read time per sample", "[tap-manager][processing]") {
+    auto tm = createPreparedTapManager();
+
+    tm.setTapEnabled(0, true);
+    tm.setTapTimeMs(0, 100.0f);
+    tm.setTapLevelDb(0, 0.0f);
+    tm.setDryWetMix(100.0f);
+    tm.reset();
+
+    // Half-speed scale: the 100 ms tap reads at 50 ms
+    const size_t length = 8192;
+    std::vector<float> scale(length, 0.5f);
+    auto input = generateImpulse(length);
+    auto outputL = generateSilence(length);
+    auto outputR = generateSilence(length);
+    tm.process(input.data(), input.data(), outputL.data(), outputR.data(), scale.data(), length);
+
+    const int64_t peak = static_cast<int64_t>(findFirstPeak(outputL, 0.1f));
+    REQUIRE(std::abs(peak - 2205) <= 1);
+
+    // The scale does not change the configured time
+    REQUIRE(tm.getTapTimeMs(0) == Approx(100.0f));
+}
+
+TEST_CASE("TapManager: Filter cutoff sweep settles on the target response", "[tap-manager][processing]") {
+    auto measure = [](TapManager& tm) {
+        // RMS of a 3 kHz tone through the tap after the filter has settled
+        const size_t length = 8192;
+        std::vector<float> input(length);
+        for (size_t i = 0; i < length; ++i) {
+            input[i] = std::sin(2.0f * 3.14159265f * 3000.0f * static_cast<float>(i) / kTestSampleRate);
+        }
+        std::vector<float> outL(length);
+        std::vector<float> outR(length);
+        tm.process(input.data(), input.data(), outL.data(), outR.data(), length);
+        return calculateRMS(std::vector<float>(outL.begin() + length / 2, outL.end()));
+    };
+
+    auto configure = [](TapManager& tm, float cutoff) {
+        tm.setTapEnabled(0, true);
+        tm.setTapTimeMs(0, 1.0f);
+        tm.setTapLevelDb(0, 0.0f);
+        tm.setTapFilterMode(0, TapFilterMode::Lowpass);
+        tm.setTapFilterCutoff(0, cutoff);
+        tm.setDryWetMix(100.0f);
+        tm.reset();
+    };
+
+    auto swept = createPreparedTapManager();
+    configure(swept, 500.0f);
+    swept.setTapFilterCutoff(0, 5000.0f);
+    (void)measure(swept);  // sweep happens here
+
+    auto fixed = createPreparedTapManager();
+    configure(fixed, 5000.0f);
+
+    REQUIRE(measure(swept) == Approx(measure(fixed)).epsilon(0.01));
+}
+
 // =============================================================================
 // Query Tests
 // =============================================================================
@@ -1020,6 +1144,7 @@ TEST_CASE("TapManager: All public methods are noexcept", "[tap-manager][real-tim
     static_assert(noexcept(std::declval<TapManager>().setMasterLevel(0.0f)));
     static_assert(noexcept(std::declval<TapManager>().setDryWetMix(100.0f)));
     static_assert(noexcept(std::declval<TapManager>().process(nullptr, nullptr, nullptr, nullptr, 0)));
+    static_assert(noexcept(std::declval<TapManager>().process(nullptr, nullptr, nullptr, nullptr, nullptr, 0)));
     static_assert(noexcept(std::declval<const TapManager>().isTapEnabled(0)));
     static_assert(noexcept(std::declval<const TapManager>().getPattern()));
     static_assert(noexcept(std::declval<const TapManager>().getActiveTapCount()));
@@ -0,0 +1,319 @@
+#pragma once
+
+// =============================================================================
+// ModeResidency - On-Demand Preparation and Release of Delay Mode Engines
+// =============================================================================
+// Pure logic with no VST3 SDK dependencies.
+// Tracks which delay mode engines hold prepared (allocated) state. Only the
+// active mode, plus the outgoing mode during a crossfade, needs its buffers;
+// every other engine can stay released. That keeps the resident footprint of
+// an instance to one or two engines instead of all eleven.
+//
+// Threading model (lock-free hand-off through one atomic state per mode):
+//   - Audio thread: acquire() a mode before using it, advance() once per slice,
+//     then wake the worker when takeWorkRequest() reports a new request
+//   - Any thread: prefetch() a mode ahead of a switch
+//   - Worker thread: service() prepares requested modes and releases idle ones
+//   - Offline rendering: acquireNow() prepares on the calling thread
+//   - Setup (processing stopped): prepareNow() / releaseAll()
+//
+// An engine is only touched by the audio thread while it is Ready, and only by
+// the worker while it is Preparing or Releasing. Transitions use
+// acquire/release ordering, so the engine's memory is handed over with the state.
+// =============================================================================
+
+#include "delay_mode.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace Iterum {
+
+/// Residency state of a single mode engine
+enum class ModeResidencyState : uint8_t {
+    Released = 0,       ///< No buffers allocated; engine must not be used
+    PrepareRequested,   ///< acquire() or prefetch() asked the worker to prepare it
+    Preparing,          ///< Worker is preparing it
+    Ready,              ///< Prepared; owned by the audio thread
+    ReleaseRequested,   ///< Idle past the timeout; worker may release it
+    Releasing           ///< Worker is releasing it
+};
+
+class ModeResidency {
+public:
+    static constexpr size_t kNumModes = static_cast<size_t>(DelayMode::NumModes);
+
+    /// Default time an engine may sit unused before its memory is released
+    static constexpr double kDefaultReleaseTimeoutSeconds = 5.0;
+
+    ModeResidency() noexcept {
+        for (auto& state : states_) {
+            state.store(ModeResidencyState::Released, std::memory_order_relaxed);
+        }
+        idleSamples_.fill(0);
+    }
+
+    // Non-copyable, non-movable (owns atomics)
+    ModeResidency(const ModeResidency&) = delete;
+    ModeResidency& operator=(const ModeResidency&) = delete;
+
+    /// @brief Set the idle timeout
+    /// @param sampleRate Processing sample rate
+    /// @param timeoutSeconds Idle time before a mode is released
+    void configure(double sampleRate, double timeoutSeconds = kDefaultReleaseTimeoutSeconds) noexcept {
+        releaseTimeoutSamples_ = static_cast<uint64_t>(sampleRate * timeoutSeconds);
+    }
+
+    // =========================================================================
+    // Audio Thread
+    // =========================================================================
+
+    /// @brief Check that a mode can be processed, requesting it if not
+    /// @return true if the engine is Ready (or the mode has no engine)
+    /// @note Real-time safe. When false, the caller keeps using its current
+    ///       mode; the worker prepares the requested one in the background.
+    bool acquire(int mode) noexcept {
+        if (!isValidMode(mode)) {
+            return true;
+        }
+        auto& state = states_[static_cast<size_t>(mode)];
+        idleSamples_[static_cast<size_t>(mode)] = 0;
+
+        ModeResidencyState current = state.load(std::memory_order_acquire);
+        switch (current) {
+            case ModeResidencyState::Ready:
+                return true;
+
+            case ModeResidencyState::ReleaseRequested:
+                // Reclaim before the worker starts releasing it
+                return state.compare_exchange_strong(current, ModeResidencyState::Ready,
+                                                     std::memory_order_acq_rel);
+
+            case ModeResidencyState::Released:
+                if (state.compare_exchange_strong(current, ModeResidencyState::PrepareRequested,
+                                                  std::memory_order_acq_rel)) {
+                    workRequested_.store(true, std::memory_order_release);
+                }
+                return false;
+
+            default:
+                // Preparing / PrepareRequested / Releasing: try again next slice
+                return false;
+        }
+    }
+
+    /// @brief Age idle modes and request release of those past the timeout
+    /// @param numSamples Samples processed since the last call
+    /// @param activeMode Mode currently producing output
+    /// @param fadingMode Mode fading out (same as activeMode when no crossfade)
+    /// @note Real-time safe
+    void advance(size_t numSamples, int activeMode, int fadingMode) noexcept {
+        for (size_t mode = 0; mode < kNumModes; ++mode) {
+            const int m = static_cast<int>(mode);
+            if (m == activeMode || m == fadingMode) {
+                idleSamples_[mode] = 0;
+                continue;
+            }
+
+            auto& state = states_[mode];
+            if (state.load(std::memory_order_relaxed) != ModeResidencyState::Ready) {
+                continue;
+            }
+
+            idleSamples_[mode] += numSamples;
+            if (idleSamples_[mode] >= releaseTimeoutSamples_) {
+                state.store(ModeResidencyState::ReleaseRequested, std::memory_order_release);
+                workRequested_.store(true, std::memory_order_release);
+            }
+        }
+    }
+
+    /// @brief Consume the "worker has something to do" flag
+    /// @return true once after acquire(), prefetch() or advance() posted a request
+    /// @note Real-time safe
+    [[nodiscard]] bool takeWorkRequest() noexcept {
+        return workRequested_.load(std::memory_order_relaxed) &&
+               workRequested_.exchange(false, std::memory_order_acq_rel);
+    }
+
+    /// @brief Make a mode Ready on the calling thread
+    ///
+    /// Used while rendering offline, where a mode switch must not depend on
+    /// when the worker gets to run. Waits if the worker is in the middle of
+    /// preparing or releasing this mode.
+    /// @param prepare Callable (int mode): allocate and prepare the engine
+    /// @note NOT real-time safe (prepare allocates)
+    template <typename PrepareFn>
+    void acquireNow(int mode, PrepareFn&& prepare) {
+        if (!isValidMode(mode)) {
+            return;
+        }
+        auto& state = states_[static_cast<size_t>(mode)];
+        idleSamples_[static_cast<size_t>(mode)] = 0;
+
+        for (;;) {
+            ModeResidencyState current = state.load(std::memory_order_acquire);
+            switch (current) {
+                case ModeResidencyState::Ready:
+                    return;
+
+                case ModeResidencyState::ReleaseRequested:
+                    if (state.compare_exchange_strong(current, ModeResidencyState::Ready,
+                                                      std::memory_order_acq_rel)) {
+                        return;
+                    }
+                    break;
+
+                case ModeResidencyState::Released:
+                case ModeResidencyState::PrepareRequested:
+                    if (state.compare_exchange_strong(current, ModeResidencyState::Preparing,
+                                                      std::memory_order_acquire)) {
+                        prepare(mode);
+                        state.store(ModeResidencyState::Ready, std::memory_order_release);
+                        return;
+                    }
+                    break;
+
+                default:
+                    // Preparing / Releasing: the worker owns the engine
+                    std::this_thread::yield();
+                    break;
+            }
+        }
+    }
+
+    // =========================================================================
+    // Any Thread
+    // =========================================================================
+
+    /// @brief Request preparation of a mode that is about to be switched to
+    /// @note Real-time safe. Does nothing unless the mode is Released; the
+    ///       switch itself still goes through acquire().
+    void prefetch(int mode) noexcept {
+        if (!isValidMode(mode)) {
+            return;
+        }
+        ModeResidencyState expected = ModeResidencyState::Released;
+        if (states_[static_cast<size_t>(mode)].compare_exchange_strong(
+                expected, ModeResidencyState::PrepareRequested, std::memory_order_acq_rel)) {
+            workRequested_.store(true, std::memory_order_release);
+        }
+    }
+
+    // =========================================================================
+    // Worker Thread
+    // =========================================================================
+
+    /// @brief Prepare requested modes and release idle ones
+    /// @param prepare Callable (int mode): allocate and prepare the engine
+    /// @param release Callable (int mode): free the engine's memory
+    /// @return Number of modes whose residency changed
+    /// @note NOT real-time safe (the callables allocate/free)
+    template <typename PrepareFn, typename ReleaseFn>
+    size_t service(PrepareFn&& prepare, ReleaseFn&& release) {
+        size_t changed = 0;
+        for (size_t mode = 0; mode < kNumModes; ++mode) {
+            auto& state = states_[mode];
+
+            ModeResidencyState expected = ModeResidencyState::PrepareRequested;
+            if (state.compare_exchange_strong(expected, ModeResidencyState::Preparing,
+                                              std::memory_order_acquire)) {
+                prepare(static_cast<int>(mode));
+                state.store(ModeResidencyState::Ready, std::memory_order_release);
+                ++changed;
+                continue;
+            }
+
+            expected = ModeResidencyState::ReleaseRequested;
+            if (state.compare_exchange_strong(expected, ModeResidencyState::Releasing,
+                                              std::memory_order_acquire)) {
+                release(static_cast<int>(mode));
+                state.store(ModeResidencyState::Released, std::memory_order_release);
+                ++changed;
+            }
+        }
+        return changed;
+    }
+
+    // =========================================================================
+    // Setup (no audio or worker thread running)
+    // =========================================================================
+
+    /// @brief Prepare a mode synchronously
+    template <typename PrepareFn>
+    void prepareNow(int mode, PrepareFn&& prepare) {
+        if (!isValidMode(mode)) {
+            return;
+        }
+        prepare(mode);
+        idleSamples_[static_cast<size_t>(mode)] = 0;
+        states_[static_cast<size_t>(mode)].store(ModeResidencyState::Ready,
+                                                  std::memory_order_release);
+    }
+
+    /// @brief Release every mode synchronously
+    template <typename ReleaseFn>
+    void releaseAll(ReleaseFn&& release) {
+        for (size_t mode = 0; mode < kNumModes; ++mode) {
+            if (states_[mode].load(std::memory_order_acquire) != ModeResidencyState::Released) {
+                release(static_cast<int>(mode));
+                states_[mode].store(ModeResidencyState::Released, std::memory_order_release);
+            }
+            idleSamples_[mode] = 0;
+        }
+    }
+
+    /// @brief Invoke fn(mode) for every Ready mode
+    template <typename Fn>
+    void forEachReady(Fn&& fn) const {
+        for (size_t mode = 0; mode < kNumModes; ++mode) {
+            if (states_[mode].load(std::memory_order_acquire) == ModeResidencyState::Ready) {
+                fn(static_cast<int>(mode));
+            }
+        }
+    }
+
+    // =========================================================================
+    // Query
+    // =========================================================================
+
+    [[nodiscard]] ModeResidencyState state(int mode) const noexcept {
+        if (!isValidMode(mode)) {
+            return ModeResidencyState::Released;
+        }
+        return states_[static_cast<size_t>(mode)].load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool isReady(int mode) const noexcept {
+        return !isValidMode(mode) || state(mode) == ModeResidencyState::Ready;
+    }
+
+    /// @brief Number of modes currently holding (or building) prepared buffers
+    [[nodiscard]] size_t residentCount() const noexcept {
+        size_t count = 0;
+        for (const auto& state : states_) {
+            const auto value = state.load(std::memory_order_relaxed);
+            if (value != ModeResidencyState::Released &&
+                value != ModeResidencyState::PrepareRequested) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+private:
+    [[nodiscard]] static constexpr bool isValidMode(int mode) noexcept {
+        return mode >= 0 && static_cast<size_t>(mode) < kNumModes;
+    }
+
+    std::array<std::atomic<ModeResidencyState>, kNumModes> states_;
+    std::atomic<bool> workRequested_{false};
+    std::array<uint64_t, kNumModes> idleSamples_{};  ///< Audio thread only
+    uint64_t releaseTimeoutSamples_ =
+        static_cast<uint64_t>(44100.0 * kDefaultReleaseTimeoutSeconds);
+};
+
+} // namespace Iterum
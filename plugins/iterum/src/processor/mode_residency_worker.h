@@ -0,0 +1,172 @@
+#pragma once
+
+// =============================================================================
+// ModeResidencyWorker - Shared Background Thread for Mode Engine Residency
+// =============================================================================
+// Pure logic with no VST3 SDK dependencies.
+// One thread per process services the ModeResidency of every active plugin
+// instance. It sleeps on a condition variable and runs a service pass over
+// all attached instances when woken, so idle instances cost nothing and a
+// session with dozens of instances still has a single worker.
+//
+// Threading model:
+//   - Setup threads: attach() when processing starts, detach() when it stops.
+//     detach() waits for a service pass in progress, so the instance's
+//     engines are never touched by the worker after it returns.
+//   - Audio thread: wake() after ModeResidency::takeWorkRequest(). It sets an
+//     atomic flag and notifies without taking the mutex. A notification lost
+//     between the worker's flag check and its wait is picked up after at most
+//     kWakeTimeout.
+//   - Worker thread: services every attached instance, holding the mutex.
+//
+// The thread starts with the first attached instance and stops when the last
+// one detaches.
+// =============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Iterum {
+
+class ModeResidencyWorker {
+public:
+    /// Identifies an attached instance (0 = not attached)
+    using Handle = uint64_t;
+
+    /// Upper bound on the delay of a lost wake-up
+    static constexpr std::chrono::milliseconds kWakeTimeout{100};
+
+    ModeResidencyWorker() = default;
+
+    ~ModeResidencyWorker() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            clients_.clear();
+            stop_ = true;
+        }
+        condition_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    // Non-copyable, non-movable (owns a thread)
+    ModeResidencyWorker(const ModeResidencyWorker&) = delete;
+    ModeResidencyWorker& operator=(const ModeResidencyWorker&) = delete;
+
+    /// @brief The worker shared by all plugin instances in the process
+    static ModeResidencyWorker& shared() {
+        static ModeResidencyWorker worker;
+        return worker;
+    }
+
+    /// @brief Register an instance's service callback, starting the thread if needed
+    /// @param service Called on the worker thread on every pass
+    /// @return Handle for detach()
+    /// @note NOT real-time safe
+    Handle attach(std::function<void()> service) {
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+
+        Handle handle = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            handle = ++lastHandle_;
+            clients_.push_back({handle, std::move(service)});
+            stop_ = false;
+        }
+        if (!thread_.joinable()) {
+            thread_ = std::thread([this] { run(); });
+        }
+
+        // Pick up requests posted while the instance was detached
+        wake();
+        return handle;
+    }
+
+    /// @brief Unregister an instance, stopping the thread after the last one
+    /// @note NOT real-time safe. Blocks while a service pass is running.
+    void detach(Handle handle) {
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto it = clients_.begin(); it != clients_.end(); ++it) {
+                if (it->handle == handle) {
+                    clients_.erase(it);
+                    break;
+                }
+            }
+            last = clients_.empty();
+            if (last) {
+                stop_ = true;
+            }
+        }
+
+        if (last && thread_.joinable()) {
+            condition_.notify_one();
+            thread_.join();
+        }
+    }
+
+    /// @brief Request a service pass
+    /// @note Real-time safe (no lock; notify only)
+    void wake() noexcept {
+        wakePending_.store(true, std::memory_order_release);
+        condition_.notify_one();
+    }
+
+    /// @brief Number of attached instances
+    [[nodiscard]] size_t clientCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return clients_.size();
+    }
+
+    /// @brief True while the worker thread exists
+    [[nodiscard]] bool isRunning() const {
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        return thread_.joinable();
+    }
+
+private:
+    struct Client {
+        Handle handle;
+        std::function<void()> service;
+    };
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stop_) {
+            condition_.wait_for(lock, kWakeTimeout, [this] {
+                return stop_ || wakePending_.load(std::memory_order_acquire);
+            });
+            if (stop_) {
+                break;
+            }
+            if (!wakePending_.exchange(false, std::memory_order_acq_rel)) {
+                continue;  // Timed out with nothing to do
+            }
+            for (Client& client : clients_) {
+                client.service();
+            }
+        }
+    }
+
+    mutable std::mutex lifecycleMutex_;  ///< Serializes attach()/detach() (thread start/join)
+    mutable std::mutex mutex_;           ///< Guards clients_ and stop_; held during a pass
+    std::condition_variable condition_;
+    std::atomic<bool> wakePending_{false};
+    std::vector<Client> clients_;
+    std::thread thread_;
+    Handle lastHandle_ = 0;
+    bool stop_ = false;
+};
+
+} // namespace Iterum
@@ -0,0 +1,158 @@
+#pragma once
+
+// =============================================================================
+// ParameterEventScheduler - Sample-Accurate Automation Slicing
+// =============================================================================
+// Pure logic with no VST3 SDK dependencies.
+// Collects every point of every host parameter queue for one process() call,
+// orders them by sample offset and walks the block in slices so each change
+// is applied at the sample it was scheduled, or up to kMinSliceSamples - 1
+// samples early (2 * kMinSliceSamples - 1 in the last 2 * kMinSliceSamples of
+// a block). Changes are never applied late.
+//
+// Usage (audio thread, per block):
+//   1. clear(), then push() every queue point
+//   2. sortByOffset()
+//   3. forEachSlice(numSamples, applyFn, processFn)
+//
+// Constitution Principle II: storage is reserved in prepare(); push(),
+// sortByOffset() and forEachSlice() never allocate.
+// =============================================================================
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Iterum {
+
+/// A single automation point taken from a host parameter queue
+struct ParameterEvent {
+    int32_t sampleOffset = 0;  ///< Position within the block
+    uint32_t paramId = 0;      ///< Parameter ID (see plugin_ids.h)
+    double value = 0.0;        ///< Normalized value [0, 1]
+    uint32_t order = 0;        ///< Insertion index (keeps same-offset events in host order)
+};
+
+class ParameterEventScheduler {
+public:
+    /// Default event capacity per block (host queues rarely exceed a few dozen points)
+    static constexpr size_t kDefaultCapacity = 1024;
+
+    /// Shortest slice the scheduler will hand to processFn (except in blocks
+    /// shorter than this). Events closer together than this are applied
+    /// together at the start of the slice that contains them,
+    /// so dense ramps cannot degrade DSP processing to a handful of samples per call.
+    static constexpr size_t kMinSliceSamples = 32;
+
+    ParameterEventScheduler() = default;
+
+    /// @brief Reserve storage for the given number of events per block
+    /// @note NOT real-time safe (allocates memory) - call from setupProcessing()
+    void prepare(size_t capacity = kDefaultCapacity) {
+        events_.assign(capacity, ParameterEvent{});
+        count_ = 0;
+    }
+
+    /// @brief Discard all collected events
+    void clear() noexcept { count_ = 0; }
+
+    /// @brief Append an event
+    /// @return false if the event array is full (event not stored)
+    bool push(int32_t sampleOffset, uint32_t paramId, double value) noexcept {
+        if (count_ >= events_.size()) {
+            return false;
+        }
+        events_[count_] = ParameterEvent{
+            std::max(sampleOffset, int32_t{0}), paramId, value, static_cast<uint32_t>(count_)};
+        ++count_;
+        return true;
+    }
+
+    /// @brief Number of events that can still be pushed this block
+    [[nodiscard]] size_t remaining() const noexcept { return events_.size() - count_; }
+
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+    [[nodiscard]] size_t capacity() const noexcept { return events_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+    [[nodiscard]] const ParameterEvent& operator[](size_t index) const noexcept {
+        return events_[index];
+    }
+
+    /// @brief Order events by sample offset, preserving host order for ties
+    /// @note std::sort with an explicit tie-break instead of std::stable_sort,
+    ///       which may allocate a temporary buffer.
+    void sortByOffset() noexcept {
+        std::sort(events_.begin(), events_.begin() + static_cast<std::ptrdiff_t>(count_),
+                  [](const ParameterEvent& a, const ParameterEvent& b) {
+                      if (a.sampleOffset != b.sampleOffset) {
+                          return a.sampleOffset < b.sampleOffset;
+                      }
+                      return a.order < b.order;
+                  });
+    }
+
+    /// @brief Apply every collected event without slicing (e.g. zero-length blocks)
+    template <typename ApplyFn>
+    void applyAll(ApplyFn&& apply) {
+        for (size_t i = 0; i < count_; ++i) {
+            apply(events_[i].paramId, events_[i].value);
+        }
+        count_ = 0;
+    }
+
+    /// @brief Walk the block in slices split at event offsets
+    ///
+    /// Before each slice, every event before the slice end is applied in
+    /// order. Slices are at least kMinSliceSamples long and never leave a tail
+    /// shorter than that, so an event is never applied late: it is applied at
+    /// its own offset, or early at the start of the slice that contains it.
+    /// The earliness is below kMinSliceSamples, or below 2 * kMinSliceSamples
+    /// once the rest of the block is too short to split. Events at or past
+    /// numSamples are applied after the last slice so the next block starts
+    /// current. Requires sortByOffset() to have been called.
+    ///
+    /// @param numSamples Block length
+    /// @param apply Callable (uint32_t paramId, double value)
+    /// @param process Callable (size_t offset, size_t length)
+    template <typename ApplyFn, typename ProcessFn>
+    void forEachSlice(size_t numSamples, ApplyFn&& apply, ProcessFn&& process) {
+        size_t next = 0;
+        size_t start = 0;
+
+        while (start < numSamples) {
+            // First event after the slice start
+            size_t pending = next;
+            while (pending < count_ && static_cast<size_t>(events_[pending].sampleOffset) <= start) {
+                ++pending;
+            }
+
+            size_t end = numSamples;
+            if (pending < count_ && static_cast<size_t>(events_[pending].sampleOffset) < numSamples &&
+                numSamples - start >= 2 * kMinSliceSamples) {
+                end = std::clamp(static_cast<size_t>(events_[pending].sampleOffset),
+                                 start + kMinSliceSamples, numSamples - kMinSliceSamples);
+            }
+
+            while (next < count_ && static_cast<size_t>(events_[next].sampleOffset) < end) {
+                apply(events_[next].paramId, events_[next].value);
+                ++next;
+            }
+
+            process(start, end - start);
+            start = end;
+        }
+
+        for (; next < count_; ++next) {
+            apply(events_[next].paramId, events_[next].value);
+        }
+        count_ = 0;
+    }
+
+private:
+    std::vector<ParameterEvent> events_;
+    size_t count_ = 0;
+};
+
+} // namespace Iterum
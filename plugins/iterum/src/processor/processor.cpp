@@ -5,6 +5,7 @@
 #include "processor.h"
 #include "plugin_ids.h"
 #include <krate/dsp/core/block_context.h>
+#include <krate/dsp/core/denormal_scope.h>
 
 #include "base/source/fstreamer.h"
 #include "pluginterfaces/vst/ivstparameterchanges.h"
@@ -15,6 +16,15 @@
 
 namespace Iterum {
 
+namespace {
+
+/// Convert the normalized (0-1) mode parameter to a mode index (0-10)
+int modeFromNormalized(Steinberg::Vst::ParamValue value) {
+    return static_cast<int>(value * 10.0 + 0.5);
+}
+
+} // anonymous namespace
+
 // ==============================================================================
 // Constructor
 // ==============================================================================
@@ -25,6 +35,10 @@ Processor::Processor() {
     setControllerClass(kControllerUID);
 }
 
+Processor::~Processor() {
+    stopResidencyWorker();
+}
+
 // ==============================================================================
 // IPluginBase
 // ==============================================================================
@@ -47,6 +61,7 @@ Steinberg::tresult PLUGIN_API Processor::initialize(FUnknown* context) {
 
 Steinberg::tresult PLUGIN_API Processor::terminate() {
     // Cleanup any resources allocated in initialize()
+    stopResidencyWorker();
     return AudioEffect::terminate();
 }
 
@@ -60,43 +75,23 @@ Steinberg::tresult PLUGIN_API Processor::setupProcessing(
     // Store processing parameters
     sampleRate_ = setup.sampleRate;
     maxBlockSize_ = setup.maxSamplesPerBlock;
+    offlineRendering_ = (setup.processMode == Steinberg::Vst::kOffline);
 
     // ==========================================================================
     // Constitution Principle II & VI: Pre-allocate ALL buffers HERE
+    // Only the selected mode's engine is prepared now; the others are prepared
+    // by the residency worker when first requested (see prepareModeEngine()),
+    // or synchronously in process() when rendering offline.
     // ==========================================================================
 
-    // Prepare GranularDelay (spec 034)
-    granularDelay_.prepare(sampleRate_);
-
-    // Prepare SpectralDelay (spec 033)
-    spectralDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_));
-
-    // Prepare DuckingDelay (spec 032)
-    duckingDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_));
-
-    // Prepare ShimmerDelay (spec 029)
-    shimmerDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 5000.0f);
-
-    // Prepare FreezeMode (spec 031)
-    freezeMode_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 5000.0f);
-
-    // Prepare ReverseDelay (spec 030)
-    reverseDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 2000.0f);
-
-    // Prepare TapeDelay (spec 024)
-    tapeDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 2000.0f);
-
-    // Prepare BBDDelay (spec 025)
-    bbdDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 1000.0f);
-
-    // Prepare DigitalDelay (spec 026)
-    digitalDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 10000.0f);
-
-    // Prepare PingPongDelay (spec 027)
-    pingPongDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 10000.0f);
-
-    // Prepare MultiTapDelay (spec 028)
-    multiTapDelay_.prepare(sampleRate_, static_cast<size_t>(maxBlockSize_), 5000.0f);
+    // Processing is inactive here, so the worker is stopped and every engine
+    // can be handled synchronously. Engines prepared for a previous setup are
+    // released because sample rate and block size may have changed.
+    stopResidencyWorker();
+    modeResidency_.configure(sampleRate_);
+    modeResidency_.releaseAll([this](int mode) { releaseModeEngine(mode); });
+    modeResidency_.prepareNow(mode_.load(std::memory_order_relaxed),
+                              [this](int mode) { prepareModeEngine(mode); });
 
     // ==========================================================================
     // Allocate Mode Crossfade Buffers (spec 041-mode-switch-clicks)
@@ -109,32 +104,28 @@ Steinberg::tresult PLUGIN_API Processor::setupProcessing(
     std::fill(crossfadeBufferL_.begin(), crossfadeBufferL_.end(), 0.0f);
     std::fill(crossfadeBufferR_.begin(), crossfadeBufferR_.end(), 0.0f);
 
-    // Calculate crossfade increment for 50ms transition
-    crossfadeIncrement_ = Krate::DSP::crossfadeIncrement(kCrossfadeTimeMs, sampleRate_);
-
-    // Initialize crossfade state as complete (no crossfade in progress)
-    crossfadePosition_ = 1.0f;
-    crossfadeActive_ = false;
+    // 50ms crossfade, no crossfade in progress; output gain starts at its
+    // current value
+    outputStage_.prepare(sampleRate_, 0);
+    outputStage_.setCrossfadeTime(kCrossfadeTimeMs);
+    outputStage_.setOutputGain(gain_.load(std::memory_order_relaxed));
+    outputStage_.reset();
     currentProcessingMode_ = mode_.load(std::memory_order_relaxed);
     previousMode_ = currentProcessingMode_;
 
+    // Reserve the per-block automation event array (sample-accurate automation)
+    paramScheduler_.prepare(ParameterEventScheduler::kDefaultCapacity);
+
     return AudioEffect::setupProcessing(setup);
 }
 
 Steinberg::tresult PLUGIN_API Processor::setActive(Steinberg::TBool state) {
     if (state) {
-        // Activating: reset any processing state
-        granularDelay_.reset();
-        spectralDelay_.reset();
-        duckingDelay_.reset();
-        freezeMode_.reset();
-        reverseDelay_.reset();
-        shimmerDelay_.reset();
-        tapeDelay_.reset();
-        bbdDelay_.reset();
-        digitalDelay_.reset();
-        pingPongDelay_.reset();
-        multiTapDelay_.reset();
+        // Activating: reset processing state of the prepared engines
+        modeResidency_.forEachReady([this](int mode) { resetModeEngine(mode); });
+        startResidencyWorker();
+    } else {
+        stopResidencyWorker();
     }
 
     return AudioEffect::setActive(state);
@@ -150,30 +141,39 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
     // - This function MUST complete within the buffer duration
     // ==========================================================================
 
-    // Process parameter changes first
+    // FTZ/DAZ for the whole callback; restores the host's mode on return
+    const Krate::DSP::ScopedFlushToZero denormalScope;
+
+    // Collect parameter changes first (applied sample-accurately below)
+    paramScheduler_.clear();
     if (data.inputParameterChanges) {
         processParameterChanges(data.inputParameterChanges);
     }
+    paramScheduler_.sortByOffset();
+
+    const auto applyChange = [this](Steinberg::Vst::ParamID id, Steinberg::Vst::ParamValue value) {
+        applyParameterChange(id, value);
+    };
 
     // Check if we have audio to process
     if (data.numSamples == 0) {
+        // Parameter flush: apply everything immediately
+        paramScheduler_.applyAll(applyChange);
         return Steinberg::kResultTrue;
     }
 
-    // Get current parameter values (atomic reads are lock-free)
-    const float currentGain = gain_.load(std::memory_order_relaxed);
-    // Note: bypass handling removed - DAWs provide their own bypass functionality
-
     // ==========================================================================
     // Main Audio Processing
     // ==========================================================================
 
     // Verify we have valid stereo I/O
     if (data.numInputs == 0 || data.numOutputs == 0) {
+        paramScheduler_.applyAll(applyChange);
         return Steinberg::kResultTrue;
     }
 
     if (data.inputs[0].numChannels < 2 || data.outputs[0].numChannels < 2) {
+        paramScheduler_.applyAll(applyChange);
         return Steinberg::kResultTrue;
     }
 
@@ -183,6 +183,7 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
     float* outputR = data.outputs[0].channelBuffers32[1];
 
     if (!inputL || !inputR || !outputL || !outputR) {
+        paramScheduler_.applyAll(applyChange);
         return Steinberg::kResultTrue;
     }
 
@@ -200,12 +201,36 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
         isPlaying = (data.processContext->state & Steinberg::Vst::ProcessContext::kPlaying) != 0;
     }
 
-    Krate::DSP::BlockContext ctx{
-        .sampleRate = sampleRate_,
-        .blockSize = static_cast<size_t>(data.numSamples),
-        .tempoBPM = tempoBPM,
-        .isPlaying = isPlaying
-    };
+    // ==========================================================================
+    // Sample-Accurate Automation
+    // Split the block at parameter event offsets (minimum slice length
+    // ParameterEventScheduler::kMinSliceSamples) and process each slice with
+    // every change scheduled inside it already applied (early, never late).
+    // ==========================================================================
+
+    paramScheduler_.forEachSlice(
+        static_cast<size_t>(data.numSamples), applyChange,
+        [&](size_t offset, size_t length) {
+            const Krate::DSP::BlockContext ctx{
+                .sampleRate = sampleRate_,
+                .blockSize = length,
+                .tempoBPM = tempoBPM,
+                .isPlaying = isPlaying
+            };
+            processSlice(inputL + offset, inputR + offset,
+                         outputL + offset, outputR + offset, length, ctx);
+        });
+
+    return Steinberg::kResultTrue;
+}
+
+void Processor::processSlice(const float* inputL, const float* inputR,
+                             float* outputL, float* outputR, size_t numSamples,
+                             const Krate::DSP::BlockContext& ctx) {
+    // Get current parameter values (atomic reads are lock-free); the output
+    // stage ramps to a new gain per sample
+    outputStage_.setOutputGain(gain_.load(std::memory_order_relaxed));
+    // Note: bypass handling removed - DAWs provide their own bypass functionality
 
     // ==========================================================================
     // Mode Crossfade Processing (spec 041-mode-switch-clicks)
@@ -213,17 +238,27 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
     // ==========================================================================
 
     const int requestedMode = mode_.load(std::memory_order_relaxed);
-    const size_t numSamples = static_cast<size_t>(data.numSamples);
 
-    // Check for mode change and initiate crossfade if needed
+    // Check for mode change and initiate crossfade if needed. A mode whose
+    // engine is not prepared yet is requested from the residency worker; the
+    // current mode keeps playing until it is ready. Offline renders prepare it
+    // here instead, so the switch lands on the same sample on every bounce.
     if (requestedMode != currentProcessingMode_) {
-        previousMode_ = currentProcessingMode_;
-        currentProcessingMode_ = requestedMode;
-        crossfadePosition_ = 0.0f;
-        crossfadeActive_ = true;
+        bool ready = true;
+        if (offlineRendering_) {
+            modeResidency_.acquireNow(requestedMode, [this](int mode) { prepareModeEngine(mode); });
+        } else {
+            ready = modeResidency_.acquire(requestedMode);
+        }
+
+        if (ready) {
+            previousMode_ = currentProcessingMode_;
+            currentProcessingMode_ = requestedMode;
+            outputStage_.startCrossfade();
+        }
     }
 
-    if (crossfadeActive_) {
+    if (outputStage_.isCrossfading()) {
         // =======================================================================
         // Crossfade Active: Process both modes and blend (T022-T024)
         // =======================================================================
@@ -235,38 +270,34 @@ Steinberg::tresult PLUGIN_API Processor::process(Steinberg::Vst::ProcessData& da
         processMode(previousMode_, inputL, inputR,
                    crossfadeBufferL_.data(), crossfadeBufferR_.data(), numSamples, ctx);
 
-        // Apply equal-power crossfade sample-by-sample
-        for (size_t i = 0; i < numSamples; ++i) {
-            float fadeOut, fadeIn;
-            Krate::DSP::equalPowerGains(crossfadePosition_, fadeOut, fadeIn);
-
-            // Blend: old mode (fading out) + new mode (fading in)
-            outputL[i] = crossfadeBufferL_[i] * fadeOut + outputL[i] * fadeIn;
-            outputR[i] = crossfadeBufferR_[i] * fadeOut + outputR[i] * fadeIn;
-
-            // Advance crossfade position
-            crossfadePosition_ += crossfadeIncrement_;
-            if (crossfadePosition_ >= 1.0f) {
-                crossfadePosition_ = 1.0f;
-                crossfadeActive_ = false;
-                // Remaining samples in this block are processed without crossfade
-                // (already in outputL/outputR from processMode)
-            }
-        }
+        // Equal-power blend of old mode (fading out) and new mode (fading in)
+        // plus output gain, in one pass. Samples after the crossfade completes
+        // keep the new mode's output.
+        outputStage_.process(outputL, outputR, numSamples,
+                             crossfadeBufferL_.data(), crossfadeBufferR_.data());
     } else {
         // =======================================================================
-        // No Crossfade: Process single mode directly
+        // No Crossfade: Process single mode directly, then output gain
         // =======================================================================
         processMode(currentProcessingMode_, inputL, inputR, outputL, outputR, numSamples, ctx);
+        outputStage_.process(outputL, outputR, numSamples);
     }
 
-    // Apply output gain
-    for (Steinberg::int32 i = 0; i < data.numSamples; ++i) {
-        outputL[i] *= currentGain;
-        outputR[i] *= currentGain;
+    // Age modes that are neither playing nor fading out
+    modeResidency_.advance(numSamples, currentProcessingMode_,
+                           outputStage_.isCrossfading() ? previousMode_ : currentProcessingMode_);
+
+    // Hand new prepare/release requests to the shared worker. Offline renders
+    // service them here so releases happen at the same point on every bounce.
+    if (modeResidency_.takeWorkRequest()) {
+        if (offlineRendering_) {
+            modeResidency_.service(
+                [this](int mode) { prepareModeEngine(mode); },
+                [this](int mode) { releaseModeEngine(mode); });
+        } else {
+            ModeResidencyWorker::shared().wake();
+        }
     }
-
-    return Steinberg::kResultTrue;
 }
 
 Steinberg::tresult PLUGIN_API Processor::setBusArrangements(
@@ -334,6 +365,15 @@ Steinberg::tresult PLUGIN_API Processor::setState(Steinberg::IBStream* state) {
     Steinberg::int32 mode = 0;
     if (streamer.readInt32(mode)) {
         mode_.store(mode, std::memory_order_relaxed);
+
+        // Start preparing the restored mode's engine before process() switches
+        // (offline renders prepare it in process() instead)
+        if (!offlineRendering_) {
+            modeResidency_.prefetch(mode);
+            if (modeResidency_.takeWorkRequest()) {
+                ModeResidencyWorker::shared().wake();
+            }
+        }
     }
 
     // Restore mode-specific parameter packs
@@ -372,86 +412,109 @@ void Processor::processParameterChanges(Steinberg::Vst::IParameterChanges* chang
         const Steinberg::Vst::ParamID paramId = paramQueue->getParameterId();
         const Steinberg::int32 numPoints = paramQueue->getPointCount();
 
-        // Get the last value (most recent)
-        Steinberg::int32 sampleOffset = 0;
-        Steinberg::Vst::ParamValue value = 0.0;
-
-        if (paramQueue->getPoint(numPoints - 1, sampleOffset, value)
-            != Steinberg::kResultTrue) {
+        if (numPoints <= 0) {
             continue;
         }
 
-        // =======================================================================
-        // Route parameter changes by ID range
-        // Constitution Principle V: Values are normalized 0.0 to 1.0
-        // =======================================================================
-
-        if (paramId < kGranularBaseId) {
-            // Global parameters (0-99)
-            switch (paramId) {
-                case kGainId:
-                    // Convert normalized to linear gain (0.0 to 2.0 range)
-                    gain_.store(static_cast<float>(value * 2.0),
-                               std::memory_order_relaxed);
-                    break;
-
-                // Note: kBypassId removed - DAWs provide their own bypass functionality
-
-                case kModeId:
-                    // Convert normalized (0-1) to mode index (0-10)
-                    mode_.store(static_cast<int>(value * 10.0 + 0.5),
-                               std::memory_order_relaxed);
-                    break;
-
-                default:
-                    break;
+        // Queue every point at its sample offset. If the event array cannot
+        // hold the whole queue, fall back to applying its last (most recent)
+        // value for the entire block.
+        if (static_cast<size_t>(numPoints) > paramScheduler_.remaining()) {
+            Steinberg::int32 sampleOffset = 0;
+            Steinberg::Vst::ParamValue value = 0.0;
+            if (paramQueue->getPoint(numPoints - 1, sampleOffset, value)
+                == Steinberg::kResultTrue) {
+                applyParameterChange(paramId, value);
             }
+            continue;
         }
-        else if (paramId >= kGranularBaseId && paramId <= kGranularEndId) {
-            // Granular Delay parameters (100-199) - spec 034
-            handleGranularParamChange(granularParams_, paramId, value);
-        }
-        else if (paramId >= kSpectralBaseId && paramId <= kSpectralEndId) {
-            // Spectral Delay parameters (200-299) - spec 033
-            handleSpectralParamChange(spectralParams_, paramId, value);
-        }
-        else if (paramId >= kShimmerBaseId && paramId <= kShimmerEndId) {
-            // Shimmer Delay parameters (300-399) - spec 029
-            handleShimmerParamChange(shimmerParams_, paramId, value);
-        }
-        else if (paramId >= kTapeBaseId && paramId <= kTapeEndId) {
-            // Tape Delay parameters (400-499) - spec 024
-            handleTapeParamChange(tapeParams_, paramId, value);
-        }
-        else if (paramId >= kBBDBaseId && paramId <= kBBDEndId) {
-            // BBD Delay parameters (500-599) - spec 025
-            handleBBDParamChange(bbdParams_, paramId, value);
-        }
-        else if (paramId >= kDigitalBaseId && paramId <= kDigitalEndId) {
-            // Digital Delay parameters (600-699) - spec 026
-            handleDigitalParamChange(digitalParams_, paramId, value);
-        }
-        else if (paramId >= kPingPongBaseId && paramId <= kPingPongEndId) {
-            // PingPong Delay parameters (700-799) - spec 027
-            handlePingPongParamChange(pingPongParams_, paramId, value);
-        }
-        else if (paramId >= kReverseBaseId && paramId <= kReverseEndId) {
-            // Reverse Delay parameters (800-899) - spec 030
-            handleReverseParamChange(reverseParams_, paramId, value);
-        }
-        else if (paramId >= kMultiTapBaseId && paramId <= kMultiTapEndId) {
-            // MultiTap Delay parameters (900-999) - spec 028
-            handleMultiTapParamChange(multiTapParams_, paramId, value);
-        }
-        else if (paramId >= kFreezeBaseId && paramId <= kFreezeEndId) {
-            // Freeze Mode parameters (1000-1099) - spec 031
-            handleFreezeParamChange(freezeParams_, paramId, value);
+
+        for (Steinberg::int32 point = 0; point < numPoints; ++point) {
+            Steinberg::int32 sampleOffset = 0;
+            Steinberg::Vst::ParamValue value = 0.0;
+            if (paramQueue->getPoint(point, sampleOffset, value)
+                == Steinberg::kResultTrue) {
+                paramScheduler_.push(sampleOffset, paramId, value);
+
+                // Mode changes later in the block: start preparing the engine now
+                if (paramId == kModeId && !offlineRendering_) {
+                    modeResidency_.prefetch(modeFromNormalized(value));
+                }
+            }
         }
-        else if (paramId >= kDuckingBaseId && paramId <= kDuckingEndId) {
-            // Ducking Delay parameters (1100-1199) - spec 032
-            handleDuckingParamChange(duckingParams_, paramId, value);
+    }
+}
+
+void Processor::applyParameterChange(Steinberg::Vst::ParamID paramId,
+                                     Steinberg::Vst::ParamValue value) {
+    // =======================================================================
+    // Route parameter changes by ID range
+    // Constitution Principle V: Values are normalized 0.0 to 1.0
+    // =======================================================================
+
+    if (paramId < kGranularBaseId) {
+        // Global parameters (0-99)
+        switch (paramId) {
+            case kGainId:
+                // Convert normalized to linear gain (0.0 to 2.0 range)
+                gain_.store(static_cast<float>(value * 2.0),
+                           std::memory_order_relaxed);
+                break;
+
+            // Note: kBypassId removed - DAWs provide their own bypass functionality
+
+            case kModeId:
+                mode_.store(modeFromNormalized(value), std::memory_order_relaxed);
+                break;
+
+            default:
+                break;
         }
     }
+    else if (paramId >= kGranularBaseId && paramId <= kGranularEndId) {
+        // Granular Delay parameters (100-199) - spec 034
+        handleGranularParamChange(granularParams_, paramId, value);
+    }
+    else if (paramId >= kSpectralBaseId && paramId <= kSpectralEndId) {
+        // Spectral Delay parameters (200-299) - spec 033
+        handleSpectralParamChange(spectralParams_, paramId, value);
+    }
+    else if (paramId >= kShimmerBaseId && paramId <= kShimmerEndId) {
+        // Shimmer Delay parameters (300-399) - spec 029
+        handleShimmerParamChange(shimmerParams_, paramId, value);
+    }
+    else if (paramId >= kTapeBaseId && paramId <= kTapeEndId) {
+        // Tape Delay parameters (400-499) - spec 024
+        handleTapeParamChange(tapeParams_, paramId, value);
+    }
+    else if (paramId >= kBBDBaseId && paramId <= kBBDEndId) {
+        // BBD Delay parameters (500-599) - spec 025
+        handleBBDParamChange(bbdParams_, paramId, value);
+    }
+    else if (paramId >= kDigitalBaseId && paramId <= kDigitalEndId) {
+        // Digital Delay parameters (600-699) - spec 026
+        handleDigitalParamChange(digitalParams_, paramId, value);
+    }
+    else if (paramId >= kPingPongBaseId && paramId <= kPingPongEndId) {
+        // PingPong Delay parameters (700-799) - spec 027
+        handlePingPongParamChange(pingPongParams_, paramId, value);
+    }
+    else if (paramId >= kReverseBaseId && paramId <= kReverseEndId) {
+        // Reverse Delay parameters (800-899) - spec 030
+        handleReverseParamChange(reverseParams_, paramId, value);
+    }
+    else if (paramId >= kMultiTapBaseId && paramId <= kMultiTapEndId) {
+        // MultiTap Delay parameters (900-999) - spec 028
+        handleMultiTapParamChange(multiTapParams_, paramId, value);
+    }
+    else if (paramId >= kFreezeBaseId && paramId <= kFreezeEndId) {
+        // Freeze Mode parameters (1000-1099) - spec 031
+        handleFreezeParamChange(freezeParams_, paramId, value);
+    }
+    else if (paramId >= kDuckingBaseId && paramId <= kDuckingEndId) {
+        // Ducking Delay parameters (1100-1199) - spec 032
+        handleDuckingParamChange(duckingParams_, paramId, value);
+    }
 }
 
 // ==============================================================================
@@ -468,272 +531,272 @@ void Processor::processMode(int mode, const float* inputL, const float* inputR,
     switch (static_cast<DelayMode>(mode)) {
         case DelayMode::Granular:
             // Update Granular parameters
-            granularDelay_.setGrainSize(granularParams_.grainSize.load(std::memory_order_relaxed));
-            granularDelay_.setDensity(granularParams_.density.load(std::memory_order_relaxed));
-            granularDelay_.setDelayTime(granularParams_.delayTime.load(std::memory_order_relaxed));
-            granularDelay_.setPitch(granularParams_.pitch.load(std::memory_order_relaxed));
-            granularDelay_.setPitchSpray(granularParams_.pitchSpray.load(std::memory_order_relaxed));
-            granularDelay_.setPositionSpray(granularParams_.positionSpray.load(std::memory_order_relaxed));
-            granularDelay_.setPanSpray(granularParams_.panSpray.load(std::memory_order_relaxed));
-            granularDelay_.setReverseProbability(granularParams_.reverseProb.load(std::memory_order_relaxed));
-            granularDelay_.setFreeze(granularParams_.freeze.load(std::memory_order_relaxed));
-            granularDelay_.setFeedback(granularParams_.feedback.load(std::memory_order_relaxed));
-            granularDelay_.setDryWet(granularParams_.dryWet.load(std::memory_order_relaxed));
-            granularDelay_.setEnvelopeType(static_cast<Krate::DSP::GrainEnvelopeType>(
+            granularDelay_->setGrainSize(granularParams_.grainSize.load(std::memory_order_relaxed));
+            granularDelay_->setDensity(granularParams_.density.load(std::memory_order_relaxed));
+            granularDelay_->setDelayTime(granularParams_.delayTime.load(std::memory_order_relaxed));
+            granularDelay_->setPitch(granularParams_.pitch.load(std::memory_order_relaxed));
+            granularDelay_->setPitchSpray(granularParams_.pitchSpray.load(std::memory_order_relaxed));
+            granularDelay_->setPositionSpray(granularParams_.positionSpray.load(std::memory_order_relaxed));
+            granularDelay_->setPanSpray(granularParams_.panSpray.load(std::memory_order_relaxed));
+            granularDelay_->setReverseProbability(granularParams_.reverseProb.load(std::memory_order_relaxed));
+            granularDelay_->setFreeze(granularParams_.freeze.load(std::memory_order_relaxed));
+            granularDelay_->setFeedback(granularParams_.feedback.load(std::memory_order_relaxed));
+            granularDelay_->setDryWet(granularParams_.dryWet.load(std::memory_order_relaxed));
+            granularDelay_->setEnvelopeType(static_cast<Krate::DSP::GrainEnvelopeType>(
                 granularParams_.envelopeType.load(std::memory_order_relaxed)));
             // Tempo sync parameters (spec 038)
-            granularDelay_.setTimeMode(granularParams_.timeMode.load(std::memory_order_relaxed));
-            granularDelay_.setNoteValue(granularParams_.noteValue.load(std::memory_order_relaxed));
+            granularDelay_->setTimeMode(granularParams_.timeMode.load(std::memory_order_relaxed));
+            granularDelay_->setNoteValue(granularParams_.noteValue.load(std::memory_order_relaxed));
             // Phase 2 parameters
-            granularDelay_.setJitter(granularParams_.jitter.load(std::memory_order_relaxed));
-            granularDelay_.setPitchQuantMode(static_cast<Krate::DSP::PitchQuantMode>(
+            granularDelay_->setJitter(granularParams_.jitter.load(std::memory_order_relaxed));
+            granularDelay_->setPitchQuantMode(static_cast<Krate::DSP::PitchQuantMode>(
                 granularParams_.pitchQuantMode.load(std::memory_order_relaxed)));
-            granularDelay_.setTexture(granularParams_.texture.load(std::memory_order_relaxed));
-            granularDelay_.setStereoWidth(granularParams_.stereoWidth.load(std::memory_order_relaxed));
+            granularDelay_->setTexture(granularParams_.texture.load(std::memory_order_relaxed));
+            granularDelay_->setStereoWidth(granularParams_.stereoWidth.load(std::memory_order_relaxed));
             // GranularDelay takes separate input/output buffers
-            granularDelay_.process(inputL, inputR, outputL, outputR, numSamples, ctx);
+            granularDelay_->process(inputL, inputR, outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Spectral:
             // Update Spectral parameters
-            spectralDelay_.setFFTSize(static_cast<size_t>(
+            spectralDelay_->setFFTSize(static_cast<size_t>(
                 spectralParams_.fftSize.load(std::memory_order_relaxed)));
-            spectralDelay_.setBaseDelayMs(spectralParams_.baseDelay.load(std::memory_order_relaxed));
-            spectralDelay_.setSpreadMs(spectralParams_.spread.load(std::memory_order_relaxed));
-            spectralDelay_.setSpreadDirection(static_cast<Krate::DSP::SpreadDirection>(
+            spectralDelay_->setBaseDelayMs(spectralParams_.baseDelay.load(std::memory_order_relaxed));
+            spectralDelay_->setSpreadMs(spectralParams_.spread.load(std::memory_order_relaxed));
+            spectralDelay_->setSpreadDirection(static_cast<Krate::DSP::SpreadDirection>(
                 spectralParams_.spreadDirection.load(std::memory_order_relaxed)));
-            spectralDelay_.setFeedback(spectralParams_.feedback.load(std::memory_order_relaxed));
-            spectralDelay_.setFeedbackTilt(spectralParams_.feedbackTilt.load(std::memory_order_relaxed));
-            spectralDelay_.setFreezeEnabled(spectralParams_.freeze.load(std::memory_order_relaxed));
-            spectralDelay_.setDiffusion(spectralParams_.diffusion.load(std::memory_order_relaxed));
-            spectralDelay_.setDryWetMix(spectralParams_.dryWet.load(std::memory_order_relaxed));
-            spectralDelay_.setSpreadCurve(static_cast<Krate::DSP::SpreadCurve>(
+            spectralDelay_->setFeedback(spectralParams_.feedback.load(std::memory_order_relaxed));
+            spectralDelay_->setFeedbackTilt(spectralParams_.feedbackTilt.load(std::memory_order_relaxed));
+            spectralDelay_->setFreezeEnabled(spectralParams_.freeze.load(std::memory_order_relaxed));
+            spectralDelay_->setDiffusion(spectralParams_.diffusion.load(std::memory_order_relaxed));
+            spectralDelay_->setDryWetMix(spectralParams_.dryWet.load(std::memory_order_relaxed));
+            spectralDelay_->setSpreadCurve(static_cast<Krate::DSP::SpreadCurve>(
                 spectralParams_.spreadCurve.load(std::memory_order_relaxed)));
-            spectralDelay_.setStereoWidth(spectralParams_.stereoWidth.load(std::memory_order_relaxed));
+            spectralDelay_->setStereoWidth(spectralParams_.stereoWidth.load(std::memory_order_relaxed));
             // Tempo Sync (spec 041)
-            spectralDelay_.setTimeMode(spectralParams_.timeMode.load(std::memory_order_relaxed));
-            spectralDelay_.setNoteValue(spectralParams_.noteValue.load(std::memory_order_relaxed));
-            spectralDelay_.process(outputL, outputR, numSamples, ctx);
+            spectralDelay_->setTimeMode(spectralParams_.timeMode.load(std::memory_order_relaxed));
+            spectralDelay_->setNoteValue(spectralParams_.noteValue.load(std::memory_order_relaxed));
+            spectralDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Shimmer:
             // Update Shimmer parameters
-            shimmerDelay_.setDelayTimeMs(shimmerParams_.delayTime.load(std::memory_order_relaxed));
-            shimmerDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            shimmerDelay_->setDelayTimeMs(shimmerParams_.delayTime.load(std::memory_order_relaxed));
+            shimmerDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 shimmerParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = shimmerParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                shimmerDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                shimmerDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            shimmerDelay_.setPitchSemitones(shimmerParams_.pitchSemitones.load(std::memory_order_relaxed));
-            shimmerDelay_.setPitchCents(shimmerParams_.pitchCents.load(std::memory_order_relaxed));
-            shimmerDelay_.setShimmerMix(shimmerParams_.shimmerMix.load(std::memory_order_relaxed));
-            shimmerDelay_.setFeedbackAmount(shimmerParams_.feedback.load(std::memory_order_relaxed));
-            shimmerDelay_.setDiffusionAmount(shimmerParams_.diffusionAmount.load(std::memory_order_relaxed));
-            shimmerDelay_.setDiffusionSize(shimmerParams_.diffusionSize.load(std::memory_order_relaxed));
-            shimmerDelay_.setFilterEnabled(shimmerParams_.filterEnabled.load(std::memory_order_relaxed));
-            shimmerDelay_.setFilterCutoff(shimmerParams_.filterCutoff.load(std::memory_order_relaxed));
-            shimmerDelay_.setDryWetMix(shimmerParams_.dryWet.load(std::memory_order_relaxed));
-            shimmerDelay_.process(outputL, outputR, numSamples, ctx);
+            shimmerDelay_->setPitchSemitones(shimmerParams_.pitchSemitones.load(std::memory_order_relaxed));
+            shimmerDelay_->setPitchCents(shimmerParams_.pitchCents.load(std::memory_order_relaxed));
+            shimmerDelay_->setShimmerMix(shimmerParams_.shimmerMix.load(std::memory_order_relaxed));
+            shimmerDelay_->setFeedbackAmount(shimmerParams_.feedback.load(std::memory_order_relaxed));
+            shimmerDelay_->setDiffusionAmount(shimmerParams_.diffusionAmount.load(std::memory_order_relaxed));
+            shimmerDelay_->setDiffusionSize(shimmerParams_.diffusionSize.load(std::memory_order_relaxed));
+            shimmerDelay_->setFilterEnabled(shimmerParams_.filterEnabled.load(std::memory_order_relaxed));
+            shimmerDelay_->setFilterCutoff(shimmerParams_.filterCutoff.load(std::memory_order_relaxed));
+            shimmerDelay_->setDryWetMix(shimmerParams_.dryWet.load(std::memory_order_relaxed));
+            shimmerDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Tape:
             // Update Tape parameters
-            tapeDelay_.setMotorSpeed(tapeParams_.motorSpeed.load(std::memory_order_relaxed));
-            tapeDelay_.setMotorInertia(tapeParams_.motorInertia.load(std::memory_order_relaxed));
-            tapeDelay_.setWear(tapeParams_.wear.load(std::memory_order_relaxed));
-            tapeDelay_.setSaturation(tapeParams_.saturation.load(std::memory_order_relaxed));
-            tapeDelay_.setAge(tapeParams_.age.load(std::memory_order_relaxed));
-            tapeDelay_.setSpliceEnabled(tapeParams_.spliceEnabled.load(std::memory_order_relaxed));
-            tapeDelay_.setSpliceIntensity(tapeParams_.spliceIntensity.load(std::memory_order_relaxed));
-            tapeDelay_.setFeedback(tapeParams_.feedback.load(std::memory_order_relaxed));
-            tapeDelay_.setMix(tapeParams_.mix.load(std::memory_order_relaxed));
-            tapeDelay_.setHeadEnabled(0, tapeParams_.head1Enabled.load(std::memory_order_relaxed));
-            tapeDelay_.setHeadEnabled(1, tapeParams_.head2Enabled.load(std::memory_order_relaxed));
-            tapeDelay_.setHeadEnabled(2, tapeParams_.head3Enabled.load(std::memory_order_relaxed));
+            tapeDelay_->setMotorSpeed(tapeParams_.motorSpeed.load(std::memory_order_relaxed));
+            tapeDelay_->setMotorInertia(tapeParams_.motorInertia.load(std::memory_order_relaxed));
+            tapeDelay_->setWear(tapeParams_.wear.load(std::memory_order_relaxed));
+            tapeDelay_->setSaturation(tapeParams_.saturation.load(std::memory_order_relaxed));
+            tapeDelay_->setAge(tapeParams_.age.load(std::memory_order_relaxed));
+            tapeDelay_->setSpliceEnabled(tapeParams_.spliceEnabled.load(std::memory_order_relaxed));
+            tapeDelay_->setSpliceIntensity(tapeParams_.spliceIntensity.load(std::memory_order_relaxed));
+            tapeDelay_->setFeedback(tapeParams_.feedback.load(std::memory_order_relaxed));
+            tapeDelay_->setMix(tapeParams_.mix.load(std::memory_order_relaxed));
+            tapeDelay_->setHeadEnabled(0, tapeParams_.head1Enabled.load(std::memory_order_relaxed));
+            tapeDelay_->setHeadEnabled(1, tapeParams_.head2Enabled.load(std::memory_order_relaxed));
+            tapeDelay_->setHeadEnabled(2, tapeParams_.head3Enabled.load(std::memory_order_relaxed));
             {
                 float linearGain = tapeParams_.head1Level.load(std::memory_order_relaxed);
                 float dB = (linearGain <= 0.0f) ? -96.0f : 20.0f * std::log10(linearGain);
-                tapeDelay_.setHeadLevel(0, dB);
+                tapeDelay_->setHeadLevel(0, dB);
             }
             {
                 float linearGain = tapeParams_.head2Level.load(std::memory_order_relaxed);
                 float dB = (linearGain <= 0.0f) ? -96.0f : 20.0f * std::log10(linearGain);
-                tapeDelay_.setHeadLevel(1, dB);
+                tapeDelay_->setHeadLevel(1, dB);
             }
             {
                 float linearGain = tapeParams_.head3Level.load(std::memory_order_relaxed);
                 float dB = (linearGain <= 0.0f) ? -96.0f : 20.0f * std::log10(linearGain);
-                tapeDelay_.setHeadLevel(2, dB);
+                tapeDelay_->setHeadLevel(2, dB);
             }
-            tapeDelay_.setHeadPan(0, tapeParams_.head1Pan.load(std::memory_order_relaxed) * 100.0f);
-            tapeDelay_.setHeadPan(1, tapeParams_.head2Pan.load(std::memory_order_relaxed) * 100.0f);
-            tapeDelay_.setHeadPan(2, tapeParams_.head3Pan.load(std::memory_order_relaxed) * 100.0f);
-            tapeDelay_.process(outputL, outputR, numSamples);
+            tapeDelay_->setHeadPan(0, tapeParams_.head1Pan.load(std::memory_order_relaxed) * 100.0f);
+            tapeDelay_->setHeadPan(1, tapeParams_.head2Pan.load(std::memory_order_relaxed) * 100.0f);
+            tapeDelay_->setHeadPan(2, tapeParams_.head3Pan.load(std::memory_order_relaxed) * 100.0f);
+            tapeDelay_->process(outputL, outputR, numSamples);
             break;
 
         case DelayMode::BBD:
             // Update BBD parameters
-            bbdDelay_.setTime(bbdParams_.delayTime.load(std::memory_order_relaxed));
-            bbdDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            bbdDelay_->setTime(bbdParams_.delayTime.load(std::memory_order_relaxed));
+            bbdDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 bbdParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = bbdParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                bbdDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                bbdDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            bbdDelay_.setFeedback(bbdParams_.feedback.load(std::memory_order_relaxed));
-            bbdDelay_.setModulation(bbdParams_.modulationDepth.load(std::memory_order_relaxed));
-            bbdDelay_.setModulationRate(bbdParams_.modulationRate.load(std::memory_order_relaxed));
-            bbdDelay_.setAge(bbdParams_.age.load(std::memory_order_relaxed));
-            bbdDelay_.setEra(Parameters::getBBDEraFromDropdown(
+            bbdDelay_->setFeedback(bbdParams_.feedback.load(std::memory_order_relaxed));
+            bbdDelay_->setModulation(bbdParams_.modulationDepth.load(std::memory_order_relaxed));
+            bbdDelay_->setModulationRate(bbdParams_.modulationRate.load(std::memory_order_relaxed));
+            bbdDelay_->setAge(bbdParams_.age.load(std::memory_order_relaxed));
+            bbdDelay_->setEra(Parameters::getBBDEraFromDropdown(
                 bbdParams_.era.load(std::memory_order_relaxed)));
-            bbdDelay_.setMix(bbdParams_.mix.load(std::memory_order_relaxed));
-            bbdDelay_.process(outputL, outputR, numSamples, ctx);
+            bbdDelay_->setMix(bbdParams_.mix.load(std::memory_order_relaxed));
+            bbdDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Digital:
             // Update Digital parameters
-            digitalDelay_.setTime(digitalParams_.delayTime.load(std::memory_order_relaxed));
-            digitalDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            digitalDelay_->setTime(digitalParams_.delayTime.load(std::memory_order_relaxed));
+            digitalDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 digitalParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = digitalParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                digitalDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                digitalDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            digitalDelay_.setFeedback(digitalParams_.feedback.load(std::memory_order_relaxed));
-            digitalDelay_.setLimiterCharacter(static_cast<Krate::DSP::LimiterCharacter>(
+            digitalDelay_->setFeedback(digitalParams_.feedback.load(std::memory_order_relaxed));
+            digitalDelay_->setLimiterCharacter(static_cast<Krate::DSP::LimiterCharacter>(
                 digitalParams_.limiterCharacter.load(std::memory_order_relaxed)));
-            digitalDelay_.setEra(static_cast<Krate::DSP::DigitalEra>(
+            digitalDelay_->setEra(static_cast<Krate::DSP::DigitalEra>(
                 digitalParams_.era.load(std::memory_order_relaxed)));
-            digitalDelay_.setAge(digitalParams_.age.load(std::memory_order_relaxed));
-            digitalDelay_.setModulationDepth(digitalParams_.modulationDepth.load(std::memory_order_relaxed));
-            digitalDelay_.setModulationRate(digitalParams_.modulationRate.load(std::memory_order_relaxed));
-            digitalDelay_.setModulationWaveform(static_cast<Krate::DSP::Waveform>(
+            digitalDelay_->setAge(digitalParams_.age.load(std::memory_order_relaxed));
+            digitalDelay_->setModulationDepth(digitalParams_.modulationDepth.load(std::memory_order_relaxed));
+            digitalDelay_->setModulationRate(digitalParams_.modulationRate.load(std::memory_order_relaxed));
+            digitalDelay_->setModulationWaveform(static_cast<Krate::DSP::Waveform>(
                 digitalParams_.modulationWaveform.load(std::memory_order_relaxed)));
-            digitalDelay_.setMix(digitalParams_.mix.load(std::memory_order_relaxed));
-            digitalDelay_.setWidth(digitalParams_.width.load(std::memory_order_relaxed));
-            digitalDelay_.process(outputL, outputR, numSamples, ctx);
+            digitalDelay_->setMix(digitalParams_.mix.load(std::memory_order_relaxed));
+            digitalDelay_->setWidth(digitalParams_.width.load(std::memory_order_relaxed));
+            digitalDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::PingPong:
             // Update PingPong parameters
-            pingPongDelay_.setDelayTimeMs(pingPongParams_.delayTime.load(std::memory_order_relaxed));
-            pingPongDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            pingPongDelay_->setDelayTimeMs(pingPongParams_.delayTime.load(std::memory_order_relaxed));
+            pingPongDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 pingPongParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = pingPongParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                pingPongDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                pingPongDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            pingPongDelay_.setLRRatio(Parameters::getLRRatioFromDropdown(
+            pingPongDelay_->setLRRatio(Parameters::getLRRatioFromDropdown(
                 pingPongParams_.lrRatio.load(std::memory_order_relaxed)));
-            pingPongDelay_.setFeedback(pingPongParams_.feedback.load(std::memory_order_relaxed));
-            pingPongDelay_.setCrossFeedback(pingPongParams_.crossFeedback.load(std::memory_order_relaxed));
-            pingPongDelay_.setWidth(pingPongParams_.width.load(std::memory_order_relaxed));
-            pingPongDelay_.setModulationDepth(pingPongParams_.modulationDepth.load(std::memory_order_relaxed));
-            pingPongDelay_.setModulationRate(pingPongParams_.modulationRate.load(std::memory_order_relaxed));
-            pingPongDelay_.setMix(pingPongParams_.mix.load(std::memory_order_relaxed));
-            pingPongDelay_.process(outputL, outputR, numSamples, ctx);
+            pingPongDelay_->setFeedback(pingPongParams_.feedback.load(std::memory_order_relaxed));
+            pingPongDelay_->setCrossFeedback(pingPongParams_.crossFeedback.load(std::memory_order_relaxed));
+            pingPongDelay_->setWidth(pingPongParams_.width.load(std::memory_order_relaxed));
+            pingPongDelay_->setModulationDepth(pingPongParams_.modulationDepth.load(std::memory_order_relaxed));
+            pingPongDelay_->setModulationRate(pingPongParams_.modulationRate.load(std::memory_order_relaxed));
+            pingPongDelay_->setMix(pingPongParams_.mix.load(std::memory_order_relaxed));
+            pingPongDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Reverse:
             // Update Reverse parameters
-            reverseDelay_.setChunkSizeMs(reverseParams_.chunkSize.load(std::memory_order_relaxed));
-            reverseDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            reverseDelay_->setChunkSizeMs(reverseParams_.chunkSize.load(std::memory_order_relaxed));
+            reverseDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 reverseParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = reverseParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                reverseDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                reverseDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            reverseDelay_.setCrossfadePercent(reverseParams_.crossfade.load(std::memory_order_relaxed));
-            reverseDelay_.setPlaybackMode(static_cast<Krate::DSP::PlaybackMode>(
+            reverseDelay_->setCrossfadePercent(reverseParams_.crossfade.load(std::memory_order_relaxed));
+            reverseDelay_->setPlaybackMode(static_cast<Krate::DSP::PlaybackMode>(
                 reverseParams_.playbackMode.load(std::memory_order_relaxed)));
-            reverseDelay_.setFeedbackAmount(reverseParams_.feedback.load(std::memory_order_relaxed));
-            reverseDelay_.setFilterEnabled(reverseParams_.filterEnabled.load(std::memory_order_relaxed));
-            reverseDelay_.setFilterCutoff(reverseParams_.filterCutoff.load(std::memory_order_relaxed));
-            reverseDelay_.setFilterType(static_cast<Krate::DSP::FilterType>(
+            reverseDelay_->setFeedbackAmount(reverseParams_.feedback.load(std::memory_order_relaxed));
+            reverseDelay_->setFilterEnabled(reverseParams_.filterEnabled.load(std::memory_order_relaxed));
+            reverseDelay_->setFilterCutoff(reverseParams_.filterCutoff.load(std::memory_order_relaxed));
+            reverseDelay_->setFilterType(static_cast<Krate::DSP::FilterType>(
                 reverseParams_.filterType.load(std::memory_order_relaxed)));
-            reverseDelay_.setDryWetMix(reverseParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
-            reverseDelay_.process(outputL, outputR, numSamples, ctx);
+            reverseDelay_->setDryWetMix(reverseParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
+            reverseDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::MultiTap:
             // Update MultiTap parameters
-            multiTapDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            multiTapDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 multiTapParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = multiTapParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                multiTapDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                multiTapDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            multiTapDelay_.loadTimingPattern(Parameters::getTimingPatternFromDropdown(
+            multiTapDelay_->loadTimingPattern(Parameters::getTimingPatternFromDropdown(
                 multiTapParams_.timingPattern.load(std::memory_order_relaxed)),
                 static_cast<size_t>(multiTapParams_.tapCount.load(std::memory_order_relaxed)));
-            multiTapDelay_.applySpatialPattern(Parameters::getSpatialPatternFromDropdown(
+            multiTapDelay_->applySpatialPattern(Parameters::getSpatialPatternFromDropdown(
                 multiTapParams_.spatialPattern.load(std::memory_order_relaxed)));
-            multiTapDelay_.setBaseTimeMs(multiTapParams_.baseTime.load(std::memory_order_relaxed));
-            multiTapDelay_.setTempo(multiTapParams_.tempo.load(std::memory_order_relaxed));
-            multiTapDelay_.setFeedbackAmount(multiTapParams_.feedback.load(std::memory_order_relaxed));
-            multiTapDelay_.setFeedbackLPCutoff(multiTapParams_.feedbackLPCutoff.load(std::memory_order_relaxed));
-            multiTapDelay_.setFeedbackHPCutoff(multiTapParams_.feedbackHPCutoff.load(std::memory_order_relaxed));
-            multiTapDelay_.setMorphTime(multiTapParams_.morphTime.load(std::memory_order_relaxed));
-            multiTapDelay_.setDryWetMix(multiTapParams_.dryWet.load(std::memory_order_relaxed));
-            multiTapDelay_.process(outputL, outputR, numSamples, ctx);
+            multiTapDelay_->setBaseTimeMs(multiTapParams_.baseTime.load(std::memory_order_relaxed));
+            multiTapDelay_->setTempo(multiTapParams_.tempo.load(std::memory_order_relaxed));
+            multiTapDelay_->setFeedbackAmount(multiTapParams_.feedback.load(std::memory_order_relaxed));
+            multiTapDelay_->setFeedbackLPCutoff(multiTapParams_.feedbackLPCutoff.load(std::memory_order_relaxed));
+            multiTapDelay_->setFeedbackHPCutoff(multiTapParams_.feedbackHPCutoff.load(std::memory_order_relaxed));
+            multiTapDelay_->setMorphTime(multiTapParams_.morphTime.load(std::memory_order_relaxed));
+            multiTapDelay_->setDryWetMix(multiTapParams_.dryWet.load(std::memory_order_relaxed));
+            multiTapDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Freeze:
             // Update Freeze parameters
-            freezeMode_.setFreezeEnabled(freezeParams_.freezeEnabled.load(std::memory_order_relaxed));
-            freezeMode_.setDelayTimeMs(freezeParams_.delayTime.load(std::memory_order_relaxed));
-            freezeMode_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            freezeMode_->setFreezeEnabled(freezeParams_.freezeEnabled.load(std::memory_order_relaxed));
+            freezeMode_->setDelayTimeMs(freezeParams_.delayTime.load(std::memory_order_relaxed));
+            freezeMode_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 freezeParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = freezeParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                freezeMode_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                freezeMode_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            freezeMode_.setFeedbackAmount(freezeParams_.feedback.load(std::memory_order_relaxed));
-            freezeMode_.setPitchSemitones(freezeParams_.pitchSemitones.load(std::memory_order_relaxed));
-            freezeMode_.setPitchCents(freezeParams_.pitchCents.load(std::memory_order_relaxed));
-            freezeMode_.setShimmerMix(freezeParams_.shimmerMix.load(std::memory_order_relaxed) * 100.0f);
-            freezeMode_.setDecay(freezeParams_.decay.load(std::memory_order_relaxed) * 100.0f);
-            freezeMode_.setDiffusionAmount(freezeParams_.diffusionAmount.load(std::memory_order_relaxed) * 100.0f);
-            freezeMode_.setDiffusionSize(freezeParams_.diffusionSize.load(std::memory_order_relaxed) * 100.0f);
-            freezeMode_.setFilterEnabled(freezeParams_.filterEnabled.load(std::memory_order_relaxed));
-            freezeMode_.setFilterType(static_cast<Krate::DSP::FilterType>(
+            freezeMode_->setFeedbackAmount(freezeParams_.feedback.load(std::memory_order_relaxed));
+            freezeMode_->setPitchSemitones(freezeParams_.pitchSemitones.load(std::memory_order_relaxed));
+            freezeMode_->setPitchCents(freezeParams_.pitchCents.load(std::memory_order_relaxed));
+            freezeMode_->setShimmerMix(freezeParams_.shimmerMix.load(std::memory_order_relaxed) * 100.0f);
+            freezeMode_->setDecay(freezeParams_.decay.load(std::memory_order_relaxed) * 100.0f);
+            freezeMode_->setDiffusionAmount(freezeParams_.diffusionAmount.load(std::memory_order_relaxed) * 100.0f);
+            freezeMode_->setDiffusionSize(freezeParams_.diffusionSize.load(std::memory_order_relaxed) * 100.0f);
+            freezeMode_->setFilterEnabled(freezeParams_.filterEnabled.load(std::memory_order_relaxed));
+            freezeMode_->setFilterType(static_cast<Krate::DSP::FilterType>(
                 freezeParams_.filterType.load(std::memory_order_relaxed)));
-            freezeMode_.setFilterCutoff(freezeParams_.filterCutoff.load(std::memory_order_relaxed));
-            freezeMode_.setDryWetMix(freezeParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
-            freezeMode_.process(outputL, outputR, numSamples, ctx);
+            freezeMode_->setFilterCutoff(freezeParams_.filterCutoff.load(std::memory_order_relaxed));
+            freezeMode_->setDryWetMix(freezeParams_.dryWet.load(std::memory_order_relaxed) * 100.0f);
+            freezeMode_->process(outputL, outputR, numSamples, ctx);
             break;
 
         case DelayMode::Ducking:
             // Update Ducking parameters
-            duckingDelay_.setDuckingEnabled(duckingParams_.duckingEnabled.load(std::memory_order_relaxed));
-            duckingDelay_.setThreshold(duckingParams_.threshold.load(std::memory_order_relaxed));
-            duckingDelay_.setDuckAmount(duckingParams_.duckAmount.load(std::memory_order_relaxed));
-            duckingDelay_.setAttackTime(duckingParams_.attackTime.load(std::memory_order_relaxed));
-            duckingDelay_.setReleaseTime(duckingParams_.releaseTime.load(std::memory_order_relaxed));
-            duckingDelay_.setHoldTime(duckingParams_.holdTime.load(std::memory_order_relaxed));
-            duckingDelay_.setDuckTarget(static_cast<Krate::DSP::DuckTarget>(
+            duckingDelay_->setDuckingEnabled(duckingParams_.duckingEnabled.load(std::memory_order_relaxed));
+            duckingDelay_->setThreshold(duckingParams_.threshold.load(std::memory_order_relaxed));
+            duckingDelay_->setDuckAmount(duckingParams_.duckAmount.load(std::memory_order_relaxed));
+            duckingDelay_->setAttackTime(duckingParams_.attackTime.load(std::memory_order_relaxed));
+            duckingDelay_->setReleaseTime(duckingParams_.releaseTime.load(std::memory_order_relaxed));
+            duckingDelay_->setHoldTime(duckingParams_.holdTime.load(std::memory_order_relaxed));
+            duckingDelay_->setDuckTarget(static_cast<Krate::DSP::DuckTarget>(
                 duckingParams_.duckTarget.load(std::memory_order_relaxed)));
-            duckingDelay_.setSidechainFilterEnabled(duckingParams_.sidechainFilterEnabled.load(std::memory_order_relaxed));
-            duckingDelay_.setSidechainFilterCutoff(duckingParams_.sidechainFilterCutoff.load(std::memory_order_relaxed));
-            duckingDelay_.setDelayTimeMs(duckingParams_.delayTime.load(std::memory_order_relaxed));
-            duckingDelay_.setTimeMode(static_cast<Krate::DSP::TimeMode>(
+            duckingDelay_->setSidechainFilterEnabled(duckingParams_.sidechainFilterEnabled.load(std::memory_order_relaxed));
+            duckingDelay_->setSidechainFilterCutoff(duckingParams_.sidechainFilterCutoff.load(std::memory_order_relaxed));
+            duckingDelay_->setDelayTimeMs(duckingParams_.delayTime.load(std::memory_order_relaxed));
+            duckingDelay_->setTimeMode(static_cast<Krate::DSP::TimeMode>(
                 duckingParams_.timeMode.load(std::memory_order_relaxed)));
             {
                 const int noteIdx = duckingParams_.noteValue.load(std::memory_order_relaxed);
                 const auto noteMapping = Krate::DSP::getNoteValueFromDropdown(noteIdx);
-                duckingDelay_.setNoteValue(noteMapping.note, noteMapping.modifier);
+                duckingDelay_->setNoteValue(noteMapping.note, noteMapping.modifier);
             }
-            duckingDelay_.setFeedbackAmount(duckingParams_.feedback.load(std::memory_order_relaxed));
-            duckingDelay_.setDryWetMix(duckingParams_.dryWet.load(std::memory_order_relaxed));
-            duckingDelay_.process(outputL, outputR, numSamples, ctx);
+            duckingDelay_->setFeedbackAmount(duckingParams_.feedback.load(std::memory_order_relaxed));
+            duckingDelay_->setDryWetMix(duckingParams_.dryWet.load(std::memory_order_relaxed));
+            duckingDelay_->process(outputL, outputR, numSamples, ctx);
             break;
 
         default:
@@ -742,4 +805,132 @@ void Processor::processMode(int mode, const float* inputL, const float* inputR,
     }
 }
 
+// ==============================================================================
+// Mode Residency
+// ==============================================================================
+
+void Processor::prepareModeEngine(int mode) {
+    // Engines are constructed fresh so a re-prepare after release starts clean
+    const auto maxBlock = static_cast<size_t>(maxBlockSize_);
+
+    switch (static_cast<DelayMode>(mode)) {
+        case DelayMode::Granular:
+            // GranularDelay (spec 034)
+            granularDelay_ = std::make_unique<Krate::DSP::GranularDelay>();
+            granularDelay_->prepare(sampleRate_);
+            break;
+        case DelayMode::Spectral:
+            // SpectralDelay (spec 033)
+            spectralDelay_ = std::make_unique<Krate::DSP::SpectralDelay>();
+            spectralDelay_->prepare(sampleRate_, maxBlock);
+            break;
+        case DelayMode::Shimmer:
+            // ShimmerDelay (spec 029)
+            shimmerDelay_ = std::make_unique<Krate::DSP::ShimmerDelay>();
+            shimmerDelay_->prepare(sampleRate_, maxBlock, 5000.0f);
+            break;
+        case DelayMode::Tape:
+            // TapeDelay (spec 024)
+            tapeDelay_ = std::make_unique<Krate::DSP::TapeDelay>();
+            tapeDelay_->prepare(sampleRate_, maxBlock, 2000.0f);
+            break;
+        case DelayMode::BBD:
+            // BBDDelay (spec 025)
+            bbdDelay_ = std::make_unique<Krate::DSP::BBDDelay>();
+            bbdDelay_->prepare(sampleRate_, maxBlock, 1000.0f);
+            break;
+        case DelayMode::Digital:
+            // DigitalDelay (spec 026)
+            digitalDelay_ = std::make_unique<Krate::DSP::DigitalDelay>();
+            digitalDelay_->prepare(sampleRate_, maxBlock, 10000.0f);
+            break;
+        case DelayMode::PingPong:
+            // PingPongDelay (spec 027)
+            pingPongDelay_ = std::make_unique<Krate::DSP::PingPongDelay>();
+            pingPongDelay_->prepare(sampleRate_, maxBlock, 10000.0f);
+            break;
+        case DelayMode::Reverse:
+            // ReverseDelay (spec 030)
+            reverseDelay_ = std::make_unique<Krate::DSP::ReverseDelay>();
+            reverseDelay_->prepare(sampleRate_, maxBlock, 2000.0f);
+            break;
+        case DelayMode::MultiTap:
+            // MultiTapDelay (spec 028)
+            multiTapDelay_ = std::make_unique<Krate::DSP::MultiTapDelay>();
+            multiTapDelay_->prepare(sampleRate_, maxBlock, 5000.0f);
+            break;
+        case DelayMode::Freeze:
+            // FreezeMode (spec 031)
+            freezeMode_ = std::make_unique<Krate::DSP::FreezeMode>();
+            freezeMode_->prepare(sampleRate_, maxBlock, 5000.0f);
+            break;
+        case DelayMode::Ducking:
+            // DuckingDelay (spec 032)
+            duckingDelay_ = std::make_unique<Krate::DSP::DuckingDelay>();
+            duckingDelay_->prepare(sampleRate_, maxBlock);
+            break;
+        default:
+            break;
+    }
+}
+
+void Processor::releaseModeEngine(int mode) {
+    // Destroying the engine frees its buffers
+    switch (static_cast<DelayMode>(mode)) {
+        case DelayMode::Granular: granularDelay_.reset(); break;
+        case DelayMode::Spectral: spectralDelay_.reset(); break;
+        case DelayMode::Shimmer:  shimmerDelay_.reset(); break;
+        case DelayMode::Tape:     tapeDelay_.reset(); break;
+        case DelayMode::BBD:      bbdDelay_.reset(); break;
+        case DelayMode::Digital:  digitalDelay_.reset(); break;
+        case DelayMode::PingPong: pingPongDelay_.reset(); break;
+        case DelayMode::Reverse:  reverseDelay_.reset(); break;
+        case DelayMode::MultiTap: multiTapDelay_.reset(); break;
+        case DelayMode::Freeze:   freezeMode_.reset(); break;
+        case DelayMode::Ducking:  duckingDelay_.reset(); break;
+        default: break;
+    }
+}
+
+void Processor::resetModeEngine(int mode) {
+    // Only called for Ready modes, whose engines exist
+    switch (static_cast<DelayMode>(mode)) {
+        case DelayMode::Granular: granularDelay_->reset(); break;
+        case DelayMode::Spectral: spectralDelay_->reset(); break;
+        case DelayMode::Shimmer:  shimmerDelay_->reset(); break;
+        case DelayMode::Tape:     tapeDelay_->reset(); break;
+        case DelayMode::BBD:      bbdDelay_->reset(); break;
+        case DelayMode::Digital:  digitalDelay_->reset(); break;
+        case DelayMode::PingPong: pingPongDelay_->reset(); break;
+        case DelayMode::Reverse:  reverseDelay_->reset(); break;
+        case DelayMode::MultiTap: multiTapDelay_->reset(); break;
+        case DelayMode::Freeze:   freezeMode_->reset(); break;
+        case DelayMode::Ducking:  duckingDelay_->reset(); break;
+        default: break;
+    }
+}
+
+void Processor::startResidencyWorker() {
+    // Offline renders service modeResidency_ from process()
+    if (residencyHandle_ != 0 || offlineRendering_) {
+        return;
+    }
+
+    residencyHandle_ = ModeResidencyWorker::shared().attach([this] {
+        modeResidency_.service(
+            [this](int mode) { prepareModeEngine(mode); },
+            [this](int mode) { releaseModeEngine(mode); });
+    });
+}
+
+void Processor::stopResidencyWorker() {
+    if (residencyHandle_ == 0) {
+        return;
+    }
+
+    // Waits for a service pass over this instance to finish
+    ModeResidencyWorker::shared().detach(residencyHandle_);
+    residencyHandle_ = 0;
+}
+
 } // namespace Iterum
@@ -15,7 +15,6 @@
 // ==============================================================================
 
 #include "public.sdk/source/vst/vstaudioeffect.h"
-#include <krate/dsp/core/crossfade_utils.h>
 #include <krate/dsp/core/dsp_utils.h>
 #include <krate/dsp/effects/bbd_delay.h>
 #include <krate/dsp/effects/digital_delay.h>
@@ -28,6 +27,7 @@
 #include <krate/dsp/effects/shimmer_delay.h>
 #include <krate/dsp/effects/spectral_delay.h>
 #include <krate/dsp/effects/tape_delay.h>
+#include <krate/dsp/primitives/output_stage.h>
 #include "parameters/bbd_params.h"
 #include "parameters/digital_params.h"
 #include "parameters/ducking_params.h"
@@ -40,8 +40,12 @@
 #include "parameters/spectral_params.h"
 #include "parameters/tape_params.h"
 #include "parameters/dropdown_mappings.h"
+#include "processor/mode_residency.h"
+#include "processor/mode_residency_worker.h"
+#include "processor/parameter_event_scheduler.h"
 
 #include <atomic>
+#include <memory>
 #include <vector>
 
 namespace Iterum {
@@ -53,7 +57,7 @@ namespace Iterum {
 class Processor : public Steinberg::Vst::AudioEffect {
 public:
     Processor();
-    ~Processor() override = default;
+    ~Processor() override;
 
     // ===========================================================================
     // IPluginBase
@@ -111,10 +115,28 @@ protected:
     // Parameter Handling
     // ==========================================================================
 
-    /// Process parameter changes from the input queue
-    /// Called at the start of each process() call
+    /// Collect every point of every parameter queue into paramScheduler_
+    /// Called at the start of each process(); points are applied sample-accurately
+    /// by process() as it walks the block slice by slice.
     void processParameterChanges(Steinberg::Vst::IParameterChanges* changes);
 
+    /// Route a single normalized parameter value to its destination
+    /// @param paramId Parameter ID (see plugin_ids.h)
+    /// @param value Normalized value [0, 1]
+    void applyParameterChange(Steinberg::Vst::ParamID paramId,
+                              Steinberg::Vst::ParamValue value);
+
+    /// Process one automation slice: mode crossfade, mode DSP and output gain
+    /// @param inputL Left input buffer (slice start)
+    /// @param inputR Right input buffer (slice start)
+    /// @param outputL Left output buffer (slice start)
+    /// @param outputR Right output buffer (slice start)
+    /// @param numSamples Slice length
+    /// @param ctx Block context (blockSize = slice length)
+    void processSlice(const float* inputL, const float* inputR,
+                      float* outputL, float* outputR, size_t numSamples,
+                      const Krate::DSP::BlockContext& ctx);
+
     /// Process a single mode's output into the given buffers
     /// @param mode The delay mode to process
     /// @param inputL Left input buffer
@@ -127,6 +149,26 @@ protected:
                      float* outputL, float* outputR, size_t numSamples,
                      const Krate::DSP::BlockContext& ctx);
 
+    // ==========================================================================
+    // Mode Residency (lazy engine preparation)
+    // ==========================================================================
+
+    /// Allocate and prepare one mode's engine for the current setup
+    /// NOT real-time safe - called from setupProcessing(), the residency worker
+    /// or, when rendering offline, from process()
+    void prepareModeEngine(int mode);
+
+    /// Free one mode's engine memory by destroying the engine
+    /// NOT real-time safe - called from setupProcessing() or the residency worker
+    void releaseModeEngine(int mode);
+
+    /// Reset one prepared mode's engine state
+    void resetModeEngine(int mode);
+
+    /// Attach to / detach from the shared worker that services modeResidency_
+    void startResidencyWorker();
+    void stopResidencyWorker();
+
 private:
     // ==========================================================================
     // Processing State
@@ -152,14 +194,8 @@ private:
     /// Previous mode (source of crossfade, only valid during crossfade)
     int previousMode_ = 5;
 
-    /// Crossfade position [0.0 = start, 1.0 = complete]
-    float crossfadePosition_ = 1.0f;
-
-    /// Per-sample increment for crossfade position
-    float crossfadeIncrement_ = 0.0f;
-
-    /// True while crossfade is in progress
-    bool crossfadeActive_ = false;
+    /// Equal-power mode crossfade and output gain, fused in one pass
+    Krate::DSP::OutputStage outputStage_;
 
     /// Work buffer for previous mode's left channel output during crossfade
     std::vector<float> crossfadeBufferL_;
@@ -167,6 +203,32 @@ private:
     /// Work buffer for previous mode's right channel output during crossfade
     std::vector<float> crossfadeBufferR_;
 
+    // ==========================================================================
+    // Sample-Accurate Automation
+    // Constitution Principle II: Event storage pre-allocated in setupProcessing()
+    // ==========================================================================
+
+    /// Queue points for the current block, sorted by sample offset
+    ParameterEventScheduler paramScheduler_;
+
+    // ==========================================================================
+    // Mode Residency
+    // Only the current mode (and the outgoing mode while crossfading) keeps its
+    // engine prepared. Other engines are prepared on request and released once
+    // idle for ModeResidency::kDefaultReleaseTimeoutSeconds, by the process-wide
+    // ModeResidencyWorker while the processor is active. Offline renders do
+    // both synchronously in process() instead, so mode switches and releases
+    // land on the same samples on every bounce.
+    // ==========================================================================
+
+    ModeResidency modeResidency_;
+
+    /// Registration with ModeResidencyWorker::shared() (0 while inactive)
+    ModeResidencyWorker::Handle residencyHandle_ = 0;
+
+    /// True when the host renders offline (ProcessSetup::processMode == kOffline)
+    bool offlineRendering_ = false;
+
     // ==========================================================================
     // Parameters (atomic for thread-safe access)
     // Constitution Principle VI: Use std::atomic for simple shared state
@@ -194,19 +256,20 @@ private:
 
     // ==========================================================================
     // DSP Components
+    // Allocated lazily - only touch an engine while modeResidency_ reports it Ready
     // ==========================================================================
 
-    Krate::DSP::GranularDelay granularDelay_;
-    Krate::DSP::SpectralDelay spectralDelay_;
-    Krate::DSP::DuckingDelay duckingDelay_;
-    Krate::DSP::FreezeMode freezeMode_;
-    Krate::DSP::ReverseDelay reverseDelay_;
-    Krate::DSP::ShimmerDelay shimmerDelay_;
-    Krate::DSP::TapeDelay tapeDelay_;
-    Krate::DSP::BBDDelay bbdDelay_;
-    Krate::DSP::DigitalDelay digitalDelay_;
-    Krate::DSP::PingPongDelay pingPongDelay_;
-    Krate::DSP::MultiTapDelay multiTapDelay_;
+    std::unique_ptr<Krate::DSP::GranularDelay> granularDelay_;
+    std::unique_ptr<Krate::DSP::SpectralDelay> spectralDelay_;
+    std::unique_ptr<Krate::DSP::DuckingDelay> duckingDelay_;
+    std::unique_ptr<Krate::DSP::FreezeMode> freezeMode_;
+    std::unique_ptr<Krate::DSP::ReverseDelay> reverseDelay_;
+    std::unique_ptr<Krate::DSP::ShimmerDelay> shimmerDelay_;
+    std::unique_ptr<Krate::DSP::TapeDelay> tapeDelay_;
+    std::unique_ptr<Krate::DSP::BBDDelay> bbdDelay_;
+    std::unique_ptr<Krate::DSP::DigitalDelay> digitalDelay_;
+    std::unique_ptr<Krate::DSP::PingPongDelay> pingPongDelay_;
+    std::unique_ptr<Krate::DSP::MultiTapDelay> multiTapDelay_;
 };
 
 } // namespace Iterum
@@ -0,0 +1,405 @@
+// ==============================================================================
+// Processor Tests: Mode Residency
+// ==============================================================================
+// Tests the ModeResidency state machine that lets Processor keep only the
+// active (and crossfading) delay mode engines prepared. The class has no VST3
+// SDK dependencies, so the audio-thread and worker-thread sides are driven
+// directly from the test.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "processor/mode_residency.h"
+#include "processor/mode_residency_worker.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Iterum;
+
+namespace {
+
+constexpr double kSampleRate = 48000.0;
+constexpr int kDigital = static_cast<int>(DelayMode::Digital);
+constexpr int kTape = static_cast<int>(DelayMode::Tape);
+constexpr int kShimmer = static_cast<int>(DelayMode::Shimmer);
+
+/// Records worker callbacks
+struct EngineLog {
+    std::vector<int> prepared;
+    std::vector<int> released;
+
+    size_t service(ModeResidency& residency) {
+        return residency.service(
+            [this](int mode) { prepared.push_back(mode); },
+            [this](int mode) { released.push_back(mode); });
+    }
+};
+
+} // anonymous namespace
+
+// =============================================================================
+// Setup
+// =============================================================================
+
+TEST_CASE("ModeResidency starts with every mode released", "[processor][residency]") {
+    ModeResidency residency;
+    REQUIRE(residency.residentCount() == 0);
+    for (size_t mode = 0; mode < ModeResidency::kNumModes; ++mode) {
+        REQUIRE(residency.state(static_cast<int>(mode)) == ModeResidencyState::Released);
+    }
+}
+
+TEST_CASE("ModeResidency prepareNow makes exactly one mode resident", "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate);
+
+    std::vector<int> prepared;
+    residency.prepareNow(kDigital, [&](int mode) { prepared.push_back(mode); });
+
+    REQUIRE(prepared == std::vector<int>{kDigital});
+    REQUIRE(residency.isReady(kDigital));
+    REQUIRE(residency.residentCount() == 1);
+
+    SECTION("releaseAll frees every resident mode") {
+        std::vector<int> released;
+        residency.releaseAll([&](int mode) { released.push_back(mode); });
+        REQUIRE(released == std::vector<int>{kDigital});
+        REQUIRE(residency.residentCount() == 0);
+    }
+}
+
+// =============================================================================
+// Mode Switching
+// =============================================================================
+
+TEST_CASE("ModeResidency prepares a requested mode on the worker", "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate);
+    residency.prepareNow(kDigital, [](int) {});
+
+    // Audio thread: switching to Tape is deferred until the worker prepares it
+    REQUIRE_FALSE(residency.acquire(kTape));
+    REQUIRE(residency.state(kTape) == ModeResidencyState::PrepareRequested);
+    REQUIRE_FALSE(residency.acquire(kTape));  // Still pending, no duplicate request
+
+    EngineLog log;
+    REQUIRE(log.service(residency) == 1);
+    REQUIRE(log.prepared == std::vector<int>{kTape});
+    REQUIRE(log.released.empty());
+
+    REQUIRE(residency.acquire(kTape));
+    REQUIRE(residency.residentCount() == 2);
+}
+
+TEST_CASE("ModeResidency treats out-of-range modes as always available",
+          "[processor][residency]") {
+    ModeResidency residency;
+    REQUIRE(residency.acquire(-1));
+    REQUIRE(residency.acquire(static_cast<int>(ModeResidency::kNumModes)));
+    REQUIRE(residency.residentCount() == 0);
+}
+
+// =============================================================================
+// Idle Release
+// =============================================================================
+
+TEST_CASE("ModeResidency releases modes idle beyond the timeout", "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate, 1.0);  // 48000 samples
+    residency.prepareNow(kDigital, [](int) {});
+    residency.prepareNow(kTape, [](int) {});
+
+    // Tape is playing; Digital sits idle
+    residency.advance(47999, kTape, kTape);
+    REQUIRE(residency.isReady(kDigital));
+
+    residency.advance(1, kTape, kTape);
+    REQUIRE(residency.state(kDigital) == ModeResidencyState::ReleaseRequested);
+
+    EngineLog log;
+    REQUIRE(log.service(residency) == 1);
+    REQUIRE(log.released == std::vector<int>{kDigital});
+    REQUIRE(residency.state(kDigital) == ModeResidencyState::Released);
+    REQUIRE(residency.isReady(kTape));
+    REQUIRE(residency.residentCount() == 1);
+}
+
+TEST_CASE("ModeResidency never releases the active or fading mode", "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate, 0.01);
+    residency.prepareNow(kDigital, [](int) {});
+    residency.prepareNow(kTape, [](int) {});
+    residency.prepareNow(kShimmer, [](int) {});
+
+    // Crossfading from Digital to Tape
+    for (int i = 0; i < 100; ++i) {
+        residency.advance(512, kTape, kDigital);
+    }
+
+    REQUIRE(residency.isReady(kDigital));
+    REQUIRE(residency.isReady(kTape));
+    REQUIRE(residency.state(kShimmer) == ModeResidencyState::ReleaseRequested);
+}
+
+TEST_CASE("ModeResidency acquire reclaims a mode pending release", "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate, 0.01);
+    residency.prepareNow(kDigital, [](int) {});
+    residency.prepareNow(kTape, [](int) {});
+
+    residency.advance(4800, kTape, kTape);
+    REQUIRE(residency.state(kDigital) == ModeResidencyState::ReleaseRequested);
+
+    // Switching back before the worker runs keeps the prepared engine
+    REQUIRE(residency.acquire(kDigital));
+    REQUIRE(residency.isReady(kDigital));
+
+    EngineLog log;
+    REQUIRE(log.service(residency) == 0);
+    REQUIRE(log.released.empty());
+}
+
+TEST_CASE("ModeResidency posts a work request once per new request", "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate, 0.01);
+    residency.prepareNow(kDigital, [](int) {});
+    REQUIRE_FALSE(residency.takeWorkRequest());
+
+    SECTION("acquire of a released mode") {
+        REQUIRE_FALSE(residency.acquire(kTape));
+        REQUIRE(residency.takeWorkRequest());
+        REQUIRE_FALSE(residency.takeWorkRequest());
+
+        // Still pending: asking again posts nothing new
+        REQUIRE_FALSE(residency.acquire(kTape));
+        REQUIRE_FALSE(residency.takeWorkRequest());
+    }
+
+    SECTION("idle timeout") {
+        residency.prepareNow(kTape, [](int) {});
+        residency.advance(4800, kDigital, kDigital);
+        REQUIRE(residency.takeWorkRequest());
+    }
+}
+
+TEST_CASE("ModeResidency prefetch requests a mode ahead of the switch", "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate);
+    residency.prepareNow(kDigital, [](int) {});
+
+    residency.prefetch(kShimmer);
+    REQUIRE(residency.state(kShimmer) == ModeResidencyState::PrepareRequested);
+    REQUIRE(residency.takeWorkRequest());
+
+    EngineLog log;
+    log.service(residency);
+    REQUIRE(log.prepared == std::vector<int>{kShimmer});
+
+    // The switch finds the engine ready
+    REQUIRE(residency.acquire(kShimmer));
+
+    // Prefetching a ready or out-of-range mode does nothing
+    residency.prefetch(kShimmer);
+    residency.prefetch(-1);
+    REQUIRE_FALSE(residency.takeWorkRequest());
+    REQUIRE(residency.isReady(kShimmer));
+}
+
+TEST_CASE("ModeResidency acquireNow prepares on the calling thread", "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate, 0.01);
+    residency.prepareNow(kDigital, [](int) {});
+
+    std::vector<int> prepared;
+    const auto prepare = [&](int mode) { prepared.push_back(mode); };
+
+    SECTION("released mode") {
+        residency.acquireNow(kTape, prepare);
+        REQUIRE(prepared == std::vector<int>{kTape});
+        REQUIRE(residency.isReady(kTape));
+    }
+
+    SECTION("mode already requested from the worker") {
+        REQUIRE_FALSE(residency.acquire(kTape));
+        residency.acquireNow(kTape, prepare);
+        REQUIRE(prepared == std::vector<int>{kTape});
+
+        // The worker finds nothing left to do
+        EngineLog log;
+        REQUIRE(log.service(residency) == 0);
+    }
+
+    SECTION("ready or pending-release mode is not prepared again") {
+        residency.prepareNow(kTape, [](int) {});
+        residency.advance(4800, kDigital, kDigital);
+        REQUIRE(residency.state(kTape) == ModeResidencyState::ReleaseRequested);
+
+        residency.acquireNow(kTape, prepare);
+        residency.acquireNow(kDigital, prepare);
+        REQUIRE(prepared.empty());
+        REQUIRE(residency.isReady(kTape));
+    }
+}
+
+// =============================================================================
+// Threading
+// =============================================================================
+
+TEST_CASE("ModeResidency hands engines between audio and worker threads",
+          "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate, 0.001);
+    residency.prepareNow(kDigital, [](int) {});
+
+    // Each "engine" is a flag: worker sets it on prepare and clears it on
+    // release. The audio thread must only ever observe set flags for modes
+    // that acquire() reported as Ready.
+    std::array<std::atomic<bool>, ModeResidency::kNumModes> engines{};
+    engines[kDigital] = true;
+
+    std::atomic<bool> running{true};
+    std::thread worker([&] {
+        while (running.load()) {
+            residency.service(
+                [&](int mode) { engines[static_cast<size_t>(mode)] = true; },
+                [&](int mode) { engines[static_cast<size_t>(mode)] = false; });
+            std::this_thread::yield();
+        }
+    });
+
+    int current = kDigital;
+    bool sawUnpreparedEngine = false;
+    for (int block = 0; block < 20000; ++block) {
+        const int requested = (block / 50) % static_cast<int>(ModeResidency::kNumModes);
+        if (requested != current && residency.acquire(requested)) {
+            current = requested;
+        }
+        if (!engines[static_cast<size_t>(current)].load()) {
+            sawUnpreparedEngine = true;
+        }
+        residency.advance(64, current, current);
+    }
+
+    running = false;
+    worker.join();
+
+    REQUIRE_FALSE(sawUnpreparedEngine);
+    REQUIRE(residency.isReady(current));
+}
+
+TEST_CASE("ModeResidency acquireNow waits for a worker mid-transition",
+          "[processor][residency]") {
+    ModeResidency residency;
+    residency.configure(kSampleRate);
+    residency.prepareNow(kDigital, [](int) {});
+    REQUIRE_FALSE(residency.acquire(kTape));
+
+    std::atomic<bool> preparing{false};
+    std::atomic<bool> finish{false};
+    std::atomic<int> prepareCount{0};
+    std::thread worker([&] {
+        residency.service(
+            [&](int) {
+                preparing = true;
+                while (!finish.load()) {
+                    std::this_thread::yield();
+                }
+                ++prepareCount;
+            },
+            [](int) {});
+    });
+
+    while (!preparing.load()) {
+        std::this_thread::yield();
+    }
+    REQUIRE(residency.state(kTape) == ModeResidencyState::Preparing);
+
+    std::thread release([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        finish = true;
+    });
+    residency.acquireNow(kTape, [&](int) { ++prepareCount; });
+
+    REQUIRE(residency.isReady(kTape));
+    REQUIRE(prepareCount == 1);
+
+    release.join();
+    worker.join();
+}
+
+// =============================================================================
+// Shared Worker
+// =============================================================================
+
+TEST_CASE("ModeResidencyWorker services attached instances when woken",
+          "[processor][residency]") {
+    ModeResidencyWorker worker;
+    REQUIRE_FALSE(worker.isRunning());
+
+    ModeResidency first;
+    ModeResidency second;
+    std::atomic<int> firstPrepared{-1};
+    std::atomic<int> secondPrepared{-1};
+    for (auto* residency : {&first, &second}) {
+        residency->configure(kSampleRate);
+        residency->prepareNow(kDigital, [](int) {});
+    }
+
+    const auto firstHandle = worker.attach([&] {
+        first.service([&](int mode) { firstPrepared = mode; }, [](int) {});
+    });
+    const auto secondHandle = worker.attach([&] {
+        second.service([&](int mode) { secondPrepared = mode; }, [](int) {});
+    });
+    REQUIRE(worker.isRunning());
+    REQUIRE(worker.clientCount() == 2);
+
+    REQUIRE_FALSE(first.acquire(kTape));
+    REQUIRE_FALSE(second.acquire(kShimmer));
+    REQUIRE(first.takeWorkRequest());
+    worker.wake();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((!first.isReady(kTape) || !second.isReady(kShimmer)) &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    REQUIRE(firstPrepared == kTape);
+    REQUIRE(secondPrepared == kShimmer);
+
+    // The thread lives only while instances are attached
+    worker.detach(firstHandle);
+    REQUIRE(worker.isRunning());
+    worker.detach(secondHandle);
+    REQUIRE_FALSE(worker.isRunning());
+    REQUIRE(worker.clientCount() == 0);
+
+    // and restarts for the next one
+    const auto thirdHandle = worker.attach([] {});
+    REQUIRE(worker.isRunning());
+    worker.detach(thirdHandle);
+}
+
+TEST_CASE("ModeResidencyWorker detach waits for a running pass",
+          "[processor][residency]") {
+    ModeResidencyWorker worker;
+    std::atomic<bool> inPass{false};
+    std::atomic<bool> passDone{false};
+
+    const auto handle = worker.attach([&] {
+        inPass = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        passDone = true;
+    });
+    worker.wake();
+    while (!inPass.load()) {
+        std::this_thread::yield();
+    }
+
+    worker.detach(handle);
+    REQUIRE(passDone);
+}
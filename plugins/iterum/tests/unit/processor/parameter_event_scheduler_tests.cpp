@@ -0,0 +1,260 @@
+// ==============================================================================
+// Processor Tests: Sample-Accurate Parameter Automation
+// ==============================================================================
+// Tests the ParameterEventScheduler that Processor::process() uses to split
+// host blocks at parameter queue points. The scheduler has no VST3 SDK
+// dependencies, so it is exercised directly here.
+// ==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "processor/parameter_event_scheduler.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace Iterum;
+
+namespace {
+
+struct Slice {
+    size_t offset;
+    size_t length;
+};
+
+struct SliceLog {
+    std::vector<Slice> slices;
+    std::vector<std::pair<uint32_t, double>> applied;
+    std::vector<size_t> appliedBeforeSlice;  // slices.size() at each apply
+
+    void run(ParameterEventScheduler& scheduler, size_t numSamples) {
+        scheduler.sortByOffset();
+        scheduler.forEachSlice(
+            numSamples,
+            [this](uint32_t id, double value) {
+                applied.emplace_back(id, value);
+                appliedBeforeSlice.push_back(slices.size());
+            },
+            [this](size_t offset, size_t length) {
+                slices.push_back({offset, length});
+            });
+    }
+};
+
+} // anonymous namespace
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+TEST_CASE("ParameterEventScheduler reserves capacity in prepare", "[processor][automation]") {
+    ParameterEventScheduler scheduler;
+    REQUIRE(scheduler.capacity() == 0);
+
+    scheduler.prepare(16);
+    REQUIRE(scheduler.capacity() == 16);
+    REQUIRE(scheduler.empty());
+    REQUIRE(scheduler.remaining() == 16);
+
+    SECTION("push fails once full instead of growing") {
+        for (int i = 0; i < 16; ++i) {
+            REQUIRE(scheduler.push(i, 1, 0.5));
+        }
+        REQUIRE_FALSE(scheduler.push(16, 1, 0.5));
+        REQUIRE(scheduler.size() == 16);
+        REQUIRE(scheduler.capacity() == 16);
+    }
+
+    SECTION("clear empties without releasing storage") {
+        scheduler.push(0, 1, 0.5);
+        scheduler.clear();
+        REQUIRE(scheduler.empty());
+        REQUIRE(scheduler.capacity() == 16);
+    }
+}
+
+// =============================================================================
+// Ordering
+// =============================================================================
+
+TEST_CASE("ParameterEventScheduler sorts by offset and keeps host order for ties",
+          "[processor][automation]") {
+    ParameterEventScheduler scheduler;
+    scheduler.prepare(8);
+
+    // Queues arrive per parameter, so offsets interleave across queues
+    scheduler.push(256, 1, 0.1);
+    scheduler.push(0, 1, 0.2);
+    scheduler.push(128, 2, 0.3);
+    scheduler.push(128, 3, 0.4);
+    scheduler.push(-5, 4, 0.5);  // Negative offsets clamp to the block start
+
+    scheduler.sortByOffset();
+
+    REQUIRE(scheduler[0].sampleOffset == 0);
+    REQUIRE(scheduler[0].paramId == 1);
+    REQUIRE(scheduler[1].sampleOffset == 0);
+    REQUIRE(scheduler[1].paramId == 4);
+    REQUIRE(scheduler[2].paramId == 2);
+    REQUIRE(scheduler[3].paramId == 3);
+    REQUIRE(scheduler[4].sampleOffset == 256);
+}
+
+// =============================================================================
+// Slicing
+// =============================================================================
+
+TEST_CASE("ParameterEventScheduler without events processes one slice",
+          "[processor][automation]") {
+    ParameterEventScheduler scheduler;
+    scheduler.prepare(8);
+
+    SliceLog log;
+    log.run(scheduler, 512);
+
+    REQUIRE(log.slices.size() == 1);
+    REQUIRE(log.slices[0].offset == 0);
+    REQUIRE(log.slices[0].length == 512);
+    REQUIRE(log.applied.empty());
+}
+
+TEST_CASE("ParameterEventScheduler splits blocks at event offsets",
+          "[processor][automation]") {
+    ParameterEventScheduler scheduler;
+    scheduler.prepare(8);
+
+    scheduler.push(0, 10, 0.0);
+    scheduler.push(300, 10, 0.5);
+    scheduler.push(700, 10, 1.0);
+
+    SliceLog log;
+    log.run(scheduler, 1024);
+
+    REQUIRE(log.slices.size() == 3);
+    REQUIRE(log.slices[0].offset == 0);
+    REQUIRE(log.slices[0].length == 300);
+    REQUIRE(log.slices[1].offset == 300);
+    REQUIRE(log.slices[1].length == 400);
+    REQUIRE(log.slices[2].offset == 700);
+    REQUIRE(log.slices[2].length == 324);
+
+    // Each value is applied immediately before the slice that starts at its offset
+    REQUIRE(log.applied.size() == 3);
+    REQUIRE(log.appliedBeforeSlice[0] == 0);
+    REQUIRE(log.appliedBeforeSlice[1] == 1);
+    REQUIRE(log.appliedBeforeSlice[2] == 2);
+    REQUIRE(log.applied[2].second == 1.0);
+}
+
+TEST_CASE("ParameterEventScheduler enforces the minimum slice length",
+          "[processor][automation]") {
+    constexpr size_t kMin = ParameterEventScheduler::kMinSliceSamples;
+
+    ParameterEventScheduler scheduler;
+    scheduler.prepare(64);
+
+    SECTION("dense ramp points are grouped") {
+        // One point every 4 samples (typical of a fast automation ramp)
+        for (int32_t offset = 0; offset < 256; offset += 4) {
+            scheduler.push(offset, 7, static_cast<double>(offset) / 256.0);
+        }
+
+        SliceLog log;
+        log.run(scheduler, 256);
+
+        size_t covered = 0;
+        for (size_t i = 0; i < log.slices.size(); ++i) {
+            REQUIRE(log.slices[i].offset == covered);
+            REQUIRE(log.slices[i].length >= kMin);
+            covered += log.slices[i].length;
+        }
+        REQUIRE(covered == 256);
+        REQUIRE(log.applied.size() == 64);
+        REQUIRE(log.applied.back().second == 252.0 / 256.0);
+    }
+
+    SECTION("event in a short tail is applied early, not after the block") {
+        scheduler.push(1000, 7, 0.25);
+
+        SliceLog log;
+        log.run(scheduler, 1024);
+
+        REQUIRE(log.slices.size() == 2);
+        REQUIRE(log.slices[0].length == 1024 - kMin);
+        REQUIRE(log.slices[1].offset == 1024 - kMin);
+        REQUIRE(log.slices[1].length == kMin);
+
+        REQUIRE(log.applied.size() == 1);
+        REQUIRE(log.appliedBeforeSlice[0] == 1);
+    }
+
+    SECTION("event inside a minimum-length slice is applied at its start") {
+        scheduler.push(10, 7, 0.75);
+
+        SliceLog log;
+        log.run(scheduler, 512);
+
+        REQUIRE(log.slices.size() == 2);
+        REQUIRE(log.slices[0].length == kMin);
+        REQUIRE(log.appliedBeforeSlice[0] == 0);
+    }
+
+    SECTION("block too short to split applies its events up front") {
+        scheduler.push(1, 7, 0.5);
+        scheduler.push(2 * kMin - 2, 7, 0.6);
+
+        SliceLog log;
+        log.run(scheduler, 2 * kMin - 1);
+
+        REQUIRE(log.slices.size() == 1);
+        REQUIRE(log.applied.size() == 2);
+        REQUIRE(log.appliedBeforeSlice[0] == 0);
+        REQUIRE(log.appliedBeforeSlice[1] == 0);
+        REQUIRE(log.applied[1].second == 0.6);
+    }
+}
+
+TEST_CASE("ParameterEventScheduler never applies an event late",
+          "[processor][automation]") {
+    constexpr size_t kMin = ParameterEventScheduler::kMinSliceSamples;
+
+    for (size_t numSamples : {size_t{1}, size_t{17}, 2 * kMin - 1, 2 * kMin, size_t{100},
+                              size_t{511}, size_t{1024}}) {
+        for (size_t offset = 0; offset < numSamples; offset += 3) {
+            ParameterEventScheduler scheduler;
+            scheduler.prepare(4);
+            scheduler.push(static_cast<int32_t>(offset), 1, 1.0);
+
+            size_t appliedAt = numSamples;
+            size_t position = 0;
+            scheduler.sortByOffset();
+            scheduler.forEachSlice(
+                numSamples,
+                [&](uint32_t, double) { appliedAt = position; },
+                [&](size_t sliceOffset, size_t length) { position = sliceOffset + length; });
+
+            INFO("Block " << numSamples << ", event at " << offset);
+            REQUIRE(appliedAt <= offset);
+            if (numSamples - appliedAt >= 2 * kMin) {
+                REQUIRE(offset - appliedAt < kMin);
+            } else {
+                REQUIRE(offset - appliedAt < 2 * kMin);
+            }
+        }
+    }
+}
+
+TEST_CASE("ParameterEventScheduler applyAll flushes without slicing",
+          "[processor][automation]") {
+    ParameterEventScheduler scheduler;
+    scheduler.prepare(8);
+    scheduler.push(0, 1, 0.1);
+    scheduler.push(0, 2, 0.2);
+
+    std::vector<uint32_t> ids;
+    scheduler.applyAll([&ids](uint32_t id, double) { ids.push_back(id); });
+
+    REQUIRE(ids == std::vector<uint32_t>{1, 2});
+    REQUIRE(scheduler.empty());
+}
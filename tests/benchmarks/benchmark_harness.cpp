@@ -0,0 +1,475 @@
+// ==============================================================================
+// Krate Benchmarks - Harness Implementation
+// ==============================================================================
+
+#include "benchmark_harness.h"
+
+#include "allocation_detector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+
+namespace Krate::Benchmarks {
+
+// ==============================================================================
+// Registry
+// ==============================================================================
+
+std::string BenchmarkResult::key() const {
+    std::ostringstream out;
+    out << group << '/' << name << '@' << static_cast<long long>(std::llround(sampleRate))
+        << '/' << blockSize;
+    return out.str();
+}
+
+BenchmarkRegistry& BenchmarkRegistry::instance() {
+    static BenchmarkRegistry registry;
+    return registry;
+}
+
+void BenchmarkRegistry::add(BenchmarkCase benchmarkCase) {
+    cases_.push_back(std::move(benchmarkCase));
+}
+
+BenchmarkRegistrar::BenchmarkRegistrar(std::string group, std::string name, CaseFactory factory) {
+    BenchmarkRegistry::instance().add({std::move(group), std::move(name), std::move(factory)});
+}
+
+std::vector<float> makeNoise(size_t numSamples, unsigned seed) {
+    std::vector<float> noise(numSamples);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    for (auto& sample : noise) {
+        sample = dist(rng);
+    }
+    return noise;
+}
+
+// ==============================================================================
+// Runner
+// ==============================================================================
+
+BenchmarkResult runBenchmark(const BenchmarkCase& benchmarkCase,
+                             const BenchmarkConfig& config,
+                             const RunOptions& options) {
+    using Clock = std::chrono::steady_clock;
+
+    BenchmarkResult result;
+    result.group = benchmarkCase.group;
+    result.name = benchmarkCase.name;
+    result.sampleRate = config.sampleRate;
+    result.blockSize = config.blockSize;
+
+    ProcessBlockFn process = benchmarkCase.factory(config);
+
+    // Warm up: first calls may fill smoothers, prime caches, etc.
+    for (int i = 0; i < options.warmupCalls; ++i) {
+        process(config.blockSize);
+    }
+
+    // Allocation probe (separate from timing so the counter adds no overhead)
+    {
+        TestHelpers::AllocationScope scope;
+        for (int i = 0; i < options.allocationProbeCalls; ++i) {
+            process(config.blockSize);
+        }
+        const size_t allocations = TestHelpers::AllocationDetector::instance().getAllocationCount();
+        result.allocationsPerCall = options.allocationProbeCalls > 0
+            ? static_cast<double>(allocations) / options.allocationProbeCalls
+            : 0.0;
+    }
+
+    const double audioSamples = options.audioSecondsPerTrial * config.sampleRate;
+    const size_t calls = std::max<size_t>(
+        1, static_cast<size_t>(std::ceil(audioSamples / static_cast<double>(config.blockSize))));
+
+    // Best of N trials: the minimum is the least noisy estimate on a busy machine
+    double bestNs = std::numeric_limits<double>::max();
+    for (int trial = 0; trial < std::max(1, options.trials); ++trial) {
+        const auto start = Clock::now();
+        for (size_t call = 0; call < calls; ++call) {
+            process(config.blockSize);
+        }
+        const auto end = Clock::now();
+        bestNs = std::min(bestNs,
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+
+    const double samples = static_cast<double>(calls) * static_cast<double>(config.blockSize);
+    result.calls = calls;
+    result.nsPerSample = bestNs / samples;
+    result.cpuPercent = result.nsPerSample * config.sampleRate * 1e-9 * 100.0;
+    return result;
+}
+
+std::vector<BenchmarkResult> runAll(const RunOptions& options) {
+    std::vector<BenchmarkResult> results;
+
+    std::cout << std::left << std::setw(44) << "benchmark"
+              << std::right << std::setw(9) << "rate"
+              << std::setw(7) << "block"
+              << std::setw(12) << "ns/sample"
+              << std::setw(10) << "%CPU"
+              << std::setw(12) << "allocs/call" << '\n';
+
+    for (const auto& benchmarkCase : BenchmarkRegistry::instance().cases()) {
+        const std::string fullName = benchmarkCase.group + "/" + benchmarkCase.name;
+        if (!options.filter.empty() && fullName.find(options.filter) == std::string::npos) {
+            continue;
+        }
+
+        for (double sampleRate : options.sampleRates) {
+            for (size_t blockSize : options.blockSizes) {
+                const BenchmarkResult result =
+                    runBenchmark(benchmarkCase, {sampleRate, blockSize}, options);
+
+                std::cout << std::left << std::setw(44) << fullName
+                          << std::right << std::setw(9) << static_cast<long>(sampleRate)
+                          << std::setw(7) << blockSize
+                          << std::fixed << std::setprecision(2)
+                          << std::setw(12) << result.nsPerSample
+                          << std::setw(10) << result.cpuPercent
+                          << std::setw(12) << result.allocationsPerCall << '\n';
+                results.push_back(result);
+            }
+        }
+    }
+    return results;
+}
+
+// ==============================================================================
+// JSON Writer
+// ==============================================================================
+
+namespace {
+
+std::string escapeJson(const std::string& text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:   out += c; break;
+        }
+    }
+    return out;
+}
+
+} // anonymous namespace
+
+bool writeJson(const std::string& path, const std::vector<BenchmarkResult>& results) {
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    file << "{\n  \"schema\": 1,\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        file << std::setprecision(6) << std::fixed
+             << "    {\"group\": \"" << escapeJson(r.group) << "\""
+             << ", \"name\": \"" << escapeJson(r.name) << "\""
+             << ", \"sampleRate\": " << std::setprecision(1) << r.sampleRate
+             << ", \"blockSize\": " << r.blockSize
+             << ", \"calls\": " << r.calls
+             << ", \"nsPerSample\": " << std::setprecision(4) << r.nsPerSample
+             << ", \"cpuPercent\": " << r.cpuPercent
+             << ", \"allocationsPerCall\": " << r.allocationsPerCall
+             << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+    return static_cast<bool>(file);
+}
+
+// ==============================================================================
+// JSON Reader
+// ==============================================================================
+// Small recursive-descent parser: enough for documents produced by writeJson()
+// and hand-edited baselines (whitespace, key order and extra fields are free).
+
+namespace {
+
+struct JsonValue {
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> items;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    [[nodiscard]] const JsonValue* find(const std::string& key) const {
+        for (const auto& [name, value] : members) {
+            if (name == key) {
+                return &value;
+            }
+        }
+        return nullptr;
+    }
+};
+
+class JsonParser {
+public:
+    explicit JsonParser(const std::string& text) : text_(text) {}
+
+    bool parse(JsonValue& out) {
+        if (!parseValue(out)) {
+            return false;
+        }
+        skipWhitespace();
+        return pos_ == text_.size();
+    }
+
+private:
+    void skipWhitespace() {
+        while (pos_ < text_.size() &&
+               (text_[pos_] == ' ' || text_[pos_] == '\n' || text_[pos_] == '\r' ||
+                text_[pos_] == '\t')) {
+            ++pos_;
+        }
+    }
+
+    bool consume(char expected) {
+        skipWhitespace();
+        if (pos_ < text_.size() && text_[pos_] == expected) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool consumeLiteral(const char* literal) {
+        const std::string word(literal);
+        if (text_.compare(pos_, word.size(), word) == 0) {
+            pos_ += word.size();
+            return true;
+        }
+        return false;
+    }
+
+    bool parseValue(JsonValue& out) {
+        skipWhitespace();
+        if (pos_ >= text_.size()) {
+            return false;
+        }
+
+        const char c = text_[pos_];
+        if (c == '{') return parseObject(out);
+        if (c == '[') return parseArray(out);
+        if (c == '"') {
+            out.type = JsonValue::Type::String;
+            return parseString(out.string);
+        }
+        if (consumeLiteral("true")) {
+            out.type = JsonValue::Type::Bool;
+            out.boolean = true;
+            return true;
+        }
+        if (consumeLiteral("false")) {
+            out.type = JsonValue::Type::Bool;
+            return true;
+        }
+        if (consumeLiteral("null")) {
+            out.type = JsonValue::Type::Null;
+            return true;
+        }
+        return parseNumber(out);
+    }
+
+    bool parseObject(JsonValue& out) {
+        out.type = JsonValue::Type::Object;
+        ++pos_;  // '{'
+        if (consume('}')) {
+            return true;
+        }
+        do {
+            skipWhitespace();
+            std::string key;
+            if (!parseString(key) || !consume(':')) {
+                return false;
+            }
+            JsonValue value;
+            if (!parseValue(value)) {
+                return false;
+            }
+            out.members.emplace_back(std::move(key), std::move(value));
+        } while (consume(','));
+        return consume('}');
+    }
+
+    bool parseArray(JsonValue& out) {
+        out.type = JsonValue::Type::Array;
+        ++pos_;  // '['
+        if (consume(']')) {
+            return true;
+        }
+        do {
+            JsonValue value;
+            if (!parseValue(value)) {
+                return false;
+            }
+            out.items.push_back(std::move(value));
+        } while (consume(','));
+        return consume(']');
+    }
+
+    bool parseString(std::string& out) {
+        if (pos_ >= text_.size() || text_[pos_] != '"') {
+            return false;
+        }
+        ++pos_;
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            char c = text_[pos_++];
+            if (c == '\\' && pos_ < text_.size()) {
+                const char escaped = text_[pos_++];
+                switch (escaped) {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    default:  c = escaped; break;  // \" \\ \/
+                }
+            }
+            out += c;
+        }
+        if (pos_ >= text_.size()) {
+            return false;
+        }
+        ++pos_;  // closing quote
+        return true;
+    }
+
+    bool parseNumber(JsonValue& out) {
+        const char* begin = text_.c_str() + pos_;
+        char* end = nullptr;
+        const double value = std::strtod(begin, &end);
+        if (end == begin) {
+            return false;
+        }
+        pos_ += static_cast<size_t>(end - begin);
+        out.type = JsonValue::Type::Number;
+        out.number = value;
+        return true;
+    }
+
+    const std::string& text_;
+    size_t pos_ = 0;
+};
+
+double numberOr(const JsonValue& object, const char* key, double fallback) {
+    const JsonValue* value = object.find(key);
+    return (value && value->type == JsonValue::Type::Number) ? value->number : fallback;
+}
+
+std::string stringOr(const JsonValue& object, const char* key) {
+    const JsonValue* value = object.find(key);
+    return (value && value->type == JsonValue::Type::String) ? value->string : std::string{};
+}
+
+} // anonymous namespace
+
+bool readJson(const std::string& path, std::vector<BenchmarkResult>& results) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+
+    JsonValue root;
+    JsonParser parser(text);
+    if (!parser.parse(root) || root.type != JsonValue::Type::Object) {
+        return false;
+    }
+
+    const JsonValue* list = root.find("results");
+    if (!list || list->type != JsonValue::Type::Array) {
+        return false;
+    }
+
+    results.clear();
+    for (const auto& item : list->items) {
+        if (item.type != JsonValue::Type::Object) {
+            continue;
+        }
+        BenchmarkResult r;
+        r.group = stringOr(item, "group");
+        r.name = stringOr(item, "name");
+        r.sampleRate = numberOr(item, "sampleRate", 0.0);
+        r.blockSize = static_cast<size_t>(numberOr(item, "blockSize", 0.0));
+        r.calls = static_cast<size_t>(numberOr(item, "calls", 0.0));
+        r.nsPerSample = numberOr(item, "nsPerSample", 0.0);
+        r.cpuPercent = numberOr(item, "cpuPercent", 0.0);
+        r.allocationsPerCall = numberOr(item, "allocationsPerCall", 0.0);
+        results.push_back(std::move(r));
+    }
+    return true;
+}
+
+// ==============================================================================
+// Baseline Comparison
+// ==============================================================================
+
+size_t compareToBaseline(const std::vector<BenchmarkResult>& current,
+                         const std::vector<BenchmarkResult>& baseline,
+                         double thresholdPercent) {
+    std::map<std::string, const BenchmarkResult*> byKey;
+    for (const auto& r : baseline) {
+        byKey[r.key()] = &r;
+    }
+
+    size_t regressions = 0;
+    size_t compared = 0;
+
+    std::cout << "\nBaseline comparison (threshold " << std::fixed << std::setprecision(1)
+              << thresholdPercent << "%)\n";
+
+    for (const auto& r : current) {
+        const auto it = byKey.find(r.key());
+        if (it == byKey.end()) {
+            std::cout << "  NEW        " << r.key() << '\n';
+            continue;
+        }
+        ++compared;
+
+        const BenchmarkResult& base = *it->second;
+        const double change = base.nsPerSample > 0.0
+            ? (r.nsPerSample / base.nsPerSample - 1.0) * 100.0
+            : 0.0;
+        const bool slower = change > thresholdPercent;
+        const bool newAllocations = base.allocationsPerCall == 0.0 && r.allocationsPerCall > 0.0;
+
+        if (slower || newAllocations) {
+            ++regressions;
+            std::cout << "  REGRESSION " << r.key() << ": "
+                      << std::setprecision(2) << base.nsPerSample << " -> " << r.nsPerSample
+                      << " ns/sample (" << std::showpos << change << std::noshowpos << "%)";
+            if (newAllocations) {
+                std::cout << ", now allocates " << r.allocationsPerCall << "/call";
+            }
+            std::cout << '\n';
+        } else if (change < -thresholdPercent) {
+            std::cout << "  FASTER     " << r.key() << ": "
+                      << std::setprecision(2) << base.nsPerSample << " -> " << r.nsPerSample
+                      << " ns/sample (" << std::showpos << change << std::noshowpos << "%)\n";
+        }
+    }
+
+    std::cout << "  " << compared << " compared, " << regressions << " regression(s)\n";
+    return regressions;
+}
+
+} // namespace Krate::Benchmarks
@@ -0,0 +1,166 @@
+#pragma once
+// ==============================================================================
+// Krate Benchmarks - Harness
+// ==============================================================================
+// Minimal benchmark registry and runner for the krate_benchmarks executable.
+//
+// Each case is registered with a factory that builds and prepares the unit
+// under test for one (sampleRate, blockSize) configuration and returns a
+// callable that processes one block. The runner measures:
+//   - ns/sample:       wall time per sample frame (stereo units count once)
+//   - %CPU:            processing time as a percentage of real time
+//   - allocs/call:     heap allocations per process call
+//                      (via TestHelpers::AllocationDetector)
+//
+// Results can be written as JSON and compared against a previous JSON run
+// (see benchmark_main.cpp for the command line).
+// ==============================================================================
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Krate::Benchmarks {
+
+// ==============================================================================
+// Configuration
+// ==============================================================================
+
+/// One point of the sample-rate x block-size matrix
+struct BenchmarkConfig {
+    double sampleRate = 44100.0;
+    size_t blockSize = 512;
+};
+
+/// Processes one block of `numSamples` (<= BenchmarkConfig::blockSize)
+using ProcessBlockFn = std::function<void(size_t numSamples)>;
+
+/// Builds and prepares a case for the given configuration.
+/// May allocate; not measured.
+using CaseFactory = std::function<ProcessBlockFn(const BenchmarkConfig&)>;
+
+struct BenchmarkCase {
+    std::string group;  ///< "effects", "systems", "primitives", "core"
+    std::string name;   ///< Unique case name, e.g. "DigitalDelay"
+    CaseFactory factory;
+};
+
+// ==============================================================================
+// Results
+// ==============================================================================
+
+struct BenchmarkResult {
+    std::string group;
+    std::string name;
+    double sampleRate = 0.0;
+    size_t blockSize = 0;
+    size_t calls = 0;                ///< Process calls in the timed run
+    double nsPerSample = 0.0;        ///< Best-of-trials wall time per sample frame
+    double cpuPercent = 0.0;         ///< nsPerSample relative to the sample period
+    double allocationsPerCall = 0.0; ///< Heap allocations per process call
+
+    /// Key used to match results against a baseline
+    [[nodiscard]] std::string key() const;
+};
+
+// ==============================================================================
+// Registry
+// ==============================================================================
+
+class BenchmarkRegistry {
+public:
+    static BenchmarkRegistry& instance();
+
+    void add(BenchmarkCase benchmarkCase);
+
+    [[nodiscard]] const std::vector<BenchmarkCase>& cases() const noexcept { return cases_; }
+
+private:
+    std::vector<BenchmarkCase> cases_;
+};
+
+/// Static registration helper:
+///   static const BenchmarkRegistrar reg{"effects", "DigitalDelay", factory};
+struct BenchmarkRegistrar {
+    BenchmarkRegistrar(std::string group, std::string name, CaseFactory factory);
+};
+
+// ==============================================================================
+// Runner
+// ==============================================================================
+
+struct RunOptions {
+    std::vector<double> sampleRates{44100.0, 48000.0, 96000.0};
+    std::vector<size_t> blockSizes{32, 128, 512, 2048};
+    std::string filter;              ///< Substring match on "group/name" (empty = all)
+    double audioSecondsPerTrial = 2.0;
+    int trials = 3;
+    int warmupCalls = 8;
+    int allocationProbeCalls = 16;
+};
+
+/// Run a single case at a single configuration
+[[nodiscard]] BenchmarkResult runBenchmark(const BenchmarkCase& benchmarkCase,
+                                           const BenchmarkConfig& config,
+                                           const RunOptions& options);
+
+/// Run every registered case matching the filter across the config matrix
+[[nodiscard]] std::vector<BenchmarkResult> runAll(const RunOptions& options);
+
+// ==============================================================================
+// JSON / Baseline
+// ==============================================================================
+
+/// Write results as a JSON document ({"results": [...]})
+bool writeJson(const std::string& path, const std::vector<BenchmarkResult>& results);
+
+/// Read results previously written by writeJson()
+/// @return false if the file cannot be read or parsed
+bool readJson(const std::string& path, std::vector<BenchmarkResult>& results);
+
+/// Compare results against a baseline and print a report
+/// @param thresholdPercent Allowed slowdown in ns/sample before a case regresses
+/// @return Number of regressions (slower than threshold, or new allocations)
+size_t compareToBaseline(const std::vector<BenchmarkResult>& current,
+                         const std::vector<BenchmarkResult>& baseline,
+                         double thresholdPercent);
+
+// ==============================================================================
+// Case Helpers
+// ==============================================================================
+
+/// Deterministic noise source shared by cases (seeded, [-0.5, 0.5])
+[[nodiscard]] std::vector<float> makeNoise(size_t numSamples, unsigned seed = 42);
+
+/// Stereo in-place work buffers refilled from a fixed noise signal each call,
+/// so feedback paths see realistic input rather than their own output.
+class StereoBlock {
+public:
+    explicit StereoBlock(size_t maxBlockSize)
+        : sourceL_(makeNoise(maxBlockSize, 42)),
+          sourceR_(makeNoise(maxBlockSize, 43)),
+          left_(maxBlockSize, 0.0f),
+          right_(maxBlockSize, 0.0f) {}
+
+    /// Copy the noise source into the work buffers
+    void refill(size_t numSamples) noexcept {
+        for (size_t i = 0; i < numSamples; ++i) {
+            left_[i] = sourceL_[i];
+            right_[i] = sourceR_[i];
+        }
+    }
+
+    [[nodiscard]] float* left() noexcept { return left_.data(); }
+    [[nodiscard]] float* right() noexcept { return right_.data(); }
+    [[nodiscard]] const float* sourceLeft() const noexcept { return sourceL_.data(); }
+    [[nodiscard]] const float* sourceRight() const noexcept { return sourceR_.data(); }
+
+private:
+    std::vector<float> sourceL_;
+    std::vector<float> sourceR_;
+    std::vector<float> left_;
+    std::vector<float> right_;
+};
+
+} // namespace Krate::Benchmarks
@@ -0,0 +1,161 @@
+// ==============================================================================
+// Krate Benchmarks - Entry Point
+// ==============================================================================
+// Usage:
+//   krate_benchmarks [options]
+//
+//   --filter <text>         Only run cases whose "group/name" contains <text>
+//   --sample-rates <list>   Comma-separated rates (default 44100,48000,96000)
+//   --block-sizes <list>    Comma-separated sizes (default 32,128,512,2048)
+//   --seconds <s>           Audio seconds processed per trial (default 2.0)
+//   --quick                 0.25 s per trial, one trial (smoke runs)
+//   --json <file>           Write results as JSON
+//   --baseline <file>       Compare against a previous --json run
+//   --threshold <percent>   Allowed ns/sample slowdown vs baseline (default 10)
+//   --list                  List registered cases and exit
+//
+// Exit code is 1 when a baseline comparison finds regressions, 2 on usage or
+// I/O errors, 0 otherwise.
+//
+// Build with optimizations (Release); Debug numbers are not meaningful.
+// ==============================================================================
+
+#include "benchmark_harness.h"
+
+#include "allocation_detector.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ==============================================================================
+// Global Allocation Tracking
+// ==============================================================================
+// The benchmark executable owns its main(), so (unlike the Catch2 test
+// binaries) it can route every scalar/array new through AllocationDetector.
+// See tests/test_helpers/allocation_detector.h.
+
+void* operator new(std::size_t size) {
+    TestHelpers::AllocationDetector::instance().recordAllocation();
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    TestHelpers::AllocationDetector::instance().recordAllocation();
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+// ==============================================================================
+// Command Line
+// ==============================================================================
+
+namespace {
+
+template <typename T>
+bool parseList(const std::string& text, std::vector<T>& out) {
+    out.clear();
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        std::stringstream value(item);
+        T parsed{};
+        if (!(value >> parsed) || parsed <= T{}) {
+            return false;
+        }
+        out.push_back(parsed);
+    }
+    return !out.empty();
+}
+
+void printUsage() {
+    std::cerr << "usage: krate_benchmarks [--filter text] [--sample-rates list]\n"
+                 "                        [--block-sizes list] [--seconds s] [--quick]\n"
+                 "                        [--json file] [--baseline file] [--threshold pct]\n"
+                 "                        [--list]\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    using namespace Krate::Benchmarks;
+
+    RunOptions options;
+    std::string jsonPath;
+    std::string baselinePath;
+    double thresholdPercent = 10.0;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        } else if (arg == "--sample-rates" && hasValue) {
+            if (!parseList(argv[++i], options.sampleRates)) {
+                printUsage();
+                return 2;
+            }
+        } else if (arg == "--block-sizes" && hasValue) {
+            if (!parseList(argv[++i], options.blockSizes)) {
+                printUsage();
+                return 2;
+            }
+        } else if (arg == "--seconds" && hasValue) {
+            options.audioSecondsPerTrial = std::atof(argv[++i]);
+        } else if (arg == "--quick") {
+            options.audioSecondsPerTrial = 0.25;
+            options.trials = 1;
+        } else if (arg == "--json" && hasValue) {
+            jsonPath = argv[++i];
+        } else if (arg == "--baseline" && hasValue) {
+            baselinePath = argv[++i];
+        } else if (arg == "--threshold" && hasValue) {
+            thresholdPercent = std::atof(argv[++i]);
+        } else if (arg == "--list") {
+            listOnly = true;
+        } else {
+            printUsage();
+            return 2;
+        }
+    }
+
+    if (listOnly) {
+        for (const auto& benchmarkCase : BenchmarkRegistry::instance().cases()) {
+            std::cout << benchmarkCase.group << '/' << benchmarkCase.name << '\n';
+        }
+        return 0;
+    }
+
+    std::vector<BenchmarkResult> baseline;
+    if (!baselinePath.empty() && !readJson(baselinePath, baseline)) {
+        std::cerr << "krate_benchmarks: cannot read baseline '" << baselinePath << "'\n";
+        return 2;
+    }
+
+    const std::vector<BenchmarkResult> results = runAll(options);
+
+    if (!jsonPath.empty() && !writeJson(jsonPath, results)) {
+        std::cerr << "krate_benchmarks: cannot write '" << jsonPath << "'\n";
+        return 2;
+    }
+
+    if (!baselinePath.empty() && compareToBaseline(results, baseline, thresholdPercent) > 0) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,252 @@
+// ==============================================================================
+// Krate Benchmarks - Layer 4 Effects
+// ==============================================================================
+// One case per effects/*.h engine, configured the way the Iterum processor
+// drives it (max delay times from Processor::prepareModeEngine) with feedback,
+// modulation and filtering engaged so the measurement reflects a busy patch.
+//
+// Replaces the standalone benchmark_spectral_delay / benchmark_shimmer_delay
+// programs (SC-005: SpectralDelay < 3% CPU at 44.1 kHz / 512 / 2048 FFT).
+// ==============================================================================
+
+#include "benchmark_harness.h"
+
+#include <krate/dsp/core/block_context.h>
+#include <krate/dsp/effects/bbd_delay.h>
+#include <krate/dsp/effects/digital_delay.h>
+#include <krate/dsp/effects/ducking_delay.h>
+#include <krate/dsp/effects/freeze_mode.h>
+#include <krate/dsp/effects/granular_delay.h>
+#include <krate/dsp/effects/multi_tap_delay.h>
+#include <krate/dsp/effects/ping_pong_delay.h>
+#include <krate/dsp/effects/reverse_delay.h>
+#include <krate/dsp/effects/shimmer_delay.h>
+#include <krate/dsp/effects/spectral_delay.h>
+#include <krate/dsp/effects/tape_delay.h>
+
+#include <memory>
+#include <vector>
+
+using namespace Krate::DSP;
+using namespace Krate::Benchmarks;
+
+namespace {
+
+BlockContext makeContext(const BenchmarkConfig& config) {
+    BlockContext ctx;
+    ctx.sampleRate = config.sampleRate;
+    ctx.blockSize = config.blockSize;
+    ctx.tempoBPM = 120.0;
+    ctx.isPlaying = true;
+    return ctx;
+}
+
+/// Engine + stereo work buffers for in-place effects
+template <typename Engine>
+struct InPlaceState {
+    explicit InPlaceState(const BenchmarkConfig& config)
+        : block(config.blockSize), ctx(makeContext(config)) {}
+
+    Engine engine;
+    StereoBlock block;
+    BlockContext ctx;
+};
+
+// The state is constructed in place and shared with the std::function, so
+// engines with deleted move operations (ShimmerDelay, FreezeMode) work too.
+template <typename Engine, typename Setup>
+ProcessBlockFn makeInPlaceCase(const BenchmarkConfig& config, Setup&& setup) {
+    auto state = std::make_shared<InPlaceState<Engine>>(config);
+    setup(state->engine, config);
+    return [state](size_t numSamples) {
+        state->block.refill(numSamples);
+        state->ctx.blockSize = numSamples;
+        state->engine.process(state->block.left(), state->block.right(), numSamples, state->ctx);
+    };
+}
+
+// ==============================================================================
+// Cases
+// ==============================================================================
+
+const BenchmarkRegistrar kBBDDelay{"effects", "BBDDelay", [](const BenchmarkConfig& config) {
+    return makeInPlaceCase<BBDDelay>(config, [](BBDDelay& delay, const BenchmarkConfig& c) {
+        delay.prepare(c.sampleRate, c.blockSize, 1000.0f);
+        delay.setTime(300.0f);
+        delay.setFeedback(0.6f);
+        delay.setModulation(0.5f);
+        delay.setModulationRate(0.8f);
+        delay.setAge(0.4f);
+        delay.setMix(0.5f);
+    });
+}};
+
+const BenchmarkRegistrar kDigitalDelay{"effects", "DigitalDelay", [](const BenchmarkConfig& config) {
+    return makeInPlaceCase<DigitalDelay>(config, [](DigitalDelay& delay, const BenchmarkConfig& c) {
+        delay.prepare(c.sampleRate, c.blockSize, 10000.0f);
+        delay.setDelayTime(400.0f);
+        delay.setFeedback(0.6f);
+        delay.setModulationDepth(0.3f);
+        delay.setModulationRate(1.0f);
+        delay.setMix(0.5f);
+        delay.snapParameters();
+    });
+}};
+
+const BenchmarkRegistrar kDuckingDelay{"effects", "DuckingDelay", [](const BenchmarkConfig& config) {
+    return makeInPlaceCase<DuckingDelay>(config, [](DuckingDelay& delay, const BenchmarkConfig& c) {
+        delay.prepare(c.sampleRate, c.blockSize);
+        delay.setDuckingEnabled(true);
+        delay.setThreshold(-24.0f);
+        delay.setDuckAmount(60.0f);
+        delay.setSidechainFilterEnabled(true);
+        delay.setDelayTimeMs(400.0f);
+        delay.setFeedbackAmount(50.0f);
+        delay.setFilterEnabled(true);
+        delay.setFilterCutoff(4000.0f);
+        delay.setDryWetMix(50.0f);
+        delay.snapParameters();
+    });
+}};
+
+const BenchmarkRegistrar kFreezeMode{"effects", "FreezeMode", [](const BenchmarkConfig& config) {
+    return makeInPlaceCase<FreezeMode>(config, [](FreezeMode& freeze, const BenchmarkConfig& c) {
+        freeze.prepare(c.sampleRate, c.blockSize, 5000.0f);
+        freeze.setDelayTimeMs(500.0f);
+        freeze.setFeedbackAmount(0.6f);
+        freeze.setPitchSemitones(12.0f);
+        freeze.setShimmerMix(50.0f);
+        freeze.setDecay(20.0f);
+        freeze.setDiffusionAmount(50.0f);
+        freeze.setFilterEnabled(true);
+        freeze.setFilterCutoff(4000.0f);
+        freeze.setDryWetMix(50.0f);
+        freeze.setFreezeEnabled(true);
+        freeze.snapParameters();
+    });
+}};
+
+const BenchmarkRegistrar kMultiTapDelay{"effects", "MultiTapDelay", [](const BenchmarkConfig& config) {
+    return makeInPlaceCase<MultiTapDelay>(config, [](MultiTapDelay& delay, const BenchmarkConfig& c) {
+        delay.prepare(c.sampleRate, c.blockSize, 5000.0f);
+        delay.setTempo(120.0f);
+        delay.loadTimingPattern(TimingPattern::EighthNote, 8);
+        delay.setFeedbackAmount(0.5f);
+        delay.setFeedbackLPCutoff(6000.0f);
+        delay.setDryWetMix(50.0f);
+        delay.snapParameters();
+    });
+}};
+
+const BenchmarkRegistrar kPingPongDelay{"effects", "PingPongDelay", [](const BenchmarkConfig& config) {
+    return makeInPlaceCase<PingPongDelay>(config, [](PingPongDelay& delay, const BenchmarkConfig& c) {
+        delay.prepare(c.sampleRate, c.blockSize, 10000.0f);
+        delay.setDelayTimeMs(375.0f);
+        delay.setFeedback(0.6f);
+        delay.setCrossFeedback(0.8f);
+        delay.setModulationDepth(0.3f);
+        delay.setModulationRate(0.7f);
+        delay.setMix(0.5f);
+        delay.snapParameters();
+    });
+}};
+
+const BenchmarkRegistrar kReverseDelay{"effects", "ReverseDelay", [](const BenchmarkConfig& config) {
+    return makeInPlaceCase<ReverseDelay>(config, [](ReverseDelay& delay, const BenchmarkConfig& c) {
+        delay.prepare(c.sampleRate, c.blockSize, 2000.0f);
+        delay.setChunkSizeMs(500.0f);
+        delay.setCrossfadePercent(30.0f);
+        delay.setFeedbackAmount(0.5f);
+        delay.setFilterEnabled(true);
+        delay.setFilterCutoff(4000.0f);
+        delay.setDryWetMix(50.0f);
+        delay.snapParameters();
+    });
+}};
+
+const BenchmarkRegistrar kShimmerDelay{"effects", "ShimmerDelay", [](const BenchmarkConfig& config) {
+    return makeInPlaceCase<ShimmerDelay>(config, [](ShimmerDelay& shimmer, const BenchmarkConfig& c) {
+        shimmer.prepare(c.sampleRate, c.blockSize, 5000.0f);
+        shimmer.setDelayTimeMs(500.0f);
+        shimmer.setPitchSemitones(12.0f);
+        shimmer.setPitchMode(PitchMode::Granular);
+        shimmer.setShimmerMix(100.0f);
+        shimmer.setFeedbackAmount(0.6f);
+        shimmer.setDiffusionAmount(70.0f);
+        shimmer.setDiffusionSize(50.0f);
+        shimmer.setFilterEnabled(true);
+        shimmer.setFilterCutoff(4000.0f);
+        shimmer.setDryWetMix(50.0f);
+        shimmer.snapParameters();
+    });
+}};
+
+const BenchmarkRegistrar kSpectralDelay{"effects", "SpectralDelay", [](const BenchmarkConfig& config) {
+    return makeInPlaceCase<SpectralDelay>(config, [](SpectralDelay& delay, const BenchmarkConfig& c) {
+        delay.setFFTSize(2048);
+        delay.prepare(c.sampleRate, c.blockSize);
+        delay.setBaseDelayMs(500.0f);
+        delay.setSpreadMs(300.0f);
+        delay.setSpreadDirection(SpreadDirection::LowToHigh);
+        delay.setFeedback(0.5f);
+        delay.setFeedbackTilt(0.2f);
+        delay.setDiffusion(0.3f);
+        delay.setDryWetMix(50.0f);
+        delay.snapParameters();
+    });
+}};
+
+// TapeDelay has no BlockContext overload
+const BenchmarkRegistrar kTapeDelay{"effects", "TapeDelay", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : block(maxBlockSize) {}
+        TapeDelay delay;
+        StereoBlock block;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->delay.prepare(config.sampleRate, config.blockSize, 2000.0f);
+    state->delay.setMotorSpeed(400.0f);
+    state->delay.setWear(0.4f);
+    state->delay.setSaturation(0.5f);
+    state->delay.setAge(0.3f);
+    state->delay.setSpliceEnabled(true);
+    state->delay.setHeadEnabled(1, true);
+    state->delay.setHeadEnabled(2, true);
+    state->delay.setFeedback(0.6f);
+    state->delay.setMix(0.5f);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->block.refill(numSamples);
+        state->delay.process(state->block.left(), state->block.right(), numSamples);
+    }};
+}};
+
+// GranularDelay processes out of place
+const BenchmarkRegistrar kGranularDelay{"effects", "GranularDelay", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(const BenchmarkConfig& c)
+            : block(c.blockSize), outL(c.blockSize), outR(c.blockSize), ctx(makeContext(c)) {}
+        GranularDelay delay;
+        StereoBlock block;
+        std::vector<float> outL;
+        std::vector<float> outR;
+        BlockContext ctx;
+    };
+    auto state = std::make_shared<State>(config);
+    state->delay.prepare(config.sampleRate);
+    state->delay.setGrainSize(80.0f);
+    state->delay.setDensity(40.0f);
+    state->delay.setDelayTime(300.0f);
+    state->delay.setPositionSpray(0.3f);
+    state->delay.setPitch(7.0f);
+    state->delay.setPitchSpray(0.2f);
+    state->delay.setPanSpray(0.5f);
+    state->delay.setFeedback(0.4f);
+    state->delay.setDryWet(0.5f);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->ctx.blockSize = numSamples;
+        state->delay.process(state->block.sourceLeft(), state->block.sourceRight(),
+                             state->outL.data(), state->outR.data(), numSamples, state->ctx);
+    }};
+}};
+
+} // anonymous namespace
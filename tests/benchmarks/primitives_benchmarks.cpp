@@ -0,0 +1,567 @@
+// ==============================================================================
+// Krate Benchmarks - Core, Primitives, Processors and Systems
+// ==============================================================================
+// Building blocks the effects are assembled from, so a regression in an
+// effect can be traced to the layer that caused it.
+//
+// Replaces the standalone benchmark_tanh (SC-001: fastTanh faster than
+// std::tanh), benchmark_feedback_network (SC-007: FeedbackNetwork < 1% CPU at
+// 44.1 kHz / 512) and benchmark_mode_crossfade (spec 041: crossfade < 2x the
+// cost of a single mode) programs.
+// ==============================================================================
+
+#include "benchmark_harness.h"
+
+#include <krate/dsp/core/block_context.h>
+#include <krate/dsp/core/crossfade_utils.h>
+#include <krate/dsp/core/denormal_scope.h>
+#include <krate/dsp/core/fast_math.h>
+#include <krate/dsp/effects/digital_delay.h>
+#include <krate/dsp/primitives/biquad.h>
+#include <krate/dsp/primitives/biquad_bank.h>
+#include <krate/dsp/primitives/delay_line.h>
+#include <krate/dsp/primitives/lfo.h>
+#include <krate/dsp/primitives/modulated_filter.h>
+#include <krate/dsp/primitives/oversampler.h>
+#include <krate/dsp/primitives/smoother.h>
+#include <krate/dsp/primitives/spectral_buffer.h>
+#include <krate/dsp/primitives/stft.h>
+#include <krate/dsp/processors/diffusion_network.h>
+#include <krate/dsp/processors/dynamics_processor.h>
+#include <krate/dsp/processors/saturation_processor.h>
+#include <krate/dsp/systems/feedback_network.h>
+#include <krate/dsp/systems/modulation_matrix.h>
+#include <krate/dsp/systems/tap_manager.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace Krate::DSP;
+using namespace Krate::Benchmarks;
+
+namespace {
+
+/// Mono input/output buffers for primitive cases
+struct MonoBuffers {
+    explicit MonoBuffers(size_t maxBlockSize)
+        : input(makeNoise(maxBlockSize)), output(maxBlockSize, 0.0f) {}
+
+    std::vector<float> input;
+    std::vector<float> output;
+};
+
+// ==============================================================================
+// Core
+// ==============================================================================
+
+// Function pointers keep the compiler from folding the loop (as in the old
+// standalone tanh benchmark); inputs span [-4, 4] to cover the saturation range.
+ProcessBlockFn makeTanhCase(const BenchmarkConfig& config, float (*fn)(float)) {
+    auto buffers = std::make_shared<MonoBuffers>(config.blockSize);
+    for (auto& x : buffers->input) {
+        x *= 8.0f;
+    }
+    volatile auto func = fn;
+    return [buffers, func](size_t numSamples) {
+        const auto f = func;
+        for (size_t i = 0; i < numSamples; ++i) {
+            buffers->output[i] = f(buffers->input[i]);
+        }
+    };
+}
+
+float fastTanhFn(float x) noexcept { return FastMath::fastTanh(x); }
+float stdTanhFn(float x) noexcept { return std::tanh(x); }
+
+const BenchmarkRegistrar kFastTanh{"core", "FastMath::fastTanh", [](const BenchmarkConfig& config) {
+    return makeTanhCase(config, &fastTanhFn);
+}};
+
+const BenchmarkRegistrar kStdTanh{"core", "std::tanh", [](const BenchmarkConfig& config) {
+    return makeTanhCase(config, &stdTanhFn);
+}};
+
+// ==============================================================================
+// Primitives
+// ==============================================================================
+
+const BenchmarkRegistrar kDelayLine{"primitives", "DelayLine::readLinear", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : buffers(maxBlockSize) {}
+        DelayLine delay;
+        OnePoleSmoother time;
+        MonoBuffers buffers;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->delay.prepare(config.sampleRate, 2.0f);
+    state->time.configure(20.0f, static_cast<float>(config.sampleRate));
+    state->time.snapTo(static_cast<float>(0.25 * config.sampleRate));
+    return ProcessBlockFn{[state](size_t numSamples) {
+        for (size_t i = 0; i < numSamples; ++i) {
+            state->delay.write(state->buffers.input[i]);
+            state->buffers.output[i] = state->delay.readLinear(state->time.process());
+        }
+    }};
+}};
+
+const BenchmarkRegistrar kBiquad{"primitives", "Biquad::processBlock", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : buffers(maxBlockSize) {}
+        Biquad filter;
+        MonoBuffers buffers;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->filter.configure(FilterType::Lowpass, 2000.0f, 0.707f, 0.0f,
+                            static_cast<float>(config.sampleRate));
+    return ProcessBlockFn{[state](size_t numSamples) {
+        std::copy_n(state->buffers.input.begin(), numSamples, state->buffers.output.begin());
+        state->filter.processBlock(state->buffers.output.data(), numSamples);
+    }};
+}};
+
+// Stereo 24 dB/oct lowpass: two BiquadCascades vs one two-lane BiquadBank
+const BenchmarkRegistrar kBiquadStereoCascade{"primitives", "BiquadCascade<2> x2 (stereo)", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : block(maxBlockSize) {}
+        BiquadCascade<2> left;
+        BiquadCascade<2> right;
+        StereoBlock block;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->left.setButterworth(FilterType::Lowpass, 2000.0f, static_cast<float>(config.sampleRate));
+    state->right.setButterworth(FilterType::Lowpass, 2000.0f, static_cast<float>(config.sampleRate));
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->block.refill(numSamples);
+        state->left.processBlock(state->block.left(), numSamples);
+        state->right.processBlock(state->block.right(), numSamples);
+    }};
+}};
+
+const BenchmarkRegistrar kBiquadBankStereo{"primitives", "BiquadBank<2,2> (stereo)", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : block(maxBlockSize) {}
+        BiquadBank<2, 2> bank;
+        StereoBlock block;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->bank.setButterworth(FilterType::Lowpass, 2000.0f, static_cast<float>(config.sampleRate));
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->block.refill(numSamples);
+        state->bank.processStereo(state->block.left(), state->block.right(), numSamples);
+    }};
+}};
+
+/// Buffers plus a per-sample cutoff sweep (200 Hz - 8 kHz) for modulated filters
+struct SweepBuffers : MonoBuffers {
+    explicit SweepBuffers(size_t maxBlockSize)
+        : MonoBuffers(maxBlockSize), cutoff(maxBlockSize) {
+        for (size_t i = 0; i < maxBlockSize; ++i) {
+            const float phase = kTwoPi * static_cast<float>(i) / static_cast<float>(maxBlockSize);
+            cutoff[i] = 200.0f * std::pow(40.0f, 0.5f + 0.5f * std::sin(phase));
+        }
+    }
+
+    std::vector<float> cutoff;
+};
+
+// Per-sample BiquadCoefficients::calculate(), as MultimodeFilter::processSample
+// used to do - the reference cost for ModulatedFilter
+const BenchmarkRegistrar kBiquadSweep{"primitives", "Biquad sweep (per-sample coeffs)", [](const BenchmarkConfig& config) {
+    struct State : SweepBuffers {
+        using SweepBuffers::SweepBuffers;
+        Biquad filter;
+        float sampleRate = 44100.0f;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->sampleRate = static_cast<float>(config.sampleRate);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        for (size_t i = 0; i < numSamples; ++i) {
+            state->filter.configure(FilterType::Lowpass, state->cutoff[i], 2.0f, 0.0f, state->sampleRate);
+            state->output[i] = state->filter.process(state->input[i]);
+        }
+    }};
+}};
+
+const BenchmarkRegistrar kModulatedFilterSweep{"primitives", "ModulatedFilter sweep", [](const BenchmarkConfig& config) {
+    struct State : SweepBuffers {
+        using SweepBuffers::SweepBuffers;
+        ModulatedFilter filter;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->filter.setParameters(FilterType::Lowpass, 1000.0f, 2.0f);
+    state->filter.prepare(config.sampleRate);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        std::copy_n(state->input.begin(), numSamples, state->output.begin());
+        state->filter.processBlock(state->output.data(), state->cutoff.data(), numSamples);
+    }};
+}};
+
+const BenchmarkRegistrar kSmoother{"primitives", "OnePoleSmoother::processBlock", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : output(maxBlockSize, 0.0f) {}
+        OnePoleSmoother smoother;
+        std::vector<float> output;
+        bool high = false;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->smoother.configure(10.0f, static_cast<float>(config.sampleRate));
+    return ProcessBlockFn{[state](size_t numSamples) {
+        // Alternate targets so the smoother never settles into its fast path
+        state->high = !state->high;
+        state->smoother.setTarget(state->high ? 1.0f : 0.0f);
+        state->smoother.processBlock(state->output.data(), numSamples);
+    }};
+}};
+
+const BenchmarkRegistrar kLFO{"primitives", "LFO::processBlock", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : output(maxBlockSize, 0.0f) {}
+        LFO lfo;
+        std::vector<float> output;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->lfo.prepare(config.sampleRate);
+    state->lfo.setFrequency(2.0f);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->lfo.processBlock(state->output.data(), numSamples);
+    }};
+}};
+
+template <typename OversamplerType>
+ProcessBlockFn makeOversamplerCase(const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : block(maxBlockSize) {}
+        OversamplerType oversampler;
+        StereoBlock block;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->oversampler.prepare(config.sampleRate, config.blockSize);
+    return [state](size_t numSamples) {
+        state->block.refill(numSamples);
+        state->oversampler.process(state->block.left(), state->block.right(), numSamples,
+            [](float* left, float* right, size_t n) {
+                for (size_t i = 0; i < n; ++i) {
+                    left[i] = FastMath::fastTanh(2.0f * left[i]);
+                    right[i] = FastMath::fastTanh(2.0f * right[i]);
+                }
+            });
+    };
+}
+
+const BenchmarkRegistrar kOversampler2x{"primitives", "Oversampler2x", [](const BenchmarkConfig& config) {
+    return makeOversamplerCase<Oversampler2x>(config);
+}};
+
+const BenchmarkRegistrar kOversampler4x{"primitives", "Oversampler4x", [](const BenchmarkConfig& config) {
+    return makeOversamplerCase<Oversampler4x>(config);
+}};
+
+// Analysis + synthesis round trip at 75% overlap (the SpectralDelay pipeline
+// without the per-bin delay work)
+const BenchmarkRegistrar kSTFT{"primitives", "STFT+OverlapAdd/2048", [](const BenchmarkConfig& config) {
+    constexpr size_t kFftSize = 2048;
+    constexpr size_t kHopSize = kFftSize / 4;
+    struct State {
+        explicit State(size_t maxBlockSize) : buffers(maxBlockSize) {}
+        STFT stft;
+        OverlapAdd overlapAdd;
+        SpectralBuffer spectrum;
+        MonoBuffers buffers;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->stft.prepare(kFftSize, kHopSize);
+    state->overlapAdd.prepare(kFftSize, kHopSize);
+    state->spectrum.prepare(kFftSize);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->stft.pushSamples(state->buffers.input.data(), numSamples);
+        while (state->stft.canAnalyze()) {
+            state->stft.analyze(state->spectrum);
+            state->overlapAdd.synthesize(state->spectrum);
+        }
+        const size_t available = std::min(numSamples, state->overlapAdd.samplesAvailable());
+        state->overlapAdd.pullSamples(state->buffers.output.data(), available);
+    }};
+}};
+
+// ==============================================================================
+// Processors
+// ==============================================================================
+
+const BenchmarkRegistrar kSaturation{"processors", "SaturationProcessor", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : buffers(maxBlockSize) {}
+        SaturationProcessor saturation;
+        MonoBuffers buffers;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->saturation.prepare(config.sampleRate, config.blockSize);
+    state->saturation.setType(SaturationType::Tube);
+    state->saturation.setInputGain(12.0f);
+    state->saturation.setMix(0.8f);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        std::copy_n(state->buffers.input.begin(), numSamples, state->buffers.output.begin());
+        state->saturation.process(state->buffers.output.data(), numSamples);
+    }};
+}};
+
+const BenchmarkRegistrar kSaturationFast{"processors", "SaturationProcessorFast", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : buffers(maxBlockSize) {}
+        SaturationProcessor saturation;
+        MonoBuffers buffers;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->saturation.prepare(config.sampleRate, config.blockSize);
+    state->saturation.setType(SaturationType::Tube);
+    state->saturation.setAccuracy(SaturationAccuracy::Fast);
+    state->saturation.setInputGain(12.0f);
+    state->saturation.setMix(0.8f);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        std::copy_n(state->buffers.input.begin(), numSamples, state->buffers.output.begin());
+        state->saturation.process(state->buffers.output.data(), numSamples);
+    }};
+}};
+
+// DigitalDelay's limiter settings; "L+R" is the old per-channel calls on
+// one processor, "linked" the stereo block path
+ProcessBlockFn makeLimiterCase(const BenchmarkConfig& config, bool linked) {
+    struct State {
+        explicit State(size_t maxBlockSize) : block(maxBlockSize) {}
+        DynamicsProcessor limiter;
+        StereoBlock block;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->limiter.prepare(config.sampleRate, config.blockSize);
+    state->limiter.setThreshold(-0.5f);
+    state->limiter.setRatio(100.0f);
+    state->limiter.setKneeWidth(6.0f);
+    state->limiter.setDetectionMode(DynamicsDetectionMode::Peak);
+    return ProcessBlockFn{[state, linked](size_t numSamples) {
+        state->block.refill(numSamples);
+        if (linked) {
+            state->limiter.processStereo(state->block.left(), state->block.right(), numSamples);
+        } else {
+            state->limiter.process(state->block.left(), numSamples);
+            state->limiter.process(state->block.right(), numSamples);
+        }
+    }};
+}
+
+const BenchmarkRegistrar kLimiterPerChannel{"processors", "DynamicsProcessor limiter L+R", [](const BenchmarkConfig& config) {
+    return makeLimiterCase(config, false);
+}};
+
+const BenchmarkRegistrar kLimiterLinked{"processors", "DynamicsProcessor limiter linked", [](const BenchmarkConfig& config) {
+    return makeLimiterCase(config, true);
+}};
+
+const BenchmarkRegistrar kDiffusion{"processors", "DiffusionNetwork", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize)
+            : block(maxBlockSize), outL(maxBlockSize), outR(maxBlockSize) {}
+        DiffusionNetwork diffusion;
+        StereoBlock block;
+        std::vector<float> outL;
+        std::vector<float> outR;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->diffusion.prepare(static_cast<float>(config.sampleRate), config.blockSize);
+    state->diffusion.setSize(60.0f);
+    state->diffusion.setDensity(100.0f);
+    state->diffusion.setModDepth(30.0f);
+    state->diffusion.setModRate(0.5f);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->diffusion.process(state->block.sourceLeft(), state->block.sourceRight(),
+                                 state->outL.data(), state->outR.data(), numSamples);
+    }};
+}};
+
+// ==============================================================================
+// Systems
+// ==============================================================================
+
+const BenchmarkRegistrar kFeedbackNetwork{"systems", "FeedbackNetwork", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : block(maxBlockSize) {}
+        FeedbackNetwork network;
+        StereoBlock block;
+        BlockContext ctx;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->ctx.sampleRate = config.sampleRate;
+    state->network.prepare(config.sampleRate, config.blockSize, 2000.0f);
+    state->network.setFeedbackAmount(0.75f);
+    state->network.setDelayTimeMs(500.0f);
+    state->network.setFilterEnabled(true);
+    state->network.setFilterType(FilterType::Lowpass);
+    state->network.setFilterCutoff(4000.0f);
+    state->network.setSaturationEnabled(true);
+    state->network.setSaturationDrive(6.0f);
+    state->network.setCrossFeedbackAmount(0.3f);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->block.refill(numSamples);
+        state->ctx.blockSize = numSamples;
+        state->network.process(state->block.left(), state->block.right(), numSamples, state->ctx);
+    }};
+}};
+
+// Feedback tail fading out: the loop carries subnormal-level signal (input
+// scaled to ~1e-39), the case where the CPU spikes without FTZ/DAZ. The FTZ
+// variant holds a ScopedFlushToZero per call, as Processor::process() does.
+ProcessBlockFn makeFeedbackTailCase(const BenchmarkConfig& config, bool flushToZero) {
+    struct State {
+        explicit State(size_t maxBlockSize)
+            : tailL(makeNoise(maxBlockSize, 42)), tailR(makeNoise(maxBlockSize, 43)),
+              left(maxBlockSize), right(maxBlockSize) {}
+        FeedbackNetwork network;
+        std::vector<float> tailL;
+        std::vector<float> tailR;
+        std::vector<float> left;
+        std::vector<float> right;
+        BlockContext ctx;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    for (size_t i = 0; i < config.blockSize; ++i) {
+        state->tailL[i] *= 1e-39f;
+        state->tailR[i] *= 1e-39f;
+    }
+    state->ctx.sampleRate = config.sampleRate;
+    state->network.prepare(config.sampleRate, config.blockSize, 2000.0f);
+    state->network.setFeedbackAmount(0.9f);
+    state->network.setDelayTimeMs(20.0f);
+    state->network.setCrossFeedbackAmount(0.3f);
+    return ProcessBlockFn{[state, flushToZero](size_t numSamples) {
+        const auto run = [&state, numSamples] {
+            std::copy_n(state->tailL.begin(), numSamples, state->left.begin());
+            std::copy_n(state->tailR.begin(), numSamples, state->right.begin());
+            state->ctx.blockSize = numSamples;
+            state->network.process(state->left.data(), state->right.data(), numSamples, state->ctx);
+        };
+        if (flushToZero) {
+            const ScopedFlushToZero denormalScope;
+            run();
+        } else {
+            run();
+        }
+    }};
+}
+
+const BenchmarkRegistrar kFeedbackTail{"systems", "FeedbackNetwork tail", [](const BenchmarkConfig& config) {
+    return makeFeedbackTailCase(config, false);
+}};
+
+const BenchmarkRegistrar kFeedbackTailFtz{"systems", "FeedbackNetwork tail (FTZ)", [](const BenchmarkConfig& config) {
+    return makeFeedbackTailCase(config, true);
+}};
+
+// All 16 taps audible with filters, pan spread and per-tap feedback
+const BenchmarkRegistrar kTapManager{"systems", "TapManager16", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize) : block(maxBlockSize) {}
+        TapManager taps;
+        StereoBlock block;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->taps.prepare(static_cast<float>(config.sampleRate), config.blockSize, 5000.0f);
+    state->taps.loadPattern(TapPattern::DottedEighth, kMaxTaps);
+    for (size_t t = 0; t < kMaxTaps; ++t) {
+        state->taps.setTapPan(t, (t % 2 == 0) ? -60.0f : 60.0f);
+        state->taps.setTapFilterMode(t, (t % 2 == 0) ? TapFilterMode::Lowpass : TapFilterMode::Highpass);
+        state->taps.setTapFilterCutoff(t, 800.0f + 300.0f * static_cast<float>(t));
+        state->taps.setTapFeedback(t, 3.0f);
+    }
+    state->taps.setDryWetMix(50.0f);
+    state->taps.reset();
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->block.refill(numSamples);
+        state->taps.process(state->block.left(), state->block.right(),
+                            state->block.left(), state->block.right(), numSamples);
+    }};
+}};
+
+// 8 held sources on 16 routes with depth automation every block
+const BenchmarkRegistrar kModulationMatrix{"systems", "ModulationMatrix16", [](const BenchmarkConfig& config) {
+    struct HeldSource : ModulationSource {
+        float value = 0.0f;
+        [[nodiscard]] float getCurrentValue() const noexcept override { return value; }
+        [[nodiscard]] std::pair<float, float> getSourceRange() const noexcept override { return {-1.0f, 1.0f}; }
+    };
+    struct State {
+        ModulationMatrix matrix;
+        std::array<HeldSource, 8> sources;
+        bool flip = false;
+    };
+    auto state = std::make_shared<State>();
+    state->matrix.prepare(config.sampleRate, config.blockSize);
+    for (uint8_t s = 0; s < 8; ++s) {
+        state->sources[s].value = 0.1f * static_cast<float>(s) - 0.4f;
+        state->matrix.registerSource(s, &state->sources[s]);
+    }
+    for (uint8_t d = 0; d < kMaxModulationDestinations; ++d) {
+        state->matrix.registerDestination(d, 0.0f, 1000.0f);
+        state->matrix.createRoute(static_cast<uint8_t>(d % 8), d, 0.5f,
+                                  (d % 2 == 0) ? ModulationMode::Bipolar : ModulationMode::Unipolar);
+    }
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->flip = !state->flip;
+        for (int r = 0; r < 16; ++r) {
+            state->matrix.setRouteDepth(r, state->flip ? 0.8f : 0.2f);
+        }
+        state->matrix.process(numSamples);
+    }};
+}};
+
+// Two DigitalDelay engines mixed with equal-power gains, mirroring the
+// Processor's mode-switch crossfade (compare against effects/DigitalDelay)
+const BenchmarkRegistrar kModeCrossfade{"systems", "ModeCrossfade", [](const BenchmarkConfig& config) {
+    struct State {
+        explicit State(size_t maxBlockSize)
+            : blockA(maxBlockSize), blockB(maxBlockSize) {}
+        DigitalDelay delayA;
+        DigitalDelay delayB;
+        StereoBlock blockA;
+        StereoBlock blockB;
+        BlockContext ctx;
+        float position = 0.0f;
+        float increment = 0.0f;
+    };
+    auto state = std::make_shared<State>(config.blockSize);
+    state->ctx.sampleRate = config.sampleRate;
+    state->increment = crossfadeIncrement(50.0f, config.sampleRate);
+    for (DigitalDelay* delay : {&state->delayA, &state->delayB}) {
+        delay->prepare(config.sampleRate, config.blockSize, 10000.0f);
+        delay->setMix(0.5f);
+    }
+    state->delayA.setDelayTime(300.0f);
+    state->delayA.setFeedback(0.5f);
+    state->delayB.setDelayTime(400.0f);
+    state->delayB.setFeedback(0.6f);
+    return ProcessBlockFn{[state](size_t numSamples) {
+        state->ctx.blockSize = numSamples;
+        state->blockA.refill(numSamples);
+        state->blockB.refill(numSamples);
+        state->delayA.process(state->blockA.left(), state->blockA.right(), numSamples, state->ctx);
+        state->delayB.process(state->blockB.left(), state->blockB.right(), numSamples, state->ctx);
+
+        float* outL = state->blockA.left();
+        float* outR = state->blockA.right();
+        const float* inL = state->blockB.left();
+        const float* inR = state->blockB.right();
+        for (size_t i = 0; i < numSamples; ++i) {
+            float fadeOut = 0.0f;
+            float fadeIn = 0.0f;
+            equalPowerGains(state->position, fadeOut, fadeIn);
+            outL[i] = outL[i] * fadeOut + inL[i] * fadeIn;
+            outR[i] = outR[i] * fadeOut + inR[i] * fadeIn;
+            // Loop the fade so every block measures crossfade cost
+            state->position += state->increment;
+            if (state->position >= 1.0f) {
+                state->position = 0.0f;
+            }
+        }
+    }};
+}};
+
+} // anonymous namespace